@@ -0,0 +1,118 @@
+// ----------- Host test: acquisition idle pacing -----------
+//
+// Runs the real SensorAcquisition task (threads + emulated hardware timer,
+// bench/idle/shim) and the loop() side of the idle state machine against
+// synthetic sensor input:
+//   1. static hand at 100 Hz -> MotionIdle goes idle, setIdle() stops the timer
+//   2. while idle the task must keep sampling at MOTION_IDLE_RATE_HZ
+//   3. the hand moves -> the motion gate scans, idle ends, 100 Hz again
+// Exits non-zero when a phase fails.
+//
+// Build + run from the repo root:  pio run -e native_idle -t exec
+// or by hand with the env's build_flags:
+//   g++ -std=gnu++11 -O2 -pthread -Ibench/idle/shim -iquote bench/idle/shim -Isrc -Iinclude
+//       -DFLEX_ADC_DMA=0 -DIMU_USE_FIFO=0 -DMOTION_IDLE_AFTER_MS=300
+//       bench/idle/idle_test.cpp bench/idle/shim/idle_shim.cpp -o idle_test
+
+#include <Arduino.h>
+#include "acquisition.h"
+
+#define TEST_RATE_HZ      ACQ_SAMPLE_RATE_HZ
+#define TEST_WINDOW_MS    250
+#define TEST_TIMEOUT_MS   (MOTION_IDLE_AFTER_MS + 2000)
+#define TEST_MEASURE_MS   1000
+
+GlovePredictor predictor;
+SensorAcquisition acquisition(predictor);
+MotionIdle motionIdle;
+
+static uint8_t activeWindowFrames;
+static uint32_t moveStep;
+static bool moving;
+
+// Flex at mid-range, IMU at rest; moving sweeps the flex channels
+static void setSensors() {
+  int flex = 2500;
+  if (moving) flex += (int)((moveStep++ * 37) % 600);
+  for (int i = 0; i < 5; ++i) shimAnalog[PIN_FLEX[i]] = flex;
+  shimImu[2] = 16384;   // 1 g on z
+}
+
+// loop(): window + classification + the idle transition (main.cpp applyIdle)
+static void process(const SensorSample& s) {
+  predictor.pushSample(s);
+  if (!predictor.windowReady()) return;
+  predictor.predictFromWindow();
+  if (!motionIdle.update(!predictor.reusedLast(), s.tMs)) return;
+
+  bool idle = motionIdle.active();
+  if (idle) activeWindowFrames = predictor.getWindowFrames();
+  acquisition.setIdle(idle, MOTION_IDLE_RATE_HZ);
+  uint32_t frames = idle ? (uint32_t)activeWindowFrames * MOTION_IDLE_RATE_HZ / TEST_RATE_HZ
+                         : activeWindowFrames;
+  predictor.setWindowFrames((uint8_t)max(frames, 1u));
+}
+
+// Drain samples for up to ms; stops early once the idle state equals until
+static uint32_t runFor(uint32_t ms, int until = -1) {
+  uint32_t samples = 0;
+  uint32_t t0 = millis();
+  while (millis() - t0 < ms) {
+    setSensors();
+    SensorSample s;
+    while (acquisition.read(s)) {
+      samples++;
+      process(s);
+    }
+    if (until >= 0 && acquisition.idling() == (until != 0)) break;
+    delay(1);
+  }
+  return samples;
+}
+
+static bool check(bool ok, const char* what) {
+  printf("%-48s %s\n", what, ok ? "ok" : "FAIL");
+  return ok;
+}
+
+int main() {
+  predictor.begin(TEST_RATE_HZ);
+  predictor.setWindowFrames(TEST_WINDOW_MS * TEST_RATE_HZ / 1000);
+  if (!acquisition.begin(TEST_RATE_HZ)) {
+    printf("acquisition.begin() failed\n");
+    return 1;
+  }
+  bool ok = true;
+
+  // 1. static hand -> idle
+  moving = false;
+  uint32_t t0 = millis();
+  runFor(TEST_TIMEOUT_MS, 1);
+  ok &= check(acquisition.idling(), "static hand goes idle");
+  printf("  idle after %lu ms\n", (unsigned long)(millis() - t0));
+
+  // 2. idle pacing: MOTION_IDLE_RATE_HZ, within a factor of two
+  uint32_t n = runFor(TEST_MEASURE_MS);
+  uint32_t expected = MOTION_IDLE_RATE_HZ * TEST_MEASURE_MS / 1000;
+  printf("  idle: %lu samples in %d ms (expected ~%lu)\n",
+         (unsigned long)n, TEST_MEASURE_MS, (unsigned long)expected);
+  ok &= check(acquisition.idling(), "still idle while static");
+  ok &= check(n >= expected / 2 && n <= expected * 2, "samples keep arriving at the idle rate");
+
+  // 3. movement -> full rate
+  moving = true;
+  t0 = millis();
+  runFor(TEST_TIMEOUT_MS, 0);
+  ok &= check(!acquisition.idling(), "movement ends idle");
+  printf("  woke after %lu ms\n", (unsigned long)(millis() - t0));
+
+  n = runFor(TEST_MEASURE_MS);
+  expected = TEST_RATE_HZ * TEST_MEASURE_MS / 1000;
+  printf("  active: %lu samples in %d ms (expected ~%lu)\n",
+         (unsigned long)n, TEST_MEASURE_MS, (unsigned long)expected);
+  ok &= check(acquisition.rate() == TEST_RATE_HZ, "rate back to the base rate");
+  ok &= check(n >= expected / 2 && n <= expected * 2, "samples at the base rate");
+
+  printf("%s\n", ok ? "PASS" : "FAIL");
+  return ok ? 0 : 1;
+}
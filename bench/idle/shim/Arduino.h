@@ -0,0 +1,105 @@
+#pragma once
+// ----------- Threaded Arduino / FreeRTOS shim for the idle test -----------
+//
+// Unlike bench/shim this runs the real acquisition task: tasks are host
+// threads, task notifications are a counter + condition variable, the
+// hardware timer is a thread that calls the ISR once per period while the
+// alarm is enabled, and millis() is the host clock. Sensor inputs come
+// from shimAnalog[] (analogRead) and shimImu[] (MPU6050::getMotion6).
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <math.h>
+#include <algorithm>
+
+#define PROGMEM
+#define IRAM_ATTR
+
+#define pgm_read_byte(p)  (*(const uint8_t*)(p))
+#define pgm_read_word(p)  (*(const uint16_t*)(p))
+#define pgm_read_dword(p) (*(const uint32_t*)(p))
+#define pgm_read_float(p) (*(const float*)(p))
+
+#define constrain(x, lo, hi) ((x) < (lo) ? (lo) : ((x) > (hi) ? (hi) : (x)))
+
+using std::min;
+using std::max;
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+
+extern volatile int shimAnalog[40];
+inline int analogRead(int pin) { return shimAnalog[pin]; }
+inline void analogReadResolution(int) {}
+
+#define RISING 1
+inline int digitalPinToInterrupt(int pin) { return pin; }
+inline void attachInterrupt(int, void (*)(), int) {}
+inline void detachInterrupt(int) {}
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t) { return 1; }
+  virtual size_t write(const uint8_t*, size_t n) { return n; }
+};
+
+class HardwareSerial : public Print {
+public:
+  void begin(unsigned long) {}
+  int available() { return 0; }
+  int read() { return -1; }
+  template <typename T> size_t print(const T&) { return 0; }
+  template <typename T> size_t print(const T&, int) { return 0; }
+  template <typename T> size_t println(const T&) { return 0; }
+  template <typename T> size_t println(const T&, int) { return 0; }
+  size_t println() { return 0; }
+  size_t printf(const char*, ...) { return 0; }
+  using Print::write;
+};
+
+extern HardwareSerial Serial;
+
+struct EspClass {
+  uint32_t getCycleCount() { return micros() * 240u; }
+};
+extern EspClass ESP;
+inline uint32_t getCpuFrequencyMhz() { return 240; }
+
+// ---- FreeRTOS (1 tick = 1 ms) ----
+
+struct ShimTask;
+typedef ShimTask* TaskHandle_t;
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdTRUE  1
+#define pdFALSE 0
+#define pdPASS  1
+#define portMAX_DELAY 0xFFFFFFFFu
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define portYIELD_FROM_ISR()
+
+BaseType_t xTaskCreatePinnedToCore(void (*fn)(void*), const char* name, uint32_t stack,
+                                   void* arg, UBaseType_t prio, TaskHandle_t* handle, BaseType_t core);
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* woken);
+inline void vTaskDelay(TickType_t ticks) { delay(ticks); }
+inline UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t) { return 0; }
+
+// ---- Hardware timer (ESP32 Arduino 2.x API) ----
+
+struct hw_timer_t;
+hw_timer_t* timerBegin(uint8_t num, uint16_t divider, bool countUp);
+void timerAttachInterrupt(hw_timer_t* t, void (*isr)(), bool edge);
+void timerAlarmWrite(hw_timer_t* t, uint64_t periodUs, bool autoReload);
+void timerAlarmEnable(hw_timer_t* t);
+void timerAlarmDisable(hw_timer_t* t);
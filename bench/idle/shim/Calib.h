@@ -0,0 +1,5 @@
+#pragma once
+// predictor.h / flex_adc.h include "Calib.h"; on a case-sensitive host that
+// would be include/Calib.h (calibration only), not the pin map in
+// src/calib.h. -iquote bench/idle/shim puts this one first.
+#include "../../../src/calib.h"
@@ -0,0 +1,18 @@
+#pragma once
+#include <Arduino.h>
+
+// No filesystem: every open fails, so replays never start
+struct File {
+  explicit operator bool() const { return false; }
+  void close() {}
+  int available() { return 0; }
+  size_t readBytesUntil(char, char*, size_t) { return 0; }
+};
+
+struct LittleFSShim {
+  bool begin(bool = false) { return false; }
+  File open(const char*, const char* = "r") { return File(); }
+  bool exists(const char*) { return false; }
+};
+
+extern LittleFSShim LittleFS;
@@ -0,0 +1,32 @@
+#pragma once
+#include <Arduino.h>
+
+// Only the non-FIFO path (IMU_USE_FIFO=0) produces data: shimImu[] = ax ay az gx gy gz
+extern volatile int16_t shimImu[6];
+
+#define MPU6050_DLPF_BW_42 0x03
+
+class MPU6050 {
+public:
+  explicit MPU6050(uint8_t) {}
+  void initialize() {}
+  bool testConnection() { return true; }
+  void getMotion6(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int16_t* gy, int16_t* gz) {
+    *ax = shimImu[0]; *ay = shimImu[1]; *az = shimImu[2];
+    *gx = shimImu[3]; *gy = shimImu[4]; *gz = shimImu[5];
+  }
+  void setDLPFMode(uint8_t) {}
+  void setRate(uint8_t) {}
+  void setFIFOEnabled(bool) {}
+  void setAccelFIFOEnabled(bool) {}
+  void setXGyroFIFOEnabled(bool) {}
+  void setYGyroFIFOEnabled(bool) {}
+  void setZGyroFIFOEnabled(bool) {}
+  void resetFIFO() {}
+  uint16_t getFIFOCount() { return 0; }
+  void getFIFOBytes(uint8_t*, uint8_t) {}
+  void setInterruptMode(bool) {}
+  void setInterruptDrive(bool) {}
+  void setInterruptLatch(bool) {}
+  void setIntDataReadyEnabled(bool) {}
+};
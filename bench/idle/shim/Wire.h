@@ -0,0 +1,15 @@
+#pragma once
+#include <Arduino.h>
+
+struct TwoWire {
+  bool begin(int, int) { return true; }
+  void setClock(uint32_t) {}
+  void beginTransmission(uint8_t) {}
+  size_t write(uint8_t) { return 1; }
+  uint8_t endTransmission(bool = true) { return 0; }
+  uint8_t requestFrom(uint8_t, uint8_t) { return 0; }
+  int read() { return 0; }
+  int available() { return 0; }
+};
+
+extern TwoWire Wire;
@@ -0,0 +1,20 @@
+#pragma once
+// IDF 4.4 continuous ADC types; the test builds with FLEX_ADC_DMA=0
+#include <stdint.h>
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_ERR_INVALID_STATE 0x103
+#define ESP_ERR_TIMEOUT 0x107
+#define ADC_ATTEN_DB_11 3
+#define SOC_ADC_DIGI_MAX_BITWIDTH 12
+typedef struct { uint8_t atten; uint8_t channel; uint8_t unit; uint8_t bit_width; } adc_digi_pattern_config_t;
+typedef struct { uint32_t max_store_buf_size; uint32_t conv_num_each_intr; uint32_t adc1_chan_mask; uint32_t adc2_chan_mask; } adc_digi_init_config_t;
+typedef enum { ADC_CONV_SINGLE_UNIT_1 = 1 } adc_digi_convert_mode_t;
+typedef enum { ADC_DIGI_OUTPUT_FORMAT_TYPE1 } adc_digi_output_format_t;
+typedef struct { bool conv_limit_en; uint32_t conv_limit_num; uint32_t pattern_num; adc_digi_pattern_config_t* adc_pattern; uint32_t sample_freq_hz; adc_digi_convert_mode_t conv_mode; adc_digi_output_format_t format; } adc_digi_configuration_t;
+typedef struct { union { struct { uint16_t data:12; uint16_t channel:4; } type1; uint16_t val; }; } adc_digi_output_data_t;
+esp_err_t adc_digi_initialize(const adc_digi_init_config_t*);
+esp_err_t adc_digi_controller_configure(const adc_digi_configuration_t*);
+esp_err_t adc_digi_start();
+esp_err_t adc_digi_deinitialize();
+esp_err_t adc_digi_read_bytes(uint8_t*, uint32_t, uint32_t*, uint32_t);
@@ -0,0 +1,109 @@
+#include <Arduino.h>
+#include <Wire.h>
+#include <MPU6050.h>
+#include <LittleFS.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+volatile int shimAnalog[40];
+volatile int16_t shimImu[6];
+HardwareSerial Serial;
+EspClass ESP;
+TwoWire Wire;
+LittleFSShim LittleFS;
+
+typedef std::chrono::steady_clock ShimClock;
+static const ShimClock::time_point shimStart = ShimClock::now();
+
+uint32_t millis() {
+  return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(ShimClock::now() - shimStart).count();
+}
+
+uint32_t micros() {
+  return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(ShimClock::now() - shimStart).count();
+}
+
+void delay(uint32_t ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+// ---- Tasks ----
+// Heap objects that are never freed: the threads are detached and may
+// still be blocked in them when main() returns.
+
+struct ShimTask {
+  std::mutex lock;
+  std::condition_variable cv;
+  uint32_t notified = 0;
+};
+
+static thread_local ShimTask* currentTask = nullptr;
+
+BaseType_t xTaskCreatePinnedToCore(void (*fn)(void*), const char*, uint32_t,
+                                   void* arg, UBaseType_t, TaskHandle_t* handle, BaseType_t) {
+  ShimTask* task = new ShimTask();
+  if (handle) *handle = task;
+  std::thread([=]() {
+    currentTask = task;
+    fn(arg);
+  }).detach();
+  return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks) {
+  ShimTask* task = currentTask;
+  std::unique_lock<std::mutex> guard(task->lock);
+  if (ticks == portMAX_DELAY) {
+    task->cv.wait(guard, [=]() { return task->notified > 0; });
+  } else {
+    task->cv.wait_for(guard, std::chrono::milliseconds(ticks), [=]() { return task->notified > 0; });
+  }
+  uint32_t n = task->notified;
+  if (n) task->notified = clearOnExit ? 0 : n - 1;
+  return n;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+  {
+    std::lock_guard<std::mutex> guard(task->lock);
+    task->notified++;
+  }
+  task->cv.notify_one();
+  return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* woken) {
+  xTaskNotifyGive(task);
+  if (woken) *woken = pdTRUE;
+}
+
+// ---- Hardware timer ----
+
+struct hw_timer_t {
+  std::atomic<uint64_t> periodUs{0};
+  std::atomic<bool> enabled{false};
+  std::atomic<void (*)()> isr{nullptr};
+};
+
+hw_timer_t* timerBegin(uint8_t, uint16_t, bool) {
+  hw_timer_t* t = new hw_timer_t();
+  std::thread([=]() {
+    ShimClock::time_point next = ShimClock::now();
+    for (;;) {
+      uint64_t us = t->periodUs.load();
+      next += std::chrono::microseconds(us ? us : 1000);
+      std::this_thread::sleep_until(next);
+      void (*fn)() = t->isr.load();
+      if (t->enabled.load() && us && fn) fn();
+    }
+  }).detach();
+  return t;
+}
+
+void timerAttachInterrupt(hw_timer_t* t, void (*isr)(), bool) { t->isr = isr; }
+void timerAlarmWrite(hw_timer_t* t, uint64_t periodUs, bool) { t->periodUs = periodUs; }
+void timerAlarmEnable(hw_timer_t* t) { t->enabled = true; }
+void timerAlarmDisable(hw_timer_t* t) { t->enabled = false; }
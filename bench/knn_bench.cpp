@@ -0,0 +1,671 @@
+// ----------- Host benchmark + equivalence harness for the KNN runtimes -----------
+//
+// Replays the recorded data through the same headers the firmware uses and
+// reports throughput, latency percentiles and label agreement:
+//   gesture  data/dataset.csv      standardizeFeatures + knn_predict, per row
+//   gesture  data/raw_*.txt        sliding window (as loop() does) + knn_predict,
+//                                  and again behind the motion gate (motion_gate.h)
+//   sentence data/sentence_dataset.csv  SentencePredictor one-shot window + predict
+//   sentence data/sentence_raw_*.txt    same, fed the raw 20 Hz log
+//
+// Agreement is against the label in the data and against sklearn's
+// predictions from tools/bench_reference.py (bench/reference/*.txt, which
+// the native env's pre-script regenerates when the models or datasets change).
+//
+// Before the timing runs, exact checks compare the fast paths with plain
+// reference code: SWAR vs scalar int8 L1, the KD-tree vs a brute-force int8
+// scan, and early-abandoned banded DTW + LB_Keogh vs a plain banded DTW.
+// The run fails (exit 1) on any mismatch, or when an agreement drops below
+// the BENCH_MIN_* / BENCH_MAX_* thresholds below.
+//
+// Build + run from the repo root:  pio run -e native -t exec
+// Optional argument: repo root (default "."). Model switches (KNN_USE_INT8,
+// KNN_USE_INDEX, L1_KERNEL, ...) are the firmware ones; set them in the
+// native env's build_flags to compare variants.
+
+#include <Arduino.h>
+#include "feature_window.h"
+#include "motion_gate.h"
+#include "knn_runtime.h"
+#include "sentence_predictor.h"
+
+#include <dirent.h>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Raw logs are recorded at 20 Hz (COLLECT_PERIOD_MS); 5 frames = 250 ms,
+// the same span as the firmware's GESTURE_WINDOW_MS at 100 Hz.
+#define BENCH_LOG_WINDOW_FRAMES 5
+
+// Pass / fail thresholds, in percent. sklearn's gesture reference is the
+// float model, so the int8 search only approximates it (98.1% of the
+// dataset rows when this was written); the sentence reference uses the
+// int8 table itself.
+#ifndef BENCH_MIN_GESTURE_REF_AGREEMENT
+#if KNN_USE_INT8
+#define BENCH_MIN_GESTURE_REF_AGREEMENT 97.5
+#else
+#define BENCH_MIN_GESTURE_REF_AGREEMENT 99.9
+#endif
+#endif
+#ifndef BENCH_MIN_SENTENCE_REF_AGREEMENT
+#define BENCH_MIN_SENTENCE_REF_AGREEMENT 99.0
+#endif
+#ifndef BENCH_MIN_DATA_AGREEMENT
+#define BENCH_MIN_DATA_AGREEMENT 90.0   // runtime vs the dataset labels
+#endif
+#ifndef BENCH_MAX_GATE_DIFFER
+#define BENCH_MAX_GATE_DIFFER 1.0       // gated labels that differ from scanning every frame
+#endif
+#ifndef BENCH_REQUIRE_REFERENCE
+#define BENCH_REQUIRE_REFERENCE 1       // 0: a missing sklearn reference is not a failure
+#endif
+
+#define BENCH_KD_CHECK_STRIDE  16       // dataset rows per KD-tree check query
+#define BENCH_KD_RANDOM_QUERIES 2000
+#define BENCH_L1_MAX_LEN       1100     // > 2 SWAR accumulator flushes (512 bytes each)
+
+#ifdef SENTENCE_KNN_Q_DTW_BAND
+#define BENCH_DTW_BAND SENTENCE_KNN_Q_DTW_BAND
+#else
+#define BENCH_DTW_BAND 8                // the model has no envelopes; test the kernels anyway
+#endif
+
+typedef std::chrono::steady_clock BenchClock;
+
+// ----------- Latency / agreement accounting -----------
+
+struct BenchResult {
+  std::vector<double> latencyUs;
+  int total = 0;
+  int matchData = 0;   // prediction == label in the data
+  int matchRef = 0;    // prediction == sklearn reference
+  int refTotal = 0;
+
+  void add(double us, bool dataOk) {
+    latencyUs.push_back(us);
+    total++;
+    if (dataOk) matchData++;
+  }
+
+  void addRef(bool refOk) {
+    refTotal++;
+    if (refOk) matchRef++;
+  }
+
+  double dataPct() const { return total ? 100.0 * matchData / total : 0.0; }
+  double refPct() const { return refTotal ? 100.0 * matchRef / refTotal : 0.0; }
+
+  void print(const char* name) {
+    if (total == 0) {
+      printf("%-20s no data\n", name);
+      return;
+    }
+    std::vector<double> v = latencyUs;
+    std::sort(v.begin(), v.end());
+    double sum = 0.0;
+    for (double x : v) sum += x;
+    auto pct = [&](double p) { return v[std::min(v.size() - 1, (size_t)(p * (v.size() - 1) + 0.5))]; };
+
+    printf("%-20s n=%-6d %10.0f q/s  mean %8.2f us  p50 %8.2f  p90 %8.2f  p99 %8.2f  max %8.2f  |  data %6.2f%%",
+           name, total, total / (sum * 1e-6), sum / total, pct(0.50), pct(0.90), pct(0.99), v.back(),
+           100.0 * matchData / total);
+    if (refTotal > 0) printf("  sklearn %6.2f%% (%d/%d)", 100.0 * matchRef / refTotal, matchRef, refTotal);
+    printf("\n");
+  }
+};
+
+template <typename F>
+static double timeUs(F fn) {
+  BenchClock::time_point t0 = BenchClock::now();
+  fn();
+  return std::chrono::duration<double, std::micro>(BenchClock::now() - t0).count();
+}
+
+// ----------- Pass / fail -----------
+
+static int benchFailures = 0;
+
+static void verdict(bool ok, const char* name, const char* what) {
+  printf("%-20s %-60s %s\n", name, what, ok ? "ok" : "FAIL");
+  if (!ok) benchFailures++;
+}
+
+// Dataset runs: agreement with the labels and with sklearn
+static void checkAgreement(const char* name, const BenchResult& r, double minRef) {
+  char what[96];
+  if (r.total == 0) {
+    verdict(false, name, "no data");
+    return;
+  }
+  snprintf(what, sizeof(what), "data agreement %.2f%% >= %.1f%%", r.dataPct(), BENCH_MIN_DATA_AGREEMENT);
+  verdict(r.dataPct() >= BENCH_MIN_DATA_AGREEMENT, name, what);
+  if (r.refTotal == 0) {
+    if (BENCH_REQUIRE_REFERENCE) verdict(false, name, "no sklearn reference (tools/bench_reference.py)");
+    return;
+  }
+  snprintf(what, sizeof(what), "sklearn agreement %.2f%% >= %.1f%%", r.refPct(), minRef);
+  verdict(r.refPct() >= minRef, name, what);
+}
+
+// Deterministic test data (the same on every libc)
+struct BenchRng {
+  uint32_t state = 12345;
+  uint32_t next() {
+    state = state * 1664525u + 1013904223u;
+    return state >> 8;
+  }
+  int8_t i8() { return (int8_t)(next() & 0xFF); }
+};
+
+// ----------- Data loading -----------
+
+static int labelIndex(const char* const* names, int n, const std::string& label) {
+  for (int i = 0; i < n; ++i) {
+    if (label == names[i]) return i;
+  }
+  return -1;
+}
+
+// CSV with nFeatures numeric columns followed by a (possibly quoted) label
+static bool loadCsv(const std::string& path, int nFeatures,
+                    std::vector<std::vector<float>>& rows, std::vector<std::string>& labels) {
+  std::ifstream in(path);
+  if (!in) return false;
+  std::string line;
+  std::getline(in, line);  // header
+  while (std::getline(in, line)) {
+    if (line.empty()) continue;
+    std::vector<float> row(nFeatures);
+    size_t pos = 0;
+    for (int i = 0; i < nFeatures; ++i) {
+      size_t comma = line.find(',', pos);
+      row[i] = strtof(line.c_str() + pos, nullptr);
+      pos = comma + 1;
+    }
+    std::string label = line.substr(pos);
+    if (!label.empty() && label.back() == '\r') label.pop_back();
+    if (label.size() >= 2 && label.front() == '"') label = label.substr(1, label.size() - 2);
+    rows.push_back(row);
+    labels.push_back(label);
+  }
+  return true;
+}
+
+// One predicted class index per line (tools/bench_reference.py)
+static std::vector<int> loadReference(const std::string& path) {
+  std::vector<int> ref;
+  std::ifstream in(path);
+  int v;
+  while (in >> v) ref.push_back(v);
+  return ref;
+}
+
+// "FLEX: f1..f5 | ACC: ax ay az | GYRO: gx gy gz | GDP=val" -> sample, plus
+// the "# key=value" header value for `key`
+static bool loadRawLog(const std::string& path, const char* key,
+                       std::string& label, std::vector<SensorSample>& samples) {
+  std::ifstream in(path);
+  if (!in) return false;
+  std::string line;
+  std::string prefix = std::string("# ") + key + "=";
+  while (std::getline(in, line)) {
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    if (line.compare(0, prefix.size(), prefix) == 0) {
+      label = line.substr(prefix.size());
+      continue;
+    }
+    int f[5], ax, ay, az, gx, gy, gz;
+    if (sscanf(line.c_str(), "FLEX: %d %d %d %d %d | ACC: %d %d %d | GYRO: %d %d %d",
+               &f[0], &f[1], &f[2], &f[3], &f[4], &ax, &ay, &az, &gx, &gy, &gz) == 11) {
+      samples.push_back(makeSensorSample(f, (int16_t)ax, (int16_t)ay, (int16_t)az,
+                                         (int16_t)gx, (int16_t)gy, (int16_t)gz, 0));
+    }
+  }
+  return true;
+}
+
+static std::vector<std::string> listFiles(const std::string& dir, const std::string& prefix) {
+  std::vector<std::string> out;
+  DIR* d = opendir(dir.c_str());
+  if (!d) return out;
+  while (struct dirent* e = readdir(d)) {
+    std::string name = e->d_name;
+    if (name.compare(0, prefix.size(), prefix) == 0 && name.size() > 4 &&
+        name.compare(name.size() - 4, 4, ".txt") == 0) {
+      out.push_back(dir + "/" + name);
+    }
+  }
+  closedir(d);
+  std::sort(out.begin(), out.end());
+  return out;
+}
+
+// ----------- Exact checks -----------
+
+static void checkL1Kernels() {
+  static int8_t a[BENCH_L1_MAX_LEN + 4] __attribute__((aligned(4)));
+  static int8_t b[BENCH_L1_MAX_LEN + 4] __attribute__((aligned(4)));
+  BenchRng rng;
+  int pairs = 0, mismatches = 0;
+  auto same = [&](const int8_t* x, const int8_t* y, int n) {
+    pairs++;
+    mismatches += l1_distance_i8_swar(x, y, n) != l1_distance_i8_scalar(x, y, n);
+  };
+
+  // Every length, random lanes and saturated ones (|127 - -128| = 255 per
+  // lane, the worst case for the 16-bit accumulators), at all alignments
+  for (int n = 0; n <= BENCH_L1_MAX_LEN; ++n) {
+    for (int i = 0; i < n + 4; ++i) {
+      a[i] = rng.i8();
+      b[i] = rng.i8();
+    }
+    for (int off = 0; off < 4; ++off) same(a + off, b, n);
+    for (int i = 0; i < n; ++i) {
+      a[i] = 127;
+      b[i] = -128;
+    }
+    same(a, b, n);
+    same(b, a, n);
+  }
+
+  // The shipped tables: neighbouring gesture rows, all sentence row pairs
+#if KNN_USE_INT8
+  for (uint32_t i = 0; i + 1 < gestureTables.numSamples; ++i) {
+    same(gestureTables.rows + i * NUM_FEATURES, gestureTables.rows + (i + 1) * NUM_FEATURES, NUM_FEATURES);
+  }
+#endif
+  for (uint32_t i = 0; i < sentenceTables.numSamples; ++i) {
+    for (uint32_t j = 0; j < sentenceTables.numSamples; ++j) {
+      same(sentenceTables.rows + i * SENTENCE_KNN_Q_N_FEATURES,
+           sentenceTables.rows + j * SENTENCE_KNN_Q_N_FEATURES, SENTENCE_KNN_Q_N_FEATURES);
+    }
+  }
+
+  char what[96];
+  snprintf(what, sizeof(what), "SWAR == scalar L1, %d pairs, %d mismatches", pairs, mismatches);
+  verdict(mismatches == 0, "l1 kernel", what);
+}
+
+#if KNN_USE_INDEX
+// Top-K (distances and rows) of the KD-tree against a brute-force scan of
+// the same int8 table, for dataset rows and random queries
+static void checkKdIndex(const std::string& root) {
+  std::vector<std::vector<float>> rows;
+  std::vector<std::string> labels;
+  loadCsv(root + "/data/dataset.csv", NUM_FEATURES, rows, labels);
+
+  std::vector<std::vector<int8_t>> queries;
+  for (size_t i = 0; i < rows.size(); i += BENCH_KD_CHECK_STRIDE) {
+    float feat[NUM_FEATURES];
+    for (int j = 0; j < NUM_FEATURES; ++j) feat[j] = rows[i][j];
+    knn_standardize(feat);
+    std::vector<int8_t> q(NUM_FEATURES);
+    knn_quantize(feat, q.data());
+    queries.push_back(q);
+  }
+  BenchRng rng;
+  for (int i = 0; i < BENCH_KD_RANDOM_QUERIES; ++i) {
+    std::vector<int8_t> q(NUM_FEATURES);
+    for (int j = 0; j < NUM_FEATURES; ++j) q[j] = rng.i8();
+    queries.push_back(q);
+  }
+
+  int mismatches = 0;
+  static int8_t q[NUM_FEATURES] __attribute__((aligned(4)));
+  for (const std::vector<int8_t>& query : queries) {
+    memcpy(q, query.data(), NUM_FEATURES);
+
+    KnnQTopK indexed;
+    indexed.reset(UINT32_MAX);
+    KnnIndexQuery s;
+    s.q = q;
+    s.top = &indexed;
+    for (int j = 0; j < NUM_FEATURES; ++j) s.off[j] = 0;
+    knn_index_search(s, 0, 0);
+
+    KnnQTopK scanned;
+    scanned.reset(UINT32_MAX);
+    knn_scan<int8_t, NUM_FEATURES, KNN_K>(q, gestureTables.rows, (int)gestureTables.numSamples,
+                                          KnnQDistance(), scanned);
+
+    bool same = true;
+    for (int k = 0; k < KNN_K; ++k) {
+      same &= indexed.dist[k] == scanned.dist[k] && indexed.row[k] == scanned.row[k];
+    }
+    mismatches += !same;
+  }
+
+  char what[96];
+  snprintf(what, sizeof(what), "KD-tree == brute-force top-%d, %zu queries, %d mismatches",
+           KNN_K, queries.size(), mismatches);
+  verdict(!queries.empty() && mismatches == 0, "kd index", what);
+}
+#endif
+
+// Banded DTW straight from the definition: full cost matrix, no rolling
+// rows, no early abandon
+static uint32_t plainDtw(const int8_t* a, const int8_t* b) {
+  const int T = SENTENCE_SAMPLES_FOR_PREDICTION;
+  const int C = SENTENCE_FEATURES_PER_SAMPLE;
+  static uint64_t cost[T + 1][T + 1];
+  for (int i = 0; i <= T; ++i) {
+    for (int j = 0; j <= T; ++j) cost[i][j] = UINT64_MAX / 2;
+  }
+  cost[0][0] = 0;
+  for (int i = 0; i < T; ++i) {
+    for (int j = 0; j < T; ++j) {
+      if (abs(i - j) > BENCH_DTW_BAND) continue;
+      uint64_t d = 0;
+      for (int c = 0; c < C; ++c) d += abs((int)a[i * C + c] - (int)(int8_t)pgm_read_byte(&b[j * C + c]));
+      cost[i + 1][j + 1] = d + std::min(cost[i][j], std::min(cost[i][j + 1], cost[i + 1][j]));
+    }
+  }
+  return (uint32_t)cost[T][T];
+}
+
+// dtw_distance_i8 == plainDtw (and abandons correctly), LB_Keogh <= DTW,
+// and a Keogh-pruned, abandoned top-K search equals the plain top-K, for
+// every table row and a time-warped, noisy copy of it as query
+static void checkDtw() {
+  const int T = SENTENCE_SAMPLES_FOR_PREDICTION;
+  const int C = SENTENCE_FEATURES_PER_SAMPLE;
+  const int D = SENTENCE_KNN_Q_N_FEATURES;
+  const int N = (int)sentenceTables.numSamples;
+  const int K = SENTENCE_KNN_Q_N_NEIGHBORS;
+  static_assert(SENTENCE_KNN_Q_N_FEATURES == SENTENCE_SAMPLES_FOR_PREDICTION * SENTENCE_FEATURES_PER_SAMPLE,
+                "DTW check needs the per-timestep sentence table");
+
+  // Envelopes as train_sentence_knn.py exports them; models that ship them
+  // must match
+  std::vector<int8_t> upper((size_t)N * D), lower((size_t)N * D);
+  int envelopeMismatches = 0;
+  for (int r = 0; r < N; ++r) {
+    const int8_t* row = sentenceTables.rows + (size_t)r * D;
+    for (int t = 0; t < T; ++t) {
+      for (int c = 0; c < C; ++c) {
+        int hi = -128, lo = 127;
+        for (int u = std::max(0, t - BENCH_DTW_BAND); u <= std::min(T - 1, t + BENCH_DTW_BAND); ++u) {
+          int v = (int8_t)pgm_read_byte(&row[u * C + c]);
+          hi = std::max(hi, v);
+          lo = std::min(lo, v);
+        }
+        size_t at = (size_t)r * D + t * C + c;
+        upper[at] = (int8_t)hi;
+        lower[at] = (int8_t)lo;
+#if SENTENCE_USE_DTW
+        envelopeMismatches += (int8_t)pgm_read_byte(&sentenceTables.dtwUpper[at]) != (int8_t)hi ||
+                              (int8_t)pgm_read_byte(&sentenceTables.dtwLower[at]) != (int8_t)lo;
+#endif
+      }
+    }
+  }
+
+  static int8_t q[SENTENCE_KNN_Q_N_FEATURES] __attribute__((aligned(4)));
+  BenchRng rng;
+  int pairs = 0, distMismatches = 0, boundViolations = 0, topMismatches = 0, queries = 0;
+  for (int r = 0; r < N; ++r) {
+    const int8_t* src = sentenceTables.rows + (size_t)r * D;
+    for (int variant = 0; variant < 2; ++variant) {
+      for (int t = 0; t < T; ++t) {
+        // variant 1: up to +-3 steps of smooth time shift plus +-3 noise
+        int shift = variant ? (int)lrintf(3.0f * sinf(t * 0.15f + r)) : 0;
+        int ts = std::max(0, std::min(T - 1, t + shift));
+        for (int c = 0; c < C; ++c) {
+          int v = (int8_t)pgm_read_byte(&src[ts * C + c]);
+          if (variant) v += (int)(rng.next() % 7) - 3;
+          q[t * C + c] = (int8_t)std::max(-128, std::min(127, v));
+        }
+      }
+      queries++;
+
+      KnnTopK<K, uint32_t> plainTop, prunedTop;
+      plainTop.reset(UINT32_MAX);
+      prunedTop.reset(UINT32_MAX);
+      for (int i = 0; i < N; ++i) {
+        const int8_t* row = sentenceTables.rows + (size_t)i * D;
+        uint32_t ref = plainDtw(q, row);
+        pairs++;
+
+        uint32_t full = dtw_distance_i8<T, C, BENCH_DTW_BAND>(q, row, UINT32_MAX);
+        uint32_t under = dtw_distance_i8<T, C, BENCH_DTW_BAND>(q, row, ref + 1);
+        uint32_t half = ref / 2 + 1;
+        uint32_t abandoned = dtw_distance_i8<T, C, BENCH_DTW_BAND>(q, row, half);
+        distMismatches += full != ref || under != ref || (half <= ref && abandoned < half);
+
+        uint32_t lb = lb_keogh_i8(q, upper.data() + (size_t)i * D, lower.data() + (size_t)i * D, D, UINT32_MAX);
+        boundViolations += lb > ref;
+
+        plainTop.insert(ref, i);
+        // Same rule as SentencePredictor::cascadeVisit
+        uint32_t bound = prunedTop.bound();
+        if (lb > bound) continue;
+        if (bound < UINT32_MAX) bound++;
+        prunedTop.insert(dtw_distance_i8<T, C, BENCH_DTW_BAND>(q, row, bound), i);
+      }
+
+      bool same = true;
+      for (int k = 0; k < K; ++k) {
+        same &= plainTop.dist[k] == prunedTop.dist[k] && plainTop.row[k] == prunedTop.row[k];
+      }
+      topMismatches += !same;
+    }
+  }
+
+  char what[96];
+  snprintf(what, sizeof(what), "banded DTW == plain DTW (band %d), %d pairs, %d mismatches",
+           BENCH_DTW_BAND, pairs, distMismatches);
+  verdict(pairs > 0 && distMismatches == 0, "dtw", what);
+  snprintf(what, sizeof(what), "LB_Keogh <= DTW, %d violations", boundViolations);
+  verdict(boundViolations == 0, "dtw", what);
+  snprintf(what, sizeof(what), "pruned top-%d == plain top-%d, %d queries, %d mismatches",
+           K, K, queries, topMismatches);
+  verdict(topMismatches == 0, "dtw", what);
+#if SENTENCE_USE_DTW
+  snprintf(what, sizeof(what), "exported envelopes == computed, %d mismatches", envelopeMismatches);
+  verdict(envelopeMismatches == 0, "dtw", what);
+#else
+  (void)envelopeMismatches;
+#endif
+}
+
+// ----------- Gesture -----------
+
+static void benchGestureDataset(const std::string& root) {
+  std::vector<std::vector<float>> rows;
+  std::vector<std::string> labels;
+  BenchResult r;
+  if (loadCsv(root + "/data/dataset.csv", NUM_FEATURES, rows, labels)) {
+    std::vector<int> ref = loadReference(root + "/bench/reference/gesture_dataset.txt");
+    if (!ref.empty() && ref.size() != rows.size()) {
+      printf("gesture reference has %zu rows, dataset %zu: ignored\n", ref.size(), rows.size());
+      ref.clear();
+    }
+    for (size_t i = 0; i < rows.size(); ++i) {
+      float feat[NUM_FEATURES];
+      for (int j = 0; j < NUM_FEATURES; ++j) feat[j] = rows[i][j];
+      uint8_t pred = 0;
+      float dist = 0.0f;
+      double us = timeUs([&] {
+        standardizeFeatures(feat);
+        pred = knn_predict(feat, &dist);
+      });
+      r.add(us, (int)pred == labelIndex(label_names, NUM_CLASSES, labels[i]));
+      if (!ref.empty()) r.addRef(pred == ref[i]);
+    }
+  }
+  r.print("gesture dataset");
+  checkAgreement("gesture dataset", r, BENCH_MIN_GESTURE_REF_AGREEMENT);
+}
+
+static void benchGestureLogs(const std::string& root) {
+  BenchResult r;
+  SlidingFeatureWindow window(BENCH_LOG_WINDOW_FRAMES);
+  for (const std::string& path : listFiles(root + "/data", "raw_")) {
+    std::string label;
+    std::vector<SensorSample> samples;
+    if (!loadRawLog(path, "label", label, samples)) continue;
+    int expected = labelIndex(label_names, NUM_CLASSES, label);
+
+    window.reset();
+    for (const SensorSample& s : samples) {
+      window.push(s);
+      if (!window.full()) continue;
+      uint8_t pred = 0;
+      float dist = 0.0f;
+      double us = timeUs([&] {
+        float feat[NUM_FEATURES];
+        window.standardized(feat);
+        pred = knn_predict(feat, &dist);
+      });
+      r.add(us, (int)pred == expected);
+    }
+  }
+  r.print("gesture raw logs");
+}
+
+// Same stream behind the motion gate: how often the scan is skipped and
+// how often that changes the label against scanning every frame
+static void benchGestureGated(const std::string& root) {
+  BenchResult r;
+  SlidingFeatureWindow window(BENCH_LOG_WINDOW_FRAMES);
+  MotionGate gate;
+  int differ = 0;
+  for (const std::string& path : listFiles(root + "/data", "raw_")) {
+    std::string label;
+    std::vector<SensorSample> samples;
+    if (!loadRawLog(path, "label", label, samples)) continue;
+    int expected = labelIndex(label_names, NUM_CLASSES, label);
+
+    window.reset();
+    gate.invalidate();
+    for (const SensorSample& s : samples) {
+      window.push(s);
+      if (!window.full()) continue;
+      float feat[NUM_FEATURES];
+      uint8_t pred = 0;
+      float dist = 0.0f;
+      double us = timeUs([&] {
+        window.standardized(feat);
+        if (!gate.reuse(feat, pred, dist)) {
+          pred = knn_predict(feat, &dist);
+          gate.store(feat, pred, dist);
+        }
+      });
+      r.add(us, (int)pred == expected);
+      differ += knn_predict(feat, &dist) != pred;
+    }
+  }
+  r.print("gesture gated logs");
+  if (r.total > 0) {
+    printf("%-20s reused %.1f%% of frames, %.2f%% labels differ from scanning every frame\n", "",
+           100.0 * gate.reused() / r.total, 100.0 * differ / r.total);
+    char what[96];
+    snprintf(what, sizeof(what), "labels differing from a full scan %.2f%% <= %.1f%%",
+             100.0 * differ / r.total, BENCH_MAX_GATE_DIFFER);
+    verdict(100.0 * differ / r.total <= BENCH_MAX_GATE_DIFFER, "gesture gated logs", what);
+  }
+}
+
+// ----------- Sentence -----------
+
+// One-shot recording of `samples` at SENTENCE_SAMPLE_RATE_HZ, then predict
+static uint8_t runSentenceWindow(SentencePredictor& sp, const std::vector<SensorSample>& samples,
+                                 double* us) {
+  // Keep the clock monotonic across windows, as on the device
+  uint32_t start = shimMillis + SENTENCE_WINDOW_DURATION_MS;
+  shimMillis = start;
+  sp.reset();
+  sp.startRecording();
+  bool complete = false;
+  for (size_t t = 0; t < samples.size() && !complete; ++t) {
+    SensorSample s = samples[t];
+    s.tMs = start + (uint32_t)(t + 1) * SENTENCE_SAMPLE_INTERVAL_MS;
+    shimMillis = s.tMs;
+    complete = sp.addSample(s);
+  }
+  if (!complete) {
+    // Short log: the device completes on the 4 s timeout and resamples
+    SensorSample s = samples.back();
+    s.tMs = start + SENTENCE_WINDOW_DURATION_MS + SENTENCE_SAMPLE_INTERVAL_MS;
+    shimMillis = s.tMs;
+    sp.addSample(s);
+  }
+
+  uint8_t pred = 0;
+  float meanDist = 0.0f;
+  *us = timeUs([&] { pred = sp.predict(&meanDist); });
+  return pred;
+}
+
+static void benchSentenceDataset(const std::string& root) {
+  std::vector<std::vector<float>> rows;
+  std::vector<std::string> labels;
+  BenchResult r;
+  static SentencePredictor sp;
+  if (loadCsv(root + "/data/sentence_dataset.csv", SENTENCE_NUM_FEATURES, rows, labels)) {
+    std::vector<int> ref = loadReference(root + "/bench/reference/sentence_dataset.txt");
+    if (!ref.empty() && ref.size() != rows.size()) {
+      printf("sentence reference has %zu rows, dataset %zu: ignored\n", ref.size(), rows.size());
+      ref.clear();
+    }
+    for (size_t i = 0; i < rows.size(); ++i) {
+      std::vector<SensorSample> samples(SENTENCE_SAMPLES_FOR_PREDICTION);
+      for (int t = 0; t < SENTENCE_SAMPLES_FOR_PREDICTION; ++t) {
+        const float* p = &rows[i][t * SENTENCE_FEATURES_PER_SAMPLE];
+        SensorSample& s = samples[t];
+        s.f1 = p[0]; s.f2 = p[1]; s.f3 = p[2]; s.f4 = p[3]; s.f5 = p[4];
+        s.gdp = p[5];
+        s.ax = p[6]; s.ay = p[7]; s.az = p[8];
+        s.gx = p[9]; s.gy = p[10]; s.gz = p[11];
+      }
+      double us = 0.0;
+      uint8_t pred = runSentenceWindow(sp, samples, &us);
+      r.add(us, (int)pred == labelIndex(sentence_label_names, SENTENCE_NUM_CLASSES, labels[i]));
+      if (!ref.empty()) r.addRef(pred == ref[i]);
+    }
+  }
+  r.print("sentence dataset");
+  checkAgreement("sentence dataset", r, BENCH_MIN_SENTENCE_REF_AGREEMENT);
+}
+
+static void benchSentenceLogs(const std::string& root) {
+  BenchResult r;
+  static SentencePredictor sp;
+  for (const std::string& path : listFiles(root + "/data", "sentence_raw_")) {
+    std::string label;
+    std::vector<SensorSample> samples;
+    if (!loadRawLog(path, "sentence_label", label, samples) || samples.empty()) continue;
+    double us = 0.0;
+    uint8_t pred = runSentenceWindow(sp, samples, &us);
+    r.add(us, (int)pred == labelIndex(sentence_label_names, SENTENCE_NUM_CLASSES, label));
+  }
+  r.print("sentence raw logs");
+}
+
+int main(int argc, char** argv) {
+  std::string root = argc > 1 ? argv[1] : ".";
+
+  printf("KNN_USE_INT8=%d KNN_USE_INDEX=%d L1_KERNEL=%d  gesture K=%d N=%d  sentence K=%d N=%d\n",
+         (int)KNN_USE_INT8, (int)KNN_USE_INDEX, (int)L1_KERNEL, KNN_K, NUM_SAMPLES,
+         SENTENCE_KNN_Q_N_NEIGHBORS, SENTENCE_KNN_Q_N_SAMPLES);
+
+  checkL1Kernels();
+#if KNN_USE_INDEX
+  checkKdIndex(root);
+#endif
+  checkDtw();
+
+  benchGestureDataset(root);
+  benchGestureLogs(root);
+  benchGestureGated(root);
+  benchSentenceDataset(root);
+  benchSentenceLogs(root);
+
+  if (benchFailures) printf("%d check(s) FAILED\n", benchFailures);
+  else printf("all checks passed\n");
+  return benchFailures ? 1 : 0;
+}
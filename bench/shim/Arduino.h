@@ -0,0 +1,60 @@
+#pragma once
+// ----------- Minimal Arduino shim for the native (host) build -----------
+//
+// Just enough of the Arduino / ESP32 core for the model and predictor
+// headers: PROGMEM access, millis(), min/max/constrain and a Serial that
+// discards output. Hardware access (ADC, I2C, timers, tasks) is not shimmed;
+// headers that need it (predictor.h, acquisition.h) are not host-buildable.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <math.h>
+#include <algorithm>
+
+#define PROGMEM
+#define IRAM_ATTR
+
+#define pgm_read_byte(p)  (*(const uint8_t*)(p))
+#define pgm_read_word(p)  (*(const uint16_t*)(p))
+#define pgm_read_dword(p) (*(const uint32_t*)(p))
+#define pgm_read_float(p) (*(const float*)(p))
+
+#define constrain(x, lo, hi) ((x) < (lo) ? (lo) : ((x) > (hi) ? (hi) : (x)))
+
+using std::min;
+using std::max;
+
+// Host clock is driven by the harness (replayed sample timestamps)
+extern uint32_t shimMillis;
+inline uint32_t millis() { return shimMillis; }
+inline uint32_t micros() { return shimMillis * 1000u; }
+inline void delay(uint32_t ms) { shimMillis += ms; }
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t) { return 1; }
+  virtual size_t write(const uint8_t*, size_t n) { return n; }
+};
+
+// Output sink: accepts the Serial calls used by the headers, prints nothing
+class HardwareSerial : public Print {
+public:
+  void begin(unsigned long) {}
+  int available() { return 0; }
+  int read() { return -1; }
+  template <typename T> size_t print(const T&) { return 0; }
+  template <typename T> size_t print(const T&, int) { return 0; }
+  template <typename T> size_t println(const T&) { return 0; }
+  template <typename T> size_t println(const T&, int) { return 0; }
+  size_t println() { return 0; }
+  size_t printf(const char*, ...) { return 0; }
+  using Print::write;
+};
+
+extern HardwareSerial Serial;
@@ -0,0 +1,4 @@
+#include <Arduino.h>
+
+uint32_t shimMillis = 0;
+HardwareSerial Serial;
@@ -42,17 +42,22 @@ let smoothedFingers = {
     pinky: 0
 };
 const SMOOTHING_FACTOR = 0.3;  // Balanced smoothing
-const FINGER_SMOOTHING = 0.2;  // Finger smoothing
+const FINGER_SMOOTHING = 0.35; // Finger smoothing
 
-// Frame limiting to prevent excessive updates
-let lastUpdateTime = 0;
-const UPDATE_INTERVAL = 16;  // ~60 FPS
+// Frames only record the pose they ask for; animate3DScene eases the bones
+// towards it once per display frame. The factors above are per 16 ms and
+// are scaled to the real frame time, so the feel does not depend on the
+// input or display rate.
+const UPDATE_INTERVAL = 16;  // ~60 FPS reference frame
+const poseTarget = { thumb: 0, index: 0, middle: 0, ring: 0, pinky: 0, x: 0, y: 0, z: 0 };
+let lastAnimateTime = 0;
 
 // Initialize 3D Hand Model
 function init3DHandModel() {
     const container = document.getElementById('hand3d');
     if (!container) {
         console.error('3D container not found');
+        animate3DScene();  // still drives the dashboard refresh
         return;
     }
 
@@ -345,9 +350,15 @@ function createSimpleHandMesh() {
 }
 
 // Animation loop
-function animate3DScene() {
+function animate3DScene(now = performance.now()) {
     animationFrameId = requestAnimationFrame(animate3DScene);
 
+    // Cap the step so a tab coming back from the background does not jump
+    const dt = lastAnimateTime ? Math.min(now - lastAnimateTime, 100) : UPDATE_INTERVAL;
+    lastAnimateTime = now;
+    applyHandPose(dt);
+    flushDashboard(now);
+
     if (orbitControls) {
         orbitControls.update();
     }
@@ -379,19 +390,10 @@ function onWindowResize() {
     renderer.setSize(width, height);
 }
 
-// Update hand pose based on sensor data
-function update3DHandPose(data) {
-    if (!handRotationArrays) {
-        // Not ready yet
-        return;
-    }
-
-    // Frame limiting - only update every UPDATE_INTERVAL ms
-    const now = Date.now();
-    if (now - lastUpdateTime < UPDATE_INTERVAL) {
-        return;
-    }
-    lastUpdateTime = now;
+// Record the pose a sensor frame asks for (applied by applyHandPose)
+function setHandPoseTarget(data) {
+    // Frames without sensor fields (sentence results) keep the last pose
+    if (data.f1 === undefined) return;
 
     // Apply calibration offsets and map flex sensor values to rotation angles
     // Subtract offset so that baseline = 0 (straight), then map to curl angle
@@ -402,29 +404,41 @@ function update3DHandPose(data) {
     const pinkyRaw = Math.max(0, (data.f5 || 0) - FLEX_OFFSETS.pinky);
     
     // Convert to rotation angles with maximum sensitivity for full curling
-    const targetThumb = -thumbRaw * 5.0;   // Increased sensitivity
-    const targetIndex = -indexRaw * 6.0;   // Increased sensitivity
-    const targetMiddle = -middleRaw * 5.5; // Increased sensitivity
-    const targetRing = -ringRaw * 6.0;     // Increased sensitivity
-    const targetPinky = -pinkyRaw * 6.5;   // Maximum sensitivity
-    
-    // Smooth finger rotations with increased response
-    smoothedFingers.thumb += (targetThumb - smoothedFingers.thumb) * 0.35;
-    smoothedFingers.index += (targetIndex - smoothedFingers.index) * 0.35;
-    smoothedFingers.middle += (targetMiddle - smoothedFingers.middle) * 0.35;
-    smoothedFingers.ring += (targetRing - smoothedFingers.ring) * 0.35;
-    smoothedFingers.pinky += (targetPinky - smoothedFingers.pinky) * 0.35;
+    poseTarget.thumb = -thumbRaw * 5.0;   // Increased sensitivity
+    poseTarget.index = -indexRaw * 6.0;   // Increased sensitivity
+    poseTarget.middle = -middleRaw * 5.5; // Increased sensitivity
+    poseTarget.ring = -ringRaw * 6.0;     // Increased sensitivity
+    poseTarget.pinky = -pinkyRaw * 6.5;   // Maximum sensitivity
     
     // Map gyro values to hand rotation with correct axis mapping
-    // Apply smoothing to reduce jitter
-    const targetRotX = (data.gx || 0) * 0.015;   // Pitch (palm up/down) - gyroX
-    const targetRotY = (data.gy || 0) * 0.015;   // Yaw (rotate left/right) - gyroY (removed inversion)
-    const targetRotZ = (data.gz || 0) * 0.015;   // Roll (twist wrist) - gyroZ
+    poseTarget.x = (data.gx || 0) * 0.015;   // Pitch (palm up/down) - gyroX
+    poseTarget.y = (data.gy || 0) * 0.015;   // Yaw (rotate left/right) - gyroY (removed inversion)
+    poseTarget.z = (data.gz || 0) * 0.015;   // Roll (twist wrist) - gyroZ
+}
+
+// Ease the bones towards poseTarget; once per animation frame
+function applyHandPose(dt) {
+    if (!handRotationArrays) {
+        // Not ready yet
+        return;
+    }
+
+    // Per-16ms factors scaled to this frame's length
+    const steps = dt / UPDATE_INTERVAL;
+    const fingerK = 1 - Math.pow(1 - FINGER_SMOOTHING, steps);
+    const rotK = 1 - Math.pow(1 - SMOOTHING_FACTOR, steps);
+
+    // Smooth finger rotations with increased response
+    smoothedFingers.thumb += (poseTarget.thumb - smoothedFingers.thumb) * fingerK;
+    smoothedFingers.index += (poseTarget.index - smoothedFingers.index) * fingerK;
+    smoothedFingers.middle += (poseTarget.middle - smoothedFingers.middle) * fingerK;
+    smoothedFingers.ring += (poseTarget.ring - smoothedFingers.ring) * fingerK;
+    smoothedFingers.pinky += (poseTarget.pinky - smoothedFingers.pinky) * fingerK;
 
     // Smooth the rotation using exponential moving average
-    smoothedRotation.x += (targetRotX - smoothedRotation.x) * SMOOTHING_FACTOR;
-    smoothedRotation.y += (targetRotY - smoothedRotation.y) * SMOOTHING_FACTOR;
-    smoothedRotation.z += (targetRotZ - smoothedRotation.z) * SMOOTHING_FACTOR;
+    smoothedRotation.x += (poseTarget.x - smoothedRotation.x) * rotK;
+    smoothedRotation.y += (poseTarget.y - smoothedRotation.y) * rotK;
+    smoothedRotation.z += (poseTarget.z - smoothedRotation.z) * rotK;
 
     // Apply smoothed rotation directly (no GSAP to prevent reverting)
     handRotationArrays.hand.x = smoothedRotation.x;
@@ -463,6 +477,9 @@ function update3DHandPose(data) {
 // WebSocket connection for real-time data
 let ws = null;
 let reconnectTimeout = null;
+// Glove to show when the bridge serves several (web_ui.py, page URL ?device=<id>)
+const deviceParam = new URLSearchParams(window.location.search).get('device');
+const deviceQuery = deviceParam ? `?device=${encodeURIComponent(deviceParam)}` : '';
 let sampleCount = 0;
 let predCount = 0;
 let predRateInterval = null;
@@ -554,7 +571,7 @@ function addLog(message, type = 'gesture') {
 // Initialize WebSocket connection
 function connectWebSocket() {
     const protocol = window.location.protocol === 'https:' ? 'wss:' : 'ws:';
-    const wsUrl = `${protocol}//${window.location.host}/ws`;
+    const wsUrl = `${protocol}//${window.location.host}/ws${deviceQuery}`;
     
     try {
         ws = new WebSocket(wsUrl);
@@ -568,7 +585,12 @@ function connectWebSocket() {
         ws.onmessage = (event) => {
             try {
                 const data = JSON.parse(event.data);
-                handleData(data);
+                // The glove batches frames into one array per message
+                if (Array.isArray(data)) {
+                    data.forEach(handleData);
+                } else {
+                    handleData(data);
+                }
             } catch (e) {
                 console.error('Failed to parse message:', e);
             }
@@ -592,23 +614,99 @@ function connectWebSocket() {
 }
 
 // Update connection status
+let connectionStatus = '';
 function updateStatus(status, text) {
+    connectionStatus = status;
     elements.statusDot.className = `status-dot ${status}`;
     elements.statusText.textContent = text;
 }
 
-// Handle incoming data
+// ---- Dashboard refresh ----
+// handleData only records what the dashboard should show; flushDashboard
+// (from the animation loop, at most every DOM_UPDATE_INTERVAL) writes it,
+// skipping values that did not change since the last write.
+const DOM_UPDATE_INTERVAL = 66;  // ~15 Hz, plenty for text and bars
+const view = {
+    gestureName: undefined,      // text, undefined = leave as is
+    confidence: undefined,       // 0..100
+    confidenceBg: undefined,     // confidence bar background ('' = stylesheet)
+    sensors: null,               // latest frame with sensor fields
+    historyDirty: false
+};
+let lastDashboardFlush = 0;
+
+// Last value written per element and property
+const domWritten = new WeakMap();
+function writeDom(el, prop, value) {
+    if (!el) return;
+    let last = domWritten.get(el);
+    if (!last) {
+        last = {};
+        domWritten.set(el, last);
+    }
+    if (last[prop] === value) return;
+    last[prop] = value;
+    if (prop === 'text') el.textContent = value;
+    else el.style[prop] = value;
+}
+
+function flushDashboard(now) {
+    if (now - lastDashboardFlush < DOM_UPDATE_INTERVAL) return;
+    lastDashboardFlush = now;
+
+    writeDom(elements.sampleCount, 'text', sampleCount.toLocaleString());
+    if (view.gestureName !== undefined) writeDom(elements.gestureName, 'text', view.gestureName);
+    if (view.confidence !== undefined) {
+        writeDom(elements.confidenceFill, 'width', `${view.confidence}%`);
+        writeDom(elements.confidenceValue, 'text', `${view.confidence.toFixed(0)}%`);
+    }
+    if (view.confidenceBg !== undefined) writeDom(elements.confidenceBar, 'background', view.confidenceBg);
+    if (view.historyDirty) {
+        view.historyDirty = false;
+        renderHistory();
+    }
+
+    const data = view.sensors;
+    if (!data) return;
+
+    // Update sensor data (GDP, flex, IMU) - for both modes
+    if (data.gdp !== undefined) {
+        const gdp = parseFloat(data.gdp);
+        writeDom(elements.gdpValue, 'text', gdp.toFixed(1));
+        const gdpPercent = Math.min(100, (gdp / 50) * 100);
+        writeDom(elements.gdpBar, 'width', `${gdpPercent.toFixed(1)}%`);
+    }
+    
+    // Update flex sensors
+    updateFlexSensor('thumb', data.f1);
+    updateFlexSensor('index', data.f2);
+    updateFlexSensor('middle', data.f3);
+    updateFlexSensor('ring', data.f4);
+    updateFlexSensor('pinky', data.f5);
+    
+    // Update IMU data
+    if (data.ax !== undefined) writeDom(elements.accelX, 'text', parseFloat(data.ax).toFixed(2));
+    if (data.ay !== undefined) writeDom(elements.accelY, 'text', parseFloat(data.ay).toFixed(2));
+    if (data.az !== undefined) writeDom(elements.accelZ, 'text', parseFloat(data.az).toFixed(2));
+    if (data.gx !== undefined) writeDom(elements.gyroX, 'text', parseFloat(data.gx).toFixed(1));
+    if (data.gy !== undefined) writeDom(elements.gyroY, 'text', parseFloat(data.gy).toFixed(1));
+    if (data.gz !== undefined) writeDom(elements.gyroZ, 'text', parseFloat(data.gz).toFixed(1));
+}
+
+// Handle incoming data: called for every frame, so it only updates state
+// (predictions, history and speech still see every frame; the DOM and the
+// 3D hand are refreshed by the animation loop)
 function handleData(data) {
     // Mark as connected when receiving data
-    if (elements.statusDot.className !== 'status-dot connected') {
+    if (connectionStatus !== 'connected') {
         updateStatus('connected', 'Connected');
     }
     
     sampleCount++;
-    elements.sampleCount.textContent = sampleCount.toLocaleString();
     
-    // Update 3D hand model with real-time sensor data
-    update3DHandPose(data);
+    // Latest sensor values for the 3D hand model and the sensor panel
+    setHandPoseTarget(data);
+    if (data.f1 !== undefined || data.gdp !== undefined) view.sensors = data;
     
     // Check if we're in sentence mode (UI state takes priority)
     if (currentMode === 'sentence') {
@@ -616,15 +714,15 @@ function handleData(data) {
         if (data.mode === 'sentence') {
             if (data.recording === true) {
                 // Show prediction progress
-                elements.gestureName.textContent = '⏳ Analyzing...';
+                view.gestureName = '⏳ Analyzing...';
                 const progress = (data.progress || 0) * 100;
                 updateConfidence(progress);
                 
                 // Update progress bar style for sentence mode
-                elements.confidenceBar.style.background = 'linear-gradient(to right, #10b981, #34d399)';
+                view.confidenceBg = 'linear-gradient(to right, #10b981, #34d399)';
             } else if (data.sentence) {
                 // Show sentence prediction
-                elements.gestureName.textContent = data.sentence;
+                view.gestureName = data.sentence;
                 predCount++;
                 addToHistory(data.sentence);
                 if (typeof window.__lastSentenceSpoken === 'undefined') {
@@ -639,26 +737,25 @@ function handleData(data) {
                 updateConfidence(confidence);
                 
                 // Reset progress bar style
-                elements.confidenceBar.style.background = '';
+                view.confidenceBg = '';
                 
                 console.log(`Predicted: "${data.sentence}" (conf: ${confidence.toFixed(0)}%, meanD: ${data.meanD?.toFixed(1)})`);
             }
         } else {
             // ESP32 is sending gesture data but we're in sentence mode
             // Show waiting message until next sentence prediction triggers
-            if (!elements.gestureName.textContent.includes('...')) {
-                elements.gestureName.textContent = '⏳ Waiting...';
+            if (!(view.gestureName || '').includes('...')) {
+                view.gestureName = '⏳ Waiting...';
                 updateConfidence(0);
             }
         }
-        // Don't return - continue to update sensor data below
     }
     
     // Gesture mode - update gesture display
     if (currentMode === 'gesture') {
         // Update gesture display
         if (data.label && data.label !== 'unknown') {
-            elements.gestureName.textContent = data.label;
+            view.gestureName = data.label;
             predCount++;
             addToHistory(data.label);
             if (typeof window.__lastGestureSpoken === 'undefined') {
@@ -674,29 +771,6 @@ function handleData(data) {
             updateConfidence(confidence);
         }
     }
-    
-    // Update sensor data (GDP, flex, IMU) - for both modes
-    if (data.gdp !== undefined) {
-        const gdp = parseFloat(data.gdp);
-        elements.gdpValue.textContent = gdp.toFixed(1);
-        const gdpPercent = Math.min(100, (gdp / 50) * 100);
-        elements.gdpBar.style.width = `${gdpPercent}%`;
-    }
-    
-    // Update flex sensors
-    updateFlexSensor('thumb', data.f1);
-    updateFlexSensor('index', data.f2);
-    updateFlexSensor('middle', data.f3);
-    updateFlexSensor('ring', data.f4);
-    updateFlexSensor('pinky', data.f5);
-    
-    // Update IMU data
-    if (data.ax !== undefined) elements.accelX.textContent = parseFloat(data.ax).toFixed(2);
-    if (data.ay !== undefined) elements.accelY.textContent = parseFloat(data.ay).toFixed(2);
-    if (data.az !== undefined) elements.accelZ.textContent = parseFloat(data.az).toFixed(2);
-    if (data.gx !== undefined) elements.gyroX.textContent = parseFloat(data.gx).toFixed(1);
-    if (data.gy !== undefined) elements.gyroY.textContent = parseFloat(data.gy).toFixed(1);
-    if (data.gz !== undefined) elements.gyroZ.textContent = parseFloat(data.gz).toFixed(1);
 }
 
 // Update flex sensor display
@@ -706,17 +780,16 @@ function updateFlexSensor(name, value) {
     const val = parseFloat(value);
     const percent = Math.max(0, Math.min(100, val * 100));
     
-    elements[`${name}Bar`].style.width = `${percent}%`;
-    elements[`${name}Val`].textContent = (val * 100).toFixed(0) + '%';
+    writeDom(elements[`${name}Bar`], 'width', `${percent.toFixed(0)}%`);
+    writeDom(elements[`${name}Val`], 'text', (val * 100).toFixed(0) + '%');
 }
 
-// Update confidence display
+// Update confidence display (written on the next dashboard refresh)
 function updateConfidence(confidence) {
-    elements.confidenceFill.style.width = `${confidence}%`;
-    elements.confidenceValue.textContent = `${confidence.toFixed(0)}%`;
+    view.confidence = confidence;
 }
 
-// Add gesture to history
+// Add gesture to history (rendered on the next dashboard refresh)
 function addToHistory(gesture) {
     const now = new Date();
     const timeStr = now.toLocaleTimeString();
@@ -727,7 +800,7 @@ function addToHistory(gesture) {
         historyItems.pop();
     }
     
-    renderHistory();
+    view.historyDirty = true;
 }
 
 // Render history list
@@ -752,7 +825,7 @@ function updatePredRate() {
     
     if (elapsed > 0) {
         const rate = predCount / elapsed;
-        elements.predRate.textContent = rate.toFixed(1);
+        writeDom(elements.predRate, 'text', rate.toFixed(1));
     }
     
     predCount = 0;
@@ -766,7 +839,7 @@ function startPolling() {
     
     pollInterval = setInterval(async () => {
         try {
-            const response = await fetch('/data');
+            const response = await fetch(`/data${deviceQuery}`);
             if (response.ok) {
                 const data = await response.json();
                 handleData(data);
@@ -826,7 +899,7 @@ async function switchToSentenceMode() {
 // Trigger a single sentence prediction
 async function triggerSentencePrediction() {
     try {
-        const response = await fetch('/api/sentence', {
+        const response = await fetch(`/api/sentence${deviceQuery}`, {
             method: 'POST',
             headers: { 'Content-Type': 'application/json' }
         });
@@ -0,0 +1,212 @@
+#pragma once
+#include <Arduino.h>
+#include "predictor.h"
+#include "sensor_ring.h"
+#include "stage_stats.h"
+#include "replay_source.h"
+
+// ----------- Timer-driven sensor acquisition (core 0) -----------
+//
+// A hardware timer fires at ACQ_SAMPLE_RATE_HZ and wakes a FreeRTOS task
+// pinned to core 0. The task reads one flex + IMU frame and pushes it into
+// a lock-free SPSC ring. loop() (core 1) drains the ring, so inference and
+// serial output never block sampling and samples stay evenly spaced.
+//
+// With IMU_INT_PIN wired (imu_fifo.h) the MPU6050 data-ready interrupt
+// paces the task at the sensor's own clock instead; the timer then only
+// runs when setRate() asks for a different rate (replay).
+//
+// While a replay is active (replay_source.h) the task takes frames from the
+// replay source instead of the sensors; setRate() changes the pacing.
+//
+// setIdle() (motion_gate.h) stops the timer and the data-ready interrupt;
+// the task then paces itself with a FreeRTOS timeout, which leaves the CPU
+// free to clock down or light-sleep between samples.
+
+#ifndef ACQ_SAMPLE_RATE_HZ
+#define ACQ_SAMPLE_RATE_HZ 100   // 10 ms per frame, matches the old sampleDelayMs
+#endif
+
+#define ACQ_RING_SIZE   64       // ~640 ms of buffering at 100 Hz
+#define ACQ_TASK_CORE   0
+#define ACQ_TASK_STACK  4096
+#define ACQ_TASK_PRIO   5
+#define ACQ_TIMER_NUM   0
+
+class SensorAcquisition {
+public:
+  explicit SensorAcquisition(GlovePredictor& p)
+  : predictor(p), taskHandle(nullptr), timer(nullptr), baseRate(0), currentRate(0),
+    idle(false), idlePeriodTicks(1), droppedSamples(0)
+  {}
+
+  // Start the sampling task and the hardware timer that paces it.
+  bool begin(uint32_t rateHz = ACQ_SAMPLE_RATE_HZ) {
+    instance = this;
+
+    BaseType_t ok = xTaskCreatePinnedToCore(
+      taskEntry, "acq", ACQ_TASK_STACK, this, ACQ_TASK_PRIO, &taskHandle, ACQ_TASK_CORE);
+    if (ok != pdPASS) return false;
+
+    uint64_t periodUs = periodFor(rateHz);
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+    timer = timerBegin(1000000);              // 1 MHz tick
+    if (!timer) return false;
+    timerAttachInterrupt(timer, &onTimer);
+    timerAlarm(timer, periodUs, true, 0);
+#else
+    timer = timerBegin(ACQ_TIMER_NUM, 80, true);  // 80 MHz APB / 80 = 1 MHz tick
+    if (!timer) return false;
+    timerAttachInterrupt(timer, &onTimer, true);
+    timerAlarmWrite(timer, periodUs, true);
+    timerAlarmEnable(timer);
+#endif
+    baseRate = rateHz;
+    currentRate = rateHz;
+    useDataReady(true);
+    return true;
+  }
+
+  // Change the sampling (or replay) rate while running.
+  void setRate(uint32_t rateHz) {
+    if (!timer) return;
+    uint64_t periodUs = periodFor(rateHz);
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+    timerAlarm(timer, periodUs, true, 0);
+#else
+    timerAlarmWrite(timer, periodUs, true);
+#endif
+    currentRate = rateHz;
+    if (idle) runTimer(true);
+    idle = false;
+    useDataReady(rateHz == baseRate);
+  }
+
+  uint32_t rate() const { return currentRate; }
+
+  // Idle pacing at rateHz without timer / interrupts; false = back to the
+  // base rate. setRate() also ends idle.
+  void setIdle(bool on, uint32_t rateHz = 0) {
+    if (!timer || on == idle) return;
+    if (!on) {
+      setRate(baseRate);
+      return;
+    }
+    TickType_t ticks = pdMS_TO_TICKS(1000 / (rateHz ? rateHz : 1));
+    idlePeriodTicks = ticks ? ticks : 1;
+    useDataReady(false);
+    runTimer(false);
+    currentRate = rateHz;
+    idle = true;
+    // The task is already blocked without a timeout (it read idle before
+    // it was set) and the timer that would wake it is stopped
+    xTaskNotifyGive(taskHandle);
+  }
+
+  bool idling() const { return idle; }
+
+  // Replay control; see replay_source.h
+  ReplaySource& replaySource() { return replay; }
+
+  // Consumer side (core 1). Returns false when no new sample is pending.
+  bool read(SensorSample& out) {
+    return ring.pop(out);
+  }
+
+  uint32_t pending() const { return ring.size(); }
+
+  // Samples lost because the consumer fell more than ACQ_RING_SIZE behind.
+  uint32_t dropped() const { return droppedSamples; }
+
+  // Unused stack of the sampling task, in bytes
+  uint32_t stackHighWater() const {
+    return taskHandle ? (uint32_t)uxTaskGetStackHighWaterMark(taskHandle) : 0;
+  }
+
+private:
+  static void IRAM_ATTR onTimer() {
+    BaseType_t woken = pdFALSE;
+    if (instance && instance->taskHandle) {
+      vTaskNotifyGiveFromISR(instance->taskHandle, &woken);
+    }
+    if (woken) {
+      portYIELD_FROM_ISR();
+    }
+  }
+
+  static void taskEntry(void* arg) {
+    static_cast<SensorAcquisition*>(arg)->run();
+  }
+
+  // Hand pacing to the MPU6050 data-ready pin (when wired) or back to the
+  // timer. The sensor runs at the base rate, so other rates use the timer.
+  void useDataReady(bool on) {
+#if IMU_USE_FIFO && IMU_INT_PIN >= 0
+    static_assert(IMU_OVERSAMPLE == 1, "IMU_INT_PIN pacing needs IMU_OVERSAMPLE 1");
+    if (on) {
+      attachInterrupt(digitalPinToInterrupt(IMU_INT_PIN), onTimer, RISING);
+      runTimer(false);
+    } else {
+      detachInterrupt(digitalPinToInterrupt(IMU_INT_PIN));
+      runTimer(true);
+    }
+#else
+    (void)on;
+#endif
+  }
+
+  void runTimer(bool on) {
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+    if (on) timerStart(timer); else timerStop(timer);
+#else
+    if (on) timerAlarmEnable(timer); else timerAlarmDisable(timer);
+#endif
+  }
+
+  static uint64_t periodFor(uint32_t rateHz) {
+    return 1000000ULL / (rateHz ? rateHz : 1);
+  }
+
+  void run() {
+    for (;;) {
+      // Block until the timer ISR signals the next sample slot (idle: the
+      // timeout is the slot)
+      ulTaskNotifyTake(pdTRUE, idle ? idlePeriodTicks : portMAX_DELAY);
+
+      SensorSample s;
+      if (replay.service()) {
+        RawFrame f;
+        uint32_t tMs;
+        if (!replay.next(f, tMs)) continue;
+        s = makeSensorSample(f.flex, f.ax, f.ay, f.az, f.gx, f.gy, f.gz, tMs);
+      } else {
+        int flex[5];
+        int16_t ax, ay, az, gx, gy, gz;
+        {
+          STATS_SCOPE(STAT_ACQ_READ);
+          predictor.readRawFrame(flex, ax, ay, az, gx, gy, gz);
+        }
+        s = makeSensorSample(flex, ax, ay, az, gx, gy, gz, millis());
+      }
+
+      if (!ring.push(s)) {
+        droppedSamples++;
+      }
+    }
+  }
+
+  GlovePredictor& predictor;
+  SpscRing<SensorSample, ACQ_RING_SIZE> ring;
+  TaskHandle_t taskHandle;
+  hw_timer_t* timer;
+  uint32_t baseRate;
+  uint32_t currentRate;
+  volatile bool idle;
+  TickType_t idlePeriodTicks;
+  volatile uint32_t droppedSamples;
+  ReplaySource replay;
+
+  static SensorAcquisition* instance;
+};
+
+SensorAcquisition* SensorAcquisition::instance = nullptr;
@@ -0,0 +1,84 @@
+#pragma once
+#include <Arduino.h>
+
+// ----------- Serial command parser -----------
+//
+// Fixed-capacity line buffer plus a dispatch table; nothing is allocated.
+// A command line is "NAME" or "NAME ARG", terminated by '\n' ('\r' is
+// ignored, names match case-insensitively). Lines longer than
+// SERIAL_CMD_MAX_LEN are discarded up to the next newline.
+
+#ifndef SERIAL_CMD_MAX_LEN
+#define SERIAL_CMD_MAX_LEN 120  // fits a replayed FLEX line
+#endif
+
+struct SerialCommand {
+  const char* name;
+  void (*handler)(const char* arg);  // arg: text after the name, "" if none
+};
+
+class CommandParser {
+public:
+  CommandParser(const SerialCommand* table, uint8_t count)
+  : table(table), count(count), len(0), overflow(false), name(buf)
+  {
+    buf[0] = '\0';
+  }
+
+  // Feed one received character. Returns true when a complete line is
+  // ready; call dispatch() before feeding more.
+  bool feed(char c) {
+    if (c == '\r') return false;
+    if (c != '\n') {
+      if (len < SERIAL_CMD_MAX_LEN) buf[len++] = c;
+      else overflow = true;
+      return false;
+    }
+
+    bool ready = !overflow;
+    buf[len] = '\0';
+    len = 0;
+    overflow = false;
+    return ready;
+  }
+
+  // Run the handler for the last line. Returns false for an unknown name;
+  // blank lines count as handled.
+  bool dispatch() {
+    name = trim(buf);
+    if (*name == '\0') return true;
+
+    char* arg = name;
+    while (*arg && *arg != ' ') ++arg;
+    if (*arg) {
+      *arg++ = '\0';
+      arg = trim(arg);
+    }
+
+    for (uint8_t i = 0; i < count; ++i) {
+      if (strcasecmp(name, table[i].name) == 0) {
+        table[i].handler(arg);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Command name of the last dispatched line
+  const char* command() const { return name; }
+
+private:
+  static char* trim(char* s) {
+    while (*s == ' ' || *s == '\t') ++s;
+    char* end = s + strlen(s);
+    while (end > s && (end[-1] == ' ' || end[-1] == '\t')) *--end = '\0';
+    return s;
+  }
+
+  const SerialCommand* table;
+  uint8_t count;
+  char buf[SERIAL_CMD_MAX_LEN + 1];
+  uint8_t len;
+  bool overflow;
+  char* name;
+};
@@ -0,0 +1,74 @@
+#pragma once
+#include <Arduino.h>
+#include "l1_kernel.h"
+
+// ----------- Banded DTW over int8 multichannel series -----------
+//
+// A series is STEPS timesteps of STEP_LEN int8 channels, stored time-major
+// like the sentence table (timestep t = bytes [t * STEP_LEN, (t + 1) * STEP_LEN)).
+// The cell cost of matching timestep i of one series to timestep j of the
+// other is the L1 distance over all channels (SWAR kernel), and the warping
+// path may stray at most BAND timesteps from the diagonal (Sakoe-Chiba).
+// All sums are integers, so results do not depend on the platform.
+//
+// LB_Keogh: with upper / lower envelopes of a candidate (max / min of each
+// channel over timesteps t - BAND .. t + BAND), every query timestep must be
+// matched to some candidate timestep inside its envelope window, so
+//   sum over t, c of  max(0, q - upper, lower - q)  <=  DTW(q, candidate).
+// The trainer exports the envelopes with the table.
+
+#define DTW_INF (UINT32_MAX / 2)   // unreachable cell; INF + cost does not overflow
+
+// Early-abandoning banded DTW. Returns a value >= bound as soon as a whole
+// row of the cost matrix reaches `bound` (every path crosses each row, and
+// costs only grow along a path).
+template <int STEPS, int STEP_LEN, int BAND>
+inline uint32_t dtw_distance_i8(const int8_t* a, const int8_t* b, uint32_t bound) {
+  uint32_t rowA[STEPS], rowB[STEPS];
+  uint32_t* prev = rowA;
+  uint32_t* cur = rowB;
+  for (int j = 0; j < STEPS; ++j) prev[j] = cur[j] = DTW_INF;
+
+  for (int i = 0; i < STEPS; ++i) {
+    const int jlo = i > BAND ? i - BAND : 0;
+    const int jhi = i + BAND < STEPS ? i + BAND : STEPS - 1;
+    const int8_t* ai = a + i * STEP_LEN;
+    uint32_t rowMin = DTW_INF;
+
+    // Cells just outside the band read as unreachable by the next row
+    if (jlo > 0) cur[jlo - 1] = DTW_INF;
+    for (int j = jlo; j <= jhi; ++j) {
+      uint32_t best = (i == 0 && j == 0) ? 0 : prev[j];
+      if (j > 0) {
+        if (prev[j - 1] < best) best = prev[j - 1];
+        if (cur[j - 1] < best) best = cur[j - 1];
+      }
+      uint32_t d = best + l1_distance_i8(ai, b + j * STEP_LEN, STEP_LEN);
+      cur[j] = d;
+      if (d < rowMin) rowMin = d;
+    }
+    if (jhi + 1 < STEPS) cur[jhi + 1] = DTW_INF;
+
+    if (rowMin >= bound) return rowMin;
+    uint32_t* t = prev; prev = cur; cur = t;
+  }
+  return prev[STEPS - 1];
+}
+
+// LB_Keogh of query q against a candidate's envelopes (n = STEPS * STEP_LEN
+// bytes, PROGMEM tables), abandoned once it reaches `bound`.
+inline uint32_t lb_keogh_i8(const int8_t* q, const int8_t* upper, const int8_t* lower,
+                            int n, uint32_t bound) {
+  uint32_t d = 0;
+  for (int i0 = 0; i0 < n; i0 += 48) {
+    const int end = i0 + 48 < n ? i0 + 48 : n;
+    for (int i = i0; i < end; ++i) {
+      const int v = q[i];
+      const int hi = (int8_t)pgm_read_byte(&upper[i]);
+      const int lo = (int8_t)pgm_read_byte(&lower[i]);
+      d += (uint32_t)(v > hi ? v - hi : (v < lo ? lo - v : 0));
+    }
+    if (d >= bound) break;
+  }
+  return d;
+}
@@ -0,0 +1,90 @@
+#pragma once
+#include <Arduino.h>
+#include "scaler_params.h"
+#include "sensor_ring.h"
+
+// ----------- Sliding-window gesture features -----------
+//
+// Keeps the last N frames in a circular buffer together with a running
+// per-feature sum. push() adds the newest frame and drops the oldest in
+// O(1), so a fresh averaged feature vector is available after every frame.
+//
+// Feature order is the strict order documented in predictor.h:
+// f1, f2, f3, f4, f5, gdp, ax, ay, az, gx, gy, gz
+//
+// Sums are kept in double. Every value is a float, so add/remove of the
+// same value is exact and the running sum does not drift.
+
+#define FEATURE_WINDOW_MAX_FRAMES 64   // same cap as buildFeatureVector()
+
+class SlidingFeatureWindow {
+public:
+  explicit SlidingFeatureWindow(uint8_t frames = 25) {
+    setLength(frames);
+  }
+
+  // Change the window length (clears the window).
+  void setLength(uint8_t frames) {
+    if (frames < 1) frames = 1;
+    if (frames > FEATURE_WINDOW_MAX_FRAMES) frames = FEATURE_WINDOW_MAX_FRAMES;
+    length = frames;
+    reset();
+  }
+
+  uint8_t getLength() const { return length; }
+
+  void reset() {
+    head = 0;
+    count = 0;
+    for (int i = 0; i < NUM_FEATURES; ++i) sum[i] = 0.0;
+  }
+
+  // Add one frame; the oldest frame falls out once the window is full.
+  void push(const SensorSample& s) {
+    float* slot = frames[head];
+
+    if (count == length) {
+      for (int i = 0; i < NUM_FEATURES; ++i) sum[i] -= slot[i];
+    } else {
+      count++;
+    }
+
+    slot[0] = s.f1;  slot[1] = s.f2;  slot[2] = s.f3;  slot[3] = s.f4;  slot[4] = s.f5;
+    slot[5] = s.gdp;
+    slot[6] = s.ax;  slot[7] = s.ay;  slot[8] = s.az;
+    slot[9] = s.gx;  slot[10] = s.gy; slot[11] = s.gz;
+
+    for (int i = 0; i < NUM_FEATURES; ++i) sum[i] += slot[i];
+
+    head = (uint8_t)((head + 1) % length);
+  }
+
+  // True once the window holds `length` frames.
+  bool full() const { return count == length; }
+
+  uint8_t size() const { return count; }
+
+  // Mean over the frames currently in the window (raw feature space).
+  void mean(float feat[NUM_FEATURES]) const {
+    if (count == 0) {
+      for (int i = 0; i < NUM_FEATURES; ++i) feat[i] = 0.0f;
+      return;
+    }
+    for (int i = 0; i < NUM_FEATURES; ++i) {
+      feat[i] = (float)(sum[i] / (double)count);
+    }
+  }
+
+  // Mean, then standardized with the exported scaler parameters.
+  void standardized(float feat[NUM_FEATURES]) const {
+    mean(feat);
+    standardizeFeatures(feat);
+  }
+
+private:
+  float frames[FEATURE_WINDOW_MAX_FRAMES][NUM_FEATURES];
+  double sum[NUM_FEATURES];
+  uint8_t head;
+  uint8_t count;
+  uint8_t length;
+};
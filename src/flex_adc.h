@@ -0,0 +1,177 @@
+#pragma once
+#include <Arduino.h>
+#include "Calib.h"
+
+#if ESP_ARDUINO_VERSION_MAJOR < 3
+#include <driver/adc.h>
+#endif
+
+// ----------- Continuous (DMA) flex ADC -----------
+//
+// ADC1 scans the five PIN_FLEX channels in the background at
+// FLEX_ADC_SAMPLE_HZ conversions/s (I2S0 DMA on the ESP32), instead of
+// five blocking analogRead() calls per frame. read() drains what the DMA
+// collected since the previous call and returns the per-channel mean, so
+// every frame is a box-filtered average of ~FLEX_ADC_SAMPLE_HZ / 5 / rate
+// conversions (~40 per channel at 100 Hz) for the cost of a buffer copy.
+//
+// Raw values stay in analogRead() units (12 bit, 11 dB), so FLEX_MIN /
+// FLEX_MAX and the trained models apply unchanged.
+//
+// Set FLEX_ADC_DMA=0 for analogRead(); start failures fall back to it too.
+
+#ifndef FLEX_ADC_DMA
+#define FLEX_ADC_DMA 1
+#endif
+
+#ifndef FLEX_ADC_SAMPLE_HZ
+#define FLEX_ADC_SAMPLE_HZ 20000   // total over all channels; ESP32 DMA minimum
+#endif
+
+#define FLEX_ADC_CHANNELS    5
+#define FLEX_ADC_BUFFER      4096   // DMA ring: ~100 ms at 20 kHz
+#define FLEX_ADC_READ_CHUNK  256    // bytes per driver read
+
+class FlexAdc {
+public:
+  FlexAdc() : running(false), overruns(0) {
+    memset(last, 0, sizeof(last));
+  }
+
+  // frameRateHz: how often read() will be called (sizes the averaging
+  // frames on Arduino-ESP32 3.x)
+  bool begin(uint32_t frameRateHz) {
+    // Seed with one blocking read so the first frames are not zero
+    for (int i = 0; i < FLEX_ADC_CHANNELS; ++i) last[i] = analogRead(PIN_FLEX[i]);
+
+#if FLEX_ADC_DMA
+    running = startDma(frameRateHz);
+#else
+    (void)frameRateHz;
+#endif
+    return running;
+  }
+
+  bool dma() const { return running; }
+
+  // One frame of raw flex values (GPIO order of PIN_FLEX)
+  void read(int out[FLEX_ADC_CHANNELS]) {
+    if (!running) {
+      for (int i = 0; i < FLEX_ADC_CHANNELS; ++i) out[i] = analogRead(PIN_FLEX[i]);
+      return;
+    }
+#if FLEX_ADC_DMA
+    drain();
+#endif
+    for (int i = 0; i < FLEX_ADC_CHANNELS; ++i) out[i] = last[i];
+  }
+
+  // DMA buffer overruns (reader stalled for more than ~100 ms)
+  uint32_t overrunCount() const { return overruns; }
+
+private:
+#if FLEX_ADC_DMA
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+  bool startDma(uint32_t frameRateHz) {
+    uint8_t pins[FLEX_ADC_CHANNELS];
+    for (int i = 0; i < FLEX_ADC_CHANNELS; ++i) pins[i] = (uint8_t)PIN_FLEX[i];
+
+    // Several driver frames per acquisition tick; drain() averages them
+    uint32_t perPin = FLEX_ADC_SAMPLE_HZ / FLEX_ADC_CHANNELS / (frameRateHz ? frameRateHz : 1) / 4;
+    analogContinuousSetWidth(12);
+    analogContinuousSetAtten(ADC_11db);
+    if (!analogContinuous(pins, FLEX_ADC_CHANNELS, perPin ? perPin : 1, FLEX_ADC_SAMPLE_HZ, nullptr)) {
+      return false;
+    }
+    return analogContinuousStart();
+  }
+
+  void drain() {
+    uint32_t sum[FLEX_ADC_CHANNELS] = {0};
+    uint32_t frames = 0;
+    adc_continuous_data_t* result = nullptr;
+    while (analogContinuousRead(&result, 0)) {
+      for (int i = 0; i < FLEX_ADC_CHANNELS; ++i) sum[slotOf(result[i].pin)] += result[i].avg_read_raw;
+      frames++;
+    }
+    if (!frames) return;
+    for (int i = 0; i < FLEX_ADC_CHANNELS; ++i) last[i] = (int)((sum[i] + frames / 2) / frames);
+  }
+
+  static int slotOf(uint8_t pin) {
+    for (int i = 0; i < FLEX_ADC_CHANNELS; ++i) if (PIN_FLEX[i] == pin) return i;
+    return 0;
+  }
+#else
+  // IDF 4.4 continuous-mode driver (adc_digi_*) with a 5-entry scan pattern
+  bool startDma(uint32_t) {
+    uint32_t mask = 0;
+    adc_digi_pattern_config_t pattern[FLEX_ADC_CHANNELS];
+    for (int i = 0; i < FLEX_ADC_CHANNELS; ++i) {
+      int ch = digitalPinToAnalogChannel(PIN_FLEX[i]);
+      if (ch < 0 || ch > 7) return false;          // ADC1 only
+      channelSlot[ch] = (int8_t)i;
+      mask |= 1u << ch;
+      pattern[i].atten = ADC_ATTEN_DB_11;
+      pattern[i].channel = (uint8_t)ch;
+      pattern[i].unit = 0;                          // ADC1
+      pattern[i].bit_width = SOC_ADC_DIGI_MAX_BITWIDTH;
+    }
+
+    adc_digi_init_config_t init;
+    memset(&init, 0, sizeof(init));
+    init.max_store_buf_size = FLEX_ADC_BUFFER;
+    init.conv_num_each_intr = FLEX_ADC_READ_CHUNK;
+    init.adc1_chan_mask = mask;
+    if (adc_digi_initialize(&init) != ESP_OK) return false;
+
+    adc_digi_configuration_t cfg;
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.conv_limit_en = true;                       // required on the ESP32
+    cfg.conv_limit_num = 250;
+    cfg.pattern_num = FLEX_ADC_CHANNELS;
+    cfg.adc_pattern = pattern;
+    cfg.sample_freq_hz = FLEX_ADC_SAMPLE_HZ;
+    cfg.conv_mode = ADC_CONV_SINGLE_UNIT_1;
+    cfg.format = ADC_DIGI_OUTPUT_FORMAT_TYPE1;
+    if (adc_digi_controller_configure(&cfg) != ESP_OK || adc_digi_start() != ESP_OK) {
+      adc_digi_deinitialize();
+      return false;
+    }
+    return true;
+  }
+
+  void drain() {
+    uint32_t sum[FLEX_ADC_CHANNELS] = {0};
+    uint16_t count[FLEX_ADC_CHANNELS] = {0};
+    uint8_t buf[FLEX_ADC_READ_CHUNK];
+
+    for (;;) {
+      uint32_t len = 0;
+      esp_err_t err = adc_digi_read_bytes(buf, sizeof(buf), &len, 0);
+      if (err == ESP_ERR_INVALID_STATE) overruns++;  // data is still valid
+      else if (err != ESP_OK) break;
+      if (len == 0) break;
+
+      const adc_digi_output_data_t* p = (const adc_digi_output_data_t*)buf;
+      for (uint32_t i = 0; i < len / sizeof(*p); ++i) {
+        uint8_t ch = p[i].type1.channel;
+        if (ch > 7 || channelSlot[ch] < 0) continue;
+        sum[channelSlot[ch]] += p[i].type1.data;
+        count[channelSlot[ch]]++;
+      }
+    }
+
+    for (int i = 0; i < FLEX_ADC_CHANNELS; ++i) {
+      if (count[i]) last[i] = (int)((sum[i] + count[i] / 2) / count[i]);
+    }
+  }
+
+  int8_t channelSlot[8] = { -1, -1, -1, -1, -1, -1, -1, -1 };  // ADC1 channel -> flex index
+#endif
+#endif
+
+  int last[FLEX_ADC_CHANNELS];
+  bool running;
+  uint32_t overruns;
+};
@@ -0,0 +1,670 @@
+#pragma once
+#include <Arduino.h>
+
+// Auto-generated by train_knn.py (KD-tree over X_train_q)
+// Node i: dim==0xFF -> leaf rows perm[a .. a+b), else split on dim at
+// split (code <= split goes left = i+1, right child = a)
+#define KNN_INDEX_NUM_SAMPLES 20800
+#define KNN_INDEX_NUM_NODES   3729
+#define KNN_INDEX_LEAF_SIZE   16
+
+static const uint8_t KNN_INDEX_DIM[KNN_INDEX_NUM_NODES] PROGMEM = { 10, 7, 1, 11, 6, 9, 8, 8, 6, 8, 0, 4, 255, 255, 8, 255, 255, 4, 11, 255, 255, 4, 255, 255, 4, 0, 10, 255, 255, 0, 255, 255, 8, 3, 255, 255, 4, 255, 255, 6, 11, 11, 11, 255, 255, 7, 255, 255, 7, 7, 255, 255, 255, 3, 4, 3, 255, 255, 255, 3, 6, 255, 255, 255, 9, 9, 9, 9, 9, 9, 255, 255, 6, 255, 255, 6, 7, 255, 255, 7, 255, 255, 6, 3, 255, 255, 3, 255, 255, 6, 7, 0, 255, 255, 4, 255, 255, 7, 7, 255, 255, 3, 255, 255, 6, 7, 4, 3, 255, 255, 255, 3, 255, 255, 3, 0, 6, 255, 255, 255, 7, 7, 255, 255, 255, 0, 8, 4, 6, 8, 255, 255, 8, 255, 255, 4, 8, 255, 255, 4, 255, 255, 0, 0, 6, 6, 255, 255, 255, 6, 255, 255, 6, 255, 255, 8, 11, 11, 11, 255, 255, 7, 255, 255, 6, 4, 255, 255, 8, 255, 255, 6, 9, 4, 255, 255, 255, 6, 4, 255, 255, 9, 255, 255, 2, 3, 9, 7, 7, 7, 0, 255, 255, 7, 255, 255, 0, 4, 0, 255, 255, 6, 255, 255, 255, 3, 3, 3, 3, 255, 255, 255, 255, 7, 4, 255, 255, 4, 255, 255, 7, 7, 9, 255, 255, 255, 3, 255, 255, 7, 6, 4, 7, 7, 255, 255, 0, 255, 255, 0, 255, 255, 9, 4, 9, 255, 7, 255, 255, 6, 255, 255, 6, 255, 255, 8, 7, 6, 0, 255, 255, 255, 8, 255, 255, 0, 3, 255, 255, 3, 255, 255, 2, 8, 3, 0, 8, 6, 255, 255, 11, 255, 255, 8, 6, 255, 255, 255, 0, 0, 255, 255, 3, 6, 255, 255, 255, 0, 7, 9, 7, 255, 255, 255, 0, 9, 255, 255, 255, 4, 6, 3, 255, 255, 255, 3, 255, 255, 0, 2, 11, 11, 11, 255, 255, 1, 255, 255, 0, 0, 255, 255, 255, 2, 0, 255, 255, 2, 255, 255, 6, 9, 1, 255, 255, 0, 255, 255, 8, 11, 11, 255, 255, 255, 9, 255, 255, 3, 8, 6, 5, 8, 0, 4, 4, 255, 255, 6, 255, 255, 4, 255, 255, 7, 7, 8, 255, 255, 255, 2, 4, 255, 255, 255, 5, 8, 0, 255, 255, 8, 255, 255, 10, 5, 255, 255, 255, 5, 4, 6, 8, 255, 255, 0, 6, 255, 255, 255, 6, 8, 8, 255, 255, 255, 8, 255, 255, 5, 6, 4, 255, 255, 0, 255, 255, 10, 11, 255, 255, 6, 255, 255, 6, 5, 7, 7, 4, 7, 255, 255, 4, 255, 255, 6, 4, 255, 255, 4, 255, 255, 6, 4, 255, 255, 0, 255, 255, 7, 6, 6, 255, 255, 7, 255, 255, 10, 5, 255, 255, 6, 255, 255, 3, 9, 3, 3, 3, 255, 255, 11, 255, 255, 7, 255, 255, 3, 3, 255, 255, 7, 255, 255, 8, 1, 1, 1, 255, 255, 255, 255, 8, 0, 255, 255, 8, 255, 255, 6, 5, 8, 7, 7, 4, 255, 255, 0, 255, 255, 8, 8, 255, 255, 4, 255, 255, 7, 0, 0, 255, 255, 4, 255, 255, 2, 0, 255, 255, 255, 10, 5, 8, 7, 255, 255, 6, 255, 255, 10, 5, 255, 255, 7, 255, 255, 8, 7, 7, 255, 255, 8, 255, 255, 7, 11, 255, 255, 2, 255, 255, 0, 2, 8, 8, 8, 9, 255, 255, 255, 2, 255, 255, 3, 6, 255, 255, 3, 6, 255, 255, 255, 8, 6, 0, 255, 255, 0, 255, 255, 0, 0, 255, 255, 6, 255, 255, 5, 6, 8, 2, 255, 255, 7, 2, 255, 255, 255, 7, 6, 255, 255, 8, 255, 255, 10, 5, 6, 255, 255, 10, 255, 255, 6, 255, 255, 3, 6, 8, 0, 6, 11, 8, 8, 8, 255, 255, 1, 255, 255, 1, 2, 4, 255, 255, 255, 255, 8, 8, 255, 255, 1, 255, 255, 0, 8, 8, 11, 255, 255, 10, 255, 255, 10, 255, 255, 8, 6, 8, 255, 255, 255, 9, 6, 1, 255, 255, 255, 255, 1, 6, 7, 7, 7, 255, 255, 255, 3, 6, 255, 255, 255, 6, 4, 255, 255, 4, 255, 255, 1, 6, 9, 7, 255, 255, 255, 6, 255, 255, 1, 255, 255, 9, 3, 3, 3, 3, 3, 255, 255, 255, 6, 7, 255, 255, 11, 255, 255, 6, 7, 11, 255, 255, 7, 255, 255, 6, 255, 255, 6, 6, 11, 7, 255, 255, 255, 6, 7, 255, 255, 6, 255, 255, 11, 7, 4, 255, 255, 4, 255, 255, 7, 255, 255, 11, 6, 7, 9, 255, 255, 7, 255, 255, 7, 6, 255, 255, 6, 255, 255, 6, 7, 255, 255, 7, 255, 255, 11, 9, 3, 3, 2, 3, 3, 3, 255, 255, 8, 255, 255, 255, 4, 8, 255, 255, 255, 4, 11, 11, 255, 255, 255, 0, 0, 255, 255, 255, 8, 9, 9, 255, 4, 255, 255, 4, 4, 255, 255, 255, 4, 8, 0, 255, 255, 255, 0, 255, 255, 3, 3, 3, 3, 3, 255, 255, 255, 11, 11, 255, 255, 255, 11, 11, 11, 255, 255, 255, 255, 8, 4, 4, 255, 255, 0, 255, 255, 0, 4, 8, 255, 255, 4, 255, 255, 8, 255, 255, 2, 8, 2, 2, 3, 2, 255, 255, 255, 6, 255, 255, 8, 7, 255, 255, 4, 255, 255, 3, 3, 3, 255, 255, 2, 2, 255, 255, 255, 7, 7, 255, 255, 4, 255, 255, 8, 9, 9, 9, 9, 255, 255, 4, 255, 255, 4, 255, 255, 4, 255, 255, 1, 4, 4, 7, 255, 255, 255, 3, 255, 255, 1, 7, 255, 255, 4, 255, 255, 9, 11, 6, 0, 8, 0, 0, 8, 255, 255, 8, 255, 255, 6, 8, 255, 255, 11, 255, 255, 0, 7, 6, 255, 255, 6, 255, 255, 6, 4, 255, 255, 255, 8, 5, 8, 8, 8, 255, 255, 255, 4, 255, 255, 5, 255, 255, 1, 5, 4, 255, 255, 255, 1, 255, 255, 1, 0, 7, 7, 0, 255, 255, 0, 255, 255, 6, 6, 255, 255, 255, 8, 2, 8, 255, 255, 255, 7, 11, 255, 255, 255, 1, 2, 8, 4, 255, 255, 4, 255, 255, 4, 2, 255, 255, 7, 255, 255, 1, 4, 255, 255, 1, 255, 255, 6, 0, 8, 1, 0, 255, 255, 1, 0, 255, 255, 255, 0, 0, 255, 255, 6, 255, 255, 8, 6, 8, 8, 255, 255, 255, 8, 8, 255, 255, 255, 10, 10, 255, 255, 6, 255, 255, 8, 0, 4, 8, 8, 255, 255, 255, 0, 255, 255, 9, 9, 9, 255, 255, 4, 255, 255, 4, 255, 255, 0, 8, 6, 255, 255, 7, 255, 255, 3, 4, 255, 255, 4, 255, 255, 2, 0, 0, 6, 8, 0, 255, 255, 0, 255, 255, 0, 0, 255, 255, 6, 255, 255, 6, 8, 6, 255, 255, 7, 255, 255, 11, 4, 255, 255, 6, 255, 255, 6, 6, 1, 8, 255, 255, 8, 255, 255, 8, 4, 255, 255, 255, 8, 4, 0, 255, 255, 4, 255, 255, 4, 255, 255, 8, 6, 0, 8, 11, 255, 255, 0, 255, 255, 8, 8, 255, 255, 255, 2, 0, 4, 4, 255, 255, 255, 4, 255, 255, 2, 255, 255, 1, 11, 11, 11, 255, 255, 255, 7, 255, 255, 1, 7, 7, 255, 255, 255, 1, 255, 255, 11, 6, 0, 0, 0, 0, 0, 8, 10, 5, 255, 255, 255, 9, 255, 255, 8, 9, 11, 255, 255, 255, 4, 255, 255, 4, 6, 1, 3, 255, 255, 255, 3, 2, 255, 255, 255, 8, 11, 255, 2, 255, 255, 4, 255, 255, 4, 8, 8, 6, 11, 11, 255, 255, 255, 1, 4, 255, 255, 255, 4, 4, 255, 255, 255, 6, 5, 6, 8, 255, 255, 255, 255, 2, 2, 255, 255, 255, 8, 9, 2, 1, 255, 255, 6, 255, 255, 6, 255, 255, 6, 11, 255, 255, 8, 255, 255, 4, 8, 2, 6, 6, 2, 255, 255, 4, 255, 255, 1, 3, 255, 255, 4, 255, 255, 6, 6, 6, 255, 255, 2, 255, 255, 1, 255, 255, 9, 4, 4, 6, 255, 255, 6, 255, 255, 2, 3, 255, 255, 3, 255, 255, 4, 6, 255, 255, 2, 255, 255, 8, 2, 4, 6, 255, 255, 4, 255, 255, 9, 1, 255, 255, 255, 2, 3, 3, 3, 255, 255, 255, 8, 255, 255, 2, 10, 255, 255, 1, 255, 255, 4, 6, 6, 6, 6, 6, 6, 255, 255, 8, 255, 255, 8, 2, 255, 255, 3, 255, 255, 8, 3, 3, 255, 255, 8, 255, 255, 2, 2, 255, 255, 10, 255, 255, 8, 2, 3, 2, 255, 255, 2, 255, 255, 8, 8, 255, 255, 255, 2, 2, 255, 255, 255, 9, 8, 3, 8, 0, 255, 255, 2, 255, 255, 2, 8, 255, 255, 8, 255, 255, 11, 11, 255, 0, 255, 255, 0, 2, 255, 255, 4, 255, 255, 3, 8, 3, 255, 255, 2, 255, 255, 8, 2, 255, 255, 255, 4, 8, 2, 11, 11, 11, 255, 255, 2, 255, 255, 1, 255, 255, 8, 0, 255, 255, 6, 0, 255, 255, 255, 2, 6, 8, 6, 255, 255, 6, 255, 255, 0, 7, 255, 255, 255, 2, 6, 255, 255, 6, 255, 255, 4, 8, 2, 3, 2, 255, 255, 6, 255, 255, 6, 8, 255, 255, 9, 255, 255, 2, 2, 255, 255, 0, 255, 255, 4, 8, 2, 255, 255, 255, 4, 8, 255, 255, 255, 0, 0, 0, 0, 8, 0, 8, 6, 255, 255, 255, 11, 11, 255, 255, 255, 0, 6, 2, 255, 255, 255, 11, 9, 255, 255, 255, 4, 11, 8, 11, 255, 255, 255, 4, 6, 255, 255, 255, 8, 0, 255, 255, 0, 11, 255, 255, 255, 4, 8, 6, 1, 11, 255, 255, 255, 8, 8, 255, 255, 255, 6, 8, 255, 255, 9, 255, 255, 9, 11, 11, 11, 255, 255, 8, 255, 255, 10, 255, 6, 6, 255, 255, 255, 8, 6, 255, 255, 255, 10, 10, 10, 10, 10, 10, 255, 255, 255, 6, 255, 255, 11, 11, 255, 255, 4, 255, 255, 4, 4, 6, 0, 255, 255, 255, 8, 255, 255, 8, 2, 9, 255, 255, 255, 2, 255, 255, 4, 4, 6, 3, 1, 255, 255, 255, 6, 0, 255, 255, 255, 8, 6, 255, 255, 2, 255, 255, 11, 11, 11, 11, 255, 255, 6, 255, 255, 8, 255, 255, 6, 8, 255, 255, 2, 255, 255, 11, 11, 11, 11, 11, 11, 11, 9, 255, 255, 6, 255, 255, 4, 9, 255, 255, 8, 255, 255, 10, 10, 10, 255, 255, 255, 4, 4, 255, 255, 255, 9, 4, 6, 1, 255, 255, 255, 6, 255, 255, 4, 4, 4, 255, 255, 255, 6, 255, 255, 4, 4, 4, 2, 255, 255, 6, 255, 255, 8, 6, 255, 255, 6, 255, 255, 2, 8, 6, 255, 255, 255, 1, 255, 255, 4, 10, 10, 255, 4, 255, 255, 4, 4, 4, 255, 255, 255, 6, 255, 255, 8, 2, 6, 1, 255, 255, 6, 255, 255, 1, 255, 255, 2, 2, 255, 255, 6, 255, 255, 4, 1, 1, 6, 4, 255, 255, 1, 1, 255, 255, 255, 6, 255, 255, 4, 4, 6, 255, 255, 6, 255, 255, 6, 8, 255, 255, 6, 255, 255, 6, 8, 8, 8, 255, 255, 255, 2, 2, 255, 255, 255, 1, 8, 2, 255, 255, 255, 6, 255, 255, 0, 9, 0, 7, 0, 11, 0, 0, 6, 255, 255, 6, 255, 255, 4, 6, 255, 255, 6, 255, 255, 11, 0, 255, 255, 11, 255, 255, 6, 9, 9, 9, 255, 255, 255, 4, 255, 255, 11, 8, 4, 255, 255, 8, 255, 255, 11, 255, 255, 0, 7, 0, 0, 11, 255, 255, 8, 255, 255, 4, 6, 255, 255, 6, 255, 255, 6, 10, 255, 255, 7, 255, 255, 6, 11, 1, 8, 255, 255, 255, 11, 255, 255, 9, 9, 9, 255, 255, 6, 255, 255, 255, 4, 6, 11, 4, 4, 8, 255, 255, 8, 255, 255, 2, 8, 255, 255, 255, 8, 11, 255, 255, 11, 8, 255, 255, 255, 6, 8, 11, 2, 255, 255, 11, 255, 255, 5, 8, 255, 255, 255, 6, 2, 3, 255, 255, 255, 6, 4, 8, 255, 255, 255, 255, 6, 8, 9, 9, 9, 255, 255, 255, 4, 255, 255, 3, 3, 255, 255, 8, 255, 255, 10, 10, 10, 10, 255, 255, 255, 8, 2, 255, 255, 255, 2, 255, 255, 0, 0, 0, 6, 0, 8, 255, 255, 255, 8, 255, 255, 4, 6, 255, 255, 6, 255, 255, 6, 4, 6, 8, 255, 255, 255, 9, 8, 255, 255, 255, 4, 8, 6, 255, 255, 8, 255, 255, 8, 255, 255, 4, 6, 8, 4, 4, 255, 255, 2, 255, 255, 3, 2, 255, 255, 255, 6, 8, 2, 255, 255, 255, 11, 6, 255, 255, 255, 8, 6, 4, 255, 255, 2, 255, 255, 6, 2, 255, 255, 9, 255, 255, 6, 10, 10, 10, 10, 10, 10, 10, 255, 255, 8, 255, 255, 8, 3, 255, 255, 4, 255, 255, 8, 8, 3, 255, 255, 3, 255, 255, 2, 3, 255, 255, 9, 255, 255, 4, 8, 3, 255, 255, 4, 255, 255, 8, 2, 255, 255, 6, 255, 255, 8, 11, 3, 2, 4, 255, 255, 255, 6, 8, 255, 255, 255, 11, 2, 255, 255, 255, 2, 6, 9, 255, 255, 2, 255, 255, 1, 1, 1, 255, 255, 255, 3, 255, 255, 8, 3, 6, 3, 2, 255, 255, 2, 255, 255, 2, 4, 255, 255, 255, 6, 9, 9, 255, 255, 255, 2, 255, 255, 3, 2, 4, 3, 255, 255, 255, 1, 1, 255, 255, 6, 255, 255, 2, 4, 1, 255, 255, 255, 1, 1, 255, 255, 255, 10, 10, 10, 10, 10, 10, 9, 255, 255, 9, 255, 255, 11, 255, 255, 9, 4, 4, 255, 255, 255, 4, 255, 255, 4, 6, 8, 255, 255, 4, 255, 255, 2, 9, 2, 255, 255, 6, 255, 255, 6, 255, 255, 4, 4, 4, 4, 255, 255, 1, 255, 255, 1, 11, 6, 255, 255, 255, 1, 255, 255, 1, 8, 2, 255, 255, 2, 255, 255, 6, 9, 255, 255, 8, 255, 255, 4, 4, 8, 4, 4, 255, 255, 6, 255, 255, 4, 4, 255, 255, 1, 255, 255, 6, 1, 8, 255, 255, 255, 8, 6, 255, 255, 255, 8, 1, 6, 6, 255, 255, 4, 255, 255, 2, 2, 255, 255, 1, 255, 255, 11, 2, 6, 255, 255, 6, 255, 255, 11, 2, 255, 255, 255, 1, 4, 6, 11, 8, 10, 6, 11, 7, 11, 255, 255, 3, 255, 255, 0, 8, 255, 255, 255, 8, 0, 11, 255, 255, 255, 0, 4, 255, 255, 2, 255, 255, 10, 8, 6, 255, 255, 6, 255, 255, 10, 4, 255, 255, 6, 255, 255, 10, 7, 0, 6, 7, 255, 255, 255, 11, 11, 255, 255, 8, 255, 255, 6, 2, 3, 255, 255, 3, 255, 255, 7, 255, 255, 10, 7, 0, 255, 255, 6, 255, 255, 10, 7, 255, 255, 10, 255, 255, 0, 8, 9, 3, 3, 3, 255, 255, 8, 255, 255, 10, 6, 255, 255, 255, 6, 9, 255, 255, 8, 255, 255, 9, 7, 7, 8, 255, 255, 255, 3, 4, 255, 255, 255, 0, 0, 255, 255, 6, 255, 255, 8, 9, 6, 11, 8, 255, 255, 255, 8, 255, 255, 11, 7, 8, 255, 255, 255, 11, 255, 255, 6, 11, 2, 6, 255, 255, 255, 11, 255, 255, 5, 3, 255, 255, 9, 255, 255, 2, 9, 7, 9, 9, 9, 255, 255, 4, 4, 255, 255, 255, 6, 7, 255, 255, 6, 255, 255, 8, 11, 6, 0, 255, 255, 255, 0, 255, 255, 0, 0, 0, 255, 255, 6, 255, 255, 3, 255, 255, 0, 7, 9, 7, 255, 255, 5, 255, 255, 0, 0, 255, 255, 5, 255, 255, 8, 10, 6, 3, 255, 255, 255, 10, 255, 255, 11, 4, 255, 255, 5, 255, 255, 9, 0, 2, 8, 11, 6, 255, 255, 6, 255, 255, 6, 0, 255, 255, 8, 255, 255, 2, 8, 11, 255, 255, 6, 255, 255, 2, 8, 255, 255, 255, 8, 6, 11, 6, 255, 255, 0, 255, 255, 0, 6, 255, 255, 0, 255, 255, 11, 9, 9, 255, 255, 7, 255, 255, 10, 8, 255, 255, 255, 1, 1, 1, 1, 255, 10, 255, 255, 0, 255, 255, 10, 0, 255, 255, 255, 11, 0, 8, 255, 255, 10, 255, 255, 0, 255, 255, 3, 6, 0, 0, 0, 0, 0, 0, 255, 255, 8, 255, 255, 9, 8, 255, 255, 255, 8, 8, 255, 255, 2, 255, 255, 11, 8, 4, 8, 255, 255, 255, 9, 6, 255, 255, 255, 8, 11, 4, 255, 255, 255, 6, 255, 255, 11, 8, 6, 6, 6, 255, 255, 8, 255, 255, 8, 255, 255, 7, 6, 7, 255, 255, 255, 9, 255, 255, 8, 6, 9, 255, 255, 8, 255, 255, 7, 8, 255, 255, 6, 255, 255, 11, 0, 9, 8, 6, 6, 255, 255, 1, 255, 255, 7, 7, 255, 255, 2, 255, 255, 0, 0, 0, 255, 255, 255, 11, 255, 255, 3, 3, 3, 3, 255, 255, 8, 255, 255, 9, 255, 255, 8, 8, 11, 255, 255, 255, 7, 4, 255, 255, 255, 8, 0, 6, 9, 255, 255, 8, 255, 255, 9, 6, 255, 255, 6, 255, 255, 9, 3, 3, 255, 255, 7, 255, 255, 6, 9, 255, 255, 11, 255, 255, 11, 6, 8, 8, 2, 9, 6, 255, 255, 255, 8, 0, 255, 255, 255, 6, 11, 11, 255, 255, 255, 10, 3, 255, 255, 255, 0, 0, 0, 0, 255, 255, 255, 7, 6, 255, 255, 8, 255, 255, 7, 6, 255, 255, 11, 255, 255, 0, 0, 8, 0, 9, 255, 255, 6, 255, 255, 0, 0, 255, 255, 255, 8, 6, 8, 255, 255, 11, 255, 255, 7, 3, 255, 255, 255, 10, 8, 6, 6, 255, 255, 255, 6, 255, 255, 10, 8, 6, 255, 255, 6, 255, 255, 10, 255, 255, 0, 6, 0, 0, 0, 0, 255, 255, 255, 8, 255, 255, 8, 11, 255, 255, 6, 255, 255, 0, 0, 0, 255, 255, 9, 255, 255, 8, 6, 255, 255, 2, 255, 255, 6, 8, 6, 2, 255, 255, 8, 255, 255, 6, 7, 255, 255, 7, 255, 255, 4, 11, 8, 255, 255, 11, 255, 255, 4, 8, 255, 255, 255, 11, 2, 8, 0, 0, 6, 0, 0, 9, 255, 255, 0, 255, 255, 8, 9, 255, 255, 11, 255, 255, 0, 5, 0, 255, 255, 5, 255, 255, 4, 4, 255, 255, 0, 255, 255, 6, 6, 6, 8, 255, 255, 8, 255, 255, 4, 8, 255, 255, 11, 255, 255, 4, 4, 4, 255, 255, 255, 10, 255, 255, 6, 6, 6, 9, 8, 255, 255, 11, 255, 255, 0, 8, 255, 255, 11, 255, 255, 8, 9, 0, 255, 255, 8, 255, 255, 11, 11, 255, 255, 255, 4, 4, 6, 3, 255, 255, 255, 8, 255, 255, 11, 11, 11, 255, 255, 255, 5, 6, 255, 255, 255, 0, 6, 0, 0, 0, 0, 255, 255, 4, 255, 255, 10, 4, 255, 255, 255, 7, 4, 7, 255, 255, 4, 255, 255, 8, 4, 255, 255, 255, 0, 0, 0, 0, 255, 255, 4, 255, 255, 7, 6, 255, 255, 255, 4, 6, 8, 255, 255, 8, 255, 255, 4, 6, 255, 255, 255, 6, 7, 11, 11, 6, 255, 255, 7, 255, 255, 6, 255, 255, 6, 6, 7, 255, 255, 255, 4, 7, 255, 255, 255, 2, 2, 2, 2, 255, 255, 255, 8, 8, 255, 255, 255, 9, 9, 9, 255, 255, 255, 4, 255, 255, 8, 0, 0, 0, 6, 0, 0, 255, 255, 8, 255, 255, 0, 0, 255, 255, 255, 6, 8, 7, 255, 255, 0, 255, 255, 4, 255, 255, 6, 11, 11, 11, 255, 255, 8, 255, 255, 4, 255, 255, 4, 6, 8, 255, 255, 4, 255, 255, 9, 255, 255, 6, 11, 11, 11, 9, 255, 255, 8, 255, 255, 8, 4, 255, 255, 255, 8, 8, 255, 255, 6, 255, 255, 11, 11, 11, 4, 255, 255, 255, 4, 4, 255, 255, 255, 4, 4, 255, 255, 6, 255, 255, 0, 6, 0, 0, 0, 0, 255, 255, 255, 9, 11, 255, 255, 255, 6, 8, 255, 255, 4, 4, 255, 255, 255, 0, 0, 0, 0, 255, 255, 7, 255, 255, 8, 4, 255, 255, 255, 2, 4, 255, 255, 2, 4, 255, 255, 255, 6, 1, 5, 6, 6, 255, 255, 255, 10, 255, 255, 1, 6, 6, 255, 255, 255, 1, 255, 255, 9, 6, 4, 7, 255, 255, 255, 4, 4, 255, 255, 255, 4, 6, 255, 255, 6, 255, 255, 0, 6, 0, 5, 8, 0, 0, 8, 255, 255, 255, 6, 4, 255, 255, 255, 0, 0, 0, 255, 255, 255, 4, 255, 255, 5, 8, 6, 255, 255, 0, 255, 255, 10, 255, 255, 7, 8, 11, 3, 255, 255, 11, 255, 255, 7, 8, 255, 255, 9, 255, 255, 4, 8, 4, 255, 255, 4, 255, 255, 9, 0, 255, 255, 8, 255, 255, 0, 8, 0, 0, 9, 255, 255, 8, 255, 255, 8, 8, 255, 255, 4, 255, 255, 0, 0, 0, 255, 255, 4, 255, 255, 1, 7, 255, 255, 1, 255, 255, 9, 4, 8, 9, 255, 255, 6, 255, 255, 6, 8, 255, 255, 11, 8, 255, 255, 255, 8, 4, 9, 255, 255, 6, 255, 255, 4, 255, 255, 6, 8, 6, 11, 4, 8, 255, 255, 8, 255, 255, 11, 9, 255, 255, 11, 255, 255, 9, 11, 8, 255, 255, 11, 255, 255, 3, 11, 255, 255, 255, 10, 1, 7, 6, 255, 255, 6, 2, 255, 255, 255, 1, 7, 255, 255, 1, 255, 255, 1, 10, 255, 255, 1, 255, 255, 9, 2, 2, 2, 2, 255, 255, 8, 255, 255, 8, 4, 255, 255, 9, 255, 255, 4, 8, 4, 255, 255, 1, 255, 255, 11, 6, 255, 255, 11, 255, 255, 7, 8, 4, 9, 255, 255, 255, 7, 11, 255, 255, 255, 4, 4, 4, 255, 255, 6, 255, 255, 11, 255, 255 };
+
+static const int8_t KNN_INDEX_SPLIT[KNN_INDEX_NUM_NODES] PROGMEM = { 0, 10, -8, 0, 7, 0, 7, -20, -43, -38, -2, -3, 0, 0, -46, 0, 0, -21, -4, 0, 0, -18, 0, 0, 2, -6, -1, 0, 0, 2, 0, 0, -46, 0, 0, 0, 8, 0, 0, -46, -2, -4, -8, 0, 0, -26, 0, 0, -4, -45, 0, 0, 0, 8, 10, 1, 0, 0, 0, 14, -40, 0, 0, 0, -1, -2, -3, -6, -10, -21, 0, 0, -41, 0, 0, -44, -50, 0, 0, -34, 0, 0, -51, 10, 0, 0, 8, 0, 0, -44, -37, 18, 0, 0, 24, 0, 0, -7, -38, 0, 0, 4, 0, 0, -33, -29, -3, 9, 0, 0, 0, 7, 0, 0, 1, -11, -7, 0, 0, 0, 5, 3, 0, 0, 0, 2, 4, 5, -41, -38, 0, 0, -45, 0, 0, 14, -52, 0, 0, 22, 0, 0, -2, -7, -7, -31, 0, 0, 0, -33, 0, 0, -46, 0, 0, 9, -5, -10, -26, 0, 0, -29, 0, 0, -70, -3, 0, 0, -19, 0, 0, -69, 2, -3, 0, 0, 0, -25, -22, 0, 0, 2, 0, 0, -15, -17, 0, -62, -70, -105, -11, 0, 0, -104, 0, 0, -6, -30, -16, 0, 0, 25, 0, 0, 0, -27, -30, -32, -64, 0, 0, 0, 0, -47, 9, 0, 0, 10, 0, 0, -48, -65, 3, 0, 0, 0, -29, 0, 0, -49, 13, 21, -50, -60, 0, 0, 3, 0, 0, 3, 0, 0, 0, -24, -1, 0, -70, 0, 0, 23, 0, 0, 15, 0, 0, 53, -37, 23, 4, 0, 0, 0, 41, 0, 0, 2, 3, 0, 0, 4, 0, 0, 15, 40, -1, -20, 18, 30, 0, 0, -1, 0, 0, 11, 50, 0, 0, 0, 7, -24, 0, 0, 5, 52, 0, 0, 0, 2, -25, 0, -67, 0, 0, 0, -42, 0, 0, 0, 0, -5, 27, 3, 0, 0, 0, 3, 0, 0, -20, 21, -2, -3, -7, 0, 0, -13, 0, 0, -22, -23, 0, 0, 0, 23, -26, 0, 0, 25, 0, 0, 26, 0, -13, 0, 0, -16, 0, 0, 10, -2, -3, 0, 0, 0, 1, 0, 0, 1, 17, -35, -2, -31, -6, 1, -5, 0, 0, -44, 0, 0, -6, 0, 0, -2, -16, -26, 0, 0, 0, -17, -21, 0, 0, 0, 0, -44, -6, 0, 0, -31, 0, 0, -6, 14, 0, 0, 0, -3, 9, -28, -53, 0, 0, 16, 36, 0, 0, 0, 24, 11, 7, 0, 0, 0, 15, 0, 0, 2, 27, 2, 0, 0, -18, 0, 0, -11, 21, 0, 0, -9, 0, 0, 18, -3, -30, -49, -26, -68, 0, 0, 20, 0, 0, -15, -23, 0, 0, -23, 0, 0, -7, -23, 0, 0, -15, 0, 0, -31, 12, 6, 0, 0, -49, 0, 0, -2, 0, 0, 0, -6, 0, 0, -15, 0, -18, -21, -29, 0, 0, 1, 0, 0, -49, 0, 0, -22, -34, 0, 0, -47, 0, 0, 30, -13, -14, -15, 0, 0, 0, 0, 50, -41, 0, 0, 54, 0, 0, -34, -3, 9, -4, -46, -1, 0, 0, 1, 0, 0, 0, -36, 0, 0, 25, 0, 0, -45, 17, 16, 0, 0, -3, 0, 0, -22, 19, 0, 0, 0, -2, 0, 7, -39, 0, 0, -74, 0, 0, -7, 17, 0, 0, -46, 0, 0, 7, -2, -42, 0, 0, -11, 0, 0, -55, 6, 0, 0, -22, 0, 0, 2, -19, 47, 8, 6, 1, 0, 0, 0, -22, 0, 0, 6, 9, 0, 0, 9, -18, 0, 0, 0, 23, 26, -10, 0, 0, -25, 0, 0, -24, -27, 0, 0, -5, 0, 0, -2, 10, 31, -18, 0, 0, -48, -21, 0, 0, 0, -32, 12, 0, 0, 24, 0, 0, -3, 3, 24, 0, 0, -16, 0, 0, 24, 0, 0, -2, 30, 32, 14, -49, 0, 30, 28, -44, 0, 0, 17, 0, 0, 17, -5, -35, 0, 0, 0, 0, 29, 7, 0, 0, 18, 0, 0, -21, 18, -4, -2, 0, 0, -1, 0, 0, -2, 0, 0, 17, -34, -42, 0, 0, 0, 0, -48, 17, 0, 0, 0, 0, 18, -49, -34, -37, -38, 0, 0, 0, -10, -51, 0, 0, 0, -5, 6, 0, 0, 5, 0, 0, 21, -51, -1, -36, 0, 0, 0, -48, 0, 0, 23, 0, 0, 0, -9, -13, -14, -15, -16, 0, 0, 0, -48, -68, 0, 0, 1, 0, 0, -48, -67, 1, 0, 0, -60, 0, 0, -44, 0, 0, 8, -51, 1, -66, 0, 0, 0, -45, -65, 0, 0, 6, 0, 0, 0, -15, -38, 0, 0, -42, 0, 0, -18, 0, 0, 0, -45, -66, 2, 0, 0, -62, 0, 0, -62, -42, 0, 0, 15, 0, 0, -47, -68, 0, 0, -26, 0, 0, 0, 0, -7, -19, -17, -21, -22, -24, 0, 0, 16, 0, 0, 0, -45, 9, 0, 0, 0, -6, -1, -3, 0, 0, 0, 16, 14, 0, 0, 0, -5, -1, -2, 0, -3, 0, 0, -3, -40, 0, 0, 0, -5, 31, 21, 0, 0, 0, 16, 0, 0, -19, -21, -22, -23, -24, 0, 0, 0, -6, -8, 0, 0, 0, -4, -7, -9, 0, 0, 0, 0, -2, -3, -8, 0, 0, 17, 0, 0, 20, -42, 18, 0, 0, -38, 0, 0, 33, 0, 0, 5, 20, -17, -18, -22, -19, 0, 0, 0, 52, 0, 0, 1, 5, 0, 0, -43, 0, 0, -21, -22, -23, 0, 0, -17, -18, 0, 0, 0, -16, -23, 0, 0, -47, 0, 0, -3, 0, -1, -2, -3, 0, 0, -3, 0, 0, -3, 0, 0, -3, 0, 0, 15, -13, -40, -17, 0, 0, 0, -6, 0, 0, 17, -16, 0, 0, -40, 0, 0, 0, 0, 28, 15, 8, -19, -46, -66, 0, 0, -51, 0, 0, -51, -51, 0, 0, -3, 0, 0, -26, -26, -24, 0, 0, -7, 0, 0, -12, 18, 0, 0, 0, 16, -3, 15, 14, 8, 0, 0, 0, 7, 0, 0, 2, 0, 0, 16, -3, -40, 0, 0, 0, 18, 0, 0, 9, -23, -12, -23, -39, 0, 0, -24, 0, 0, 61, 50, 0, 0, 0, 6, 14, -7, 0, 0, 0, -12, -3, 0, 0, 0, 16, 13, -5, -40, 0, 0, -36, 0, 0, 5, 16, 0, 0, 7, 0, 0, 18, -39, 0, 0, 20, 0, 0, 29, 15, 4, 17, -21, 0, 0, 29, -44, 0, 0, 0, -27, -42, 0, 0, -1, 0, 0, 15, -19, 8, -15, 0, 0, 0, 14, 11, 0, 0, 0, -1, -2, 0, 0, -4, 0, 0, 2, 23, -3, -5, -7, 0, 0, 0, 16, 0, 0, -1, -2, -3, 0, 0, 8, 0, 0, 8, 0, 0, -24, 27, 49, 0, 0, -24, 0, 0, 10, -39, 0, 0, 9, 0, 0, 15, 17, -9, -24, -21, -16, 0, 0, -46, 0, 0, -30, -50, 0, 0, 0, 0, 0, -12, 3, -40, 0, 0, 1, 0, 0, 0, 15, 0, 0, 34, 0, 0, 39, 17, 15, 8, 0, 0, 26, 0, 0, 34, -39, 0, 0, 0, -5, -39, 22, 0, 0, 10, 0, 0, 10, 0, 0, 18, 26, 22, -4, 1, 0, 0, 21, 0, 0, 16, 15, 0, 0, 0, 20, 15, 8, 6, 0, 0, 0, 4, 0, 0, 22, 0, 0, 3, -1, -3, -6, 0, 0, 0, -26, 0, 0, 6, -11, -13, 0, 0, 0, 8, 0, 0, 0, -1, 1, -20, -28, -36, -75, -26, -1, -2, 0, 0, 0, -3, 0, 0, -21, 1, -4, 0, 0, 0, 13, 0, 0, -32, -13, 6, -2, 0, 0, 0, -1, -10, 0, 0, 0, -34, -1, 0, 19, 0, 0, -11, 0, 0, 5, -7, -34, -11, -1, -2, 0, 0, 0, 5, 4, 0, 0, 0, 4, 3, 0, 0, 0, -15, -3, -18, 4, 0, 0, 0, 0, -10, -11, 0, 0, 0, -35, 0, 18, 12, 0, 0, -9, 0, 0, -11, 0, 0, -11, -2, 0, 0, -8, 0, 0, 11, -34, 2, -16, -24, -21, 0, 0, 7, 0, 0, -1, -16, 0, 0, 5, 0, 0, -7, -10, -12, 0, 0, 8, 0, 0, 9, 0, 0, 0, 9, 5, -13, 0, 0, -21, 0, 0, -20, 5, 0, 0, -18, 0, 0, 10, -18, 0, 0, -19, 0, 0, -17, -16, 13, -16, 0, 0, 15, 0, 0, 0, -12, 0, 0, 0, -19, 6, 3, -17, 0, 0, 0, -5, 0, 0, 9, -1, 0, 0, -12, 0, 0, 11, -16, -18, -21, -26, -31, -34, 0, 0, -13, 0, 0, -16, 11, 0, 0, 3, 0, 0, -16, 4, 2, 0, 0, -17, 0, 0, 11, -16, 0, 0, -1, 0, 0, -15, 13, 3, -14, 0, 0, 12, 0, 0, -16, -17, 0, 0, 0, 13, 12, 0, 0, 0, 0, 4, 5, -17, 19, 0, 0, -16, 0, 0, 12, -20, 0, 0, -24, 0, 0, -1, -2, 0, 23, 0, 0, 23, 18, 0, 0, 4, 0, 0, 6, -7, 2, 0, 0, -18, 0, 0, -2, 9, 0, 0, 0, 16, -11, 11, -1, -2, -3, 0, 0, -16, 0, 0, -12, 0, 0, -20, 27, 0, 0, -18, 14, 0, 0, 0, -17, -11, -2, -14, 0, 0, -20, 0, 0, 9, 20, 0, 0, 0, 9, -8, 0, 0, -8, 0, 0, 19, -14, 14, 12, 11, 0, 0, -23, 0, 0, -17, -16, 0, 0, 0, 0, 0, 14, -9, 0, 0, 15, 0, 0, 21, -15, 14, 0, 0, 0, 24, -14, 0, 0, 0, 13, -18, -28, -66, -9, -101, -25, 10, 0, 0, 0, -3, -5, 0, 0, 0, -94, 14, 10, 0, 0, 0, -2, -1, 0, 0, 0, 11, -3, -14, -9, 0, 0, 0, -32, 12, 0, 0, 0, -7, -48, 0, 0, -48, -1, 0, 0, 0, 5, -17, 38, -16, -7, 0, 0, 0, -19, -20, 0, 0, 0, 36, -13, 0, 0, 0, 0, 0, 0, -1, -2, -5, 0, 0, -17, 0, 0, -1, 0, 38, 37, 0, 0, 0, -17, 37, 0, 0, 0, -1, -2, -3, -5, -9, -15, 0, 0, 0, 20, 0, 0, -4, -6, 0, 0, 12, 0, 0, 9, -13, 11, -2, 0, 0, 0, -18, 0, 0, -15, -15, 0, 0, 0, 0, -11, 0, 0, 8, -19, 11, -18, -10, 0, 0, 0, 13, 1, 0, 0, 0, -9, 12, 0, 0, 6, 0, 0, -2, -3, -5, -7, 0, 0, 23, 0, 0, -19, 0, 0, 19, -4, 0, 0, 14, 0, 0, -1, -2, -3, -5, -8, -17, -28, 4, 0, 0, 16, 0, 0, 7, 0, 0, 0, -15, 0, 0, -2, -4, -6, 0, 0, 0, 10, 7, 0, 0, 0, -1, 8, 27, 10, 0, 0, 0, 16, 0, 0, 10, 3, -4, 0, 0, 0, 11, 0, 0, 10, 6, -3, 13, 0, 0, 16, 0, 0, -11, 16, 0, 0, 15, 0, 0, 10, -15, 9, 0, 0, 0, 13, 0, 0, 8, -1, -2, 0, 0, 0, 0, 3, -3, -6, 0, 0, 0, 12, 0, 0, -13, 10, 8, 11, 0, 0, 13, 0, 0, 17, 0, 0, 11, 8, 0, 0, 11, 0, 0, 9, 9, -12, 27, -3, 0, 0, -13, -14, 0, 0, 0, 30, 0, 0, 5, 3, 16, 0, 0, 1, 0, 0, 15, -1, 0, 0, 16, 0, 0, 13, -15, -19, -21, 0, 0, 0, 10, -11, 0, 0, 0, 9, -12, 10, 0, 0, 0, 17, 0, 0, 8, 0, -15, 17, -27, 3, -44, -85, 3, 0, 0, 2, 0, 0, -31, -14, 0, 0, -1, 0, 0, 6, -55, 0, 0, 12, 0, 0, 24, -1, -2, -3, 0, 0, 0, 5, 0, 0, 2, -16, 9, 0, 0, -4, 0, 0, 6, 0, 0, -28, 21, -76, -104, 3, 0, 0, -30, 0, 0, 10, -5, 0, 0, 5, 0, 0, 4, -1, 0, 0, 23, 0, 0, -9, 2, 6, -33, 0, 0, 0, 4, 0, 0, -1, -2, -3, 0, 0, -7, 0, 0, 0, 11, -11, 3, 9, 7, -15, 0, 0, -14, 0, 0, -18, -3, 0, 0, 0, -40, 6, 0, 0, 6, -11, 0, 0, 0, 6, -33, 2, 6, 0, 0, 5, 0, 0, -3, -4, 0, 0, 0, 10, -17, -19, 0, 0, 0, 14, -19, -1, 0, 0, 0, 0, -15, -13, -1, -2, -3, 0, 0, 0, 14, 0, 0, 6, 1, 0, 0, 1, 0, 0, -1, -2, -4, -7, 0, 0, 0, -5, -17, 0, 0, 0, -17, 0, 0, -18, -30, -68, 4, -99, -17, 0, 0, 0, -4, 0, 0, 13, -10, 0, 0, -2, 0, 0, 12, 5, -10, -32, 0, 0, 0, 2, -28, 0, 0, 0, 2, -16, 41, 0, 0, -10, 0, 0, -14, 0, 0, 11, -16, -19, 4, -4, 0, 0, -16, 0, 0, 6, -22, 0, 0, 0, -3, -32, -15, 0, 0, 0, 3, 15, 0, 0, 0, -11, -19, 16, 0, 0, -14, 0, 0, -10, -20, 0, 0, 2, 0, 0, 7, -1, -2, -3, -6, -10, -14, -19, 0, 0, -16, 0, 0, -21, 9, 0, 0, 8, 0, 0, -12, -23, 10, 0, 0, 10, 0, 0, -15, 7, 0, 0, -2, 0, 0, 11, -13, 8, 0, 0, 7, 0, 0, -11, 14, 0, 0, -10, 0, 0, -11, 2, 12, 13, 12, 0, 0, 0, -13, -18, 0, 0, 0, 5, 15, 0, 0, 0, 11, -12, 0, 0, 0, -16, 0, 0, 13, 12, 11, 0, 0, 0, 9, 0, 0, -13, 11, -16, 5, 11, 0, 0, 13, 0, 0, 12, 12, 0, 0, 0, -13, 0, -1, 0, 0, 0, 14, 0, 0, 9, -6, 13, 5, 0, 0, 0, 10, 2, 0, 0, -3, 0, 0, 15, 15, 10, 0, 0, 0, 13, 12, 0, 0, 0, -1, -2, -4, -7, -12, -24, -6, 0, 0, -11, 0, 0, 11, 0, 0, -1, 10, 1, 0, 0, 0, 10, 0, 0, 9, 17, 0, 0, 0, 0, 0, 0, 9, 0, -1, 0, 0, 28, 0, 0, 17, 0, 0, 10, 5, -5, -39, 0, 0, 10, 0, 0, 10, 3, 17, 0, 0, 0, 15, 0, 0, 4, -18, -15, 0, 0, -14, 0, 0, 15, 0, 0, 0, -12, 0, 0, 9, 3, -8, -12, -43, 0, 0, 30, 0, 0, 0, -6, 0, 0, 10, 0, 0, 17, 14, -3, 0, 0, 0, -10, 31, 0, 0, 0, -14, -1, 33, 31, 0, 0, 22, 0, 0, 9, 8, 0, 0, 12, 0, 0, 2, 9, 17, 0, 0, 19, 0, 0, 4, 8, 0, 0, 0, 1, 8, -6, -1, -6, 2, -35, -3, 4, -6, 0, 0, -2, 0, 0, -2, -47, 0, 0, 0, -37, -6, -3, 0, 0, 0, -1, 4, 0, 0, 5, 0, 0, 7, -45, -35, 0, 0, -35, 0, 0, 16, -5, 0, 0, -29, 0, 0, 2, -40, 20, -77, -55, 0, 0, 0, -4, -7, 0, 0, 12, 0, 0, -47, -18, 8, 0, 0, -30, 0, 0, 6, 0, 0, 6, -47, 18, 0, 0, -61, 0, 0, 14, -40, 0, 0, 22, 0, 0, 16, -17, 1, 0, -5, -10, 0, 0, -46, 0, 0, 2, -43, 0, 0, 0, -50, 3, 0, 0, -40, 0, 0, 1, 5, -52, 11, 0, 0, 0, 3, 5, 0, 0, 0, 2, -2, 0, 0, -73, 0, 0, 5, -1, -53, 5, -8, 0, 0, 0, -26, 0, 0, 4, -16, -8, 0, 0, 0, 8, 0, 0, -74, 3, -19, -79, 0, 0, 0, 6, 0, 0, -1, 10, 0, 0, 4, 0, 0, 11, 0, -39, -2, -8, -25, 0, 0, -23, -26, 0, 0, 0, 20, -67, 0, 0, 26, 0, 0, 14, 0, 11, 17, 0, 0, 0, -2, 0, 0, 22, 18, -6, 0, 0, 26, 0, 0, -30, 0, 0, 1, -60, 5, -68, 0, 0, 5, 0, 0, -7, -24, 0, 0, 1, 0, 0, 28, 5, 30, 3, 0, 0, 0, 16, 0, 0, -1, -22, 0, 0, 4, 0, 0, 1, -19, 16, -14, 3, 31, 0, 0, 34, 0, 0, 31, -24, 0, 0, -2, 0, 0, 20, -2, -1, 0, 0, 51, 0, 0, 22, 9, 0, 0, 0, -6, 28, 1, 21, 0, 0, 24, 0, 0, -16, 44, 0, 0, 11, 0, 0, 0, -1, -2, 0, 0, 8, 0, 0, 2, 15, 0, 0, 0, -14, -15, -16, -17, 0, 2, 0, 0, -22, 0, 0, 3, -19, 0, 0, 0, 0, 15, 4, 0, 0, 2, 0, 0, 12, 0, 0, 5, -6, -2, -8, -13, -15, -18, -20, 0, 0, -17, 0, 0, 0, -22, 0, 0, 0, -6, -29, 0, 0, 14, 0, 0, -1, -18, 12, -33, 0, 0, 0, 0, -21, 0, 0, 0, -7, 3, 12, 0, 0, 0, -25, 0, 0, 0, -7, -20, -24, -36, 0, 0, -14, 0, 0, -37, 0, 0, 16, -20, -2, 0, 0, 0, 1, 0, 0, -12, -21, 2, 0, 0, -25, 0, 0, 14, -5, 0, 0, -12, 0, 0, 0, -16, 2, 8, 33, 19, 0, 0, -13, 0, 0, 7, 4, 0, 0, 16, 0, 0, -20, -22, -25, 0, 0, 0, -2, 0, 0, 0, -14, -18, -21, 0, 0, 51, 0, 0, 0, 0, 0, 18, -3, -4, 0, 0, 0, -48, 21, 0, 0, 0, 13, -19, 25, -1, 0, 0, -10, 0, 0, 0, 18, 0, 0, 19, 0, 0, 0, -3, -15, 0, 0, 4, 0, 0, 20, 3, 0, 0, 5, 0, 0, 0, -9, 1, -7, -13, 1, -21, 0, 0, 0, -31, 28, 0, 0, 0, -21, -2, -3, 0, 0, 0, 2, 8, 0, 0, 0, 0, -2, -7, -17, 0, 0, 0, -30, -24, 0, 0, 8, 0, 0, 3, -46, 0, 0, -6, 0, 0, 8, -2, 19, -79, -1, 0, 0, 25, 0, 0, -26, -41, 0, 0, 0, 8, -1, -4, 0, 0, -3, 0, 0, -48, 8, 0, 0, 0, 1, -12, 32, 27, 0, 0, 0, 2, 0, 0, 3, -11, 30, 0, 0, 12, 0, 0, 7, 0, 0, 7, -6, 0, -2, -6, -7, 0, 0, 0, 6, 0, 0, 1, 4, 0, 0, -32, 0, 0, -25, -28, -77, 0, 0, -2, 0, 0, 19, 21, 0, 0, 22, 0, 0, 13, -5, -7, -14, 0, 0, -12, 0, 0, -12, 11, 0, 0, 10, 0, 0, 20, 3, -7, 0, 0, 5, 0, 0, 23, -25, 0, 0, 0, 0, 10, -2, -6, -28, -9, -63, -108, 0, 0, 0, -91, 0, 0, -23, 0, 0, 0, -5, 0, 0, -78, -2, -111, 0, 0, 4, 0, 0, 6, -32, 0, 0, -48, 0, 0, -10, -20, -56, -39, 0, 0, -29, 0, 0, 4, -37, 0, 0, -1, 0, 0, 6, 3, -33, 0, 0, 0, 1, 0, 0, 16, 5, -9, 1, -18, 0, 0, -5, 0, 0, 22, -13, 0, 0, -4, 0, 0, -12, 1, 19, 0, 0, -18, 0, 0, -2, -3, 0, 0, 0, -4, -40, 49, -19, 0, 0, 0, -14, 0, 0, -3, -4, -7, 0, 0, 0, -3, 22, 0, 0, 0, 17, -4, -22, -28, -30, -33, 0, 0, -33, 0, 0, 2, -33, 0, 0, 0, -32, -37, -65, 0, 0, -35, 0, 0, 29, -23, 0, 0, 0, 7, -28, -36, -88, 0, 0, -21, 0, 0, 7, 16, 0, 0, 0, -43, 52, 23, 0, 0, 18, 0, 0, -39, 40, 0, 0, 0, 30, -58, -2, -5, -47, 0, 0, -66, 0, 0, -50, 0, 0, 16, 5, -31, 0, 0, 0, -41, -14, 0, 0, 0, 5, -16, -18, -20, 0, 0, 0, 38, 21, 0, 0, 0, 1, -2, -4, 0, 0, 0, -40, 0, 0, -8, 14, 0, -37, -7, -65, -87, 0, 0, -53, 0, 0, -61, -92, 0, 0, 0, -11, -42, 15, 0, 0, -19, 0, 0, 9, 0, 0, -12, -2, -5, -7, 0, 0, -14, 0, 0, 17, 0, 0, 16, -2, -15, 0, 0, 2, 0, 0, 0, 0, 0, 2, -2, -5, -14, 20, 0, 0, -30, 0, 0, -36, 10, 0, 0, 0, -25, -36, 0, 0, -17, 0, 0, -2, -4, -7, 9, 0, 0, 0, 11, 7, 0, 0, 0, 9, 2, 0, 0, 19, 0, 0, 19, 25, 9, -31, -63, -94, 0, 0, 0, 1, -6, 0, 0, 0, 7, 2, 0, 0, 12, 7, 0, 0, 0, 14, -20, -24, -25, 0, 0, -8, 0, 0, 2, 7, 0, 0, 0, 15, 0, 0, 0, 19, 4, 0, 0, 0, 9, 15, -2, -1, -3, 0, 0, 0, 2, 0, 0, 18, -4, -5, 0, 0, 0, 19, 0, 0, 1, 36, 4, 6, 0, 0, 0, 9, 1, 0, 0, 0, 7, 16, 0, 0, 25, 0, 0, 15, -6, -22, -1, -19, -32, -63, -33, 0, 0, 0, -13, 5, 0, 0, 0, -29, -32, -43, 0, 0, 0, -34, 0, 0, 4, -24, -20, 0, 0, -31, 0, 0, 9, 0, 0, 14, -30, 3, 2, 0, 0, 5, 0, 0, -8, 30, 0, 0, 2, 0, 0, 9, -32, 6, 0, 0, -3, 0, 0, 0, 10, 0, 0, -23, 0, 0, 3, -2, -45, -82, -3, 0, 0, -26, 0, 0, -17, -33, 0, 0, -31, 0, 0, -24, -29, -50, 0, 0, 7, 0, 0, 4, -9, 0, 0, 7, 0, 0, 0, -38, 5, -2, 0, 0, 61, 0, 0, 26, -8, 0, 0, 3, -5, 0, 0, 0, -1, -7, 5, 0, 0, 36, 0, 0, -7, 0, 0, 15, 1, -7, 4, 12, -35, 0, 0, -20, 0, 0, 8, 1, 0, 0, 22, 0, 0, 1, 3, -14, 0, 0, 7, 0, 0, 4, 5, 0, 0, 0, 2, 18, 8, -47, 0, 0, 0, 18, 0, 0, 0, 20, -60, 0, 0, 22, 0, 0, 16, 7, 0, 0, 19, 0, 0, 0, 9, -14, -17, -18, 0, 0, 10, 0, 0, -6, 9, 0, 0, -2, 0, 0, 5, -6, 1, 0, 0, 11, 0, 0, 3, 26, 0, 0, 14, 0, 0, 8, 2, 1, 3, 0, 0, 0, -11, 2, 0, 0, 0, 8, 1, -39, 0, 0, 25, 0, 0, 2, 0, 0 };
+
+static const uint16_t KNN_INDEX_A[KNN_INDEX_NUM_NODES] PROGMEM = { 2448, 1239, 634, 357, 184, 125, 64, 39, 24, 17, 14, 13, 0, 12, 16, 24, 35, 21, 20, 45, 58, 23, 68, 79, 32, 29, 28, 87, 96, 31, 111, 122, 36, 35, 133, 146, 38, 152, 162, 53, 48, 45, 44, 170, 183, 47, 196, 209, 52, 51, 220, 234, 247, 59, 58, 57, 263, 278, 290, 63, 62, 306, 317, 326, 104, 89, 82, 75, 72, 71, 338, 348, 74, 358, 367, 79, 78, 375, 385, 81, 393, 402, 86, 85, 410, 422, 88, 433, 445, 97, 94, 93, 456, 470, 96, 481, 493, 101, 100, 505, 518, 103, 531, 542, 114, 111, 110, 109, 552, 563, 572, 113, 584, 599, 120, 119, 118, 614, 624, 634, 124, 123, 648, 656, 668, 155, 142, 135, 132, 131, 676, 688, 134, 698, 709, 139, 138, 720, 732, 141, 744, 754, 152, 149, 148, 147, 764, 773, 782, 151, 793, 802, 154, 810, 826, 171, 164, 161, 160, 842, 852, 163, 862, 872, 168, 167, 881, 891, 170, 901, 911, 177, 176, 175, 920, 932, 944, 181, 180, 959, 970, 183, 978, 992, 272, 229, 220, 205, 196, 193, 192, 997, 1011, 195, 1024, 1040, 204, 201, 200, 1048, 1063, 203, 1069, 1085, 1089, 213, 212, 211, 210, 1095, 1105, 1115, 1131, 217, 216, 1143, 1159, 219, 1167, 1181, 226, 225, 224, 1191, 1204, 1212, 228, 1228, 1244, 255, 242, 239, 236, 235, 1259, 1272, 238, 1284, 1298, 241, 1308, 1322, 252, 249, 246, 1335, 248, 1341, 1351, 251, 1359, 1371, 254, 1382, 1397, 265, 262, 261, 260, 1411, 1422, 1432, 264, 1445, 1461, 269, 268, 1474, 1488, 271, 1501, 1511, 318, 297, 288, 283, 280, 279, 1520, 1531, 282, 1542, 1557, 287, 286, 1563, 1572, 1581, 292, 291, 1597, 1613, 296, 295, 1628, 1638, 1645, 309, 304, 303, 302, 1658, 1671, 1680, 308, 307, 1692, 1706, 1709, 315, 314, 313, 1722, 1735, 1747, 317, 1753, 1768, 340, 333, 328, 325, 324, 1782, 1793, 327, 1802, 1814, 332, 331, 1822, 1835, 1845, 337, 336, 1854, 1866, 339, 1878, 1891, 348, 345, 344, 1900, 1916, 347, 1926, 1937, 354, 353, 352, 1947, 1959, 1965, 356, 1973, 1987, 507, 432, 397, 384, 373, 370, 367, 366, 1994, 2009, 369, 2018, 2030, 372, 2042, 2056, 379, 378, 377, 2069, 2081, 2092, 383, 382, 2107, 2120, 2128, 392, 389, 388, 2141, 2152, 391, 2161, 2171, 396, 395, 2181, 2191, 2201, 417, 408, 403, 402, 2215, 2230, 407, 406, 2242, 2251, 2259, 414, 413, 412, 2269, 2278, 2287, 416, 2303, 2316, 425, 422, 421, 2322, 2336, 424, 2350, 2366, 429, 428, 2378, 2390, 431, 2402, 2413, 472, 457, 450, 443, 440, 439, 2423, 2435, 442, 2444, 2456, 447, 446, 2463, 2477, 449, 2483, 2494, 454, 453, 2501, 2515, 456, 2528, 2539, 465, 462, 461, 2550, 2562, 464, 2574, 2584, 469, 468, 2594, 2606, 471, 2618, 2628, 492, 485, 482, 479, 478, 2638, 2651, 481, 2659, 2671, 484, 2676, 2691, 489, 488, 2705, 2716, 491, 2727, 2738, 500, 499, 498, 497, 2749, 2759, 2771, 2782, 504, 503, 2798, 2812, 506, 2822, 2834, 569, 538, 525, 518, 515, 514, 2846, 2862, 517, 2873, 2888, 522, 521, 2900, 2915, 524, 2928, 2942, 533, 530, 529, 2953, 2966, 532, 2976, 2986, 537, 536, 2995, 3008, 3021, 554, 547, 544, 543, 3036, 3049, 546, 3061, 3074, 551, 550, 3085, 3101, 553, 3108, 3120, 562, 559, 558, 3131, 3146, 561, 3160, 3170, 566, 565, 3180, 3192, 568, 3202, 3213, 605, 590, 581, 578, 577, 576, 3224, 3238, 3244, 580, 3259, 3274, 585, 584, 3281, 3295, 589, 588, 3309, 3319, 3327, 598, 595, 594, 3336, 3350, 597, 3361, 3375, 602, 601, 3386, 3398, 604, 3409, 3418, 623, 616, 611, 610, 3426, 3442, 615, 614, 3457, 3467, 3474, 620, 619, 3488, 3500, 622, 3512, 3521, 631, 628, 627, 3529, 3538, 630, 3547, 3556, 633, 3564, 3579, 954, 795, 720, 687, 662, 655, 648, 645, 644, 3593, 3608, 647, 3623, 3637, 654, 653, 652, 3651, 3664, 3668, 3672, 659, 658, 3688, 3699, 661, 3710, 3719, 674, 671, 668, 667, 3727, 3736, 670, 3744, 3754, 673, 3761, 3776, 680, 679, 678, 3791, 3800, 3808, 686, 685, 684, 3823, 3833, 3843, 3846, 707, 700, 695, 694, 693, 3854, 3870, 3873, 699, 698, 3888, 3900, 3912, 704, 703, 3922, 3937, 706, 3951, 3965, 717, 714, 713, 712, 3978, 3990, 3999, 716, 4014, 4030, 719, 4043, 4059, 772, 747, 736, 729, 728, 727, 4072, 4080, 4090, 733, 732, 4103, 4117, 735, 4131, 4147, 744, 741, 740, 4159, 4170, 743, 4180, 4190, 746, 4199, 4214, 761, 754, 753, 752, 4224, 4238, 4247, 758, 757, 4259, 4270, 760, 4277, 4287, 769, 766, 765, 4294, 4305, 768, 4313, 4323, 771, 4332, 4344, 788, 781, 778, 777, 4356, 4369, 780, 4381, 4394, 785, 784, 4406, 4418, 787, 4430, 4442, 792, 791, 4454, 4468, 794, 4480, 4493, 885, 846, 825, 814, 809, 808, 805, 804, 4505, 4518, 807, 4530, 4540, 4549, 813, 812, 4564, 4576, 4587, 820, 819, 818, 4600, 4611, 4619, 824, 823, 4633, 4642, 4650, 837, 832, 829, 4664, 831, 4673, 4688, 836, 835, 4696, 4706, 4714, 843, 842, 841, 4729, 4740, 4747, 845, 4762, 4778, 866, 859, 854, 853, 852, 4794, 4806, 4815, 858, 857, 4830, 4841, 4847, 865, 864, 863, 4863, 4873, 4881, 4895, 874, 871, 870, 4910, 4926, 873, 4942, 4958, 882, 879, 878, 4967, 4977, 881, 4986, 4995, 884, 5003, 5013, 921, 904, 897, 894, 893, 892, 5022, 5031, 5041, 896, 5057, 5068, 901, 900, 5078, 5092, 903, 5106, 5121, 914, 909, 908, 5127, 5139, 913, 912, 5148, 5156, 5167, 918, 917, 5173, 5184, 920, 5195, 5208, 937, 934, 931, 928, 927, 5216, 5229, 930, 5235, 5251, 933, 5262, 5276, 936, 5288, 5301, 947, 944, 943, 942, 5314, 5324, 5333, 946, 5337, 5349, 951, 950, 5359, 5372, 953, 5381, 5394, 1134, 1059, 1010, 987, 974, 967, 964, 963, 5401, 5411, 966, 5421, 5431, 971, 970, 5438, 5447, 973, 5455, 5464, 982, 979, 978, 5472, 5483, 981, 5491, 5500, 986, 985, 5508, 5518, 5525, 1001, 998, 995, 994, 993, 5541, 5552, 5563, 997, 5575, 5588, 1000, 5597, 5607, 1007, 1006, 1005, 5617, 5633, 5644, 1009, 5655, 5671, 1036, 1025, 1020, 1017, 1016, 5681, 5693, 1019, 5702, 5713, 1024, 1023, 5719, 5731, 5742, 1031, 1030, 1029, 5755, 5766, 5775, 1035, 1034, 5788, 5797, 5805, 1052, 1045, 1042, 1041, 5820, 5833, 1044, 5846, 5859, 1049, 1048, 5871, 5882, 1051, 5893, 5905, 1056, 1055, 5911, 5926, 1058, 5933, 5949, 1097, 1078, 1071, 1066, 1065, 5955, 5970, 1070, 1069, 5985, 5994, 6003, 1075, 1074, 6015, 6031, 1077, 6047, 6061, 1090, 1085, 1084, 1083, 6075, 6087, 6096, 1089, 1088, 6109, 6119, 6127, 1094, 1093, 6137, 6151, 1096, 6167, 6182, 1119, 1108, 1105, 1104, 1103, 6193, 6204, 6213, 1107, 6225, 6241, 1116, 1113, 1112, 6256, 6265, 1115, 6275, 6284, 1118, 6292, 6303, 1127, 1124, 1123, 6313, 6329, 1126, 6344, 6358, 1131, 1130, 6372, 6388, 1133, 6398, 6411, 1192, 1167, 1152, 1145, 1142, 1141, 6424, 6433, 1144, 6442, 6451, 1149, 1148, 6460, 6469, 1151, 6478, 6487, 1160, 1157, 1156, 6496, 6505, 1159, 6514, 6523, 1164, 1163, 6532, 6542, 1166, 6550, 6559, 1181, 1176, 1173, 1172, 6568, 6579, 1175, 6588, 6598, 1180, 1179, 6608, 6619, 6625, 1189, 1186, 1185, 6638, 6648, 1188, 6657, 6667, 1191, 6676, 6692, 1220, 1207, 1202, 1199, 1198, 6707, 6717, 1201, 6725, 6735, 1206, 1205, 6742, 6756, 6759, 1217, 1214, 1213, 1212, 6771, 6780, 6788, 1216, 6793, 6802, 1219, 6811, 6826, 1230, 1227, 1226, 1225, 6834, 6844, 6854, 1229, 6870, 6886, 1236, 1235, 1234, 6902, 6914, 6924, 1238, 6935, 6944, 1921, 1594, 1419, 1336, 1285, 1264, 1255, 1252, 1251, 1250, 6953, 6963, 6973, 1254, 6986, 7002, 1261, 1260, 1259, 7018, 7028, 7035, 1263, 7050, 7066, 1276, 1271, 1270, 1269, 7082, 7097, 7108, 1275, 1274, 7121, 7130, 7139, 1282, 1279, 7152, 1281, 7165, 7175, 1284, 7182, 7197, 1317, 1304, 1299, 1294, 1293, 1292, 7211, 7220, 7231, 1298, 1297, 7236, 7252, 7253, 1303, 1302, 7256, 7263, 7273, 1312, 1311, 1310, 1309, 7278, 7290, 7295, 7306, 1316, 1315, 7312, 7324, 7332, 1329, 1326, 1323, 1322, 7343, 7354, 1325, 7364, 7374, 1328, 7382, 7392, 1333, 1332, 7402, 7415, 1335, 7427, 7440, 1388, 1365, 1354, 1347, 1344, 1343, 7450, 7463, 1346, 7473, 7483, 1351, 1350, 7493, 7503, 1353, 7513, 7524, 1362, 1359, 1358, 7533, 7548, 1361, 7557, 7567, 1364, 7575, 7591, 1381, 1374, 1371, 1370, 7605, 7618, 1373, 7630, 7644, 1378, 1377, 7655, 7669, 1380, 7681, 7690, 1385, 1384, 7699, 7715, 1387, 7731, 7742, 1402, 1397, 1394, 1393, 7749, 7763, 1396, 7776, 7791, 1401, 1400, 7800, 7816, 7832, 1412, 1409, 1408, 1407, 7848, 7859, 7869, 1411, 7884, 7898, 1416, 1415, 7908, 7916, 1418, 7928, 7940, 1515, 1472, 1453, 1438, 1431, 1428, 1427, 7947, 7963, 1430, 7976, 7989, 1435, 1434, 8002, 8014, 1437, 8024, 8035, 1446, 1443, 1442, 8046, 8058, 1445, 8069, 8078, 1450, 1449, 8086, 8097, 1452, 8103, 8106, 1467, 1462, 1459, 1458, 8120, 8130, 1461, 8140, 8152, 1466, 1465, 8157, 8164, 8176, 1471, 1470, 8189, 8198, 8207, 1502, 1489, 1482, 1479, 1478, 8219, 8230, 1481, 8241, 8251, 1486, 1485, 8258, 8268, 1488, 8278, 8287, 1495, 1492, 8296, 1494, 8311, 8324, 1499, 1498, 8337, 8350, 1501, 8356, 8365, 1510, 1507, 1506, 8373, 8385, 1509, 8395, 8405, 1514, 1513, 8415, 8425, 8432, 1559, 1538, 1529, 1526, 1523, 1522, 8444, 8458, 1525, 8469, 8482, 1528, 8488, 8499, 1533, 1532, 8508, 8524, 1537, 1536, 8540, 8549, 8557, 1552, 1547, 1544, 1543, 8572, 8585, 1546, 8593, 8604, 1551, 1550, 8612, 8625, 8635, 1556, 1555, 8650, 8664, 1558, 8672, 8683, 1583, 1576, 1569, 1566, 1565, 8693, 8705, 1568, 8717, 8729, 1573, 1572, 8741, 8756, 1575, 8763, 8775, 1580, 1579, 8785, 8800, 1582, 8815, 8828, 1589, 1588, 1587, 8839, 8850, 8861, 1593, 1592, 8877, 8886, 8895, 1760, 1683, 1642, 1621, 1610, 1605, 1604, 1603, 8911, 8924, 8933, 1609, 1608, 8946, 8955, 8963, 1616, 1615, 1614, 8979, 8991, 9000, 1620, 1619, 9013, 9022, 9031, 1633, 1628, 1627, 1626, 9046, 9056, 9063, 1632, 1631, 9079, 9089, 9097, 1637, 1636, 9112, 9128, 1641, 1640, 9144, 9150, 9161, 1662, 1655, 1650, 1649, 1648, 9175, 9185, 9193, 1654, 1653, 9209, 9222, 9228, 1659, 1658, 9238, 9253, 1661, 9265, 9281, 1678, 1671, 1668, 1667, 9291, 9306, 1670, 9320, 9332, 1673, 9343, 1677, 1676, 9349, 9358, 9367, 1682, 1681, 9375, 9387, 9393, 1721, 1702, 1695, 1692, 1691, 1690, 9407, 9418, 9428, 1694, 9444, 9459, 1699, 1698, 9474, 9489, 1701, 9501, 9512, 1712, 1709, 1708, 1707, 9523, 9532, 9540, 1711, 9549, 9562, 1718, 1717, 1716, 9572, 9586, 9589, 1720, 9597, 9609, 1741, 1734, 1729, 1728, 1727, 9621, 9634, 9646, 1733, 1732, 9660, 9675, 9685, 1738, 1737, 9695, 9707, 1740, 9718, 9731, 1753, 1750, 1747, 1746, 9740, 9751, 1749, 9760, 9770, 1752, 9779, 9791, 1757, 1756, 9801, 9816, 1759, 9830, 9846, 1870, 1835, 1810, 1791, 1780, 1773, 1770, 1769, 9858, 9871, 1772, 9883, 9896, 1777, 1776, 9906, 9919, 1779, 9930, 9942, 1786, 1785, 1784, 9953, 9966, 9973, 1790, 1789, 9987, 9999, 10004, 1801, 1798, 1797, 1796, 10019, 10028, 10037, 1800, 10050, 10066, 1807, 1806, 1805, 10081, 10090, 10098, 1809, 10111, 10126, 1826, 1819, 1816, 1815, 10140, 10150, 1818, 10159, 10171, 1823, 1822, 10178, 10188, 1825, 10198, 10208, 1832, 1831, 1830, 10216, 10226, 10236, 1834, 10249, 10263, 1851, 1842, 1839, 10273, 1841, 10287, 10303, 1848, 1847, 1846, 10318, 10330, 10340, 1850, 10353, 10369, 1863, 1860, 1857, 1856, 10385, 10398, 1859, 10404, 10414, 1862, 10422, 10431, 1867, 1866, 10439, 10451, 1869, 10462, 10473, 1900, 1885, 1882, 1877, 1876, 10484, 10498, 1881, 1880, 10510, 10522, 10530, 1884, 10536, 10550, 1893, 1890, 1889, 10562, 10572, 1892, 10582, 10593, 1897, 1896, 10602, 10613, 1899, 10620, 10631, 1912, 1907, 1906, 1905, 10638, 10648, 10658, 1911, 1910, 10674, 10683, 10691, 1918, 1917, 1916, 10705, 10715, 10723, 1920, 10739, 10752, 2181, 2098, 2013, 1970, 1949, 1942, 1935, 1932, 1931, 10762, 10773, 1934, 10782, 10792, 1939, 1938, 10801, 10812, 1941, 10820, 10830, 1946, 1945, 10839, 10855, 1948, 10871, 10886, 1959, 1956, 1955, 1954, 10900, 10916, 10930, 1958, 10941, 10952, 1967, 1964, 1963, 10962, 10973, 1966, 10980, 10992, 1969, 10998, 11012, 1994, 1987, 1980, 1977, 1976, 11022, 11034, 1979, 11044, 11055, 1984, 1983, 11065, 11078, 1986, 11089, 11098, 1991, 1990, 11106, 11118, 1993, 11126, 11135, 2004, 2001, 2000, 1999, 11144, 11155, 11165, 2003, 11180, 11193, 2012, 2009, 2008, 11200, 11211, 2011, 11220, 11229, 11238, 2065, 2038, 2029, 2024, 2021, 2020, 11252, 11267, 2023, 11281, 11293, 2028, 2027, 11305, 11314, 11323, 2033, 2032, 11336, 11352, 2037, 2036, 11368, 11377, 11386, 2052, 2047, 2044, 2043, 11399, 11410, 2046, 11416, 11425, 2051, 2050, 11433, 11445, 11456, 2058, 2057, 2056, 11467, 11479, 11485, 2064, 2063, 2062, 11501, 11511, 11518, 11524, 2083, 2076, 2073, 2072, 2071, 11534, 11547, 11557, 2075, 11572, 11582, 2080, 2079, 11591, 11605, 2082, 11618, 11633, 2095, 2090, 2089, 2088, 11644, 11654, 11661, 2094, 2093, 11676, 11685, 11693, 2097, 11708, 11724, 2140, 2117, 2110, 2107, 2106, 2105, 11739, 11750, 11758, 2109, 11774, 11789, 2114, 2113, 11802, 11818, 2116, 11834, 11850, 2129, 2124, 2123, 2122, 11865, 11874, 11883, 2128, 2127, 11897, 11908, 11918, 2137, 2134, 2133, 11928, 11941, 2136, 11946, 11955, 2139, 11963, 11978, 2166, 2155, 2150, 2147, 2146, 11990, 11999, 2149, 12007, 12016, 2154, 2153, 12024, 12034, 12043, 2161, 2160, 2159, 12057, 12066, 12074, 2165, 2164, 12090, 12101, 12111, 2174, 2171, 2170, 12122, 12137, 2173, 12150, 12164, 2178, 2177, 12175, 12190, 2180, 12202, 12215, 2315, 2266, 2231, 2216, 2201, 2194, 2191, 2190, 12228, 12241, 2193, 12252, 12262, 2198, 2197, 12271, 12281, 2200, 12290, 12300, 2209, 2206, 2205, 12309, 12320, 2208, 12328, 12337, 2213, 2212, 12346, 12356, 2215, 12365, 12375, 2224, 2221, 2220, 12383, 12398, 2223, 12410, 12422, 2228, 2227, 12434, 12450, 2230, 12460, 12472, 2249, 2244, 2239, 2238, 2237, 12484, 12499, 12507, 2243, 2242, 12521, 12530, 12539, 2248, 2247, 12551, 12565, 12569, 2257, 2254, 2253, 12583, 12599, 2256, 12610, 12623, 2263, 2262, 2261, 12631, 12643, 12652, 2265, 12658, 12667, 2290, 2281, 2276, 2273, 2272, 12676, 12690, 2275, 12701, 12712, 2280, 2279, 12720, 12733, 12741, 2287, 2286, 2285, 12753, 12767, 12776, 2289, 12785, 12799, 2304, 2297, 2296, 2295, 12813, 12827, 12836, 2301, 2300, 12850, 12860, 2303, 12869, 12878, 2310, 2309, 2308, 12887, 12897, 12904, 2314, 2313, 12919, 12933, 12942, 2391, 2358, 2339, 2330, 2327, 2324, 2323, 12950, 12959, 2326, 12967, 12977, 2329, 12984, 13000, 2336, 2335, 2334, 13014, 13023, 13032, 2338, 13045, 13061, 2347, 2344, 2343, 13070, 13086, 2346, 13102, 13118, 2355, 2352, 2351, 13134, 13143, 2354, 13151, 13161, 2357, 13168, 13181, 2376, 2367, 2364, 2363, 13190, 13205, 2366, 13219, 13234, 2373, 2372, 2371, 13246, 13255, 13264, 2375, 13272, 13285, 2384, 2381, 2380, 13293, 13304, 2383, 13313, 13323, 2388, 2387, 13332, 13345, 2390, 13353, 13362, 2419, 2408, 2401, 2398, 2397, 13371, 13383, 2400, 13395, 13408, 2405, 2404, 13419, 13429, 2407, 13437, 13446, 2414, 2413, 2412, 13454, 13466, 13477, 2418, 2417, 13490, 13499, 13507, 2435, 2428, 2425, 2424, 13523, 13535, 2427, 13542, 13554, 2432, 2431, 13561, 13576, 2434, 13581, 13590, 2443, 2440, 2439, 13598, 13611, 2442, 13621, 13630, 2447, 2446, 13638, 13650, 13658, 3100, 2777, 2616, 2537, 2496, 2481, 2468, 2463, 2460, 2459, 13671, 13683, 2462, 13692, 13704, 2467, 2466, 13711, 13720, 13728, 2474, 2473, 2472, 13743, 13759, 13769, 2478, 2477, 13777, 13786, 2480, 13794, 13803, 2489, 2486, 2485, 13811, 13825, 2488, 13838, 13852, 2493, 2492, 13865, 13878, 2495, 13890, 13903, 2522, 2511, 2504, 2503, 2502, 13914, 13926, 13936, 2508, 2507, 13952, 13963, 2510, 13972, 13981, 2519, 2516, 2515, 13990, 14000, 2518, 14008, 14019, 2521, 14026, 14042, 2530, 2527, 2526, 14057, 14072, 2529, 14082, 14095, 2534, 2533, 14107, 14117, 2536, 14126, 14136, 2579, 2560, 2553, 2548, 2545, 2544, 14145, 14155, 2547, 14164, 14173, 2552, 2551, 14182, 14193, 14203, 2557, 2556, 14217, 14232, 2559, 14240, 14252, 2572, 2567, 2566, 2565, 14263, 14275, 14282, 2571, 2570, 14298, 14311, 14318, 2576, 2575, 14333, 14347, 2578, 14358, 14368, 2599, 2590, 2587, 2586, 2585, 14378, 14387, 14395, 2589, 14408, 14423, 2596, 2595, 2594, 14437, 14446, 14454, 2598, 14470, 14483, 2609, 2606, 2605, 2604, 14495, 14505, 14515, 2608, 14524, 14537, 2613, 2612, 14550, 14566, 2615, 14582, 14594, 2690, 2657, 2636, 2629, 2624, 2623, 14603, 14619, 2628, 2627, 14635, 14646, 14654, 2633, 2632, 14666, 14682, 2635, 14695, 14711, 2646, 2643, 2642, 2641, 14724, 14733, 14742, 2645, 14758, 14771, 2654, 2651, 2650, 14783, 14792, 2653, 14801, 14810, 2656, 14818, 14830, 2673, 2666, 2663, 2662, 14842, 14857, 2665, 14872, 14887, 2670, 2669, 14902, 14918, 2672, 14931, 14945, 2683, 2680, 2679, 2678, 14959, 14968, 14976, 2682, 14990, 15004, 2687, 2686, 15016, 15031, 2689, 15045, 15058, 2750, 2721, 2708, 2701, 2698, 2697, 15071, 15082, 2700, 15092, 15103, 2705, 2704, 15113, 15123, 2707, 15132, 15142, 2716, 2713, 2712, 15150, 15161, 2715, 15169, 15178, 2720, 2719, 15187, 15197, 15204, 2737, 2730, 2727, 2726, 15219, 15230, 2729, 15240, 15252, 2734, 2733, 15261, 15271, 2736, 15278, 15287, 2745, 2742, 2741, 15295, 15310, 2744, 15316, 15326, 2749, 2748, 15333, 15342, 15350, 2766, 2761, 2758, 2755, 15365, 2757, 15379, 15388, 2760, 15396, 15411, 2765, 2764, 15423, 15432, 15441, 2774, 2771, 2770, 15453, 15465, 2773, 15476, 15487, 2776, 15498, 15513, 2941, 2860, 2823, 2802, 2795, 2790, 2787, 2786, 15528, 15542, 2789, 15551, 15562, 2794, 2793, 15573, 15583, 15593, 2799, 2798, 15599, 15613, 2801, 15626, 15639, 2814, 2809, 2808, 2807, 15652, 15664, 15671, 2813, 2812, 15687, 15697, 15706, 2820, 2819, 2818, 15721, 15730, 15739, 2822, 15748, 15761, 2845, 2836, 2833, 2830, 2829, 15774, 15784, 2832, 15794, 15804, 2835, 15811, 15823, 2842, 2841, 2840, 15835, 15844, 15852, 2844, 15867, 15883, 2853, 2850, 2849, 15895, 15911, 2852, 15920, 15933, 2857, 2856, 15943, 15955, 2859, 15967, 15978, 2910, 2887, 2878, 2871, 2868, 2867, 15987, 15997, 2870, 16007, 16017, 2875, 2874, 16027, 16039, 2877, 16047, 16058, 2884, 2883, 2882, 16065, 16074, 16083, 2886, 16096, 16109, 2899, 2896, 2893, 2892, 16113, 16122, 2895, 16131, 16141, 2898, 16149, 16165, 2905, 2904, 2903, 16178, 16188, 16195, 2909, 2908, 16209, 16222, 16229, 2926, 2919, 2916, 2915, 16239, 16254, 2918, 16266, 16278, 2923, 2922, 16289, 16302, 2925, 16313, 16325, 2934, 2931, 2930, 16335, 16348, 2933, 16360, 16370, 2938, 2937, 16380, 16392, 2940, 16401, 16412, 3037, 2988, 2967, 2956, 2951, 2950, 2949, 16422, 16434, 16445, 2955, 2954, 16457, 16469, 16474, 2962, 2961, 2960, 16490, 16499, 16509, 2966, 2965, 16525, 16540, 16547, 2981, 2974, 2973, 2972, 16558, 16569, 16579, 2978, 2977, 16595, 16605, 2980, 16613, 16622, 2985, 2984, 16630, 16646, 2987, 16657, 16671, 3016, 3003, 2998, 2995, 2994, 16684, 16693, 2997, 16702, 16711, 3002, 3001, 16719, 16728, 16737, 3011, 3008, 3007, 16752, 16762, 3010, 16770, 16779, 3015, 3014, 16787, 16796, 16804, 3026, 3023, 3022, 3021, 16819, 16830, 16841, 3025, 16854, 16868, 3034, 3031, 3030, 16882, 16891, 3033, 16899, 16908, 3036, 16916, 16930, 3071, 3056, 3049, 3046, 3045, 3044, 16944, 16951, 16961, 3048, 16968, 16978, 3053, 3052, 16988, 17001, 3055, 17009, 17018, 3064, 3061, 3060, 17027, 17039, 3063, 17051, 17064, 3068, 3067, 17074, 17083, 3070, 17092, 17101, 3087, 3080, 3077, 3076, 17110, 17121, 3079, 17132, 17144, 3084, 3083, 17153, 17167, 3086, 17174, 17184, 3095, 3092, 3091, 17193, 17207, 3094, 17217, 17229, 3099, 3098, 17240, 17252, 17261, 3490, 3313, 3212, 3161, 3136, 3121, 3114, 3111, 3110, 17275, 17286, 3113, 17296, 17306, 3118, 3117, 17316, 17328, 3120, 17336, 17346, 3129, 3126, 3125, 17355, 17365, 3128, 17374, 17383, 3133, 3132, 17392, 17403, 3135, 17411, 17420, 3152, 3145, 3142, 3141, 17429, 17439, 3144, 17448, 17459, 3149, 3148, 17467, 17477, 3151, 17486, 17500, 3158, 3157, 3156, 17505, 17516, 17524, 3160, 17536, 17551, 3191, 3178, 3171, 3168, 3167, 17566, 17579, 3170, 17589, 17602, 3175, 3174, 17611, 17624, 3177, 17632, 17643, 3186, 3183, 3182, 17651, 17662, 3185, 17672, 17683, 3190, 3189, 17693, 17705, 17714, 3201, 3198, 3197, 3196, 17725, 17741, 17747, 3200, 17760, 17776, 3207, 3206, 3205, 17790, 17802, 17810, 3211, 3210, 17824, 17833, 17842, 3268, 3241, 3228, 3223, 3220, 3219, 17855, 17868, 3222, 17881, 17894, 3227, 3226, 17904, 17915, 17923, 3236, 3233, 3232, 17932, 17946, 3235, 17959, 17971, 3240, 3239, 17976, 17987, 17998, 3255, 3250, 3247, 3246, 18009, 18019, 3249, 18029, 18042, 3254, 3253, 18049, 18058, 18066, 3263, 3260, 3259, 18082, 18093, 3262, 18104, 18115, 3267, 3266, 18124, 18133, 18141, 3292, 3281, 3278, 3275, 3274, 18153, 18165, 3277, 18174, 18184, 3280, 18192, 18205, 3287, 3286, 3285, 18218, 18227, 18235, 3291, 3290, 18251, 18261, 18270, 3304, 3299, 3298, 3297, 18283, 18296, 18307, 3303, 3302, 18320, 18329, 18337, 3310, 3309, 3308, 18352, 18363, 18373, 3312, 18385, 18400, 3405, 3364, 3341, 3330, 3325, 3322, 3321, 18408, 18418, 3324, 18426, 18435, 3329, 3328, 18443, 18454, 18462, 3338, 3335, 3334, 18478, 18488, 3337, 18497, 18506, 3340, 18514, 18529, 3353, 3350, 3347, 3346, 18543, 18554, 3349, 18564, 18575, 3352, 18583, 18599, 3361, 3358, 3357, 18614, 18625, 3360, 18633, 18642, 3363, 18650, 18665, 3386, 3379, 3374, 3371, 3370, 18677, 18686, 3373, 18695, 18704, 3378, 3377, 18713, 18723, 18730, 3383, 3382, 18746, 18761, 3385, 18772, 18787, 3398, 3393, 3392, 3391, 18797, 18809, 18820, 3397, 3396, 18835, 18845, 18852, 3402, 3401, 18862, 18877, 3404, 18890, 18905, 3451, 3428, 3419, 3414, 3413, 3412, 18917, 18926, 18934, 3418, 3417, 18950, 18960, 18967, 3423, 3422, 18983, 18999, 3427, 3426, 19014, 19023, 19032, 3442, 3437, 3434, 3433, 19045, 19055, 3436, 19062, 19073, 3441, 3440, 19079, 19088, 19096, 3446, 3445, 19112, 19128, 3450, 3449, 19144, 19158, 19164, 3471, 3462, 3459, 3458, 3457, 19172, 19183, 19194, 3461, 19210, 19226, 3468, 3467, 3466, 19242, 19255, 19261, 3470, 19275, 19284, 3483, 3478, 3477, 3476, 19293, 19302, 19311, 3482, 3481, 19327, 19339, 19345, 3487, 3486, 19361, 19376, 3489, 19391, 19401, 3618, 3557, 3526, 3515, 3506, 3501, 3500, 3499, 19410, 19419, 19427, 3505, 3504, 19443, 19452, 19460, 3512, 3511, 3510, 19476, 19486, 19496, 3514, 19511, 19524, 3523, 3520, 3519, 19537, 19548, 3522, 19559, 19568, 3525, 19576, 19592, 3542, 3535, 3532, 3531, 19608, 19622, 3534, 19633, 19646, 3539, 3538, 19655, 19670, 3541, 19678, 19694, 3550, 3547, 3546, 19701, 19714, 3549, 19723, 19737, 3554, 3553, 19745, 19758, 3556, 19768, 19778, 3589, 3574, 3567, 3564, 3563, 19788, 19801, 3566, 19812, 19824, 3571, 3570, 19835, 19848, 3573, 19859, 19871, 3582, 3579, 3578, 19881, 19895, 3581, 19909, 19921, 3586, 3585, 19932, 19943, 3588, 19953, 19967, 3607, 3598, 3595, 3594, 19974, 19990, 3597, 20004, 20019, 3602, 3601, 20031, 20047, 3606, 3605, 20060, 20069, 20077, 3615, 3612, 3611, 20087, 20098, 3614, 20109, 20119, 3617, 20128, 20144, 3674, 3649, 3636, 3629, 3626, 3625, 20160, 20175, 3628, 20189, 20198, 3633, 3632, 20206, 20217, 3635, 20226, 20237, 3644, 3641, 3640, 20245, 20260, 3643, 20274, 20285, 3648, 3647, 20295, 20307, 20312, 3667, 3660, 3655, 3654, 20328, 20344, 3659, 3658, 20359, 20373, 20377, 3664, 3663, 20388, 20401, 3666, 20414, 20430, 3671, 3670, 20437, 20453, 3673, 20468, 20480, 3706, 3691, 3684, 3681, 3680, 20490, 20506, 3683, 20517, 20529, 3688, 3687, 20540, 20552, 3690, 20564, 20573, 3699, 3696, 3695, 20582, 20595, 3698, 20607, 20620, 3703, 3702, 20632, 20644, 3705, 20655, 20664, 3718, 3713, 3712, 3711, 20672, 20684, 20690, 3717, 3716, 20705, 20715, 20722, 3726, 3723, 3722, 20738, 20748, 3725, 20757, 20766, 3728, 20774, 20787 };
+
+static const uint16_t KNN_INDEX_B[KNN_INDEX_NUM_NODES] PROGMEM = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 12, 0, 11, 10, 0, 0, 13, 10, 0, 11, 8, 0, 0, 0, 9, 15, 0, 11, 11, 0, 0, 13, 6, 0, 10, 8, 0, 0, 0, 0, 13, 13, 0, 13, 11, 0, 0, 14, 13, 16, 0, 0, 0, 15, 12, 16, 0, 0, 11, 9, 12, 0, 0, 0, 0, 0, 0, 10, 10, 0, 9, 8, 0, 0, 10, 8, 0, 9, 8, 0, 0, 12, 11, 0, 12, 11, 0, 0, 0, 14, 11, 0, 12, 12, 0, 0, 13, 13, 0, 11, 10, 0, 0, 0, 0, 11, 9, 12, 0, 15, 15, 0, 0, 0, 10, 10, 14, 0, 0, 8, 12, 8, 0, 0, 0, 0, 0, 12, 10, 0, 11, 11, 0, 0, 12, 12, 0, 10, 10, 0, 0, 0, 0, 9, 9, 11, 0, 9, 8, 0, 16, 16, 0, 0, 0, 0, 10, 10, 0, 10, 9, 0, 0, 10, 10, 0, 10, 9, 0, 0, 0, 12, 12, 15, 0, 0, 11, 8, 0, 14, 5, 0, 0, 0, 0, 0, 0, 0, 14, 13, 0, 16, 8, 0, 0, 0, 15, 6, 0, 16, 4, 6, 0, 0, 0, 0, 10, 10, 16, 12, 0, 0, 16, 8, 0, 14, 10, 0, 0, 0, 13, 8, 16, 0, 16, 15, 0, 0, 0, 0, 0, 13, 12, 0, 14, 10, 0, 14, 13, 0, 0, 0, 6, 0, 10, 8, 0, 12, 11, 0, 15, 14, 0, 0, 0, 0, 11, 10, 13, 0, 16, 13, 0, 0, 14, 13, 0, 10, 9, 0, 0, 0, 0, 0, 0, 11, 11, 0, 15, 6, 0, 0, 9, 9, 16, 0, 0, 16, 15, 0, 0, 10, 7, 13, 0, 0, 0, 0, 13, 9, 12, 0, 0, 14, 3, 13, 0, 0, 0, 13, 12, 6, 0, 15, 14, 0, 0, 0, 0, 0, 11, 9, 0, 12, 8, 0, 0, 13, 10, 9, 0, 0, 12, 12, 0, 13, 9, 0, 0, 0, 16, 10, 0, 11, 10, 0, 0, 0, 12, 6, 8, 0, 14, 7, 0, 0, 0, 0, 0, 0, 0, 0, 15, 9, 0, 12, 12, 0, 14, 13, 0, 0, 0, 12, 11, 15, 0, 0, 13, 8, 13, 0, 0, 0, 11, 9, 0, 10, 10, 0, 0, 10, 10, 14, 0, 0, 0, 0, 15, 12, 0, 0, 9, 8, 10, 0, 0, 0, 9, 9, 16, 0, 13, 6, 0, 0, 0, 14, 14, 0, 16, 12, 0, 0, 12, 12, 0, 11, 10, 0, 0, 0, 0, 0, 0, 12, 9, 0, 12, 7, 0, 0, 14, 6, 0, 11, 7, 0, 0, 14, 13, 0, 11, 11, 0, 0, 0, 12, 12, 0, 10, 10, 0, 0, 12, 12, 0, 10, 10, 0, 0, 0, 0, 0, 13, 8, 0, 12, 5, 0, 15, 14, 0, 0, 11, 11, 0, 11, 11, 0, 0, 0, 0, 10, 12, 11, 16, 0, 0, 14, 10, 0, 12, 12, 0, 0, 0, 0, 0, 0, 16, 11, 0, 15, 12, 0, 0, 15, 13, 0, 14, 11, 0, 0, 0, 13, 10, 0, 10, 9, 0, 0, 13, 13, 15, 0, 0, 0, 0, 13, 12, 0, 13, 11, 0, 0, 16, 7, 0, 12, 11, 0, 0, 0, 15, 14, 0, 10, 10, 0, 0, 12, 10, 0, 11, 11, 0, 0, 0, 0, 0, 0, 14, 6, 15, 0, 15, 7, 0, 0, 14, 14, 0, 0, 10, 8, 9, 0, 0, 0, 14, 11, 0, 14, 11, 0, 0, 12, 11, 0, 9, 8, 0, 0, 0, 0, 16, 15, 0, 0, 10, 7, 14, 0, 0, 12, 12, 0, 9, 8, 0, 0, 0, 9, 9, 0, 9, 8, 0, 15, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 15, 0, 14, 14, 0, 0, 0, 13, 4, 4, 16, 0, 0, 11, 11, 0, 9, 8, 0, 0, 0, 0, 9, 8, 0, 10, 7, 0, 15, 15, 0, 0, 0, 9, 8, 15, 0, 0, 0, 10, 10, 3, 8, 0, 0, 0, 0, 0, 16, 3, 15, 0, 0, 12, 12, 10, 0, 0, 15, 14, 0, 14, 13, 0, 0, 0, 0, 12, 9, 15, 0, 16, 13, 0, 16, 13, 0, 0, 0, 0, 0, 0, 8, 10, 13, 0, 0, 14, 14, 0, 16, 12, 0, 0, 0, 11, 10, 0, 10, 9, 0, 15, 10, 0, 0, 0, 0, 14, 9, 12, 0, 0, 11, 7, 0, 10, 7, 0, 0, 0, 11, 8, 0, 10, 9, 0, 12, 12, 0, 0, 0, 0, 13, 12, 0, 13, 12, 0, 0, 12, 12, 0, 12, 12, 0, 0, 14, 12, 0, 13, 12, 0, 0, 0, 0, 0, 0, 0, 0, 13, 12, 0, 10, 9, 15, 0, 0, 12, 11, 13, 0, 0, 0, 11, 8, 14, 0, 0, 9, 8, 14, 0, 0, 0, 9, 0, 15, 8, 0, 0, 10, 8, 15, 0, 0, 0, 11, 7, 15, 0, 16, 16, 0, 0, 0, 0, 0, 12, 9, 15, 0, 0, 11, 6, 16, 0, 0, 0, 10, 8, 14, 15, 0, 0, 0, 16, 16, 0, 16, 9, 0, 0, 0, 10, 9, 0, 9, 8, 0, 10, 9, 0, 0, 0, 0, 0, 0, 9, 10, 16, 0, 11, 10, 0, 0, 14, 14, 0, 15, 6, 0, 0, 0, 12, 9, 0, 0, 8, 11, 6, 0, 0, 11, 11, 0, 13, 8, 0, 0, 0, 0, 0, 13, 6, 0, 16, 11, 0, 14, 12, 0, 13, 13, 0, 0, 0, 0, 10, 9, 4, 0, 12, 10, 0, 0, 13, 9, 0, 13, 7, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 0, 10, 7, 0, 0, 9, 8, 0, 9, 8, 0, 0, 0, 11, 8, 0, 9, 8, 0, 0, 10, 7, 16, 0, 0, 0, 0, 0, 11, 11, 12, 0, 13, 9, 0, 10, 10, 0, 0, 0, 16, 11, 11, 0, 16, 10, 0, 0, 0, 0, 0, 12, 9, 0, 11, 6, 0, 0, 12, 11, 13, 0, 0, 0, 11, 9, 13, 0, 0, 9, 8, 15, 0, 0, 0, 0, 13, 13, 0, 13, 12, 0, 0, 11, 11, 0, 12, 6, 0, 0, 15, 7, 0, 16, 6, 0, 0, 0, 0, 0, 15, 15, 0, 0, 9, 9, 12, 0, 0, 16, 16, 0, 14, 14, 0, 0, 0, 0, 12, 9, 13, 0, 0, 10, 8, 10, 0, 0, 14, 16, 0, 15, 11, 0, 0, 0, 0, 0, 11, 9, 12, 0, 16, 15, 0, 0, 0, 9, 10, 0, 9, 8, 0, 11, 10, 0, 0, 0, 16, 15, 0, 14, 14, 0, 0, 16, 10, 0, 13, 13, 0, 0, 0, 0, 0, 0, 9, 9, 0, 9, 9, 0, 0, 9, 9, 0, 9, 9, 0, 0, 0, 9, 9, 0, 9, 9, 0, 0, 10, 8, 0, 9, 9, 0, 0, 0, 0, 11, 9, 0, 10, 10, 0, 0, 11, 6, 13, 0, 0, 0, 10, 9, 0, 10, 9, 0, 16, 15, 0, 0, 0, 0, 0, 10, 8, 0, 10, 7, 0, 0, 14, 3, 12, 0, 0, 0, 0, 9, 8, 5, 0, 9, 9, 0, 15, 8, 0, 0, 0, 0, 10, 10, 16, 0, 16, 16, 0, 0, 0, 12, 10, 11, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 13, 0, 16, 16, 0, 0, 0, 10, 7, 15, 0, 16, 16, 0, 0, 0, 0, 15, 11, 13, 0, 0, 9, 9, 13, 0, 0, 13, 0, 10, 7, 0, 15, 14, 0, 0, 0, 0, 0, 0, 9, 11, 5, 0, 0, 16, 1, 3, 0, 0, 7, 10, 5, 0, 0, 0, 0, 12, 5, 11, 6, 0, 0, 12, 8, 11, 0, 0, 0, 0, 11, 10, 0, 10, 8, 0, 10, 10, 0, 0, 13, 12, 0, 13, 10, 0, 0, 0, 0, 0, 0, 13, 10, 0, 10, 10, 0, 0, 10, 10, 0, 11, 9, 0, 0, 0, 15, 9, 0, 10, 8, 0, 16, 14, 0, 0, 0, 0, 13, 12, 0, 14, 11, 0, 0, 14, 12, 0, 9, 9, 0, 0, 16, 16, 0, 11, 7, 0, 0, 0, 0, 14, 13, 0, 15, 9, 0, 0, 16, 16, 16, 0, 0, 0, 0, 11, 10, 15, 0, 14, 10, 0, 0, 8, 12, 0, 12, 7, 0, 0, 0, 0, 0, 0, 0, 16, 13, 0, 13, 13, 0, 0, 12, 10, 0, 11, 11, 0, 0, 0, 12, 11, 0, 9, 8, 0, 0, 11, 6, 0, 3, 14, 0, 0, 0, 0, 10, 10, 0, 12, 5, 0, 0, 7, 12, 13, 0, 0, 9, 9, 12, 0, 0, 0, 0, 0, 11, 11, 0, 10, 7, 0, 0, 10, 10, 0, 9, 9, 0, 0, 15, 0, 13, 13, 0, 0, 13, 6, 0, 9, 8, 0, 0, 0, 12, 10, 0, 10, 10, 0, 0, 10, 7, 12, 0, 0, 0, 0, 0, 0, 14, 11, 0, 13, 6, 0, 11, 9, 0, 0, 16, 16, 0, 0, 9, 8, 15, 0, 0, 0, 0, 13, 8, 0, 11, 8, 0, 0, 13, 10, 15, 0, 0, 14, 8, 0, 11, 10, 0, 0, 0, 0, 0, 12, 12, 0, 12, 12, 0, 0, 15, 7, 0, 12, 10, 0, 0, 15, 15, 0, 13, 11, 0, 0, 0, 11, 11, 16, 0, 0, 9, 9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 13, 9, 13, 0, 0, 9, 8, 16, 0, 0, 0, 12, 9, 13, 0, 0, 9, 9, 15, 0, 0, 0, 0, 10, 7, 16, 0, 0, 10, 8, 15, 0, 0, 16, 16, 0, 0, 6, 11, 14, 0, 0, 0, 0, 0, 10, 8, 16, 0, 0, 13, 6, 10, 0, 0, 15, 12, 0, 16, 10, 0, 0, 0, 0, 15, 14, 0, 12, 11, 0, 6, 0, 0, 9, 9, 8, 0, 0, 12, 6, 14, 0, 0, 0, 0, 0, 0, 11, 10, 16, 0, 15, 15, 0, 0, 15, 12, 0, 11, 11, 0, 0, 0, 0, 9, 8, 9, 0, 13, 10, 0, 0, 0, 14, 3, 8, 0, 12, 12, 0, 0, 0, 0, 0, 13, 12, 14, 0, 0, 15, 10, 10, 0, 0, 12, 11, 0, 13, 9, 0, 0, 0, 0, 11, 9, 0, 10, 9, 0, 12, 10, 0, 0, 15, 14, 0, 16, 12, 0, 0, 0, 0, 0, 0, 0, 0, 13, 12, 0, 13, 10, 0, 0, 13, 11, 0, 12, 11, 0, 0, 0, 13, 7, 14, 0, 0, 12, 5, 15, 0, 0, 0, 0, 9, 9, 13, 0, 16, 15, 0, 0, 0, 9, 8, 13, 0, 15, 14, 0, 0, 0, 0, 10, 9, 0, 12, 7, 0, 0, 10, 10, 0, 10, 8, 0, 0, 0, 10, 10, 13, 0, 14, 10, 0, 0, 0, 14, 0, 16, 15, 0, 0, 0, 12, 10, 13, 0, 16, 16, 0, 0, 0, 0, 13, 6, 0, 10, 8, 0, 9, 8, 0, 0, 12, 11, 0, 11, 11, 0, 0, 0, 0, 0, 14, 12, 0, 0, 12, 8, 6, 0, 14, 12, 0, 0, 0, 10, 10, 0, 11, 9, 0, 0, 11, 7, 0, 11, 7, 0, 0, 0, 0, 10, 10, 16, 0, 0, 9, 8, 14, 0, 0, 0, 10, 8, 16, 0, 13, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 9, 0, 10, 9, 0, 0, 11, 8, 0, 10, 9, 0, 0, 16, 16, 0, 15, 14, 0, 0, 0, 0, 16, 14, 11, 0, 11, 10, 0, 0, 0, 11, 7, 0, 12, 6, 0, 14, 10, 0, 0, 0, 0, 0, 12, 10, 0, 11, 10, 0, 0, 13, 11, 0, 9, 8, 0, 0, 12, 8, 0, 9, 9, 0, 0, 0, 0, 11, 10, 15, 0, 13, 7, 0, 0, 0, 11, 9, 0, 9, 9, 14, 0, 0, 0, 0, 0, 0, 15, 14, 0, 12, 12, 0, 0, 9, 9, 13, 0, 0, 16, 16, 0, 0, 9, 9, 13, 0, 0, 0, 0, 11, 6, 0, 9, 8, 0, 0, 12, 11, 11, 0, 0, 0, 12, 6, 16, 0, 0, 0, 10, 7, 6, 10, 0, 0, 0, 0, 0, 13, 10, 15, 0, 10, 9, 0, 0, 14, 13, 0, 15, 11, 0, 0, 0, 0, 10, 7, 15, 0, 0, 9, 8, 15, 0, 16, 15, 0, 0, 0, 0, 0, 0, 11, 8, 16, 0, 15, 13, 0, 0, 16, 16, 0, 16, 15, 0, 0, 0, 0, 9, 9, 14, 0, 0, 11, 10, 10, 0, 0, 0, 13, 5, 0, 9, 8, 0, 15, 12, 0, 0, 0, 0, 0, 9, 8, 0, 9, 8, 0, 0, 10, 9, 14, 0, 0, 0, 9, 8, 16, 0, 0, 11, 10, 11, 0, 0, 0, 15, 13, 0, 14, 11, 0, 0, 15, 12, 0, 13, 13, 0, 0, 0, 0, 0, 0, 0, 0, 13, 11, 0, 10, 9, 0, 0, 10, 9, 0, 10, 9, 0, 0, 0, 11, 8, 0, 9, 9, 0, 0, 10, 9, 0, 10, 8, 0, 0, 0, 15, 12, 0, 12, 12, 0, 0, 16, 10, 0, 12, 12, 0, 0, 0, 0, 0, 15, 8, 14, 0, 0, 9, 9, 12, 0, 0, 14, 4, 14, 0, 0, 0, 16, 11, 0, 13, 8, 0, 0, 0, 12, 9, 6, 0, 9, 9, 0, 0, 0, 0, 0, 14, 11, 0, 11, 8, 0, 0, 13, 8, 12, 0, 0, 0, 14, 9, 9, 0, 14, 14, 0, 0, 0, 0, 14, 9, 14, 0, 0, 10, 9, 0, 9, 9, 0, 0, 0, 10, 7, 15, 0, 0, 14, 9, 8, 0, 0, 0, 0, 0, 0, 0, 9, 8, 0, 10, 7, 0, 16, 14, 0, 0, 0, 9, 9, 13, 0, 16, 9, 0, 0, 0, 16, 16, 0, 16, 16, 0, 0, 0, 9, 8, 0, 10, 7, 0, 13, 9, 0, 0, 0, 0, 15, 14, 0, 15, 12, 0, 0, 0, 9, 9, 8, 0, 13, 8, 0, 0, 0, 11, 9, 0, 10, 9, 0, 0, 13, 8, 0, 9, 9, 0, 0, 0, 0, 0, 12, 12, 0, 13, 11, 0, 0, 10, 8, 0, 9, 8, 0, 0, 0, 12, 11, 13, 0, 0, 9, 8, 16, 0, 0, 0, 0, 12, 7, 0, 12, 7, 0, 0, 15, 5, 0, 9, 8, 0, 0, 0, 13, 10, 0, 9, 8, 0, 0, 12, 8, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 9, 0, 12, 7, 0, 0, 9, 8, 15, 0, 0, 0, 16, 10, 8, 0, 0, 9, 8, 0, 9, 8, 0, 0, 0, 14, 13, 0, 14, 13, 0, 0, 13, 12, 0, 13, 11, 0, 0, 0, 0, 0, 12, 10, 16, 0, 0, 11, 9, 0, 9, 9, 0, 0, 0, 10, 8, 0, 11, 7, 0, 16, 15, 0, 0, 0, 15, 10, 0, 13, 12, 0, 0, 10, 9, 0, 10, 9, 0, 0, 0, 0, 0, 0, 10, 9, 0, 9, 9, 0, 0, 11, 10, 14, 0, 0, 15, 8, 0, 12, 11, 0, 0, 0, 0, 12, 7, 16, 0, 0, 13, 7, 15, 0, 0, 14, 11, 0, 10, 10, 0, 0, 0, 0, 0, 9, 8, 13, 0, 15, 14, 0, 0, 0, 9, 8, 16, 0, 13, 12, 0, 0, 0, 0, 10, 10, 9, 0, 13, 13, 0, 0, 16, 16, 0, 12, 9, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, 11, 8, 12, 0, 0, 16, 13, 0, 16, 13, 0, 0, 0, 0, 9, 9, 16, 0, 13, 12, 0, 0, 0, 9, 9, 0, 9, 8, 0, 12, 12, 0, 0, 0, 0, 15, 15, 0, 15, 15, 0, 0, 16, 13, 0, 14, 14, 0, 0, 0, 0, 9, 8, 14, 0, 14, 12, 0, 0, 15, 14, 0, 13, 13, 0, 0, 0, 0, 0, 0, 11, 10, 0, 11, 10, 0, 0, 10, 9, 0, 10, 8, 0, 0, 0, 11, 8, 0, 9, 9, 0, 0, 10, 7, 15, 0, 0, 0, 0, 11, 10, 0, 12, 9, 0, 0, 10, 7, 0, 9, 8, 0, 0, 0, 15, 6, 0, 10, 7, 0, 0, 9, 8, 15, 0, 0, 0, 0, 14, 0, 9, 8, 0, 15, 12, 0, 0, 9, 9, 12, 0, 0, 0, 12, 11, 0, 11, 11, 0, 15, 15, 0, 0, 0, 0, 0, 0, 0, 0, 14, 9, 0, 11, 11, 0, 0, 10, 10, 6, 0, 0, 14, 13, 0, 13, 13, 0, 0, 0, 0, 12, 7, 16, 0, 0, 10, 9, 15, 0, 0, 0, 9, 9, 9, 0, 13, 13, 0, 0, 0, 0, 0, 10, 10, 0, 10, 7, 0, 12, 12, 0, 0, 0, 9, 8, 15, 0, 16, 12, 0, 0, 0, 16, 9, 0, 13, 10, 0, 0, 12, 12, 0, 11, 9, 0, 0, 0, 0, 0, 0, 10, 10, 0, 10, 10, 0, 0, 12, 8, 0, 11, 7, 0, 0, 0, 9, 9, 13, 0, 13, 4, 0, 0, 0, 0, 9, 9, 0, 10, 8, 0, 16, 13, 0, 0, 0, 10, 7, 14, 0, 0, 13, 7, 10, 0, 0, 0, 0, 15, 12, 0, 12, 11, 0, 0, 13, 11, 0, 12, 10, 0, 0, 0, 13, 12, 0, 10, 10, 0, 0, 12, 9, 0, 11, 10, 0, 0, 0, 0, 0, 0, 0, 12, 11, 12, 0, 0, 12, 5, 16, 0, 0, 0, 9, 10, 16, 0, 0, 15, 7, 11, 0, 0, 0, 0, 11, 10, 16, 0, 0, 10, 8, 0, 9, 8, 0, 0, 16, 11, 0, 14, 13, 0, 0, 0, 0, 0, 9, 9, 0, 9, 8, 0, 0, 9, 9, 15, 0, 0, 0, 10, 8, 0, 9, 8, 0, 0, 9, 8, 15, 0, 0, 0, 0, 11, 11, 13, 0, 14, 14, 0, 0, 0, 9, 8, 0, 9, 8, 0, 14, 14, 0, 0, 0, 0, 0, 0, 7, 10, 7, 0, 10, 10, 0, 0, 13, 8, 0, 9, 9, 0, 0, 0, 12, 12, 0, 13, 10, 0, 0, 9, 9, 0, 9, 9, 0, 0, 0, 0, 11, 11, 0, 12, 9, 0, 0, 14, 7, 0, 10, 9, 0, 0, 0, 14, 10, 0, 12, 11, 0, 0, 12, 9, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 10, 0, 10, 10, 0, 0, 12, 8, 0, 10, 9, 0, 0, 0, 10, 9, 0, 9, 9, 0, 0, 11, 8, 0, 9, 9, 0, 0, 0, 0, 10, 9, 0, 11, 8, 0, 0, 10, 9, 0, 14, 5, 0, 0, 0, 11, 8, 12, 0, 15, 15, 0, 0, 0, 0, 0, 13, 10, 0, 13, 9, 0, 0, 13, 8, 0, 11, 8, 0, 0, 0, 11, 10, 0, 11, 10, 0, 0, 12, 9, 11, 0, 0, 0, 0, 16, 6, 13, 0, 16, 14, 0, 0, 0, 12, 8, 14, 0, 0, 9, 9, 13, 0, 0, 0, 0, 0, 0, 13, 13, 0, 13, 10, 0, 0, 11, 8, 9, 0, 0, 0, 14, 13, 0, 12, 5, 0, 0, 11, 11, 11, 0, 0, 0, 0, 10, 10, 0, 13, 7, 0, 0, 9, 8, 16, 0, 0, 0, 11, 11, 0, 11, 9, 0, 0, 9, 8, 12, 0, 0, 0, 0, 0, 12, 9, 0, 10, 8, 0, 13, 13, 0, 0, 0, 9, 8, 16, 0, 0, 10, 9, 13, 0, 0, 0, 0, 13, 11, 13, 0, 0, 9, 8, 15, 0, 0, 0, 11, 10, 12, 0, 15, 8, 0, 0, 0, 0, 0, 0, 0, 10, 8, 0, 9, 8, 0, 0, 11, 8, 16, 0, 0, 0, 10, 9, 0, 9, 8, 0, 15, 14, 0, 0, 0, 0, 11, 10, 0, 11, 8, 0, 16, 15, 0, 0, 0, 11, 8, 0, 9, 8, 0, 15, 12, 0, 0, 0, 0, 0, 9, 9, 0, 9, 9, 0, 0, 10, 7, 16, 0, 0, 15, 11, 0, 15, 10, 0, 0, 0, 0, 12, 11, 15, 0, 0, 10, 7, 10, 0, 0, 15, 13, 0, 15, 12, 0, 0, 0, 0, 0, 0, 9, 8, 16, 0, 0, 10, 7, 16, 0, 0, 16, 15, 0, 0, 9, 9, 13, 0, 0, 0, 0, 10, 7, 0, 11, 6, 0, 0, 9, 8, 16, 0, 0, 16, 16, 0, 0, 14, 6, 8, 0, 0, 0, 0, 0, 11, 11, 16, 0, 16, 16, 0, 0, 0, 13, 6, 14, 0, 9, 9, 0, 0, 0, 0, 9, 9, 16, 0, 0, 12, 6, 16, 0, 0, 15, 15, 0, 10, 9, 0, 0, 0, 0, 0, 0, 0, 0, 9, 8, 16, 0, 0, 9, 8, 16, 0, 0, 0, 10, 10, 15, 0, 13, 13, 0, 0, 0, 11, 11, 0, 9, 8, 0, 16, 16, 0, 0, 0, 0, 14, 11, 0, 13, 9, 0, 0, 15, 8, 0, 16, 7, 0, 0, 0, 13, 9, 0, 14, 8, 0, 0, 13, 10, 0, 10, 10, 0, 0, 0, 0, 0, 13, 11, 0, 12, 11, 0, 0, 13, 11, 0, 12, 10, 0, 0, 0, 14, 14, 0, 12, 11, 0, 0, 11, 10, 0, 14, 7, 0, 0, 0, 0, 16, 14, 0, 15, 12, 0, 0, 16, 13, 0, 0, 9, 8, 10, 0, 0, 0, 11, 11, 0, 10, 9, 0, 16, 16, 0, 0, 0, 0, 0, 0, 15, 14, 0, 9, 8, 0, 0, 11, 9, 0, 11, 8, 0, 0, 0, 15, 14, 0, 11, 10, 0, 0, 12, 5, 16, 0, 0, 0, 0, 16, 15, 0, 0, 14, 4, 11, 0, 0, 13, 13, 0, 16, 7, 0, 0, 16, 15, 0, 12, 10, 0, 0, 0, 0, 0, 16, 11, 0, 12, 11, 0, 0, 12, 12, 0, 9, 9, 0, 0, 0, 13, 12, 0, 13, 12, 0, 0, 12, 11, 0, 9, 8, 0, 0, 0, 0, 12, 6, 15, 0, 0, 10, 7, 16, 0, 0, 0, 10, 9, 0, 9, 8, 0, 13, 13 };
+
+static const uint16_t KNN_INDEX_PERM[KNN_INDEX_NUM_SAMPLES] PROGMEM = {
+  1542, 3051, 4957, 5716, 8017, 9219, 12191, 12285, 13183, 17146, 19845, 20487, 1284, 1600, 7427, 11548, 12177, 13566, 13743, 14565, 16672, 16940, 16992, 18325, 152, 1202, 1960, 2959, 11547, 11594, 11711, 17675,
+  18079, 19127, 20298, 1091, 3096, 4624, 4762, 6406, 12484, 17159, 17423, 18080, 18544, 1259, 2819, 3036, 3238, 3248, 6421, 7623, 12058, 12976, 13276, 16280, 16937, 20041, 2774, 3498, 6443, 8684, 9787, 11035,
+  11728, 15384, 16551, 17120, 502, 3818, 4797, 5123, 9776, 10771, 12233, 12413, 13201, 15539, 16725, 4335, 7920, 8434, 15158, 16329, 16773, 17449, 18921, 282, 3130, 4590, 7538, 8671, 8872, 19409, 19535, 20292,
+  872, 2768, 3201, 3746, 6370, 6803, 7364, 12146, 16154, 16596, 17643, 17656, 17698, 17763, 20229, 3372, 3715, 4311, 10052, 12176, 12602, 14451, 14945, 17213, 19582, 19960, 311, 430, 1273, 1932, 2589, 3511,
+  4282, 5791, 8958, 11734, 15559, 623, 1689, 2196, 4776, 5375, 6673, 12237, 12259, 13435, 13484, 13707, 14913, 20182, 848, 3304, 10267, 17114, 18031, 18386, 1440, 4139, 4181, 6960, 7097, 7905, 8902, 18078,
+  19560, 19645, 301, 2888, 8285, 11036, 11700, 15028, 16300, 17490, 240, 4331, 5829, 6272, 6313, 7600, 8590, 14390, 16918, 16984, 17372, 19140, 20341, 497, 2411, 2834, 3445, 3667, 8231, 11617, 11981, 14441,
+  15353, 19314, 19991, 20222, 188, 414, 763, 1958, 5586, 6001, 9717, 10071, 12890, 13717, 13724, 16324, 20276, 2007, 2873, 2992, 9954, 13586, 15126, 16311, 16668, 17156, 18255, 19874, 134, 649, 1705, 5606,
+  8221, 11581, 13223, 14178, 15358, 17241, 17599, 17686, 18627, 20594, 106, 811, 2312, 5304, 6509, 8369, 9055, 10597, 13265, 13393, 13998, 15102, 16831, 220, 4005, 4766, 5478, 6919, 7716, 9698, 10510, 11742,
+  12284, 13197, 14668, 15519, 15796, 15932, 19996, 2212, 5119, 5802, 7602, 7616, 10919, 11502, 11597, 12308, 13440, 14220, 16045, 16219, 17730, 19636, 1781, 3217, 4611, 9455, 9486, 11037, 11485, 12802, 17101, 17987,
+  19556, 19771, 1218, 2064, 5358, 7103, 7269, 8508, 8813, 8863, 11095, 11318, 11333, 13087, 16820, 18856, 20425, 20617, 2435, 9224, 9249, 9686, 12522, 13767, 13773, 16518, 16945, 17149, 20707, 2570, 4218, 4355,
+  8438, 10870, 11173, 11322, 13895, 17886, 1580, 2053, 2337, 3175, 3822, 6517, 6611, 8458, 8668, 11865, 13222, 15676, 868, 6216, 7388, 13291, 14663, 14891, 18179, 19128, 19217, 19611, 1215, 1546, 1820, 2803,
+  3191, 4112, 7201, 8483, 13723, 16200, 3998, 4746, 6391, 6434, 6707, 12739, 14007, 17954, 18483, 1607, 1814, 3250, 7523, 9221, 12241, 12886, 20284, 167, 3590, 4381, 4944, 6028, 7535, 12983, 13879, 14315,
+  18959, 4998, 6167, 6759, 6973, 8785, 10859, 16771, 19542, 2925, 3186, 4269, 4278, 6701, 10761, 11906, 18903, 19458, 446, 2052, 3784, 6177, 6713, 10698, 16181, 20168, 427, 2149, 8557, 11943, 13808, 14735,
+  14808, 15244, 18217, 18317, 20069, 20793, 1150, 6215, 8733, 10982, 12779, 14026, 15224, 16465, 16614, 19334, 19664, 20, 1127, 1264, 1804, 4189, 7153, 11769, 12745, 14166, 15211, 16609, 17843, 1128, 4256, 6411,
+  6613, 7200, 7583, 11826, 13208, 15606, 16578, 18431, 3230, 3705, 3856, 5188, 5857, 6868, 8841, 10407, 11582, 11621, 12367, 12844, 13760, 16261, 680, 984, 2132, 6318, 6618, 8163, 10211, 12491, 12953, 17708,
+  20510, 61, 96, 1325, 2915, 4280, 6863, 7040, 9955, 10356, 14165, 16667, 18203, 749, 3636, 3985, 4240, 4634, 8638, 9393, 10803, 12153, 13255, 19425, 20755, 3327, 4699, 4987, 5063, 7894, 9000, 10425,
+  10608, 11424, 15616, 16756, 17585, 19701, 2237, 3273, 3615, 4930, 5389, 5856, 9234, 10814, 11345, 11818, 14599, 16815, 17944, 14, 5614, 6394, 6472, 9747, 11398, 11560, 15745, 18178, 20138, 20326, 267, 810,
+  3690, 5172, 5513, 7049, 8387, 9683, 18036, 18578, 1602, 4518, 4768, 4904, 5949, 11602, 13157, 15072, 15443, 17679, 19971, 293, 5950, 6711, 9252, 11170, 12189, 14465, 15270, 18241, 863, 5030, 7979, 8339,
+  9639, 14711, 14799, 14974, 15456, 16460, 17847, 19229, 3767, 3788, 7315, 8082, 9635, 11420, 11697, 11991, 12605, 13575, 14112, 17707, 17715, 18621, 20327, 1351, 2823, 3698, 3947, 4553, 6017, 6772, 6847, 9797,
+  11731, 15207, 16173, 16375, 16412, 18023, 108, 4367, 6369, 7276, 7746, 9200, 9737, 18069, 19413, 19575, 5339, 6688, 8340, 8764, 10479, 12858, 15978, 18438, 19593, 20106, 1002, 2238, 3827, 4804, 5775, 9354,
+  9988, 13252, 15753, 16213, 18828, 19778, 19924, 20038, 1667, 5804, 8712, 9715, 10431, 19295, 20263, 20540, 3532, 6948, 7940, 8034, 9713, 10265, 10535, 11804, 13572, 14550, 19956, 20227, 7576, 10639, 13448, 14574,
+  14884, 15085, 18239, 20703, 2553, 3503, 5609, 7077, 9131, 11094, 12436, 13029, 13253, 13520, 13874, 19986, 1733, 8501, 9147, 11016, 12621, 15073, 16644, 16975, 20406, 20668, 730, 859, 3187, 7732, 9407, 12616,
+  12633, 13164, 14341, 18071, 18554, 1069, 1335, 1905, 3114, 7577, 8319, 8416, 9094, 9371, 15434, 19595, 1687, 1955, 5038, 11149, 12840, 12907, 13352, 16378, 18976, 19090, 19327, 19423, 539, 3887, 8890, 10109,
+  10592, 10699, 12843, 13995, 14107, 14225, 14568, 19868, 2936, 3973, 5404, 7924, 8271, 8694, 13762, 16112, 16531, 20702, 2223, 6165, 7383, 9831, 10430, 10435, 15706, 18622, 19446, 20232, 998, 2395, 10941, 11815,
+  12352, 12805, 15352, 20100, 20670, 2495, 5266, 5299, 5797, 8450, 13168, 14473, 18586, 19940, 2759, 3193, 3825, 6642, 7172, 8280, 8383, 11375, 12402, 15178, 20592, 5051, 8008, 9246, 10362, 15419, 15849, 18799,
+  19082, 20507, 996, 2700, 2735, 7144, 12289, 13736, 16073, 17144, 1062, 1346, 2436, 3136, 3740, 4785, 6464, 6763, 8198, 8917, 10948, 11022, 13285, 14764, 17008, 19522, 287, 1276, 3949, 6084, 6857, 9099,
+  9691, 12985, 13302, 15780, 16823, 17031, 18185, 18291, 18373, 20577, 2464, 7140, 8073, 12328, 12710, 16222, 16478, 17141, 17161, 19589, 908, 2055, 4548, 7505, 10858, 14343, 17971, 18196, 18511, 19863, 2758, 5524,
+  6189, 10488, 13577, 14207, 14470, 16683, 17369, 17448, 13, 6570, 8069, 8789, 9020, 12338, 14669, 16846, 16920, 2920, 5659, 5691, 8148, 8695, 8731, 8883, 17904, 19095, 19622, 1173, 1437, 2598, 5031, 5920,
+  6788, 11724, 15822, 16907, 18505, 812, 3031, 5202, 6561, 14149, 14310, 14399, 15218, 16611, 20479, 5433, 6978, 8525, 13009, 14969, 15332, 16212, 16458, 20646, 746, 4101, 5081, 6395, 7007, 11860, 13067, 13407,
+  13857, 14236, 15864, 19961, 4075, 4631, 5008, 5956, 7802, 10077, 11133, 14214, 18278, 18982, 19465, 20378, 4503, 4706, 5970, 9655, 9826, 9846, 10566, 13239, 14417, 15876, 17376, 18359, 19950, 20150, 20295, 658,
+  1409, 5109, 7053, 7184, 7456, 9611, 10340, 11754, 12628, 13739, 3387, 4040, 4287, 5717, 6659, 12951, 16210, 16545, 4276, 4979, 5005, 5439, 10273, 10540, 10745, 11163, 14218, 14670, 15735, 17907, 18096, 20236,
+  727, 3584, 6099, 9667, 11949, 1671, 2326, 3014, 10201, 13399, 13433, 13896, 15315, 16013, 16273, 18076, 19164, 20139, 20228, 1024, 1114, 1924, 2466, 2500, 2540, 2616, 11620, 12394, 18874, 18887, 20250, 20407,
+  600, 611, 2828, 3915, 6251, 7117, 7418, 8313, 8689, 10278, 14904, 15011, 16836, 19061, 19774, 20348, 178, 639, 1632, 6310, 9573, 15180, 17903, 20389, 56, 157, 365, 657, 1840, 3481, 5009, 6044,
+  9625, 10448, 10968, 14137, 15942, 19571, 20149, 813, 2269, 5379, 17166, 18091, 19915, 702, 2172, 3257, 3877, 9276, 9847, 10078, 10820, 12379, 12763, 14709, 15243, 15787, 16414, 18624, 19995, 9215, 10257, 13780,
+  17232, 317, 4191, 13002, 16164, 16550, 20390, 7344, 8511, 13326, 13675, 13916, 14034, 15047, 15130, 17406, 18809, 137, 1162, 4148, 4941, 6824, 9077, 9467, 16844, 17459, 18425, 2093, 2836, 3782, 3787, 7545,
+  8322, 8377, 8431, 8687, 13013, 13272, 14469, 15123, 15823, 20063, 20359, 3630, 3785, 3882, 11263, 14265, 14823, 15276, 15520, 16680, 18596, 18933, 19115, 3492, 3643, 5612, 6055, 6429, 6647, 7671, 8780, 11543,
+  11783, 12539, 13112, 13166, 15076, 18308, 19720, 4717, 7432, 13459, 13585, 14502, 14905, 18087, 19550, 2383, 3595, 3748, 4420, 5021, 7210, 10285, 10913, 11477, 11986, 14959, 15961, 16428, 17173, 1041, 1180, 2719,
+  2877, 7578, 9134, 9935, 11972, 15799, 18014, 35, 1338, 1561, 3719, 5058, 6947, 9104, 9497, 9804, 9863, 10873, 11011, 20567, 5974, 8908, 12012, 13887, 15896, 17036, 17112, 19440, 694, 2485, 4342, 4869,
+  5663, 6006, 7852, 7971, 8264, 8962, 11064, 12003, 12429, 15639, 18248, 18350, 1067, 1854, 3034, 4755, 6353, 6954, 6968, 10484, 10607, 11006, 11366, 12304, 13368, 15631, 17445, 20576, 1664, 2525, 2649, 2837,
+  3483, 7454, 7662, 9963, 15696, 15820, 16489, 16891, 17334, 17845, 19643, 2792, 3957, 4074, 4765, 6378, 6604, 7791, 8279, 12370, 13172, 14704, 15751, 20300, 1108, 7228, 8389, 8518, 8587, 10651, 11097, 11698,
+  15482, 16033, 16701, 19015, 441, 579, 604, 1537, 1719, 4156, 4596, 5182, 9203, 16432, 17004, 17823, 18074, 20199, 1772, 7889, 8551, 9562, 12196, 12214, 14328, 14947, 16257, 17263, 450, 2727, 2978, 7165,
+  7672, 8415, 9989, 10170, 11910, 13450, 14981, 17122, 17972, 20649, 2199, 4350, 4486, 5816, 7515, 8891, 9432, 12073, 12340, 16089, 16719, 18184, 19390, 2036, 4107, 13439, 17564, 20465, 20549, 3380, 6521, 11702,
+  13257, 14566, 15376, 15766, 18174, 18433, 20012, 1014, 8062, 9972, 10539, 11692, 14917, 16627, 17538, 125, 1894, 3975, 5045, 5066, 5615, 9872, 11309, 13843, 14340, 19005, 19648, 2292, 4481, 6681, 12253, 12922,
+  13953, 16274, 17816, 18388, 19169, 20568, 834, 3266, 4306, 4394, 4713, 7360, 8608, 8828, 8860, 11076, 11523, 11670, 11733, 16262, 18131, 416, 719, 1388, 2315, 3122, 3194, 9358, 9862, 10520, 10660, 13672,
+  17354, 19135, 20489, 78, 2825, 4829, 11350, 12551, 13287, 13984, 14311, 14861, 14918, 15336, 447, 5661, 6641, 8827, 9549, 15736, 17255, 17705, 20049, 20334, 1037, 2063, 3830, 3903, 4162, 4327, 5420, 11748,
+  12332, 12446, 14430, 17347, 17970, 2173, 2857, 3436, 5643, 7191, 8408, 8889, 8912, 10216, 10358, 12186, 16196, 16348, 17218, 17760, 20105, 567, 5087, 5777, 7741, 8708, 9532, 10822, 11341, 11567, 15045, 19767,
+  20661, 20765, 513, 3557, 3812, 3914, 3934, 4122, 8475, 11612, 15462, 15500, 15522, 16126, 16948, 19914, 1083, 4210, 4911, 5674, 8159, 10635, 13733, 15287, 15729, 17976, 18281, 18811, 18885, 2452, 3241, 3619,
+  5724, 10634, 10914, 11588, 15012, 16108, 16908, 4724, 5442, 8048, 8386, 9575, 11901, 18435, 18920, 19768, 2581, 5518, 7607, 9827, 10601, 11545, 12915, 12917, 13246, 16462, 16520, 1884, 3071, 3545, 3772, 5480,
+  6070, 6710, 9708, 10442, 14156, 19832, 408, 413, 1567, 3303, 3824, 4712, 4773, 4901, 5110, 6455, 6610, 8926, 16403, 17787, 19376, 971, 3766, 5878, 10398, 14138, 16346, 5508, 5812, 10230, 13627, 15325,
+  17592, 18108, 18785, 19988, 809, 898, 3983, 4104, 4517, 10642, 14555, 14650, 15556, 258, 1927, 2456, 3297, 3495, 6205, 6823, 9851, 12264, 12490, 13295, 13362, 13381, 19906, 20137, 20438, 3383, 4060, 5074,
+  5845, 6339, 7354, 12095, 13190, 13718, 15704, 17193, 18038, 18702, 18906, 20181, 20710, 121, 432, 2746, 4484, 7275, 9714, 10272, 11248, 11634, 12836, 13106, 13772, 15634, 18854, 19219, 6386, 7151, 7812, 7823,
+  7944, 9173, 12019, 12908, 14326, 18013, 4070, 12994, 14751, 16229, 16794, 19267, 20758, 1498, 2883, 3131, 3836, 4108, 5698, 9703, 10208, 12365, 19638, 20384, 20497, 20635, 2773, 5259, 6342, 7202, 8807, 11164,
+  13024, 13474, 13932, 14826, 16752, 17227, 20618, 1801, 4917, 8620, 10006, 11463, 12009, 12537, 15321, 18840, 1714, 3144, 4757, 9204, 9903, 11933, 12583, 14929, 17824, 18292, 18459, 19072, 2613, 3040, 3182, 3514,
+  4284, 13411, 13434, 13794, 15314, 16115, 16185, 16904, 17891, 19241, 10332, 12123, 16131, 870, 1913, 4292, 6063, 6083, 6340, 8552, 8850, 11656, 13499, 15945, 16767, 20015, 1254, 1262, 3301, 3393, 3792, 4984,
+  5369, 9816, 10348, 11505, 14632, 17734, 18412, 2457, 3606, 5117, 9258, 9868, 9939, 10145, 10613, 19529, 19780, 20151, 20246, 642, 6899, 10777, 12761, 12807, 15576, 452, 1219, 1676, 2701, 3652, 5786, 6368,
+  6680, 11450, 13271, 13466, 16889, 18077, 19089, 19508, 2729, 3410, 3488, 3660, 6651, 7609, 7690, 8051, 9850, 9985, 18270, 18829, 19106, 19185, 873, 899, 5778, 6679, 8307, 8528, 10531, 11018, 11695, 14459,
+  15423, 1669, 6089, 8406, 15138, 15394, 15470, 16572, 18650, 19630, 1378, 1803, 6150, 9401, 10152, 11347, 13548, 13750, 14039, 14608, 17292, 19394, 246, 532, 995, 1175, 6718, 8755, 11396, 11967, 1165, 1452,
+  1467, 2756, 3749, 4798, 8679, 8981, 11117, 12997, 13727, 14674, 19124, 1139, 1928, 6238, 9116, 9849, 10070, 10964, 13301, 17945, 18081, 528, 1586, 6440, 9516, 9971, 12774, 17965, 19796, 20147, 2143, 2215,
+  2929, 5961, 6917, 7704, 8814, 9437, 9630, 11228, 17253, 19469, 619, 862, 1794, 5273, 5276, 8577, 11970, 12756, 13160, 16849, 17154, 17552, 1723, 2493, 2865, 5462, 8042, 8195, 10027, 10306, 14443, 15614,
+  17356, 19410, 19505, 369, 5942, 7281, 10462, 11401, 12217, 12426, 17020, 19871, 708, 2386, 3216, 3374, 5599, 5694, 6964, 7829, 8211, 8305, 9777, 12870, 13776, 13934, 19252, 20712, 3558, 4406, 8044, 11328,
+  11638, 12443, 12657, 13118, 17799, 20171, 291, 5858, 7693, 10668, 11087, 12409, 14564, 14596, 14729, 14847, 18999, 5322, 6500, 9580, 11564, 12258, 13020, 13642, 14383, 15575, 19083, 1159, 7102, 9368, 9600, 12851,
+  13557, 14457, 15124, 17533, 17802, 18313, 20745, 606, 1300, 7091, 7327, 17425, 18717, 3654, 5921, 9261, 9780, 13994, 14480, 16404, 19853, 399, 1308, 2139, 4267, 5082, 5658, 5862, 8004, 8098, 8180, 11572,
+  11827, 17637, 19628, 433, 543, 1576, 7821, 12515, 13261, 14018, 1720, 4833, 6356, 7009, 7428, 10503, 11540, 15091, 15269, 16736, 17239, 17989, 18449, 18869, 18949, 1121, 2548, 3027, 7357, 8422, 10551, 17197,
+  17740, 19860, 5149, 5806, 8663, 8676, 11720, 12187, 14330, 14795, 14956, 17541, 19123, 20590, 2135, 2596, 3340, 8040, 8862, 9869, 10065, 11752, 11762, 18130, 18754, 20730, 472, 1318, 1395, 1547, 2831, 5815,
+  6344, 6678, 7146, 8423, 8648, 8968, 12090, 14242, 2106, 2508, 5029, 5703, 6143, 7888, 11997, 12425, 13686, 13951, 14954, 15962, 19398, 1648, 4890, 8810, 9543, 9735, 14304, 15552, 16109, 18019, 18777, 20537,
+  20623, 75, 843, 8320, 9236, 10830, 11048, 11321, 12418, 15259, 16789, 18533, 144, 211, 3283, 3457, 4396, 6380, 7072, 8190, 10482, 12132, 14899, 16854, 17814, 19939, 20550, 7, 1324, 3029, 5581, 6229,
+  6735, 11206, 11992, 12016, 13406, 14148, 14796, 19925, 2552, 3424, 6760, 7081, 9380, 10799, 16180, 16374, 2791, 3055, 3309, 4057, 4094, 5235, 7890, 8984, 10499, 11885, 12072, 16577, 16607, 17, 3853, 6436,
+  7005, 8063, 8914, 13343, 13525, 16283, 16301, 16652, 1903, 6529, 7911, 12178, 13284, 15581, 15880, 17905, 19151, 490, 3160, 5885, 10945, 11458, 16835, 17685, 18048, 18271, 19202, 904, 1971, 7252, 13836, 14014,
+  15626, 17789, 19018, 20056, 20412, 2431, 8477, 9507, 9833, 10816, 10848, 11661, 11866, 12727, 15110, 3147, 4896, 5403, 7458, 9192, 10947, 12534, 16377, 18868, 19886, 2285, 2902, 3070, 3311, 5209, 5704, 9138,
+  12250, 13170, 13841, 17359, 19112, 19270, 19719, 7486, 7730, 7869, 8374, 10695, 12390, 14835, 15744, 17453, 17827, 18951, 19901, 20187, 20283, 20291, 655, 748, 1081, 5100, 9527, 11735, 12297, 13945, 16175, 17381,
+  17581, 19890, 166, 8288, 9193, 9511, 10687, 10779, 11358, 12804, 13031, 234, 584, 5854, 6199, 7408, 8110, 11278, 11832, 1935, 3747, 4526, 8996, 10244, 10377, 13156, 13646, 17704, 17899, 259, 617, 6646,
+  6702, 8468, 9498, 9779, 9805, 14478, 1757, 2403, 5464, 10313, 13742, 14298, 15535, 20279, 20621, 337, 1255, 2546, 2924, 3763, 3839, 5383, 7285, 7597, 8688, 11116, 13138, 14221, 15231, 17532, 20245, 1851,
+  1889, 2799, 4981, 8093, 12617, 13568, 15430, 16993, 18047, 18202, 18687, 19088, 5443, 5568, 8131, 11171, 16749, 16814, 31, 5579, 5992, 6337, 6698, 6815, 8775, 8849, 12612, 13753, 15106, 16387, 19079, 19101,
+  4675, 7948, 8803, 9127, 10457, 10684, 10894, 11394, 11507, 12213, 18190, 18472, 20372, 20782, 241, 357, 799, 1653, 1775, 3406, 12866, 14356, 14514, 15819, 16791, 18609, 18832, 18847, 18872, 18985, 2595, 2635,
+  3851, 3880, 4022, 4257, 7079, 10746, 12235, 12563, 14087, 16419, 2177, 2178, 2396, 6185, 6223, 8615, 12771, 13110, 14000, 14609, 18009, 18695, 2556, 3637, 4874, 5352, 5689, 6263, 7679, 8550, 8753, 13032,
+  14078, 20506, 191, 2838, 5893, 6388, 6775, 7659, 8674, 11024, 11111, 11378, 16730, 400, 1166, 4358, 9790, 10368, 14857, 17029, 17768, 17912, 19729, 1622, 2861, 3244, 5499, 5680, 6225, 8286, 9078, 12632,
+  13488, 14013, 19718, 1662, 2232, 3648, 10178, 16827, 18836, 19154, 19702, 20439, 2486, 2788, 5510, 9940, 12982, 13848, 15902, 16170, 17821, 18880, 19931, 20073, 1577, 3580, 4100, 4202, 7385, 7943, 17200, 3981,
+  5779, 6623, 7012, 8790, 9207, 14053, 14139, 14290, 15705, 16051, 17514, 18923, 20600, 2958, 3701, 6832, 7592, 12291, 13788, 842, 1649, 1727, 2374, 5651, 7158, 8348, 10410, 12266, 16079, 20045, 1558, 2013,
+  5621, 10147, 13771, 14337, 14931, 672, 1610, 1857, 4985, 11088, 12400, 13402, 14235, 17336, 18137, 18357, 19236, 20025, 20459, 5298, 6706, 8120, 9006, 10833, 13523, 14381, 15521, 15667, 16064, 16547, 18963, 19283,
+  1142, 2380, 3174, 3948, 8224, 9088, 14444, 16684, 17528, 17597, 18531, 752, 2976, 3661, 6031, 9555, 13546, 13974, 16203, 16440, 18876, 19455, 928, 2133, 3778, 4527, 8176, 10156, 11329, 14484, 16925, 17030,
+  18713, 19912, 60, 1454, 1974, 3623, 6085, 8088, 9550, 14136, 15808, 17537, 18066, 18536, 1856, 4262, 5557, 6481, 6622, 13069, 16142, 17509, 18771, 20370, 1529, 3039, 4044, 5589, 5679, 9176, 11699, 12949,
+  15078, 17285, 846, 1391, 2020, 4850, 5069, 9834, 10661, 12622, 17435, 17825, 18631, 20337, 232, 1214, 4427, 6195, 8125, 9904, 11232, 12512, 12921, 13923, 14697, 15943, 977, 3743, 6315, 7560, 9705, 13687,
+  15966, 16678, 17916, 20307, 2519, 5286, 11648, 16235, 17185, 17993, 18942, 19433, 20230, 20585, 2043, 2160, 3197, 4378, 4782, 6843, 7761, 8395, 8545, 8773, 8795, 10739, 18696, 5226, 7433, 8068, 9994, 10893,
+  12762, 18374, 19655, 2862, 3941, 4285, 5880, 7632, 8782, 12181, 12494, 13093, 13457, 18625, 18882, 2517, 7923, 11542, 11854, 16661, 3560, 3688, 4895, 6114, 7125, 7259, 8086, 9649, 12859, 13219, 14440, 17463,
+  18275, 18731, 18801, 721, 4679, 6766, 8506, 8612, 10069, 13840, 14828, 16640, 17116, 17179, 17765, 18830, 18879, 1826, 5953, 10852, 11264, 11951, 13123, 13600, 15867, 17014, 17534, 19821, 1544, 2706, 5729, 8390,
+  11397, 12083, 12685, 15346, 15347, 15883, 17619, 641, 994, 1763, 1995, 4064, 4585, 5475, 5624, 7113, 10977, 16779, 3930, 5960, 8100, 8474, 11848, 15222, 16179, 16281, 16959, 19118, 20414, 510, 1143, 7314,
+  7717, 9157, 13685, 15365, 16526, 18795, 20148, 4163, 4184, 7075, 8470, 8530, 8591, 13623, 13682, 16575, 17714, 19144, 20751, 456, 1750, 3172, 5238, 9112, 9892, 10037, 13056, 14252, 16150, 18980, 342, 1394,
+  1762, 2001, 2317, 3285, 3805, 5582, 7027, 7544, 12158, 13234, 13540, 16464, 18598, 18851, 1005, 2404, 5708, 8457, 8829, 8934, 9568, 10669, 13781, 15285, 15684, 17045, 19835, 19962, 2518, 4222, 4489, 6373,
+  8295, 9167, 17437, 17614, 17744, 18277, 1809, 4906, 7637, 11252, 11330, 12466, 15132, 15306, 16068, 17673, 20766, 20792, 320, 3006, 6549, 6551, 6951, 7744, 9024, 17358, 17920, 18761, 19864, 20253, 900, 4562,
+  4841, 4849, 5234, 5850, 6202, 7686, 8167, 8460, 8574, 10329, 13602, 14196, 18540, 20548, 244, 1495, 1620, 4758, 8338, 11208, 12835, 13429, 13658, 14245, 14407, 16, 3401, 5096, 6580, 6724, 8199, 8245,
+  9491, 9711, 10478, 11980, 12106, 18862, 19120, 20628, 435, 512, 4051, 4410, 4421, 4682, 6729, 10966, 13792, 14175, 17473, 19783, 1111, 2742, 2987, 7550, 10197, 11570, 11689, 13178, 13912, 14199, 14656, 15776,
+  15979, 16336, 20315, 6080, 8586, 8970, 9025, 9494, 10649, 11437, 12039, 13596, 16562, 19063, 20159, 20536, 2634, 2890, 7062, 9448, 11792, 13304, 14957, 15459, 15824, 16157, 16276, 18085, 19032, 20266, 2506, 3431,
+  5641, 7114, 7473, 8597, 9542, 11929, 15594, 18402, 19644, 185, 213, 662, 2382, 4182, 5924, 8496, 9160, 11324, 12004, 12911, 13748, 17991, 360, 1204, 1827, 3414, 4113, 6246, 11100, 14047, 16707, 17495,
+  442, 5075, 6228, 7595, 8050, 9500, 11655, 12909, 14660, 16090, 334, 1096, 7625, 9679, 9895, 11067, 13533, 18484, 19957, 21, 1950, 2852, 3587, 6502, 9482, 10959, 12102, 17842, 17924, 18279, 18285, 18757,
+  797, 3196, 5196, 6709, 7892, 8206, 14644, 15033, 16321, 16628, 16774, 18222, 18905, 4454, 5881, 8719, 9188, 11336, 13131, 13177, 14184, 14237, 14815, 17479, 18234, 19183, 20394, 20622, 4035, 5343, 6186, 6397,
+  8646, 10163, 12051, 12717, 15359, 15730, 15940, 18371, 19981, 930, 3177, 8371, 8774, 11480, 11632, 12517, 12674, 12744, 13331, 17068, 19625, 514, 964, 1941, 3181, 3933, 6574, 7469, 12650, 15778, 16467, 18070,
+  20179, 20216, 590, 826, 3106, 4534, 5898, 8296, 8794, 12770, 14525, 14554, 16912, 2558, 3676, 3738, 4592, 5473, 5748, 8465, 8756, 11539, 13796, 13827, 14023, 15019, 16308, 18150, 18361, 2948, 6323, 10884,
+  11907, 19242, 19476, 19808, 840, 7784, 8991, 9026, 13085, 13676, 13801, 14496, 15157, 16147, 16600, 16876, 245, 1641, 2465, 2722, 2851, 7696, 9693, 15658, 17501, 17933, 19708, 522, 1334, 2563, 3831, 4372,
+  4670, 5734, 5749, 6326, 8094, 11054, 13018, 15970, 17794, 19813, 1601, 1815, 2872, 9195, 10194, 10603, 10836, 14458, 15249, 16479, 18093, 19672, 20502, 20527, 376, 5963, 8147, 9410, 12316, 14077, 16272, 16913,
+  19797, 20006, 2904, 3229, 3501, 3513, 7649, 7736, 13229, 14419, 15454, 15963, 1029, 7064, 10043, 10057, 10470, 11730, 12410, 12945, 15135, 16852, 17595, 17901, 845, 938, 1239, 5702, 8832, 10817, 14101, 16119,
+  17126, 18001, 159, 1216, 1785, 4691, 4978, 6348, 10523, 13606, 15874, 16172, 17098, 3575, 4764, 5562, 9070, 12174, 13597, 15671, 15702, 16063, 16395, 17516, 2314, 2833, 3700, 4328, 7251, 9763, 9948, 14090,
+  16494, 16704, 17608, 18204, 18352, 19104, 3077, 6578, 9984, 10491, 14837, 19002, 603, 2342, 3078, 3565, 6046, 7898, 8184, 9581, 9803, 13350, 14189, 14402, 15731, 18259, 19091, 2246, 4453, 5210, 6794, 7622,
+  8010, 8816, 9080, 9579, 10778, 12200, 12920, 17961, 18990, 19591, 1339, 2165, 3207, 9045, 11150, 18786, 20430, 1192, 2336, 3237, 5533, 5576, 7261, 8412, 9684, 10293, 11227, 11686, 14921, 18028, 19687, 1516,
+  2254, 2569, 4451, 5043, 5438, 6612, 6790, 6858, 8119, 10628, 10954, 12965, 17389, 193, 1381, 2447, 5370, 6573, 6741, 7115, 7444, 13703, 17027, 2345, 4165, 7682, 11808, 17770, 18979, 19922, 20680, 225,
+  1994, 2639, 3398, 4630, 11585, 12358, 14612, 14723, 1451, 1686, 2650, 3253, 4168, 9990, 10217, 11472, 11508, 14275, 16145, 16218, 19558, 19825, 53, 4152, 4564, 5093, 5446, 8060, 12319, 15651, 17087, 17559,
+  17883, 1439, 2126, 4413, 5272, 7438, 7667, 8128, 8462, 12067, 13315, 13386, 17050, 17096, 17176, 329, 1865, 10633, 11517, 12326, 13563, 16544, 17220, 17869, 18331, 18652, 2096, 2107, 2970, 3670, 4053, 7518,
+  8540, 9638, 11057, 12037, 12683, 17796, 5410, 9669, 10989, 11604, 12236, 13028, 13247, 15250, 17242, 18154, 18715, 2863, 2892, 2923, 5316, 7749, 11109, 15137, 19754, 19816, 481, 632, 679, 3233, 3485, 5090,
+  9096, 13303, 1188, 1940, 3110, 6193, 8251, 8644, 9214, 11165, 12955, 13898, 14155, 16381, 16492, 16646, 17000, 17761, 2049, 3125, 5553, 7822, 8809, 10387, 10740, 11247, 12057, 14194, 14254, 15604, 16942, 18133,
+  18478, 2065, 3381, 4170, 6513, 7499, 8404, 8484, 10805, 13289, 13454, 273, 517, 3967, 5938, 7029, 15281, 19318, 963, 4388, 4641, 5192, 5258, 6860, 7726, 7980, 13205, 15633, 15679, 16674, 19335, 19822,
+  451, 2434, 5526, 6475, 6723, 8818, 10436, 13885, 14785, 14797, 17849, 19685, 1306, 1590, 5474, 10238, 10296, 12558, 14050, 14595, 14988, 15467, 15771, 18904, 803, 5247, 8070, 12195, 12564, 13113, 13549, 15499,
+  17140, 123, 1353, 6865, 9791, 12272, 13250, 14426, 15852, 1668, 4037, 5405, 6697, 8140, 8178, 8573, 10279, 13047, 1074, 1459, 7109, 8583, 9522, 12339, 13456, 14979, 16957, 3944, 7268, 8417, 11410, 12823,
+  13622, 13774, 14538, 14722, 3795, 5664, 7108, 9082, 11688, 12030, 13044, 19584, 272, 1478, 2878, 4211, 4873, 8463, 13073, 16101, 16220, 16843, 17521, 17766, 17804, 18468, 20405, 391, 856, 1888, 3786, 6094,
+  7941, 8677, 9853, 9976, 11184, 12649, 12696, 17693, 20620, 1253, 3317, 3953, 5019, 5157, 9540, 9921, 12149, 12947, 14083, 15803, 16015, 16184, 16343, 20381, 736, 2189, 2829, 3121, 9541, 9858, 12064, 13396,
+  13669, 13921, 14171, 15601, 18290, 18769, 19482, 755, 912, 1872, 2194, 3158, 6577, 6806, 7297, 7790, 9066, 12048, 12874, 13211, 16851, 520, 914, 2167, 2619, 4109, 5847, 6844, 7141, 7451, 9338, 12826,
+  13963, 17471, 18632, 564, 4532, 7854, 9035, 9855, 12205, 13644, 16270, 16703, 18276, 18672, 20027, 20218, 305, 1735, 2468, 18633, 968, 1070, 9794, 18312, 101, 3188, 5121, 5229, 7863, 8311, 9370, 9878,
+  11448, 15105, 16041, 16778, 17810, 18580, 18764, 20249, 201, 372, 4720, 5122, 5314, 6086, 7039, 15067, 18521, 18538, 19583, 2734, 4235, 5761, 6617, 6845, 8635, 12680, 12868, 13418, 14120, 20244, 2419, 3613,
+  4234, 5976, 7533, 9394, 14642, 14678, 18766, 3432, 8598, 9085, 9301, 11013, 17168, 20322, 20630, 4740, 4914, 5409, 7695, 7737, 8632, 13210, 13613, 15355, 3996, 7752, 10167, 10420, 10700, 11912, 14334, 15280,
+  2037, 5016, 5113, 6025, 6552, 7631, 10298, 15212, 15413, 16872, 653, 1130, 6320, 6712, 12833, 13071, 20165, 814, 1783, 3916, 4571, 4599, 4962, 5418, 5535, 6427, 6848, 9433, 13614, 16552, 17791, 18831,
+  541, 3375, 4011, 6152, 6615, 8649, 11251, 13688, 13720, 14388, 15163, 15838, 16964, 17776, 19958, 631, 830, 7701, 8763, 14281, 16198, 17043, 20457, 20768, 4279, 5065, 6886, 7382, 10525, 16058, 19769, 20615,
+  1463, 3211, 5091, 5822, 8316, 8626, 9832, 10371, 12215, 13629, 15502, 15585, 17338, 17575, 19008, 3979, 4030, 5399, 7652, 9144, 10770, 15361, 16245, 17872, 19403, 3050, 3860, 6665, 9064, 11541, 11982, 12440,
+  12956, 14505, 20675, 4923, 12293, 16437, 1310, 2399, 4742, 4759, 9010, 12234, 12816, 14987, 558, 2405, 2629, 2896, 3373, 3594, 4474, 5491, 6901, 9917, 12071, 13122, 13705, 17554, 18644, 20666, 2615, 8904,
+  17667, 1790, 2588, 5781, 6056, 8579, 9237, 9419, 10227, 11954, 16158, 18718, 18846, 19309, 19715, 20409, 506, 1329, 4129, 4644, 9608, 12963, 13684, 13734, 16839, 17228, 17470, 19932, 1034, 4714, 4737, 5444,
+  9325, 9463, 9471, 11454, 11770, 12468, 14342, 18938, 1636, 3161, 6459, 6850, 9566, 9589, 12784, 14560, 15717, 20761, 4715, 6273, 6473, 7014, 7195, 12320, 13904, 14677, 17077, 17286, 17753, 19377, 19724, 20146,
+  20308, 2354, 2357, 2483, 4705, 6295, 7363, 7437, 7564, 14247, 16211, 17230, 18265, 18462, 18541, 86, 1134, 2079, 4654, 5451, 5616, 5887, 7484, 11332, 11880, 16987, 17039, 17164, 20448, 933, 1312, 1490,
+  3732, 4398, 5176, 6164, 8973, 9118, 9332, 9857, 14397, 17351, 758, 5502, 5882, 6276, 8975, 9122, 9658, 10294, 12777, 13666, 15437, 19189, 918, 5054, 7896, 8547, 11459, 12639, 12658, 13103, 13969, 2329,
+  2724, 4539, 5906, 6565, 10112, 10335, 10552, 10579, 11482, 12160, 12713, 15295, 16384, 19350, 3146, 4547, 7086, 7389, 8079, 8430, 11571, 12923, 13230, 14028, 14168, 14378, 14452, 15444, 17887, 18339, 1480, 2454,
+  5084, 5896, 8722, 9848, 10076, 10697, 10985, 13218, 13706, 16060, 20608, 207, 958, 1374, 1408, 1553, 2543, 4478, 4736, 5600, 5941, 7982, 8248, 11576, 11911, 12114, 17601, 19, 313, 710, 2251, 5907,
+  7319, 11169, 11354, 12665, 13625, 16755, 18227, 18838, 97, 6140, 9707, 14421, 15108, 15388, 16612, 19208, 3964, 4920, 4945, 5174, 8394, 16451, 17396, 17713, 18956, 19737, 347, 608, 2467, 3662, 3908, 6660,
+  13249, 13410, 13576, 15360, 18065, 19725, 19866, 460, 495, 4555, 4696, 5431, 6816, 7858, 9496, 9885, 12179, 13153, 14951, 15463, 19984, 1170, 1288, 2192, 2413, 2578, 4668, 9056, 11200, 12878, 13853, 14497,
+  19697, 19975, 20066, 1420, 2086, 2115, 3420, 3540, 9474, 10622, 11352, 11519, 13089, 13578, 14277, 15461, 17741, 19562, 20691, 111, 1711, 3260, 5044, 6447, 7095, 8544, 11529, 11618, 12207, 13001, 17674, 580,
+  1186, 4332, 6664, 11030, 12944, 14211, 15298, 16022, 16729, 19736, 573, 2128, 2643, 7591, 12092, 13770, 14205, 15960, 17057, 17819, 1925, 3959, 4912, 10243, 11280, 11979, 17518, 18952, 20522, 20651, 791, 2408,
+  10035, 10195, 11326, 12655, 15063, 17702, 19122, 841, 1838, 2125, 2330, 2384, 3115, 4698, 6068, 6479, 6672, 7361, 14436, 15058, 15909, 20294, 1286, 2239, 2576, 3895, 6304, 7203, 10626, 11303, 14783, 16316,
+  1634, 3276, 4188, 4476, 5048, 9310, 11750, 14032, 18090, 18307, 18791, 19418, 20554, 20687, 202, 1116, 5337, 8637, 14503, 16062, 16194, 16995, 19174, 2108, 3641, 5764, 5843, 7530, 7952, 8057, 10086, 14283,
+  14739, 15812, 19990, 2184, 8420, 8652, 8905, 9183, 9231, 14486, 14756, 15967, 18943, 20400, 4977, 8127, 9079, 11052, 13383, 13991, 16094, 2262, 8781, 10972, 12008, 12220, 14498, 15505, 15784, 19395, 20177, 2030,
+  5300, 9599, 10538, 11904, 17512, 19647, 972, 2521, 8843, 9142, 11058, 12211, 12380, 13664, 14062, 14528, 19461, 231, 362, 4794, 8654, 10845, 12086, 14840, 19617, 1860, 4347, 7296, 8572, 8768, 12606, 15953,
+  16785, 17616, 18466, 7371, 7651, 7777, 9770, 16480, 17186, 19048, 19214, 19602, 131, 4433, 7511, 8013, 9018, 9060, 10546, 12950, 13740, 17800, 18132, 20625, 2061, 3128, 4393, 4721, 15451, 15695, 17739, 18075,
+  19022, 19282, 19497, 19670, 161, 277, 3234, 3624, 5011, 6157, 6924, 7867, 8822, 9314, 16397, 16508, 19198, 2498, 4095, 4351, 4382, 4992, 8851, 10767, 11856, 13146, 14699, 18212, 18724, 1616, 5613, 6952,
+  8293, 8548, 10733, 10907, 10980, 12451, 13094, 13451, 16421, 18960, 895, 948, 2697, 4047, 5657, 6873, 7435, 8174, 11405, 14908, 19299, 20270, 3531, 4814, 6319, 6798, 8439, 9499, 10781, 13155, 15748, 16148,
+  18888, 19937, 491, 1119, 2242, 6782, 9283, 9677, 11595, 15673, 15986, 17856, 19039, 19111, 1125, 1747, 2348, 5436, 5891, 6795, 7462, 10768, 12789, 16230, 19969, 20495, 374, 1806, 1812, 6492, 9590, 11938,
+  12593, 17330, 17628, 17697, 20142, 20267, 774, 2163, 4021, 8819, 10567, 11060, 11725, 11821, 14721, 15297, 16000, 17276, 19254, 20258, 1628, 4927, 4999, 5092, 9584, 9786, 14121, 15908, 16204, 18365, 18768, 19467,
+  740, 3479, 4835, 10134, 11994, 13318, 13517, 14093, 17928, 18005, 18220, 18420, 18787, 471, 1623, 4146, 6270, 7349, 7697, 8111, 9627, 16556, 19851, 20383, 20692, 1178, 1272, 2050, 4607, 5808, 6256, 6871,
+  10108, 12773, 13897, 17234, 19747, 20443, 704, 969, 2400, 2549, 3538, 4866, 7384, 9289, 18342, 19426, 19714, 19753, 3342, 3664, 3745, 6355, 6367, 6579, 7719, 9182, 10645, 14308, 478, 1858, 2035, 3208,
+  7410, 10621, 14765, 15411, 20351, 28, 687, 1493, 2524, 2602, 5321, 5463, 8901, 9960, 12591, 14125, 14154, 14598, 17269, 20219, 2979, 3020, 4610, 5055, 12601, 13524, 14244, 14707, 16121, 17170, 18589, 20252,
+  1518, 1541, 2170, 3170, 5218, 8481, 10753, 16528, 16721, 17748, 20485, 407, 1233, 1839, 2091, 3937, 4522, 5329, 7196, 10489, 11975, 12980, 13025, 18700, 160, 731, 2307, 3032, 3066, 4965, 10181, 10307,
+  12497, 13394, 19478, 216, 1778, 6463, 7057, 11793, 15968, 17353, 20470, 1979, 3645, 4513, 7681, 8328, 9760, 10786, 10905, 11205, 11932, 12262, 12300, 20152, 20302, 195, 3190, 6065, 7142, 7834, 10468, 11840,
+  19557, 19631, 2952, 3534, 3544, 6941, 7705, 9159, 13397, 15561, 1397, 1631, 2789, 3396, 8045, 10288, 10896, 11127, 11600, 12666, 15662, 15919, 16754, 16879, 3135, 7495, 8143, 10219, 10671, 11928, 14506, 16514,
+  17706, 3470, 3477, 4389, 4401, 7378, 8054, 9475, 9495, 12053, 12926, 13147, 14620, 15989, 16936, 20664, 6030, 6092, 10157, 10354, 14537, 15112, 16269, 17382, 966, 5660, 5825, 9665, 10174, 10637, 12108, 14152,
+  15486, 18502, 2275, 6867, 10719, 14084, 14740, 15114, 17265, 17818, 3563, 5538, 5980, 6019, 6582, 7071, 8373, 12423, 12977, 15752, 18725, 19538, 19907, 20209, 20728, 6690, 7264, 8300, 9434, 9828, 10792, 11443,
+  12150, 15420, 15422, 16935, 5062, 6428, 6465, 9733, 11603, 13948, 16769, 987, 3627, 4855, 7412, 9345, 9483, 11790, 11902, 12096, 13008, 13607, 14991, 15862, 19544, 19748, 2190, 2664, 3279, 4431, 5448, 7792,
+  8523, 9259, 9598, 11984, 12559, 13322, 13917, 14591, 15039, 16285, 526, 1293, 1341, 1594, 3502, 4709, 8685, 11807, 12081, 12274, 12572, 14990, 15494, 15749, 19722, 20074, 1987, 3352, 6125, 6962, 9222, 11141,
+  11605, 12818, 16739, 17850, 18232, 18931, 100, 6119, 9906, 12457, 12940, 13228, 13997, 19025, 20193, 304, 2060, 2547, 4584, 4646, 4983, 5142, 6088, 6389, 10054, 10731, 15300, 17879, 19359, 19834, 3888, 6547,
+  7552, 8698, 8736, 10734, 12062, 13082, 13127, 17003, 19609, 4540, 8116, 9633, 10040, 15016, 16099, 1426, 5398, 7099, 7303, 8542, 9911, 10210, 10670, 12795, 12820, 14472, 15225, 15299, 18759, 20121, 20167, 2906,
+  5200, 9678, 11701, 16988, 18246, 18372, 20391, 20449, 20453, 1060, 3694, 4238, 5461, 6789, 17317, 17994, 18727, 395, 1626, 1688, 2014, 3007, 7494, 8019, 10044, 10584, 13556, 16692, 17513, 18697, 20189, 737,
+  2611, 4114, 5027, 5129, 5914, 6655, 6689, 11143, 12275, 15256, 16511, 17015, 18932, 19060, 1157, 1956, 4662, 4795, 6169, 9663, 10788, 11066, 11218, 11526, 15472, 16227, 16653, 18391, 19153, 19498, 361, 1797,
+  4069, 9949, 12672, 13097, 14001, 14487, 14524, 14665, 15120, 16331, 16903, 19009, 19472, 19755, 674, 1647, 3104, 3349, 5496, 7709, 7935, 7998, 9641, 10275, 10981, 13332, 13419, 17867, 19222, 19373, 2646, 2739,
+  2900, 8929, 10991, 13259, 14037, 15122, 17487, 154, 410, 3476, 3881, 6122, 9044, 14501, 14645, 19561, 19573, 3687, 4626, 5756, 7192, 9379, 10648, 18850, 19092, 19944, 1848, 3094, 4638, 7496, 8059, 10399,
+  11816, 13936, 14871, 2461, 2932, 6957, 8314, 9294, 17467, 17638, 17758, 4952, 5683, 5720, 7414, 8510, 12566, 15642, 16260, 19817, 20145, 2820, 3482, 4173, 6352, 11348, 12500, 15260, 18719, 20553, 700, 7674,
+  8189, 12725, 13012, 14333, 15220, 15997, 18194, 793, 3183, 8427, 10207, 10359, 12295, 12378, 16066, 16797, 19551, 1655, 2745, 5315, 5965, 9102, 10139, 14020, 14234, 15809, 16567, 17319, 17660, 17868, 18162, 20652,
+  20693, 849, 4283, 5159, 7279, 9624, 11492, 16074, 16454, 18295, 18534, 20350, 62, 582, 593, 5827, 6470, 6791, 10361, 10411, 11452, 16565, 759, 2320, 4556, 6158, 7559, 7759, 10693, 11915, 14257, 16775,
+  18059, 18617, 20741, 20750, 1595, 4076, 6058, 7051, 8261, 9051, 10928, 13944, 14649, 15140, 17712, 17722, 18293, 19704, 1148, 1813, 2425, 2998, 3992, 4842, 5359, 6357, 7643, 8253, 8966, 11430, 13766, 14597,
+  19949, 4725, 7087, 13737, 15390, 18151, 20397, 2368, 4187, 4423, 8808, 11772, 13345, 15277, 16337, 16911, 18814, 19155, 19887, 1270, 4338, 8310, 11521, 11935, 15161, 15620, 19300, 20251, 2949, 7932, 8436, 12098,
+  13357, 13535, 15310, 19460, 280, 1563, 2123, 7126, 8553, 8878, 10179, 13855, 15119, 16394, 18355, 4400, 5523, 7257, 9488, 16007, 20610, 1172, 1545, 7127, 10252, 10338, 12255, 13964, 14570, 15059, 19421, 19782,
+  181, 1386, 2491, 3496, 3917, 4395, 4934, 7844, 8411, 9042, 19574, 3862, 3906, 4931, 6403, 11189, 12412, 12432, 13647, 13692, 14461, 16616, 18775, 19023, 9285, 10136, 11643, 13078, 14557, 15938, 17461, 17646,
+  3081, 3212, 5742, 7124, 7951, 12109, 13730, 14456, 15954, 17426, 17665, 20135, 20518, 3118, 6121, 8185, 17215, 17583, 18208, 235, 1256, 1331, 3088, 4255, 4722, 8655, 9191, 10738, 11870, 12670, 12729, 13355,
+  14159, 16334, 18282, 1507, 2353, 2550, 6079, 8033, 10652, 11236, 11357, 11791, 17262, 20373, 322, 1565, 1677, 2381, 12303, 12503, 13007, 14289, 15558, 15760, 19057, 20039, 20312, 20560, 415, 836, 1031, 3219,
+  4204, 5124, 11709, 16700, 16863, 17830, 18334, 19621, 3546, 6377, 8588, 10182, 12720, 13037, 13310, 15092, 15349, 17362, 19094, 19543, 19597, 919, 8137, 8874, 9666, 9817, 10936, 12968, 13521, 13560, 14105, 16166,
+  17250, 20556, 2492, 2541, 2677, 5569, 7557, 9308, 9997, 18367, 19745, 20196, 2012, 2777, 3570, 6015, 6422, 11630, 12933, 19411, 20760, 633, 820, 17177, 20116, 1609, 1725, 3145, 3225, 4203, 5341, 9481,
+  12764, 13894, 15415, 17148, 18328, 1831, 5799, 6458, 13634, 14818, 17238, 17413, 17745, 18929, 19226, 466, 2350, 2721, 2999, 4524, 9009, 9297, 12025, 16548, 16669, 18000, 18269, 20419, 366, 404, 1184, 1821,
+  7541, 12110, 16497, 17310, 19173, 689, 2134, 3844, 4828, 7058, 8066, 8145, 11246, 11867, 12507, 13430, 15337, 18445, 3204, 4417, 9202, 10236, 13480, 16522, 16758, 896, 2422, 3867, 4789, 9694, 11891, 12169,
+  14046, 15466, 20450, 1816, 2442, 7183, 7569, 9662, 10995, 11487, 13204, 18164, 19854, 1073, 4436, 8515, 9842, 10012, 10459, 11007, 14604, 15292, 15348, 1051, 3069, 17990, 18082, 18603, 19292, 20299, 371, 1701,
+  4039, 4991, 6627, 7374, 13414, 13617, 16369, 4554, 6425, 6661, 8469, 9913, 16083, 17629, 20195, 1501, 5293, 7770, 13835, 14350, 15853, 18354, 18579, 20609, 2475, 4956, 5639, 8183, 16242, 16934, 17118, 17573,
+  761, 2284, 3711, 9014, 9121, 9977, 14231, 14771, 16433, 17631, 19952, 1164, 2798, 3592, 7585, 8367, 10889, 15060, 18225, 4018, 4628, 6335, 6466, 7353, 14830, 16118, 18155, 19303, 1249, 1319, 1410, 4315,
+  5997, 17613, 18707, 20065, 249, 419, 2947, 3037, 4856, 5962, 11406, 11575, 12999, 16463, 2267, 5692, 6638, 7517, 9072, 12608, 15149, 3242, 4083, 5052, 6078, 7508, 7663, 7965, 8509, 10548, 14126, 14318,
+  14355, 14938, 15759, 16165, 18382, 6, 1376, 4220, 5000, 7230, 8787, 10016, 10909, 11209, 15545, 19490, 355, 487, 2490, 3932, 4082, 4166, 6471, 6636, 8681, 13645, 18140, 2260, 4658, 4788, 4805, 5194,
+  7011, 10031, 14176, 16859, 17326, 18530, 20166, 1217, 1503, 2438, 2750, 3446, 9355, 9357, 13109, 14867, 19516, 19600, 19713, 20674, 2214, 2272, 2592, 2667, 4336, 12142, 12692, 14142, 15939, 1877, 4550, 5468,
+  7806, 9340, 15707, 17346, 17519, 19221, 19417, 1112, 3411, 4099, 8247, 8978, 12107, 16076, 16224, 19158, 19911, 888, 1092, 1137, 2356, 6856, 8289, 8867, 12121, 12361, 12974, 13392, 13704, 17747, 18377, 19130,
+  20335, 3221, 3684, 5160, 6743, 6937, 7111, 8097, 8760, 9508, 11908, 12368, 1156, 4802, 5003, 7401, 9360, 11673, 12671, 13404, 14742, 17248, 19087, 314, 2416, 2931, 3529, 3537, 4224, 5521, 7405, 7519,
+  10330, 13866, 14475, 14942, 19427, 20440, 20713, 7256, 8997, 12414, 14325, 14513, 16027, 16055, 16379, 19449, 19967, 880, 6959, 7084, 7509, 8826, 11114, 13485, 14906, 16591, 16601, 20071, 20474, 2202, 3366, 3907,
+  5545, 8354, 9386, 11623, 13663, 20366, 537, 3754, 4588, 5034, 5313, 5650, 6385, 9290, 9352, 16110, 19110, 2283, 6852, 10233, 10955, 11669, 18895, 5424, 5504, 6291, 8998, 10465, 10997, 13095, 13871, 15782,
+  16469, 17480, 20656, 7543, 7554, 9097, 10352, 10691, 12135, 12349, 15088, 17023, 19666, 20447, 462, 628, 945, 2155, 5022, 5460, 6837, 10572, 16453, 16747, 17809, 18054, 18398, 22, 1046, 2614, 8129, 9934,
+  10091, 13811, 15821, 16383, 17724, 18430, 1260, 1674, 3518, 4443, 7238, 8937, 12269, 14687, 19512, 1016, 2023, 2994, 3940, 6014, 7556, 9425, 10703, 10704, 14710, 14993, 15543, 19518, 1643, 2142, 5932, 6683,
+  9373, 10853, 12849, 13638, 18073, 127, 1512, 9695, 11305, 12089, 12488, 13752, 18810, 516, 2370, 2962, 5531, 5955, 6334, 7485, 11266, 12611, 14059, 17243, 17860, 19639, 19946, 20280, 1564, 4360, 9040, 9998,
+  10865, 11128, 12041, 13116, 15479, 16589, 17948, 20331, 20698, 2346, 4488, 4791, 6626, 7121, 7702, 7938, 8709, 8811, 11008, 12116, 12957, 14696, 588, 3651, 5935, 8191, 9910, 10176, 13467, 14114, 14541, 16393,
+  17502, 18674, 19255, 5208, 7463, 8242, 8710, 8751, 11363, 12931, 14054, 15773, 16312, 16632, 18968, 569, 2191, 2361, 4026, 4787, 7480, 12346, 14800, 14820, 19238, 19844, 1343, 3487, 4254, 10838, 10922, 11761,
+  12538, 14210, 15134, 17244, 20243, 3439, 4219, 4221, 5620, 6764, 10986, 11825, 16764, 17199, 18303, 18870, 20601, 243, 2296, 2668, 15619, 16450, 17942, 1773, 1895, 2514, 2874, 3803, 5368, 5432, 5817, 7273,
+  7654, 8846, 11086, 12251, 14103, 18134, 1161, 2533, 5170, 7419, 15811, 19342, 19966, 2339, 4567, 4692, 4816, 6200, 7748, 8302, 8602, 10973, 11873, 14134, 14866, 17598, 17678, 18866, 19659, 1766, 5445, 7843,
+  17259, 19710, 19865, 477, 2944, 6819, 7644, 9058, 9149, 11828, 12145, 13241, 13745, 15070, 17135, 18257, 20591, 20647, 149, 1027, 1342, 2295, 5294, 6059, 8445, 10901, 13121, 13960, 14576, 14578, 17491, 19920,
+  19989, 2783, 3883, 6890, 9019, 9087, 11952, 12356, 12377, 20636, 183, 2529, 2748, 3621, 8922, 10994, 12904, 18314, 19225, 891, 5996, 6938, 8357, 9059, 9807, 10744, 11279, 11745, 12516, 13956, 15156, 511,
+  1167, 1663, 1834, 3978, 4880, 5292, 7311, 8743, 9759, 12430, 13376, 13905, 18392, 18397, 20022, 1527, 6100, 7639, 7665, 7804, 10897, 11883, 11974, 14546, 14679, 16909, 17884, 19159, 19265, 19893, 20023, 2068,
+  3335, 6945, 7302, 8149, 8218, 8478, 9546, 11105, 11290, 12916, 15565, 18818, 19546, 384, 2513, 3875, 4171, 5566, 7841, 10111, 13192, 13471, 14590, 15890, 16388, 17746, 20718, 2017, 2171, 3692, 9924, 10413,
+  14806, 15538, 17264, 18574, 19042, 19147, 20026, 5004, 5490, 7620, 11043, 11894, 15136, 15646, 18375, 18564, 1869, 2953, 5219, 5762, 6409, 7795, 8256, 12565, 13461, 16345, 16510, 18018, 18746, 1406, 1904, 7017,
+  7073, 8407, 13810, 14466, 15770, 16676, 16828, 1294, 4871, 5532, 6354, 15897, 16330, 18802, 20752, 1953, 7406, 8405, 9950, 12935, 13544, 13555, 15806, 16759, 18626, 1126, 3084, 4605, 4876, 7212, 7502, 9632,
+  10005, 11144, 13041, 13552, 14807, 17225, 18401, 332, 2089, 3016, 3655, 3758, 3779, 4323, 4655, 6248, 13317, 13821, 13906, 15971, 18405, 19207, 20742, 1323, 4418, 7661, 7710, 8418, 10160, 11042, 11078, 12127,
+  12839, 16340, 20202, 20435, 20454, 20605, 1833, 3659, 4783, 8219, 8497, 11317, 11556, 13491, 14029, 14370, 16727, 1883, 5969, 10266, 11059, 11132, 14248, 15022, 16043, 17574, 18165, 18849, 1524, 4676, 5233, 6430,
+  6891, 9478, 12857, 17216, 17399, 3720, 6183, 6516, 6994, 9399, 10819, 12486, 13526, 17973, 19178, 20198, 20639, 309, 3124, 3562, 7431, 7832, 8122, 9201, 10432, 12897, 15587, 16665, 17060, 17205, 17771, 18555,
+  20744, 2323, 2453, 4886, 6537, 8825, 8947, 8999, 10337, 11797, 11813, 13492, 15429, 18638, 19756, 19998, 779, 1572, 1721, 2031, 2355, 3056, 5646, 10575, 18414, 3379, 7393, 7546, 7678, 13604, 14294, 16938,
+  17813, 19065, 19820, 1384, 3452, 3999, 7498, 10537, 11914, 13667, 16139, 18706, 2159, 3389, 4214, 7571, 10501, 13603, 15709, 18114, 1873, 5939, 6312, 8700, 11999, 13551, 14882, 17063, 18694, 20225, 20624, 1608,
+  1630, 1703, 2608, 5868, 9861, 14131, 14200, 18247, 19021, 915, 1198, 2226, 5625, 6075, 7229, 7757, 9205, 9559, 10408, 10679, 10749, 10825, 13057, 13833, 15777, 728, 2587, 3400, 7733, 10673, 11746, 11960,
+  12282, 13971, 14490, 14530, 15982, 16837, 18056, 18207, 2584, 3265, 3599, 3905, 4953, 5561, 5948, 6910, 8680, 9870, 10640, 12147, 12362, 16032, 2443, 2856, 3320, 3774, 4549, 6787, 9119, 10569, 14758, 14846,
+  15239, 15377, 19237, 20595, 1438, 1917, 2644, 3874, 4683, 4815, 5730, 7420, 7810, 9502, 10456, 10646, 14512, 15956, 16266, 18594, 4065, 5853, 5944, 6976, 7619, 8796, 12548, 14801, 18236, 20076, 837, 1479,
+  4943, 5919, 6363, 9312, 13472, 14810, 17620, 17775, 17966, 19439, 19867, 916, 9728, 10591, 12265, 12798, 12888, 13043, 13244, 14744, 14941, 15318, 17908, 19879, 581, 1481, 2365, 3315, 3505, 4248, 9718, 11315,
+  18693, 1105, 3072, 3922, 5250, 5705, 6533, 10550, 15223, 17822, 5128, 5351, 6052, 7129, 12894, 13052, 13373, 15234, 17172, 2219, 4096, 8037, 12054, 14266, 14841, 15697, 16130, 17430, 2228, 3080, 3607, 5805,
+  11789, 15237, 17133, 17735, 19405, 1656, 7989, 8820, 11726, 13107, 15165, 15659, 16618, 19102, 578, 2963, 3264, 3771, 7163, 15228, 15865, 16239, 18783, 960, 1759, 3581, 4642, 7614, 11017, 15881, 16059, 20662,
+  68, 2041, 9225, 9408, 12970, 13500, 16205, 19044, 20101, 2640, 3842, 4127, 4529, 7740, 11147, 14858, 14887, 16315, 1371, 3455, 10080, 10477, 11407, 14366, 16081, 18922, 20511, 238, 3506, 10460, 14775, 15013,
+  17022, 18591, 18977, 19281, 385, 1028, 4708, 6923, 7189, 8500, 9626, 11936, 17729, 18211, 1844, 2631, 7130, 7711, 8836, 16241, 16625, 17051, 46, 1205, 1847, 3249, 4387, 12310, 16310, 16953, 20631, 644,
+  757, 1780, 5897, 6870, 14198, 15465, 15984, 17266, 164, 1978, 2058, 2682, 4505, 9397, 13286, 15758, 16592, 18116, 18762, 570, 2960, 3986, 10311, 11033, 12002, 15481, 17974, 19033, 1080, 2757, 4602, 8043,
+  11003, 12716, 13584, 15725, 18944, 19245, 278, 2210, 3499, 5239, 6467, 8859, 12070, 14088, 16151, 17769, 1968, 2763, 3098, 4639, 6939, 8267, 10137, 11993, 13828, 14357, 19288, 798, 9344, 10706, 13873, 15779,
+  17277, 1539, 2437, 5335, 6445, 7901, 7999, 8391, 10573, 11918, 12063, 13881, 17352, 20582, 1421, 2618, 4456, 4851, 6176, 7207, 12803, 15887, 16597, 19650, 802, 3347, 4719, 5788, 6426, 8622, 10342, 13258,
+  20746, 344, 437, 974, 1415, 5348, 10129, 11071, 11819, 12748, 17019, 614, 4063, 4625, 4870, 5195, 10588, 11937, 16763, 17169, 2927, 3377, 3789, 3873, 4618, 5592, 7160, 7768, 9576, 11353, 12444, 13312,
+  14916, 15252, 17293, 20552, 350, 5099, 5575, 6731, 8156, 10474, 10990, 11207, 12182, 12899, 13081, 16104, 17105, 17323, 20542, 542, 4862, 9073, 9792, 11219, 11515, 12688, 15933, 17237, 19554, 3156, 4958, 11753,
+  14482, 14627, 14874, 16861, 18948, 1010, 4469, 5423, 10713, 10784, 11633, 12533, 15554, 16944, 17046, 1066, 3829, 12758, 16287, 19365, 20688, 20781, 773, 1588, 3162, 7232, 7286, 7973, 9280, 9430, 9610, 9765,
+  12035, 14878, 15427, 19818, 7122, 15992, 18649, 4621, 6757, 8456, 9440, 9652, 12990, 13509, 14989, 15205, 16304, 17407, 17876, 2358, 2812, 4050, 6255, 8504, 9668, 13292, 14939, 16534, 3926, 4452, 6053, 10038,
+  12172, 15567, 16838, 20197, 3833, 10331, 11230, 11727, 18413, 4718, 4940, 5874, 7351, 7630, 9002, 12256, 13680, 19500, 5918, 6783, 10321, 13860, 15267, 15408, 18972, 19062, 20000, 453, 2617, 5244, 6861, 7094,
+  8038, 11193, 11923, 12492, 15457, 16296, 17180, 18902, 19629, 19882, 6853, 7161, 8855, 11107, 16114, 16941, 19084, 20515, 2480, 3678, 4408, 4950, 11272, 13648, 16654, 16737, 17342, 18370, 4067, 6834, 7453, 8584,
+  9422, 10299, 12066, 12209, 12511, 20103, 1052, 1782, 3872, 4386, 4933, 8227, 9057, 9421, 10842, 11717, 12483, 12927, 17013, 17364, 18302, 19344, 1627, 1988, 4055, 4996, 5222, 6316, 7457, 9054, 11431, 12906,
+  13372, 14859, 15681, 16128, 17074, 17212, 807, 2310, 3035, 4614, 6343, 6407, 7618, 8136, 10505, 10658, 10898, 11274, 12031, 15329, 15533, 15708, 1428, 2309, 2939, 6949, 6970, 9287, 9551, 10730, 15038, 17109,
+  19319, 20759, 122, 1131, 2077, 3314, 3610, 5605, 6508, 15958, 18491, 18666, 1911, 3261, 6420, 15147, 15976, 17010, 17441, 19000, 19257, 20444, 20797, 858, 993, 1450, 5811, 6478, 9565, 13624, 14912, 18109,
+  2302, 2821, 2859, 3215, 4310, 4537, 7245, 10674, 12793, 82, 954, 2463, 4728, 4885, 5147, 11214, 12324, 18026, 20404, 283, 6134, 7190, 7294, 7601, 8939, 16468, 19379, 19721, 19751, 3385, 4536, 4770,
+  6108, 6381, 8085, 8202, 8315, 10055, 13477, 13872, 14327, 20603, 70, 3463, 4228, 4732, 5834, 6738, 6817, 7170, 9151, 9900, 10232, 11213, 13163, 14693, 19766, 20514, 818, 5080, 7903, 8142, 8414, 8721,
+  11743, 12415, 13793, 13805, 14754, 15680, 15826, 16559, 19642, 19749, 3332, 3334, 8306, 8503, 9143, 10461, 11899, 14829, 15054, 17676, 1704, 6777, 6969, 7731, 10798, 12513, 19539, 1882, 4321, 4748, 8106, 8203,
+  9417, 9836, 10864, 10886, 13324, 14856, 15860, 16328, 17590, 17663, 279, 1213, 6170, 7248, 8522, 10960, 11239, 13042, 13437, 13830, 16057, 17035, 17756, 18498, 18618, 18684, 1431, 2747, 3500, 5089, 5807, 8238,
+  8784, 11339, 14542, 14684, 15206, 18630, 19166, 19504, 19706, 20478, 1964, 2016, 2510, 3321, 4657, 5725, 6477, 9299, 9334, 10199, 16943, 17511, 18559, 19730, 20422, 29, 1485, 5731, 5821, 6897, 7167, 8249,
+  9270, 10910, 15750, 17591, 5610, 6217, 10000, 10063, 11559, 11909, 13628, 14996, 15974, 15988, 17119, 17299, 18659, 422, 1578, 10681, 13158, 13504, 17268, 17458, 18494, 18961, 1364, 3042, 4589, 6376, 18665, 19381,
+  19599, 19842, 20736, 1570, 1598, 3148, 4839, 5289, 8428, 11475, 12600, 15965, 17383, 18166, 18453, 19806, 223, 1387, 2011, 3133, 4318, 5168, 8690, 10983, 12530, 14485, 16741, 16881, 17312, 2389, 8451, 8833,
+  9536, 9839, 10564, 18301, 19430, 20541, 20569, 52, 1939, 11557, 13035, 18098, 19596, 20174, 1999, 4041, 5125, 5402, 5819, 6548, 6720, 6754, 7265, 7689, 12000, 12305, 16275, 16971, 20107, 1584, 2740, 3355,
+  4552, 4558, 5928, 6446, 7373, 8571, 9268, 9886, 10676, 11445, 12618, 54, 2866, 5597, 6905, 7987, 9001, 13516, 18730, 19297, 2986, 4080, 6002, 7037, 7648, 8452, 12228, 13273, 15433, 18105, 18842, 3995,
+  6249, 11823, 17302, 20379, 1554, 1748, 1753, 3384, 5206, 6600, 6975, 8052, 8187, 14752, 14791, 14970, 18546, 18562, 19681, 20607, 8291, 2080, 9918, 10729, 1444, 4769, 12702, 15994, 19972, 20543, 20643, 233,
+  1179, 4593, 6658, 8965, 9389, 13822, 15032, 15198, 17349, 5046, 7219, 11714, 16372, 17434, 775, 2141, 3744, 4180, 8193, 8370, 9206, 11830, 12948, 14036, 15551, 18516, 937, 5672, 6493, 10965, 12749, 562,
+  1059, 3269, 5189, 6201, 9539, 11014, 15424, 16808, 18183, 19830, 8804, 11172, 11771, 18084, 19170, 19384, 0, 1231, 2835, 4273, 5783, 6985, 16070, 17414, 17607, 17648, 18231, 19553, 194, 692, 6067, 8014,
+  10125, 10184, 15107, 19847, 4479, 5498, 6449, 6645, 7422, 16634, 16761, 16967, 17025, 17201, 17718, 790, 2561, 3921, 5374, 9964, 11284, 11360, 13657, 18981, 19354, 19577, 2801, 8642, 9120, 10010, 10801, 11898,
+  12464, 18918, 19873, 20248, 1694, 3336, 5072, 7194, 7441, 8624, 14834, 15330, 16298, 16782, 72, 5505, 6149, 12603, 16917, 18219, 18429, 20115, 392, 2698, 6736, 7000, 8471, 11080, 12755, 14309, 19330, 19686,
+  2305, 4186, 8927, 9089, 9305, 9385, 11428, 15638, 17783, 17836, 47, 2905, 3790, 4921, 5287, 6588, 8134, 8225, 11426, 15879, 18097, 18987, 19613, 1864, 3368, 4827, 6491, 6797, 7874, 10270, 11614, 13819,
+  14055, 18984, 19146, 2663, 2930, 3897, 6903, 10643, 11432, 11963, 14745, 15037, 15783, 17995, 20648, 20747, 2655, 4231, 4656, 5649, 6168, 7963, 10946, 12312, 12343, 20679, 455, 1799, 2197, 2248, 5152, 5642,
+  9674, 9968, 10103, 11377, 13074, 14401, 15003, 1726, 3164, 6737, 8488, 9999, 11945, 13256, 14577, 16206, 20154, 565, 720, 2385, 9400, 12286, 14313, 15792, 17401, 18957, 20133, 3900, 5217, 5743, 6568, 7626,
+  11376, 13701, 16347, 16809, 18003, 2234, 7954, 8856, 9465, 9752, 10088, 10533, 10711, 13341, 14479, 1755, 3679, 6081, 9327, 11864, 13452, 13868, 15757, 16389, 18790, 323, 1841, 2264, 5800, 10412, 11916, 12578,
+  12998, 16159, 17163, 17889, 4681, 4778, 7082, 9137, 9146, 11438, 14494, 16209, 18927, 874, 3571, 4619, 7563, 8426, 9692, 10934, 11616, 13125, 13175, 14532, 18798, 19679, 19900, 20685, 2637, 3712, 8853, 9016,
+  9460, 9996, 13798, 19698, 20364, 1633, 2512, 3442, 7725, 10169, 11304, 12872, 13507, 19635, 20175, 669, 3863, 6460, 8107, 11074, 12841, 14637, 16751, 1548, 4008, 5354, 5751, 6811, 7529, 8023, 8480, 9929,
+  11966, 12760, 16295, 17507, 18612, 19010, 19204, 1292, 4976, 5127, 5353, 6262, 6692, 6807, 11287, 12078, 13779, 15226, 15236, 18475, 18792, 255, 465, 1056, 5167, 5340, 5570, 7205, 8327, 8745, 9493, 13377,
+  20068, 20441, 474, 1063, 2871, 4048, 6895, 7434, 8490, 8868, 10292, 10528, 19096, 19240, 764, 980, 2154, 2661, 3413, 7386, 7956, 8250, 12604, 14817, 15665, 18896, 19129, 19763, 1540, 2853, 3703, 10186,
+  10716, 11591, 15395, 16042, 16886, 17582, 19519, 1174, 5076, 5108, 5859, 6156, 7031, 8214, 8839, 9672, 9721, 16576, 18729, 18965, 19141, 2334, 3127, 3206, 7128, 11785, 11805, 12587, 13567, 15035, 17508, 18646,
+  19895, 563, 1761, 3956, 11379, 14694, 15740, 16338, 20500, 20791, 310, 1429, 4020, 6274, 8385, 11229, 11302, 11364, 12620, 142, 444, 718, 1222, 2567, 4090, 6231, 6280, 7004, 7254, 8401, 9264, 14460,
+  15669, 15795, 18812, 228, 3165, 3516, 4784, 5268, 5723, 6934, 8492, 8964, 10446, 15055, 15955, 15972, 16442, 16766, 17795, 1071, 2119, 2449, 6483, 9457, 12580, 13280, 14468, 18892, 19474, 20655, 171, 4193,
+  6532, 10737, 14535, 18711, 19486, 264, 1710, 4441, 6400, 7899, 8495, 10094, 10506, 10840, 12993, 16555, 16619, 19928, 20583, 1232, 1278, 4727, 6940, 7608, 12594, 12896, 14080, 14788, 17184, 17700, 18242, 20484,
+  4, 1681, 3076, 3541, 5255, 8623, 10345, 12689, 14173, 15074, 15805, 18323, 19483, 19889, 20711, 956, 1021, 6062, 6359, 7461, 7845, 10868, 11478, 12005, 1922, 2277, 2688, 2885, 4145, 4357, 6212, 8835,
+  10662, 11268, 12571, 16491, 16635, 18677, 19786, 20080, 897, 1520, 3968, 5630, 7742, 7785, 8830, 11196, 12518, 14579, 17781, 17900, 19055, 20119, 20332, 20446, 482, 1190, 6439, 6452, 8056, 11314, 11990, 13538,
+  14367, 14522, 14812, 15844, 15991, 16931, 19143, 20036, 2733, 8739, 9184, 10372, 11493, 11812, 12345, 13369, 15101, 15128, 15591, 2111, 4687, 9479, 10580, 11872, 13498, 13862, 15763, 17890, 19071, 906, 4229, 4693,
+  8800, 11106, 13363, 13475, 13888, 15274, 15590, 17203, 18660, 19131, 19338, 20111, 2881, 4319, 4344, 6778, 7866, 9369, 14143, 14435, 15370, 15789, 16939, 17024, 18571, 19294, 741, 2057, 3074, 3367, 10383, 10529,
+  10942, 14558, 16307, 18939, 40, 177, 3045, 4333, 6838, 14019, 14968, 16476, 4312, 4730, 5818, 6300, 7234, 7310, 9938, 12455, 12988, 18200, 19043, 20796, 373, 2274, 4052, 4582, 5472, 9075, 11583, 11690,
+  14300, 17367, 18110, 18144, 1617, 4752, 5492, 10516, 13892, 14736, 17143, 500, 975, 1984, 2622, 4574, 4594, 5771, 8257, 16622, 17397, 17494, 18825, 19419, 19480, 19826, 20563, 1032, 1910, 2131, 2914, 4893,
+  6761, 7088, 10498, 10732, 10912, 11271, 14110, 18117, 768, 2432, 4774, 5934, 6035, 8613, 9342, 12403, 14387, 15517, 18883, 20123, 20437, 2955, 3143, 3354, 6106, 6153, 6842, 9916, 14004, 15746, 18767, 19785,
+  20345, 20361, 1404, 2311, 4817, 8262, 9071, 9891, 10151, 11513, 11869, 12631, 15817, 20493, 3423, 4824, 7641, 9242, 13124, 13379, 16238, 17636, 18480, 19856, 2884, 6091, 7738, 8078, 8919, 9701, 16396, 16793,
+  17551, 18058, 19678, 383, 1744, 7610, 7877, 10811, 11130, 16488, 16819, 18092, 19840, 20093, 2266, 3224, 3647, 4066, 6145, 6715, 8115, 10235, 10277, 11852, 12654, 16320, 1902, 3142, 4242, 8188, 9123, 9211,
+  10742, 13988, 16976, 18496, 19456, 1461, 5274, 6635, 8616, 10794, 10988, 11574, 11800, 12861, 627, 7871, 8277, 9749, 10888, 11316, 13698, 19849, 66, 5134, 6528, 7226, 10090, 10416, 11640, 15774, 16325, 16991,
+  18021, 1203, 10570, 14132, 15514, 20678, 20790, 7443, 7846, 20024, 508, 2418, 3179, 4198, 7897, 8647, 9263, 13293, 14515, 15142, 15754, 16623, 17287, 18122, 936, 1901, 3166, 9605, 13382, 13626, 14282, 15925,
+  19674, 19885, 893, 1523, 3299, 4343, 9198, 11956, 11976, 13928, 18135, 19235, 967, 3292, 3554, 9514, 11441, 13143, 14280, 14706, 15661, 16323, 18039, 20316, 463, 1285, 2802, 4751, 10481, 1898, 7507, 7588,
+  10496, 12579, 13114, 13374, 6887, 7399, 10682, 11122, 11835, 12270, 12700, 13111, 14527, 16439, 17726, 19484, 2, 1257, 1650, 1796, 4117, 11338, 15927, 17078, 18052, 18083, 19466, 19657, 20771, 58, 2903, 8325,
+  8823, 15873, 17485, 19179, 19742, 20017, 2179, 3060, 4000, 4339, 8969, 10154, 10384, 11682, 11927, 5015, 5666, 7500, 8246, 8566, 9396, 13226, 14569, 15816, 16882, 19223, 20795, 182, 411, 1697, 5169, 5397,
+  9706, 12119, 13643, 17107, 17496, 18837, 2511, 3095, 6146, 7824, 8783, 12219, 16355, 16786, 17857, 19196, 19506, 1506, 10310, 10751, 12751, 14216, 14749, 15478, 16525, 18575, 19194, 3573, 3646, 5450, 12943, 14631,
+  16950, 20128, 1477, 2942, 4922, 7067, 8153, 15670, 16025, 19224, 19601, 20732, 568, 4126, 4810, 5501, 9775, 9796, 11651, 15613, 15998, 16399, 296, 473, 5175, 5964, 9038, 13005, 15701, 17261, 17315, 2536,
+  6034, 9139, 11439, 13344, 15109, 15410, 15948, 19633, 668, 1009, 4879, 5323, 6913, 7065, 12474, 12918, 12971, 14246, 14589, 14851, 17817, 17949, 20629, 946, 1760, 2897, 2934, 5676, 7809, 9750, 11056, 11257,
+  11283, 12669, 18657, 19909, 3609, 3791, 3942, 5966, 6321, 7101, 7289, 8252, 10193, 12372, 13972, 15111, 16830, 261, 829, 4568, 7688, 11102, 11995, 12679, 13389, 14239, 16648, 16862, 18145, 20059, 2250, 3444,
+  6432, 9619, 10072, 20254, 4820, 5481, 11025, 12049, 14508, 16733, 17569, 18789, 20575, 4158, 6297, 11140, 14664, 16039, 16961, 18582, 19046, 1954, 5097, 5107, 6668, 9163, 9811, 13506, 13670, 13714, 17828, 18623,
+  19287, 3638, 4409, 4543, 5396, 5541, 6769, 10582, 12437, 15637, 19107, 884, 6131, 9365, 13066, 13108, 14978, 15175, 15235, 17028, 18142, 2474, 3397, 4003, 9784, 13298, 13909, 16723, 18193, 19994, 20579, 4105,
+  6294, 8260, 8309, 11400, 12397, 12439, 13213, 14258, 19823, 1430, 7497, 8255, 14553, 16951, 17300, 17946, 4271, 5105, 5207, 7359, 7424, 10183, 10547, 17672, 17844, 18320, 19532, 20398, 3236, 4402, 5185, 5260,
+  5989, 6102, 10515, 11811, 12167, 13176, 14997, 17625, 19210, 20772, 2081, 2388, 3012, 3195, 9583, 11349, 12309, 14946, 17484, 19734, 20259, 4578, 4916, 5872, 7169, 8087, 11391, 12642, 12863, 13354, 14606, 16168,
+  16448, 17565, 1557, 2018, 2681, 13046, 13263, 19938, 2441, 7727, 8546, 10653, 11858, 12480, 15131, 16093, 17653, 20086, 20748, 9155, 11203, 11335, 13618, 16050, 17711, 17947, 18267, 18288, 2950, 8534, 8959, 10045,
+  10536, 11776, 13387, 15655, 16253, 16554, 16806, 17429, 17929, 17978, 18673, 19762, 571, 951, 4089, 4982, 5297, 7936, 8656, 12834, 12964, 14351, 15450, 16699, 18988, 19045, 19271, 20697, 881, 6768, 7239, 9545,
+  11069, 12711, 13615, 17271, 18732, 1675, 2867, 3997, 8361, 17404, 18128, 18458, 19872, 1468, 2024, 2332, 2956, 4988, 5303, 5929, 8362, 8711, 8834, 9591, 10755, 16486, 17576, 18681, 307, 729, 1514, 3801,
+  5023, 6366, 8209, 12732, 14141, 15018, 16709, 18848, 19824, 4747, 6734, 7574, 10128, 13096, 13790, 19113, 20160, 295, 5665, 8985, 10142, 12891, 13120, 14389, 15077, 15815, 17162, 18671, 83, 2901, 6341, 7407,
+  8318, 8621, 18343, 20632, 2648, 3931, 7640, 10118, 13786, 14893, 15042, 16127, 16459, 16521, 16928, 18025, 18723, 3582, 7348, 9271, 9962, 10735, 12159, 12701, 14354, 18221, 18611, 3351, 3430, 3846, 3965, 4636,
+  5548, 5863, 10402, 10764, 11231, 11501, 15396, 15644, 18294, 18336, 349, 2710, 3168, 3639, 4702, 4995, 7043, 10807, 12298, 14682, 16507, 18107, 19326, 19660, 1075, 1892, 1959, 4937, 9528, 11070, 12984, 14763,
+  2591, 3493, 7306, 10248, 10701, 12210, 13958, 14009, 18680, 19119, 19347, 771, 2818, 3105, 3952, 6928, 7542, 12131, 15580, 16509, 20589, 2304, 5972, 6553, 6758, 9456, 9981, 12240, 12596, 17075, 17081, 17553,
+  19343, 548, 1226, 2026, 5470, 6828, 8324, 11404, 13510, 13564, 14002, 18519, 18823, 252, 942, 2308, 3535, 6362, 7055, 10068, 10123, 14985, 16708, 19424, 20534, 306, 4779, 5028, 5171, 8084, 9226, 12476,
+  18399, 18750, 18808, 19765, 20717, 230, 2822, 5330, 8345, 10234, 10568, 10689, 13886, 15366, 15416, 16431, 17048, 17515, 18055, 20333, 8, 6510, 9028, 11187, 12574, 14209, 19470, 988, 1713, 2718, 3918, 4860,
+  8166, 12450, 13816, 14603, 15097, 17621, 18911, 375, 1996, 8363, 8762, 9553, 10696, 11166, 15294, 17373, 19534, 547, 4825, 6206, 8453, 8541, 10397, 11446, 12405, 14849, 16358, 16695, 17885, 19206, 19862, 20114,
+  1352, 8157, 9068, 9484, 12722, 12769, 15188, 16282, 16655, 16885, 17677, 18306, 18344, 18852, 19445, 1004, 2882, 2887, 3691, 3938, 5262, 5677, 6104, 10295, 10350, 13729, 17208, 19733, 1937, 5902, 9466, 13800,
+  14041, 14287, 15477, 16620, 18062, 18539, 19363, 38, 2531, 3318, 4761, 6413, 7334, 14374, 15761, 16226, 16413, 20014, 1435, 3210, 4872, 4929, 5302, 8730, 8897, 11135, 15628, 15917, 17042, 262, 1043, 2110,
+  2594, 2685, 4088, 4424, 4695, 5163, 7038, 8639, 10862, 12327, 12590, 14096, 15672, 236, 2607, 3209, 8752, 9535, 10808, 15069, 20463, 20695, 156, 1212, 9613, 10030, 10756, 12529, 12936, 13370, 17032, 986,
+  2244, 5722, 6204, 8761, 9387, 10490, 11884, 12133, 13973, 14692, 15170, 15596, 15716, 16136, 19819, 285, 524, 711, 876, 2989, 4726, 5796, 10748, 16299, 16585, 17281, 18532, 18889, 1983, 2628, 5253, 7247,
+  7447, 7617, 10750, 12873, 17996, 5360, 5875, 5915, 6943, 9436, 9461, 12050, 12536, 14549, 14680, 15858, 16670, 19233, 443, 2105, 3200, 3363, 4270, 10087, 11242, 13935, 15367, 5140, 9660, 10931, 11034, 14130,
+  16117, 16243, 17452, 103, 734, 1055, 6396, 6885, 7218, 7613, 12175, 12441, 12938, 15588, 15833, 16214, 17503, 17838, 18641, 1603, 3886, 4288, 5699, 6575, 7059, 8718, 9039, 12125, 12499, 16897, 18890, 801,
+  5331, 6958, 12120, 16958, 18168, 19052, 20092, 20725, 1432, 2040, 3245, 4731, 5506, 6048, 6060, 8402, 12482, 18683, 18859, 19494, 20309, 555, 1659, 1948, 3718, 3731, 6628, 9459, 16498, 20109, 2844, 7198,
+  7403, 9473, 10872, 11182, 17921, 17959, 18884, 89, 3427, 5686, 5813, 8284, 9011, 11944, 13903, 14329, 14420, 14700, 14832, 14998, 15497, 19514, 8949, 12216, 13479, 13882, 14746, 16097, 17639, 19329, 19839, 20562,
+  3293, 11191, 11509, 18175, 19258, 19441, 19705, 682, 788, 2124, 5199, 6560, 6752, 7788, 8421, 9745, 11005, 11413, 12686, 16361, 16930, 18315, 20003, 2499, 2676, 3112, 8155, 9185, 9838, 10961, 13308, 14802,
+  19269, 3929, 4949, 9376, 16155, 16561, 18049, 18689, 20212, 2241, 2526, 3724, 5162, 6308, 6984, 8491, 10440, 12122, 12396, 16370, 17716, 17910, 18213, 20571, 3708, 4447, 5151, 6243, 6717, 6773, 7996, 10937,
+  11822, 12586, 13220, 13710, 14188, 16533, 18871, 20317, 42, 1118, 2032, 4430, 5792, 6253, 6338, 7763, 8568, 10373, 13592, 14291, 14316, 14661, 19047, 19351, 2738, 17066, 18027, 19389, 19565, 20242, 550, 1734,
+  4460, 7052, 7830, 8239, 10892, 13751, 16813, 16853, 20342, 1382, 2571, 7997, 9688, 12485, 14624, 17150, 17245, 17536, 17922, 18356, 18779, 20113, 20163, 3415, 3519, 3552, 6401, 8012, 10204, 10394, 10406, 17378,
+  17443, 44, 6041, 11158, 11220, 17194, 18873, 19076, 20410, 248, 1867, 2532, 4293, 7131, 7423, 8192, 9284, 13139, 13424, 13987, 14170, 14201, 14323, 18363, 19792, 4299, 4723, 9799, 10757, 11500, 11950, 12034,
+  12741, 12864, 14628, 17121, 18667, 19800, 1289, 4019, 10060, 13715, 17851, 17864, 364, 4498, 10039, 10923, 11334, 13514, 17129, 19586, 20347, 20734, 3132, 5014, 7566, 8517, 8824, 9515, 9537, 9778, 10173, 10598,
+  10851, 11124, 12599, 14404, 14748, 294, 6144, 9936, 11273, 13876, 15065, 16100, 17751, 17772, 18858, 19310, 20663, 3059, 5593, 6620, 7724, 8461, 8651, 8713, 10790, 14021, 15168, 15814, 16069, 17272, 17930, 18329,
+  18797, 1240, 4061, 5281, 8294, 9680, 13174, 14035, 15523, 18553, 20010, 290, 1549, 3218, 5883, 6230, 7793, 9927, 11183, 12395, 12581, 16983, 18506, 18736, 19024, 19220, 155, 2048, 2937, 3618, 3866, 4134,
+  6992, 8653, 9552, 10519, 11395, 12767, 14690, 15969, 2544, 3013, 5275, 5656, 5798, 7320, 7611, 7939, 14928, 15343, 15525, 19707, 3673, 5945, 10472, 10921, 11758, 13825, 16527, 17469, 20185, 20431, 20654, 2850,
+  7266, 7953, 7958, 8442, 17522, 92, 4002, 4925, 6346, 8055, 10009, 18602, 19340, 20360, 1405, 3310, 5943, 7326, 10895, 11224, 14447, 17668, 19289, 8366, 10242, 12853, 13756, 15144, 18537, 19521, 19684, 99,
+  2462, 4501, 8104, 9554, 10033, 12231, 17054, 17962, 18758, 19264, 20318, 1692, 2138, 9615, 13513, 15618, 17190, 599, 1045, 6550, 7342, 8092, 8281, 11296, 13799, 15627, 16602, 17128, 17654, 18668, 20472, 3116,
+  4847, 7593, 7815, 7850, 9468, 9756, 10467, 16420, 18535, 20356, 1035, 5018, 6259, 10247, 10494, 11837, 14790, 18497, 19249, 20057, 671, 4023, 6064, 6423, 6986, 7325, 13086, 14102, 14691, 14909, 15975, 16167,
+  16539, 17123, 19378, 20505, 87, 2651, 3434, 4834, 4857, 5283, 6836, 9914, 11269, 13608, 16718, 17231, 18448, 18726, 19027, 1396, 1642, 3087, 3356, 6331, 9427, 9524, 9978, 12569, 13519, 13804, 14594, 17137,
+  18900, 19400, 401, 997, 2067, 4232, 4852, 5145, 5344, 6543, 8507, 8759, 9653, 10226, 14994, 18230, 20597, 1624, 2707, 5876, 10347, 12246, 12406, 12962, 14182, 16107, 18115, 19493, 19955, 84, 1447, 2273,
+  4928, 9966, 10222, 10374, 14556, 15229, 17540, 18748, 117, 170, 1228, 4290, 6190, 14376, 17635, 18456, 19735, 19987, 20681, 57, 832, 3043, 6264, 6275, 7599, 10839, 15129, 20780, 10301, 10589, 12914, 13815,
+  13922, 14972, 17335, 20144, 10, 2047, 2263, 2325, 11657, 11905, 13503, 15765, 18426, 50, 115, 3140, 3287, 5216, 8297, 10150, 11386, 12623, 13060, 14115, 14314, 19918, 684, 744, 1952, 6755, 9821, 11365,
+  13671, 15568, 18148, 19040, 370, 643, 2982, 3611, 5583, 6653, 9406, 11719, 11965, 12097, 13203, 13661, 17189, 19462, 4300, 9774, 20722, 4110, 4963, 10464, 12288, 13128, 16824, 16898, 19273, 3220, 3775, 3884,
+  4209, 7308, 9809, 9815, 11168, 11327, 15389, 17065, 17692, 1328, 2029, 3536, 3686, 3806, 7449, 10106, 14051, 14411, 16297, 18738, 20544, 1209, 2182, 3852, 4304, 4502, 7572, 8449, 9742, 12582, 17727, 18400,
+  19827, 20192, 6198, 7721, 9048, 9363, 11113, 12036, 12335, 15928, 18806, 19253, 19804, 20078, 703, 1086, 4499, 5013, 6854, 7328, 12018, 12753, 14536, 14933, 16866, 17696, 18839, 20564, 894, 2868, 3403, 3815,
+  4583, 5139, 6654, 9722, 10444, 13763, 16244, 17398, 17577, 18051, 18113, 5667, 6793, 6988, 12889, 12903, 15764, 16857, 18639, 18940, 19545, 256, 5482, 8977, 11738, 13913, 14881, 14943, 15121, 16250, 18201, 3405,
+  3800, 5940, 8659, 9022, 11380, 13865, 14731, 17275, 18703, 18992, 19353, 1385, 1739, 4366, 4514, 6135, 11624, 13297, 13731, 14734, 18877, 20220, 4533, 4600, 7045, 9755, 12260, 16353, 16438, 17547, 18043, 18592,
+  19137, 20581, 20689, 781, 921, 3572, 6383, 7789, 9675, 13327, 16402, 19093, 3345, 3864, 6175, 8527, 8821, 14816, 14853, 15187, 16080, 18360, 18605, 2969, 4213, 9023, 11551, 12199, 12381, 13027, 16979, 17153,
+  1499, 3002, 5870, 6008, 7949, 8748, 14883, 15839, 16143, 16400, 2294, 2428, 4374, 5242, 11531, 12185, 14937, 18568, 19626, 630, 1767, 3683, 8802, 10773, 13072, 13852, 14394, 19026, 19799, 20281, 20508, 887,
+  3550, 6487, 10007, 10752, 12887, 13761, 16038, 17456, 18914, 5115, 5754, 5971, 9594, 13129, 13621, 14429, 15303, 15548, 16637, 17021, 18123, 19317, 19533, 20442, 390, 1555, 4384, 4506, 4686, 5866, 7249, 8292,
+  9501, 9648, 9859, 14483, 17773, 20238, 4792, 5345, 5793, 8154, 9429, 12766, 13784, 14934, 16046, 16673, 16926, 16998, 17394, 17786, 18322, 18542, 1287, 3835, 5899, 7683, 11859, 12848, 16910, 17529, 17721, 17866,
+  18780, 19970, 2786, 3764, 3765, 4684, 5327, 6141, 12645, 12952, 15871, 17874, 18410, 18867, 20779, 27, 2401, 4130, 4179, 5126, 8025, 8772, 10827, 13565, 14295, 14930, 16878, 354, 1445, 4268, 7186, 10212,
+  11245, 12659, 13850, 14623, 15931, 17117, 18451, 19103, 1141, 1822, 4434, 6457, 7024, 8355, 8666, 9166, 13591, 16584, 308, 445, 2909, 9824, 11768, 14048, 15492, 15506, 15737, 16255, 16890, 18380, 19831, 3223,
+  5267, 6267, 6699, 7411, 11137, 12103, 13478, 16970, 17091, 19362, 4853, 5231, 5311, 8272, 9390, 13785, 15215, 15677, 15855, 18614, 19580, 20784, 2854, 3448, 4525, 5053, 7429, 7582, 9696, 11393, 12137, 15184,
+  16035, 2121, 4346, 8207, 10083, 13746, 14543, 15393, 16349, 16406, 17977, 18152, 18244, 18547, 3759, 8982, 13817, 16560, 19277, 19371, 19475, 1093, 1277, 3085, 6111, 6507, 11558, 11931, 12100, 12404, 12901, 16098,
+  16333, 17793, 19540, 250, 1196, 1875, 4902, 9210, 10315, 10560, 12447, 12693, 12782, 16570, 19627, 4121, 12013, 15689, 17307, 17424, 577, 871, 2620, 3428, 6485, 6676, 12776, 13539, 14667, 15333, 15790, 18063,
+  18121, 20395, 20737, 905, 2256, 2459, 4482, 7655, 10821, 13620, 14269, 17940, 1784, 1793, 4013, 5078, 7003, 8223, 8946, 15439, 16798, 2042, 2157, 2590, 3814, 6007, 8617, 11777, 12449, 12607, 12975, 14303,
+  18488, 19388, 795, 1295, 3184, 4143, 6257, 6419, 6966, 7416, 11243, 11650, 13422, 14792, 14920, 14924, 15302, 15513, 3608, 3716, 5180, 5454, 7962, 10692, 11467, 12333, 12504, 12877, 14952, 16425, 18034, 18362,
+  20221, 3504, 5765, 6987, 9431, 9472, 14615, 15435, 18743, 19133, 4197, 9883, 13655, 16217, 19004, 19134, 19414, 20264, 1348, 4438, 6474, 7061, 7150, 7375, 10463, 10594, 10823, 11362, 13425, 15937, 20716, 192,
+  1344, 1579, 6047, 9255, 11534, 13296, 13348, 13949, 13986, 14099, 15103, 15641, 18206, 18891, 406, 3139, 6196, 8039, 8776, 10469, 13065, 13605, 14658, 14877, 15857, 17808, 18549, 20362, 428, 6851, 7173, 7797,
+  8234, 10556, 10837, 11084, 14305, 14655, 574, 1695, 8179, 9274, 12029, 14229, 15485, 19348, 20434, 538, 1389, 3578, 6252, 6450, 8095, 8636, 8706, 11306, 14703, 15640, 17442, 1000, 5213, 6774, 7293, 8944,
+  18195, 20535, 196, 1379, 2062, 2496, 3781, 8770, 9629, 9979, 14495, 16435, 636, 2916, 5983, 9027, 13339, 14652, 17550, 17982, 18032, 19947, 1094, 1416, 1543, 3871, 5057, 5810, 12552, 15036, 16466, 18708,
+  33, 1099, 1307, 4422, 5978, 7134, 12084, 20460, 1502, 4491, 5186, 5522, 8716, 12934, 15253, 15471, 17498, 18487, 253, 476, 2289, 4092, 4745, 6733, 8563, 10417, 11552, 20445, 1777, 6154, 7240, 8379,
+  10165, 11093, 12184, 12427, 13390, 16357, 17278, 19563, 20052, 1039, 2070, 3344, 4322, 5587, 8955, 9512, 10396, 13795, 14563, 19507, 20546, 20596, 20775, 941, 2528, 6069, 6751, 7119, 9164, 10940, 13262, 14108,
+  19067, 260, 2078, 4836, 7833, 7916, 10437, 11399, 12799, 13187, 13231, 14519, 15262, 16017, 20584, 2303, 2406, 4632, 7685, 9743, 10447, 10880, 12785, 13581, 14724, 14805, 16271, 16960, 17368, 19041, 19616, 368,
+  640, 786, 2809, 5520, 8645, 11221, 11528, 11622, 11763, 13277, 14335, 15724, 19145, 20638, 2158, 5638, 7857, 12493, 12757, 12817, 13651, 17571, 18072, 18647, 20285, 20496, 4881, 5336, 6066, 7295, 9942, 11470,
+  14022, 17333, 18157, 20194, 2554, 3322, 4241, 5452, 7514, 8108, 8596, 10019, 10180, 10507, 17749, 19380, 20170, 104, 1691, 2287, 4973, 5318, 6208, 6211, 6284, 7284, 11416, 11665, 12334, 13137, 14455, 14819,
+  17139, 1076, 1333, 1347, 1787, 2470, 2964, 6095, 7728, 9090, 10641, 12856, 13496, 15878, 16519, 19888, 20203, 553, 3138, 4354, 8963, 9865, 12525, 14894, 18044, 18815, 20129, 20136, 20288, 20686, 665, 2787,
+  3240, 10403, 10785, 11415, 1779, 3689, 5755, 6349, 7864, 9180, 9544, 12845, 14587, 16887, 2800, 5395, 10451, 11704, 13217, 14082, 17350, 17865, 2423, 2918, 6127, 9179, 11679, 15324, 16624, 18120, 20604, 772,
+  3727, 4305, 5393, 10048, 10138, 13077, 13395, 1337, 4071, 10780, 13099, 13545, 14446, 15496, 17134, 18584, 19502, 19836, 20490, 1573, 1741, 3520, 3924, 3939, 5173, 7472, 8554, 8837, 11123, 13721, 158, 4275,
+  12543, 13216, 14685, 16762, 17058, 17548, 17683, 17998, 20798, 2279, 4192, 5252, 5608, 9800, 10276, 15248, 15448, 17044, 19149, 19457, 335, 1321, 2257, 5449, 6955, 8683, 10386, 10815, 11672, 14715, 15261, 15692,
+  18101, 20098, 1700, 7367, 14449, 14614, 15293, 17076, 17454, 17483, 17691, 18409, 18439, 19444, 396, 6250, 6765, 9485, 10418, 12783, 13162, 13522, 14984, 16095, 19053, 20719, 4516, 9444, 11121, 11371, 12458, 16546,
+  19108, 20217, 961, 6224, 12321, 12684, 12902, 19791, 706, 1078, 3555, 6946, 8061, 8864, 13427, 13464, 13813, 14253, 14728, 17016, 17370, 19188, 2455, 3474, 6130, 9894, 10214, 11020, 13167, 14057, 14966, 16351,
+  20413, 20504, 625, 925, 4159, 5133, 8109, 8896, 10101, 11471, 13989, 17833, 2412, 2702, 2703, 7551, 8350, 13938, 14601, 19396, 19693, 19788, 120, 493, 1206, 4432, 5865, 8344, 9187, 12479, 12573, 16645,
+  18881, 5296, 7209, 7372, 11490, 15913, 16424, 16784, 18635, 19615, 3064, 9645, 9879, 13349, 13481, 13919, 15621, 16056, 16543, 19097, 20272, 1466, 5571, 6184, 10787, 13188, 13365, 14517, 1007, 1693, 9841, 11154,
+  13558, 14839, 15378, 16482, 16500, 16631, 18983, 2737, 4509, 6024, 6785, 7145, 17859, 20184, 885, 4572, 5334, 5733, 6437, 9510, 11598, 11861, 12791, 19492, 1800, 3776, 4445, 7221, 8657, 11847, 12715, 13064,
+  15949, 18907, 698, 1850, 1934, 3313, 4226, 5047, 5809, 8222, 10042, 10632, 11877, 13237, 17695, 18899, 20363, 20375, 3804, 5558, 8181, 9031, 9492, 12276, 13428, 14379, 20616, 10155, 10772, 11795, 12852, 13610,
+  18655, 19619, 20428, 683, 2606, 3382, 5144, 5908, 8364, 8454, 9614, 11040, 12192, 13076, 14276, 15115, 20055, 4528, 10664, 14260, 14306, 15177, 15417, 17295, 17932, 18489, 18709, 4822, 6454, 7136, 12781, 12954,
+  18289, 19262, 19732, 1022, 2647, 5001, 5380, 6631, 7782, 10609, 11050, 12085, 12299, 13198, 13421, 13660, 17332, 19929, 20727, 1018, 1123, 1758, 5148, 5150, 8196, 10439, 11297, 13754, 13856, 14228, 14453, 15043,
+  2642, 3878, 4085, 4832, 8744, 11267, 12076, 13636, 14044, 20233, 9, 153, 796, 1301, 3510, 6559, 7805, 8513, 10829, 11019, 16745, 1349, 2653, 2869, 2943, 3755, 6482, 8334, 11917, 16049, 1673, 3699,
+  4557, 6640, 7658, 12553, 13880, 14529, 16335, 17853, 965, 3770, 8433, 8672, 8866, 11841, 13119, 13224, 17092, 3102, 3963, 8046, 9005, 9362, 11079, 13502, 13653, 13979, 18153, 18481, 2839, 3600, 8375, 9266,
+  10264, 10365, 13765, 17524, 48, 4645, 7653, 9529, 10610, 11868, 15167, 15524, 15894, 19759, 200, 3650, 5158, 8172, 9729, 11233, 12778, 15569, 20301, 1424, 2527, 3757, 6287, 8112, 8601, 10443, 11919, 12283,
+  12627, 13787, 14106, 18345, 18447, 19468, 19618, 2270, 4309, 6040, 6299, 6415, 6776, 6846, 7331, 8268, 9782, 10583, 11834, 12460, 13281, 16579, 16722, 251, 1638, 4215, 5580, 5916, 6442, 6535, 6974, 8594,
+  9739, 18691, 19632, 19919, 20319, 20701, 45, 2476, 2907, 2968, 4652, 5290, 9291, 9992, 15455, 17274, 17282, 18245, 20314, 20491, 299, 1047, 1238, 5696, 8876, 8924, 10754, 10877, 11760, 14770, 16410, 17594,
+  18645, 19401, 19587, 20208, 204, 784, 2813, 3865, 6869, 8114, 10415, 12640, 13254, 13854, 15445, 16868, 17290, 20626, 2127, 2487, 8771, 9382, 10127, 10188, 12281, 14086, 14160, 17681, 19604, 454, 825, 3695,
+  3854, 11532, 11890, 14778, 16416, 17080, 18573, 19594, 5556, 6180, 7018, 7968, 12996, 13334, 13732, 15191, 18015, 19894, 533, 597, 4471, 5179, 5861, 9391, 11568, 15566, 16161, 18309, 18935, 4161, 6632, 7762,
+  11195, 17882, 18068, 19186, 2293, 2886, 6556, 6879, 7664, 8921, 9547, 10190, 15682, 15807, 17798, 18774, 7692, 9262, 11180, 15341, 19056, 19964, 750, 1517, 1559, 1802, 3202, 4383, 6925, 7216, 12514, 12972,
+  13380, 15308, 17314, 20696, 2656, 3371, 8026, 9556, 14786, 15916, 17207, 17981, 18599, 19585, 1330, 1989, 3167, 3199, 3530, 5095, 6435, 6694, 10343, 12521, 14580, 18324, 696, 1765, 2795, 5709, 9758, 14910,
+  15305, 17217, 17803, 18994, 219, 1596, 1933, 2259, 3564, 4362, 5164, 6286, 10205, 13970, 18020, 4340, 5457, 5828, 6997, 7337, 9286, 12719, 15374, 15563, 20306, 645, 4811, 7849, 8321, 9616, 10388, 10449,
+  12644, 12651, 15192, 16990, 18897, 19285, 379, 853, 2222, 5671, 9321, 12589, 15889, 16002, 16816, 18376, 18608, 676, 3468, 5619, 7627, 8003, 8006, 9098, 9781, 17267, 389, 1185, 3324, 4466, 8609, 10302,
+  14592, 14824, 1819, 5025, 7299, 8205, 9220, 10132, 11786, 12895, 13759, 15798, 18518, 19172, 1909, 4918, 8208, 10253, 11608, 12350, 14868, 15238, 2749, 9339, 10401, 10558, 10565, 12311, 13240, 14654, 20436, 3290,
+  4604, 12554, 13335, 15340, 15362, 17710, 18954, 19606, 1849, 7267, 7594, 7970, 8903, 10920, 13501, 13824, 19275, 20555, 20714, 2276, 3339, 5307, 5911, 7176, 7876, 11674, 14895, 15800, 19316, 4771, 4975, 5713,
+  5901, 8089, 8444, 8906, 9251, 10064, 11577, 16082, 17113, 17655, 18712, 19341, 1422, 1881, 3119, 3902, 5401, 5994, 10028, 10318, 10856, 10930, 18864, 19197, 19296, 1532, 3274, 5738, 10320, 10521, 11796, 16146,
+  1317, 5039, 8485, 10562, 12978, 14362, 16896, 18486, 18527, 18587, 20367, 2832, 4038, 5361, 6830, 9388, 9944, 13401, 16302, 20461, 1079, 1614, 1658, 1679, 7426, 7925, 8895, 11039, 15015, 405, 1207, 9673,
+  10976, 11197, 11971, 18396, 19038, 20180, 2056, 7013, 7706, 9887, 10690, 11373, 13306, 15488, 16593, 16639, 16870, 18094, 19547, 19717, 208, 6139, 8326, 8881, 10191, 11658, 12082, 13512, 13690, 17090, 17812, 18266,
+  19190, 20072, 20256, 780, 857, 5895, 6026, 7881, 8290, 9699, 10185, 10492, 10718, 11839, 16398, 17206, 20240, 1678, 1745, 2278, 2448, 4337, 6827, 15747, 16264, 17481, 18160, 18705, 18946, 4116, 4251, 6877,
+  7244, 7525, 8226, 8943, 14183, 17664, 17896, 20468, 20551, 292, 5385, 5787, 6732, 7629, 7675, 8875, 17952, 20018, 3591, 5849, 7487, 8792, 9682, 10062, 10590, 18369, 18841, 609, 3841, 5458, 5776, 7548,
+  10958, 11468, 12712, 15797, 16693, 17937, 18264, 19126, 32, 319, 673, 1088, 3730, 4177, 4877, 5987, 8847, 10555, 10775, 11511, 11887, 12772, 14720, 15537, 1462, 1817, 2731, 5652, 7235, 9825, 10614, 11194,
+  11729, 12238, 14725, 15632, 16523, 18499, 18816, 20130, 94, 1030, 9273, 9757, 11276, 12703, 15460, 17402, 19857, 1552, 3426, 4313, 4707, 4913, 5406, 15768, 17301, 20297, 525, 4111, 6327, 6767, 9724, 10644,
+  10824, 14286, 15087, 15154, 17811, 18514, 20720, 3189, 3247, 3489, 5101, 10287, 11555, 11845, 12966, 14633, 16999, 18739, 4531, 6682, 7991, 11829, 14907, 17570, 469, 738, 5631, 7526, 10615, 16549, 18485, 19167,
+  20125, 485, 3298, 8022, 8974, 9117, 12721, 16787, 18243, 1020, 1530, 2006, 2069, 2478, 5923, 6398, 6546, 13011, 15612, 18283, 19099, 913, 4659, 5326, 7532, 11199, 11809, 13134, 17709, 19499, 20324, 20396,
+  436, 1195, 2101, 2893, 3769, 4314, 6266, 10017, 12630, 12987, 16504, 1017, 2333, 2741, 6218, 6670, 6818, 8002, 13388, 14161, 14625, 18088, 19559, 6160, 8064, 10841, 15093, 15221, 20709, 1535, 6333, 6831,
+  7042, 7147, 8899, 13159, 13696, 13755, 15549, 16978, 18138, 18349, 18607, 18676, 18772, 1615, 5050, 5903, 7208, 7492, 9413, 9523, 13747, 16366, 17069, 1718, 4697, 5726, 6037, 10260, 13420, 14976, 2572, 3925,
+  6004, 6182, 8030, 9190, 976, 1354, 1998, 3323, 3707, 8102, 9350, 10349, 14005, 20659, 878, 2638, 4464, 5852, 7753, 10720, 10993, 13048, 14602, 19232, 19537, 20060, 20355, 585, 1871, 2559, 6109, 8353,
+  8941, 13021, 16513, 17089, 17967, 146, 237, 1176, 5693, 6662, 8437, 9785, 11749, 13409, 14076, 15847, 16452, 17152, 20512, 20570, 1427, 4016, 6833, 7030, 8838, 9793, 10281, 10758, 18147, 20642, 81, 883,
+  3341, 8707, 10683, 11313, 12420, 18304, 19773, 554, 1145, 3612, 4059, 5434, 5736, 6498, 7567, 9330, 9788, 10124, 11153, 17093, 20699, 242, 1183, 1299, 3626, 7233, 9375, 9820, 10984, 12960, 14726, 16905,
+  16929, 20669, 847, 5083, 5236, 5269, 7180, 7318, 9181, 9509, 10036, 11693, 12724, 14181, 15241, 16156, 18224, 2984, 3951, 3970, 5673, 6523, 6539, 7976, 14716, 17178, 18333, 18495, 269, 566, 1304, 4329,
+  6748, 11372, 13893, 14879, 16777, 17938, 7070, 9586, 9888, 9925, 10902, 11481, 18989, 2778, 8705, 9789, 9947, 10126, 10135, 13366, 13476, 14272, 14509, 14760, 16303, 17151, 20079, 20088, 440, 1383, 1402, 2601,
+  7060, 8429, 17556, 19432, 20275, 1722, 7735, 10911, 11004, 13195, 13985, 19385, 19740, 2373, 2481, 2679, 2830, 3962, 5477, 7148, 7355, 8778, 9450, 13443, 14133, 15357, 15904, 16427, 651, 1038, 1327, 1639,
+  2046, 2243, 3222, 6880, 8171, 10813, 11892, 14301, 14854, 19066, 19139, 20183, 2762, 3009, 5574, 6804, 7149, 7926, 9829, 10453, 11176, 11381, 15009, 15052, 15487, 18287, 18305, 1791, 2780, 3752, 5647, 7468,
+  7628, 10327, 11125, 17408, 19011, 19883, 325, 5877, 6021, 6317, 13689, 16502, 19279, 20667, 2169, 2981, 4530, 6963, 6991, 7048, 10606, 12498, 13150, 14773, 15786, 15895, 17006, 17497, 19321, 19665, 1982, 2394,
+  5407, 9335, 11392, 11687, 12148, 12837, 13791, 14836, 15405, 16916, 18004, 18945, 20532, 776, 1036, 1106, 5391, 6469, 8182, 8532, 8915, 11930, 14040, 17055, 19404, 19436, 135, 529, 889, 1926, 3099, 5578,
+  9822, 10382, 10553, 12682, 13161, 13436, 14493, 14869, 15623, 18205, 1489, 1874, 3435, 4442, 7250, 7811, 8359, 10378, 10441, 14109, 15183, 16883, 17875, 19081, 19383, 20087, 380, 561, 1315, 1345, 3486, 7647,
+  9300, 11736, 11740, 11831, 15204, 15772, 15957, 16267, 16495, 17417, 36, 1113, 2298, 2891, 3635, 3891, 5905, 9767, 10876, 12541, 15099, 15209, 17894, 18857, 20035, 74, 2767, 4223, 6520, 10082, 16322, 17742,
+  18280, 19491, 49, 3796, 3838, 14491, 14561, 16581, 18817, 19402, 20293, 324, 540, 1090, 1362, 2864, 3252, 4743, 5549, 10274, 12615, 14860, 15675, 15990, 18610, 2116, 3761, 4939, 9517, 10098, 13236, 14922,
+  14986, 15327, 15856, 15923, 1199, 2912, 2973, 7783, 8945, 9257, 14172, 17936, 18615, 19663, 2704, 2744, 5772, 6801, 7568, 8177, 11710, 12707, 14940, 15020, 714, 970, 3305, 4569, 4710, 4772, 5598, 8629,
+  9197, 11563, 14438, 16706, 19875, 2286, 9617, 14662, 16966, 19073, 2211, 2568, 5456, 7255, 7440, 7646, 8797, 11139, 16947, 168, 3923, 4633, 7986, 16880, 18353, 18716, 20343, 1947, 2784, 3275, 3811, 5555,
+  5602, 5844, 9930, 10334, 11295, 11649, 12471, 13803, 14385, 18403, 4414, 8441, 9970, 10172, 11684, 12359, 13702, 13982, 14393, 15886, 16010, 19884, 6730, 9769, 10834, 11028, 12704, 13837, 13930, 19007, 19511, 3644,
+  5153, 5214, 5820, 11886, 14151, 15383, 19489, 458, 2444, 4711, 9034, 10724, 12068, 13266, 13486, 13494, 911, 3919, 8278, 14331, 15061, 18030, 18126, 18526, 1251, 1297, 3729, 6360, 8595, 9265, 10224, 10578,
+  12391, 15832, 745, 4812, 8058, 9046, 12676, 14344, 14504, 14545, 17183, 226, 2114, 4298, 8283, 8352, 8634, 12527, 15622, 15791, 16141, 16865, 17410, 18432, 20462, 1508, 4364, 9336, 11145, 11838, 18366, 18688,
+  19917, 19933, 3100, 9228, 12435, 15712, 16342, 18606, 19552, 20519, 592, 6309, 7930, 9622, 10251, 11289, 11520, 11842, 12528, 13264, 13282, 13659, 16566, 17325, 19438, 19726, 1855, 1912, 3539, 4496, 8734, 9980,
+  12271, 13169, 14375, 15162, 15977, 1082, 1149, 1229, 2156, 6151, 8692, 12542, 13294, 17062, 17762, 2562, 3090, 4025, 5187, 6090, 7133, 7813, 12928, 13010, 16169, 18692, 828, 1951, 2421, 2805, 5697, 6293,
+  7402, 12115, 12743, 12831, 13309, 14571, 16795, 17650, 19246, 2019, 4972, 6261, 6609, 7032, 7961, 9115, 9331, 10391, 11418, 16811, 16832, 17919, 189, 5263, 5985, 6544, 7154, 9343, 11250, 13797, 14676, 14936,
+  15179, 16177, 17221, 18875, 2772, 4391, 7945, 8105, 8276, 10935, 12129, 13920, 14730, 18022, 19757, 1155, 3412, 4545, 5204, 5732, 6719, 6953, 8885, 8920, 9130, 9533, 10316, 11569, 15436, 16434, 1751, 1920,
+  4650, 10617, 10818, 12550, 13674, 15529, 15723, 17294, 18796, 19623, 2440, 3459, 5525, 6038, 6971, 8139, 9414, 14157, 16373, 16493, 17395, 17488, 20287, 981, 1500, 3023, 9716, 11820, 12170, 12930, 16712, 17182,
+  17652, 18226, 19776, 19880, 1189, 2504, 5102, 9189, 10161, 11939, 12765, 14581, 15040, 15703, 19031, 19311, 19437, 742, 1407, 1893, 5366, 11423, 11680, 17181, 18106, 18863, 19811, 20117, 2507, 3235, 7927, 8521,
+  11681, 14302, 15508, 17694, 17738, 20418, 957, 4295, 5435, 5925, 12667, 14880, 14889, 16001, 20190, 947, 3861, 5381, 5636, 6684, 11466, 11573, 13589, 15495, 18129, 3030, 3052, 5735, 8701, 9348, 10073, 13033,
+  13117, 20172, 1220, 1690, 5061, 10828, 13133, 14043, 14955, 16557, 18629, 20627, 953, 3086, 5611, 5670, 5768, 12033, 12173, 14689, 15104, 449, 601, 2187, 3602, 6244, 7990, 13891, 14081, 14135, 14733, 18335,
+  51, 1582, 5515, 9349, 14915, 16232, 18261, 20614, 1158, 2002, 2895, 3617, 8589, 10861, 11636, 13405, 15617, 3523, 4485, 6392, 10544, 10727, 12088, 14476, 16004, 19307, 1250, 2439, 3680, 5782, 8854, 11666,
+  12091, 13844, 16277, 18229, 7260, 8009, 11940, 14091, 14838, 15230, 17280, 19501, 20374, 3525, 4205, 6555, 6594, 7481, 9783, 12239, 13423, 13700, 20469, 1985, 3228, 6489, 8393, 10915, 17160, 18384, 19162, 822,
+  1271, 2876, 5225, 10426, 12279, 14094, 15400, 15579, 15906, 16418, 18467, 19951, 20321, 20371, 589, 2808, 5544, 6290, 10189, 12531, 14434, 14600, 15574, 16132, 16568, 17505, 1756, 2363, 2565, 4586, 6194, 8956,
+  9004, 12624, 15507, 17523, 18024, 19308, 179, 2420, 3422, 3697, 6103, 6916, 7036, 12247, 14195, 15369, 18319, 19391, 544, 654, 952, 1054, 1929, 2218, 3657, 3663, 6814, 8233, 8738, 10677, 17011, 17632,
+  17858, 20526, 860, 1861, 6721, 6893, 8121, 8879, 16505, 18172, 20140, 20330, 5707, 6209, 6506, 7803, 8555, 9247, 10218, 10878, 12754, 12871, 14584, 16515, 1015, 1263, 1368, 2769, 4072, 5413, 9801, 14416,
+  15079, 16972, 19903, 20096, 425, 626, 3802, 3904, 5376, 6451, 8948, 10422, 12718, 13554, 15528, 18417, 18572, 19017, 20094, 2928, 3399, 3512, 7668, 8806, 13278, 14635, 15825, 1708, 2366, 6045, 6210, 9751,
+  11668, 13612, 14605, 15802, 15837, 16682, 19182, 19243, 19876, 1144, 6233, 11629, 13438, 14977, 15029, 15331, 19069, 20186, 5041, 5594, 7598, 9111, 9650, 13864, 16030, 17542, 19930, 128, 3178, 3362, 4153, 4894,
+  5637, 7035, 7774, 9103, 9140, 12022, 17097, 71, 716, 1133, 1870, 3465, 10393, 11026, 11903, 12065, 12193, 12828, 13511, 13709, 19978, 229, 7338, 9609, 19709, 2249, 6232, 6265, 6358, 9319, 9746, 14299,
+  15350, 16924, 17957, 18228, 19496, 20051, 20783, 1316, 1640, 3478, 4144, 4897, 6566, 9067, 10445, 12188, 15491, 15562, 17053, 18634, 19077, 20231, 20726, 5184, 7105, 9428, 10795, 11708, 12786, 12913, 18012, 19114,
+  19700, 20754, 1227, 1571, 3642, 5655, 6562, 6981, 7817, 8349, 10405, 10458, 10783, 15504, 17318, 4848, 4966, 7635, 12475, 13202, 15048, 16091, 20164, 1986, 2501, 3097, 4455, 5539, 8380, 10376, 11331, 12428,
+  14872, 19049, 20313, 4512, 6009, 6800, 6922, 11096, 13831, 14944, 17155, 17832, 5466, 6461, 7104, 9720, 11244, 15743, 3620, 5479, 9856, 14122, 15407, 16006, 17388, 19109, 19942, 98, 9076, 11455, 14015, 14811,
+  15289, 16247, 17071, 18513, 1949, 3251, 4349, 4475, 5455, 7270, 8072, 8341, 9254, 13598, 13915, 14422, 17645, 19012, 747, 5995, 8516, 9973, 9991, 11637, 14052, 14777, 16294, 17298, 19051, 3977, 4741, 6296,
+  10514, 11751, 12709, 13316, 15094, 17517, 18567, 19833, 4253, 5927, 7712, 11177, 14256, 14666, 14793, 17049, 65, 910, 4373, 4859, 6644, 8141, 8884, 9326, 12354, 16390, 18678, 19121, 19695, 67, 3579, 6643,
+  8498, 8519, 8788, 15654, 15872, 955, 1661, 2009, 5803, 7720, 9100, 11755, 12750, 13180, 14992, 18821, 19668, 39, 616, 1752, 2181, 2206, 4175, 9256, 10074, 11126, 11436, 11713, 13677, 16457, 17603, 1058,
+  1102, 1129, 8607, 12668, 13802, 14898, 17640, 19592, 2583, 5769, 6716, 9588, 9864, 13442, 18493, 19098, 20157, 1243, 2669, 4245, 7489, 7634, 8585, 8925, 9012, 9062, 9647, 11888, 15458, 16135, 16770, 1776,
+  1899, 3677, 7187, 7358, 7855, 9213, 11201, 11537, 13962, 16977, 18788, 19435, 19772, 1098, 1475, 1556, 4793, 8682, 10213, 10559, 11506, 12094, 12278, 15273, 15431, 16029, 16805, 34, 1460, 5388, 6624, 8304,
+  8950, 9415, 12306, 13171, 110, 363, 4297, 4954, 7076, 8169, 9008, 9557, 11849, 13996, 15096, 15922, 16444, 17297, 5753, 6700, 6915, 7900, 7983, 9275, 9364, 12140, 13839, 15062, 151, 766, 2322, 7779,
+  7984, 8725, 8758, 17918, 18845, 3826, 6242, 8766, 10283, 11654, 14285, 15781, 18053, 18675, 302, 5042, 10883, 14158, 14406, 15981, 19361, 19750, 20042, 1859, 2340, 6663, 6796, 7138, 7400, 11082, 14540, 15532,
+  18440, 3015, 7584, 13901, 15100, 17273, 19125, 19807, 647, 1938, 4883, 7305, 7506, 10624, 11496, 11579, 13633, 15536, 16105, 16138, 16305, 17764, 18964, 5511, 6616, 7307, 8870, 9489, 9623, 10018, 10943, 11281,
+  13053, 14336, 15026, 16834, 19682, 2751, 3471, 4980, 9919, 11417, 12244, 15098, 17247, 19910, 515, 5285, 11159, 16605, 18765, 18782, 19268, 19711, 1976, 3507, 5071, 12946, 12995, 14042, 14413, 17026, 19828, 145,
+  2460, 8627, 9578, 11237, 12080, 17835, 19360, 2341, 6525, 6967, 7483, 11148, 14073, 15307, 18017, 18662, 20002, 4878, 5469, 6756, 7123, 11538, 13045, 16208, 663, 2845, 4264, 4504, 4830, 5864, 6908, 7715,
+  8216, 10627, 10712, 10951, 10992, 15727, 16535, 17450, 1001, 2112, 2815, 3604, 4010, 7206, 9687, 10221, 11256, 11546, 12879, 14371, 16268, 18002, 1373, 2479, 3281, 3450, 3672, 9560, 11460, 14902, 16019, 978,
+  2247, 2338, 2597, 5264, 10944, 11299, 12134, 12638, 186, 867, 1244, 1749, 2913, 6105, 6322, 8664, 9306, 9951, 10574, 13728, 18820, 2313, 4247, 5136, 5900, 6306, 6402, 7476, 10454, 11895, 12038, 12226,
+  13959, 18006, 18656, 18995, 20753, 3855, 10050, 10576, 10612, 11254, 16594, 17774, 19074, 19358, 1583, 3892, 5527, 5550, 5745, 5838, 6933, 9328, 10389, 13101, 13132, 15247, 16524, 20110, 20339, 20799, 1171, 3847,
+  4081, 4150, 4233, 4472, 8440, 10159, 11190, 11989, 13062, 14885, 16606, 17558, 17680, 19829, 2377, 2966, 3282, 4970, 7765, 8080, 8158, 9806, 10882, 11089, 12838, 14923, 15174, 17127, 18378, 18479, 254, 2417,
+  2530, 3151, 3946, 5007, 5288, 7164, 13493, 14017, 14769, 14772, 15312, 15547, 15870, 18181, 5191, 5547, 6054, 7516, 9837, 10495, 10846, 12417, 16892, 398, 2140, 3141, 8332, 9451, 9854, 12408, 19795, 1360,
+  3163, 4541, 5603, 6792, 11465, 12419, 13487, 14960, 16587, 1505, 5563, 5836, 9235, 11010, 13601, 17719, 3214, 3515, 5879, 6010, 7352, 10835, 14784, 17171, 17226, 17985, 18477, 19530, 19572, 2113, 2360, 5181,
+  9114, 10341, 11186, 12197, 14516, 18950, 129, 733, 2104, 3067, 5036, 5141, 5201, 5826, 6173, 7992, 10969, 11958, 13722, 15007, 16191, 90, 2699, 4777, 7931, 8360, 12007, 12363, 12919, 13764, 14297, 15005,
+  15571, 17041, 17955, 387, 1241, 1361, 2183, 4753, 5459, 6504, 9049, 9107, 10874, 11535, 13849, 15722, 19320, 20671, 64, 126, 794, 1738, 3150, 9030, 10483, 13090, 13221, 14474, 14825, 18966, 2575, 3640,
+  4120, 5094, 8779, 10003, 10863, 11879, 15392, 1621, 2387, 2566, 4867, 5572, 14499, 17852, 18996, 20644, 85, 1592, 7415, 11099, 12384, 15850, 16946, 18661, 346, 1446, 1465, 2402, 7575, 7884, 9969, 10200,
+  12643, 14647, 16780, 17214, 18813, 1291, 1683, 4786, 5426, 6239, 10975, 13983, 20593, 2482, 5540, 8076, 8446, 11652, 11851, 11876, 11947, 12047, 16188, 17132, 1818, 4591, 7947, 8565, 10587, 15615, 17986, 19200,
+  20325, 3464, 4103, 4426, 4483, 4843, 7807, 11678, 13694, 14274, 18316, 1908, 2152, 2666, 4690, 7673, 11824, 12932, 12991, 16636, 2216, 3509, 5954, 6519, 8865, 8952, 10957, 11498, 12232, 12459, 13342, 16877,
+  20388, 6136, 8918, 9384, 11162, 11495, 11659, 16077, 18033, 130, 1436, 2705, 8757, 9525, 11261, 14352, 16423, 18755, 3312, 5842, 6453, 9596, 14492, 15600, 15769, 17642, 18427, 1635, 3551, 5833, 7904, 9279,
+  9412, 9681, 11134, 12523, 17984, 18492, 20401, 1120, 1981, 1992, 2641, 4551, 5138, 7002, 9726, 9920, 10974, 18443, 20032, 505, 1065, 3391, 3628, 4492, 8464, 9810, 10131, 10857, 14448, 15739, 16613, 20082,
+  1698, 3058, 4580, 8123, 8720, 8923, 9186, 9909, 15911, 17801, 17975, 420, 875, 3053, 5114, 7446, 12180, 15364, 16697, 18146, 20769, 4093, 4407, 8204, 10011, 10518, 10545, 12302, 17254, 989, 6821, 11293,
+  14144, 14431, 14619, 15208, 15846, 18550, 2100, 4225, 7522, 12788, 13346, 15311, 15379, 18260, 2793, 3911, 4135, 7223, 8750, 9830, 10381, 11489, 16621, 17252, 19569, 20471, 2670, 4775, 6592, 8747, 9730, 10140,
+  12229, 15742, 16088, 17175, 17644, 1282, 1473, 3041, 7820, 11712, 11775, 12959, 13004, 13470, 13550, 13579, 14425, 20323, 163, 2692, 3330, 6098, 9513, 11181, 12637, 13809, 14657, 1053, 2674, 3943, 8704, 10395,
+  11607, 12625, 15214, 30, 598, 1358, 1810, 3153, 3653, 4137, 6892, 7377, 11553, 12567, 15597, 16144, 16981, 17669, 18474, 934, 1771, 3988, 8561, 10971, 12369, 12810, 13207, 13518, 15173, 15335, 20743, 2816,
+  5350, 11527, 12737, 12827, 18698, 20282, 1754, 5212, 6126, 6950, 8678, 9169, 9923, 11721, 13834, 14750, 16223, 16318, 982, 1472, 3935, 12489, 12584, 16290, 20498, 2728, 4392, 5421, 7253, 8077, 12981, 13000,
+  13417, 13691, 15921, 16641, 16696, 17422, 18326, 19728, 4169, 4701, 5909, 14999, 20124, 2059, 4838, 7137, 7856, 7929, 10526, 16650, 17405, 19323, 3890, 7838, 8381, 8392, 9238, 11814, 12641, 13515, 356, 492,
+  2200, 3370, 5400, 5554, 8593, 10058, 13036, 13189, 13361, 16163, 17233, 3984, 4507, 5801, 7056, 10929, 13708, 17661, 19812, 20122, 20423, 1807, 7660, 7909, 8152, 9922, 12811, 15227, 15339, 16503, 5166, 7796,
+  11062, 11955, 13823, 14718, 15182, 18924, 3227, 5033, 5867, 6405, 6526, 7317, 11803, 14060, 16376, 16573, 17778, 19263, 5710, 5740, 9447, 10400, 11707, 12532, 17953, 20399, 1242, 2846, 4307, 5205, 5378, 7155,
+  8162, 10026, 10237, 11155, 11611, 11959, 14187, 1788, 4744, 11584, 11942, 12812, 14643, 14757, 15398, 16020, 16341, 19209, 19787, 2316, 3004, 3357, 3418, 7579, 11536, 12208, 19579, 20613, 2300, 3063, 3549, 5701,
+  5967, 7955, 14779, 15468, 16233, 16626, 18029, 19509, 6011, 7767, 8907, 12647, 13630, 17001, 20201, 855, 5577, 7839, 14338, 14610, 17979, 19471, 19843, 20353, 1122, 3438, 5495, 7669, 8524, 9700, 13681, 15578,
+  4837, 4884, 6301, 6740, 9503, 10102, 10259, 10434, 11675, 12113, 15755, 15946, 17386, 17606, 20349, 3527, 3533, 5319, 5347, 6586, 6982, 9095, 9592, 10203, 10967, 11061, 11921, 13269, 13353, 13609, 19302, 3,
+  498, 2231, 2515, 6996, 7100, 8737, 11962, 16517, 16746, 2004, 3989, 5993, 6809, 9091, 11494, 16263, 17106, 95, 1707, 2535, 6722, 10353, 11046, 13140, 15550, 20619, 59, 2990, 3388, 4898, 7676, 10826,
+  12453, 20633, 1521, 3656, 5280, 7700, 8455, 11631, 12112, 12893, 17834, 1208, 3799, 6840, 7985, 8168, 16190, 17489, 18563, 4259, 4903, 4936, 5241, 5627, 7047, 10527, 12969, 13631, 14162, 16024, 16251, 16790,
+  18978, 717, 1230, 2027, 3173, 6155, 10970, 12329, 14539, 15442, 15866, 19654, 19662, 20738, 1423, 1589, 1993, 2145, 2268, 3736, 5719, 6538, 6704, 11794, 12044, 12386, 14681, 16735, 239, 1261, 1449, 1702,
+  2898, 3631, 3972, 5392, 5618, 7570, 10336, 13314, 16286, 4303, 5270, 5640, 7836, 10611, 14950, 15326, 16952, 17040, 18583, 19974, 20081, 20565, 1837, 4330, 5211, 6197, 10480, 11259, 17056, 17926, 18327, 19488,
+  20365, 20385, 950, 3092, 5230, 8000, 8569, 8871, 10949, 11671, 14263, 15859, 15930, 16363, 18590, 6619, 8961, 8967, 11275, 11853, 12467, 12742, 13640, 13741, 17506, 18358, 275, 4087, 6564, 6726, 7964, 10604,
+  14339, 16003, 18404, 18722, 18997, 20162, 4029, 4566, 5197, 5648, 6554, 8459, 8630, 9441, 11241, 11310, 743, 7394, 7835, 8235, 8942, 10504, 11367, 11844, 13408, 13911, 13955, 14626, 15272, 15683, 17493, 18955,
+  147, 289, 1298, 1852, 2593, 6123, 13098, 14962, 15914, 18663, 19858, 3869, 9814, 10987, 11387, 11767, 12325, 15719, 16216, 18926, 1380, 2658, 13806, 13993, 14975, 16677, 16949, 18040, 20352, 2085, 4909, 5308,
+  6260, 7786, 11049, 14803, 15432, 20224, 5098, 5377, 10223, 10370, 11926, 13582, 14278, 15143, 15934, 16687, 535, 2429, 4781, 7666, 8960, 9574, 13243, 14097, 3316, 4084, 5739, 8696, 8880, 9315, 12646, 15371,
+  17009, 17291, 17892, 2213, 2689, 4425, 4444, 10455, 18218, 19239, 3603, 4068, 4993, 6545, 8232, 8581, 10466, 13182, 13367, 14873, 16036, 16657, 17531, 19590, 19878, 20030, 1442, 2489, 3681, 5017, 6666, 6926,
+  7166, 7636, 10075, 13358, 13807, 16965, 17136, 17863, 18865, 2889, 4671, 4946, 6878, 9288, 10081, 10917, 11258, 11402, 13473, 15490, 17618, 18250, 18390, 20612, 805, 5411, 6171, 8144, 11292, 12151, 13678, 17033,
+  18011, 19485, 735, 3291, 3971, 4265, 6077, 10950, 11609, 12389, 13006, 13338, 15441, 16477, 16664, 2371, 2502, 4216, 6518, 7729, 7981, 9086, 11625, 12462, 12705, 13014, 17699, 1077, 1716, 5363, 7645, 9174,
+  12059, 13590, 14226, 17012, 17602, 5220, 7298, 12819, 13165, 13845, 14174, 15836, 19675, 19935, 336, 3126, 8633, 8786, 9873, 15080, 18136, 18682, 19298, 19738, 55, 4615, 5371, 6005, 9620, 9704, 16792, 17321,
+  19328, 2632, 6336, 8329, 11846, 13957, 14410, 15993, 16598, 19612, 20050, 1398, 3713, 4910, 5530, 7333, 16633, 16663, 17593, 19339, 723, 725, 1042, 1275, 2580, 3583, 15320, 17345, 18597, 3601, 6770, 7313,
+  11382, 14363, 16804, 17476, 18104, 19743, 1795, 4361, 6372, 6745, 6932, 7633, 7957, 8015, 8740, 9367, 15840, 1101, 4947, 5912, 7831, 9690, 9874, 12540, 14547, 17340, 17361, 2129, 2147, 2612, 2715, 4907,
+  6124, 7677, 8831, 12074, 13820, 14932, 15447, 17260, 17790, 1606, 4012, 6714, 7409, 8986, 10326, 10979, 12023, 12549, 15006, 15453, 16103, 17670, 20161, 20311, 1709, 2150, 2378, 4155, 6245, 12027, 16705, 17002,
+  2038, 3079, 3255, 3333, 5006, 7182, 9744, 10241, 13611, 15440, 16604, 19117, 217, 1494, 1825, 6725, 8342, 10534, 11103, 14191, 15264, 18321, 19247, 312, 2503, 5790, 5823, 6705, 8799, 10355, 11453, 12898,
+  13505, 14213, 14391, 2520, 5986, 7139, 13360, 13650, 16649, 18928, 1414, 2229, 2282, 2291, 3808, 4854, 5333, 5601, 7933, 10280, 12268, 12448, 12822, 14049, 17546, 19211, 3243, 7814, 7937, 8346, 11092, 14219,
+  14616, 14755, 15008, 16807, 19176, 19926, 20048, 351, 1201, 1862, 3101, 3622, 9105, 11653, 1248, 1332, 1652, 1916, 4077, 4174, 4597, 5310, 7760, 8241, 11285, 12117, 12157, 18728, 20501, 1458, 2477, 3203,
+  8728, 11101, 11985, 12348, 13385, 14428, 15219, 15309, 15317, 16499, 18067, 4412, 4535, 5120, 5617, 6749, 8101, 8605, 11282, 15313, 17094, 19641, 2054, 3154, 3751, 4809, 11222, 12399, 12829, 19231, 19610, 19789,
+  621, 1482, 7781, 8005, 8576, 9889, 10844, 12675, 15483, 16783, 2879, 6235, 9734, 11667, 12519, 13083, 14973, 20085, 20204, 4800, 9378, 9689, 12322, 14071, 15685, 17563, 19215, 660, 1605, 1792, 2255, 2765,
+  4823, 4889, 6448, 7054, 9372, 11524, 13412, 14575, 1187, 3038, 4807, 4900, 6799, 9347, 10022, 10286, 11514, 12077, 12296, 12502, 13184, 14719, 19487, 333, 656, 4207, 5758, 6530, 8244, 8702, 11359, 13593,
+  14127, 18504, 18833, 19165, 20205, 5, 1365, 11787, 12575, 12653, 12883, 14147, 16067, 18169, 572, 1363, 5190, 8957, 15635, 16608, 19332, 20723, 990, 2855, 3859, 4277, 5277, 8505, 8798, 9670, 11204, 11411,
+  12592, 13059, 13966, 14914, 16186, 19576, 1097, 2446, 3596, 5537, 6876, 10023, 13130, 13639, 13890, 14012, 15804, 17375, 19897, 339, 6097, 7063, 7969, 11635, 12555, 15980, 16016, 17038, 19019, 19992, 20033, 6595,
+  6912, 8011, 10166, 10938, 11941, 15718, 16483, 18640, 20176, 536, 1025, 1646, 2726, 3958, 7754, 10049, 11449, 12505, 13340, 2072, 5422, 6417, 7376, 17557, 17641, 18936, 19690, 20467, 12, 678, 1033, 1618,
+  1931, 3840, 4623, 6980, 7380, 11863, 13543, 16037, 19976, 143, 1258, 6614, 6696, 8133, 8670, 9269, 10375, 12524, 14185, 17611, 19943, 20420, 227, 560, 1474, 5560, 6839, 7034, 7603, 8220, 11778, 12385,
+  12452, 16288, 16391, 16748, 19694, 19905, 175, 480, 1828, 1853, 2810, 3982, 6148, 7801, 9506, 10304, 10924, 11843, 15503, 15700, 16688, 17848, 6051, 6074, 6965, 6977, 7346, 7396, 8858, 9411, 10025, 11647,
+  14768, 20611, 6057, 9965, 10369, 10725, 11311, 13697, 14794, 18473, 19406, 624, 2230, 3870, 4227, 10419, 11351, 11550, 11988, 12821, 13875, 14140, 14552, 15382, 16359, 18529, 19368, 770, 983, 2066, 2397, 2657,
+  4119, 4131, 6669, 7994, 8888, 13135, 14675, 16237, 18460, 18919, 19881, 4542, 4667, 4875, 5700, 6237, 7471, 11566, 12392, 16078, 16113, 18749, 102, 3823, 3991, 4515, 6480, 11469, 14150, 16405, 174, 394,
+  7950, 8724, 9558, 10029, 11374, 15004, 15610, 19070, 20340, 20377, 1786, 2693, 2980, 3980, 8994, 9145, 9487, 9548, 9671, 10110, 10541, 11457, 13212, 13495, 13952, 18679, 1915, 4154, 5440, 5493, 5552, 6161,
+  9882, 12478, 12544, 15268, 18446, 18471, 20141, 1969, 2185, 3280, 7246, 7694, 9446, 10390, 12445, 12792, 13333, 14780, 16569, 17327, 18442, 18670, 19727, 3113, 4448, 4767, 5957, 6995, 9217, 10667, 11068, 13846,
+  16686, 17805, 18100, 18734, 424, 3605, 4603, 9852, 14523, 18523, 19132, 19420, 19691, 2082, 2095, 6542, 9392, 14611, 16199, 16743, 19030, 19603, 268, 429, 677, 1169, 2488, 3735, 4428, 6027, 9753, 10239,
+  12079, 12825, 13054, 17433, 19815, 20126, 176, 6855, 11323, 11434, 11900, 15373, 16279, 16461, 16860, 16902, 17131, 17224, 18941, 926, 3346, 4666, 5103, 5165, 12634, 13884, 17034, 18237, 18860, 19620, 19758, 852,
+  3109, 4808, 8882, 11129, 14251, 19058, 19784, 20530, 2600, 2654, 3845, 7019, 13693, 14927, 15127, 17393, 18143, 4302, 7477, 7895, 8021, 8691, 12060, 14347, 16028, 16258, 2671, 8560, 9438, 10741, 11344, 17732,
+  17846, 20143, 107, 559, 1104, 5228, 12061, 12501, 12941, 13662, 14230, 18191, 18215, 18509, 959, 1824, 4133, 4700, 7946, 9476, 13483, 14533, 15952, 17246, 17624, 20598, 402, 1453, 7204, 8543, 11599, 12227,
+  12560, 13649, 13726, 14085, 14621, 16574, 17925, 18424, 20336, 341, 785, 1403, 3696, 6302, 10303, 10438, 10916, 13965, 15564, 15721, 16332, 17196, 18648, 20386, 91, 902, 1377, 3180, 3901, 4661, 5010, 5282,
+  11703, 11948, 12598, 15516, 16485, 18669, 20286, 7025, 7455, 8065, 9208, 9398, 9676, 10047, 11298, 12652, 12939, 14180, 18428, 19669, 19671, 20776, 594, 2033, 2369, 2426, 2781, 2858, 3762, 4046, 6727, 7707,
+  10599, 10765, 11486, 16129, 16352, 19412, 326, 2225, 7120, 8448, 8535, 9318, 9452, 12708, 14464, 15014, 16408, 19637, 20517, 1900, 2168, 2195, 4201, 5759, 7370, 8714, 9170, 9656, 11862, 13260, 15438, 17873,
+  18310, 421, 903, 1878, 3993, 6375, 9061, 10339, 12520, 15258, 16125, 16662, 18476, 18827, 19614, 1237, 3526, 6179, 8150, 12366, 14919, 17725, 19790, 20210, 5596, 5688, 6603, 7390, 9156, 16197, 18379, 20387,
+  4212, 5721, 7521, 8186, 8337, 9241, 10686, 12290, 13463, 13587, 17596, 18566, 19116, 19136, 1177, 1279, 3239, 4206, 6278, 7698, 8024, 8081, 8893, 13068, 16195, 17468, 19527, 20237, 2000, 2684, 4581, 5364,
+  6674, 9074, 9165, 10175, 10956, 18258, 18593, 19993, 468, 800, 3288, 4370, 6739, 6805, 7397, 8979, 9177, 10963, 13711, 13967, 14312, 17909, 19985, 321, 697, 1715, 3669, 5278, 8754, 12353, 16923, 17439,
+  17911, 17964, 18060, 18061, 19739, 1153, 1551, 2409, 2875, 4490, 6629, 7324, 7751, 9317, 15426, 16647, 18192, 19649, 76, 6112, 7096, 7479, 8356, 9017, 11705, 12144, 12152, 13468, 13954, 15301, 20277, 1372,
+  5622, 8910, 8976, 10502, 11044, 14544, 14967, 17881, 18007, 19473, 206, 3819, 4056, 4176, 4405, 7470, 7691, 8419, 11053, 15025, 1, 330, 1234, 1866, 5240, 5584, 5635, 7174, 7220, 15328, 15414, 257,
+  907, 5848, 6909, 9840, 10932, 11587, 12015, 14360, 17316, 6214, 7680, 7917, 9420, 9646, 12442, 15446, 16888, 17861, 19810, 509, 610, 4997, 6303, 9033, 10487, 17258, 18512, 20134, 3258, 5746, 6023, 8398,
+  11212, 11384, 14024, 14714, 15951, 16313, 2045, 5715, 8641, 11530, 13403, 14113, 18569, 18701, 944, 1907, 4115, 5414, 6888, 8746, 10650, 12869, 18188, 19959, 20213, 939, 1805, 1930, 4118, 12556, 13939, 15831,
+  18908, 1731, 5086, 7848, 9572, 9577, 11027, 13695, 14695, 16841, 15, 3003, 9685, 10250, 14232, 14559, 17070, 19156, 19397, 2469, 4840, 6571, 9021, 11723, 12056, 13783, 15534, 17797, 19953, 806, 1581, 2359,
+  6780, 11964, 15493, 18898, 1808, 2221, 2579, 4892, 5243, 7771, 8852, 9050, 10198, 10333, 10722, 11294, 13447, 16012, 20020, 804, 1486, 1975, 4183, 7491, 9462, 11340, 11874, 13270, 14224, 19407, 266, 2022,
+  2522, 2560, 4017, 4888, 8538, 9199, 11476, 17649, 783, 1789, 3117, 3390, 3920, 4653, 5794, 9477, 9896, 11085, 14255, 15050, 2736, 3157, 4576, 7335, 7650, 9761, 11544, 12728, 16174, 2842, 3093, 5447,
+  6921, 7882, 8347, 9634, 11385, 13181, 19837, 6569, 7379, 8165, 10891, 11063, 12317, 19442, 2144, 2760, 4138, 7110, 17223, 18822, 18835, 19105, 20694, 3091, 3262, 5465, 6277, 6942, 14384, 16558, 19549, 935,
+  5483, 6347, 6522, 7046, 7050, 7271, 7553, 8259, 12383, 12473, 15049, 16847, 16874, 20112, 9003, 13274, 15145, 15425, 16921, 19555, 423, 2557, 4001, 5855, 8643, 10116, 12577, 15607, 16826, 19157, 1730, 7743,
+  16371, 17303, 18819, 19536, 20070, 2771, 7107, 15263, 15530, 16586, 16829, 19213, 20432, 20520, 1672, 5973, 11764, 13179, 17103, 18035, 18296, 18561, 886, 2451, 3461, 3556, 5654, 5728, 7083, 12355, 13482, 14227,
+  16034, 17634, 18284, 18600, 18710, 605, 1651, 6187, 6747, 9065, 11601, 13307, 14926, 15082, 17500, 17997, 18457, 19651, 20677, 133, 1441, 3369, 5224, 7460, 7978, 9272, 10647, 12629, 393, 6497, 8673, 11817,
+  19416, 19838, 20061, 20155, 203, 2534, 3107, 7080, 10024, 10908, 11002, 11015, 12105, 14439, 15071, 15334, 17931, 18686, 20773, 2911, 3263, 3473, 5325, 7188, 8228, 12017, 12093, 12910, 15611, 17492, 18119, 637,
+  3828, 5747, 6188, 6884, 7231, 13530, 18886, 19744, 486, 2224, 2414, 7227, 8273, 9171, 13206, 13426, 18826, 722, 973, 1476, 4521, 5695, 5789, 6166, 6416, 11012, 16031, 16140, 20634, 739, 999, 1980,
+  2074, 10297, 10998, 14145, 14186, 16536, 17549, 17737, 19001, 2621, 3569, 4500, 4587, 8472, 8971, 10522, 13227, 16344, 16582, 20763, 2433, 4449, 7573, 8217, 9032, 9081, 9333, 12163, 12314, 14583, 20774, 4799,
+  6563, 8160, 9845, 11355, 14241, 14445, 15181, 16781, 17187, 18262, 88, 2840, 6350, 7561, 9158, 10158, 10849, 14066, 14293, 14842, 15428, 15888, 17475, 17754, 20188, 26, 1326, 1885, 2258, 4399, 6589, 6744,
+  10015, 10471, 13040, 15034, 16124, 17289, 18756, 18958, 1685, 2233, 2393, 3494, 3777, 8732, 8995, 10791, 14507, 15148, 15756, 16702, 20009, 20278, 2281, 3404, 4951, 8723, 9727, 14888, 15075, 16969, 17941, 4647,
+  5372, 9409, 12570, 13142, 16738, 17235, 17792, 18953, 20200, 20239, 2236, 2379, 2717, 4316, 4546, 7910, 8130, 9047, 13191, 13547, 18751, 2252, 4147, 4649, 5227, 5485, 6087, 8287, 10688, 15983, 19977, 1019,
+  3159, 6128, 7199, 7475, 8229, 8703, 12257, 12714, 19227, 4470, 5367, 5500, 7840, 19393, 19779, 1290, 2753, 3213, 7356, 9597, 11073, 12613, 17313, 18254, 18853, 19003, 20040, 20458, 20531, 1023, 2301, 3057,
+  6514, 6639, 8512, 8669, 13351, 14322, 16765, 18112, 19581, 20090, 2109, 2484, 2826, 3021, 6118, 7197, 8275, 9644, 11499, 11773, 12635, 16084, 16160, 328, 622, 4803, 5453, 6022, 7093, 10254, 13907, 14776,
+  16409, 18177, 19322, 20338, 707, 782, 4942, 6042, 9101, 13665, 14489, 16009, 17192, 17855, 18548, 20131, 7322, 13758, 14634, 15201, 16309, 17167, 19346, 11, 114, 1026, 1569, 4043, 4244, 4477, 7657, 11857,
+  12223, 12416, 12673, 12738, 18937, 20369, 20521, 224, 4703, 9843, 10263, 10473, 10630, 10885, 13415, 15139, 20715, 2537, 4495, 4663, 5990, 9323, 9766, 11628, 17419, 20451, 2938, 2988, 3528, 5261, 7156, 9945,
+  13968, 13992, 15541, 16757, 17403, 17584, 18917, 19037, 20402, 1625, 2796, 6512, 9292, 9571, 15464, 15605, 16072, 16354, 1637, 3268, 3685, 4200, 5958, 7330, 7366, 13232, 14418, 1977, 2186, 2324, 2775, 4612,
+  12867, 15265, 15296, 16417, 2097, 2542, 3469, 6307, 7816, 7960, 8686, 10144, 11685, 12526, 14027, 14787, 16956, 962, 1443, 2711, 3723, 4660, 5328, 6314, 10424, 11152, 17752, 17934, 18197, 20482, 932, 4369,
+  5177, 9295, 11216, 12218, 13063, 16449, 18099, 18223, 1863, 3893, 5780, 6781, 10906, 11083, 15199, 16694, 17337, 18770, 3553, 4487, 4844, 6387, 8489, 11969, 15406, 15834, 19712, 20705, 265, 1736, 2921, 4826,
+  6181, 6240, 15518, 869, 3267, 4151, 9818, 9908, 12697, 12925, 16821, 17829, 19266, 19431, 20104, 3460, 4142, 5155, 5998, 7596, 8331, 11325, 12287, 14056, 18421, 18721, 19570, 1746, 1842, 3256, 7739, 9309,
+  9651, 10557, 17355, 17626, 3586, 7503, 8028, 9607, 9697, 16011, 16690, 19345, 80, 343, 4014, 5632, 5841, 8575, 8625, 9013, 12431, 12880, 13070, 13531, 14572, 14782, 15898, 1309, 2993, 3910, 4049, 4266,
+  7010, 8938, 10113, 10351, 10530, 11388, 14638, 15141, 17615, 18620, 20156, 2985, 3082, 5256, 5832, 6503, 9958, 10423, 11747, 16052, 18180, 19661, 19723, 138, 2390, 2723, 3353, 5946, 7214, 10162, 11342, 12597,
+  12979, 13999, 14116, 15322, 16380, 16470, 17072, 715, 5154, 8016, 8410, 9136, 12212, 13320, 17684, 17988, 3033, 3793, 4508, 6820, 7766, 8282, 10493, 10561, 11234, 13026, 14206, 15899, 18616, 3152, 4480, 9813,
+  10141, 10231, 13588, 14551, 17371, 19085, 20574, 2015, 3566, 5161, 7798, 8197, 8399, 9124, 11977, 12342, 18658, 19175, 20650, 276, 2217, 2349, 2555, 8817, 9113, 10497, 11518, 15164, 16734, 17079, 19777, 519,
+  1367, 1585, 3467, 6637, 10289, 11664, 13328, 14980, 16472, 20054, 2660, 5889, 6779, 7092, 8400, 13635, 15469, 16071, 16997, 222, 345, 2445, 4494, 5913, 8972, 11301, 14377, 15690, 20260, 378, 821, 2044,
+  3364, 3416, 6918, 12509, 12794, 19180, 19349, 2585, 4905, 6018, 7157, 11510, 12506, 14369, 15728, 15863, 20329, 467, 1923, 4613, 7026, 8898, 13656, 13842, 13877, 15152, 16538, 409, 475, 3429, 3548, 5871,
+  8845, 10927, 14982, 15000, 15572, 16133, 19899, 634, 2633, 5623, 6061, 9943, 16617, 17530, 19451, 461, 2201, 2347, 2625, 2720, 6107, 7540, 8403, 8413, 19248, 20099, 340, 2328, 6147, 7288, 8767, 11108,
+  14949, 1247, 2362, 6361, 6484, 7159, 11610, 17249, 18423, 19869, 2564, 2609, 4704, 10149, 14774, 14850, 18393, 19859, 20358, 1972, 2220, 3440, 3480, 3768, 5514, 10665, 11175, 12165, 12576, 17125, 17341, 19064,
+  397, 1835, 2204, 3108, 4363, 4595, 5077, 6822, 12141, 12465, 13465, 14069, 18878, 3741, 12243, 15666, 16553, 3820, 4635, 9928, 11156, 11167, 14273, 16368, 18337, 19100, 1513, 3832, 6476, 8274, 10619, 15686,
+  16906, 17627, 17960, 132, 866, 1359, 2991, 4620, 4678, 6236, 14477, 15404, 17951, 507, 3976, 4627, 11001, 16023, 16968, 18016, 20606, 381, 1843, 1961, 2848, 5682, 6072, 6364, 7274, 9083, 9108, 11706,
+  14111, 15193, 17420, 20533, 20704, 1355, 3047, 3350, 6810, 6902, 14349, 14961, 15734, 18441, 18744, 19278, 19908, 20257, 670, 2430, 6608, 6634, 7708, 8215, 14843, 18159, 20013, 20545, 4027, 4986, 5390, 7074,
+  8135, 8992, 14809, 353, 1879, 5183, 7467, 7606, 10524, 11744, 12973, 13115, 14900, 17477, 17478, 19846, 19979, 1087, 1266, 1357, 1712, 3343, 3585, 8741, 10593, 12942, 13321, 16401, 17147, 20415, 1265, 1302,
+  3270, 17385, 18064, 18753, 20037, 753, 2094, 5068, 5886, 10059, 11260, 14222, 16291, 18318, 18803, 1191, 2523, 5591, 5984, 6117, 10728, 11051, 11337, 12393, 13215, 13279, 14058, 15064, 16717, 18517, 288, 864,
+  1921, 4467, 9418, 10067, 12341, 14008, 14639, 14911, 15113, 16685, 198, 2245, 3451, 7282, 7906, 8067, 13003, 14208, 17839, 18741, 19028, 19997, 1390, 4237, 4577, 7421, 7562, 8631, 10001, 11308, 12382, 12677,
+  18934, 136, 338, 1509, 3169, 9469, 10225, 10269, 10812, 11041, 11586, 11983, 14124, 15275, 4334, 4967, 8693, 9239, 9531, 10596, 10656, 10831, 11009, 13144, 18628, 991, 1124, 1491, 1966, 5040, 6289, 9304,
+  12203, 15762, 18209, 20178, 20207, 690, 1095, 1107, 3022, 6849, 9987, 11412, 11504, 15996, 17902, 141, 4390, 4559, 6621, 6874, 9153, 11288, 13055, 14033, 14123, 14762, 15338, 16265, 596, 1146, 3111, 5542,
+  6693, 7023, 10620, 12164, 12307, 13075, 14753, 16869, 635, 5551, 9748, 12626, 14636, 16689, 16899, 16901, 17870, 20102, 1375, 3674, 5931, 7381, 7893, 11512, 14827, 15153, 15546, 16980, 664, 3577, 7152, 7493,
+  8812, 12222, 12796, 15714, 15901, 16319, 19364, 19434, 1252, 1314, 5362, 6826, 9359, 9881, 10962, 16356, 19080, 3454, 4239, 5975, 6414, 7316, 7590, 9346, 10228, 15151, 16447, 16642, 184, 1370, 1488, 6812,
+  9898, 11732, 13867, 15356, 15663, 17486, 851, 1699, 5687, 8007, 9303, 11973, 15510, 16490, 16615, 17555, 18781, 20226, 1660, 3284, 4078, 4459, 10380, 10809, 10900, 12373, 12585, 17525, 18455, 924, 992, 2410,
+  2627, 2977, 3449, 6581, 6742, 12636, 14089, 19495, 20486, 1305, 1562, 3376, 4989, 5573, 5770, 5890, 6695, 7699, 9564, 11677, 18268, 1728, 3588, 5668, 5690, 17256, 1743, 3928, 4689, 4863, 4961, 8113,
+  8715, 9253, 10317, 11390, 13080, 14193, 14437, 15068, 18008, 19923, 382, 3024, 4672, 6174, 9567, 12245, 14368, 18577, 19982, 861, 920, 1140, 3693, 7520, 12001, 13145, 15950, 17100, 18742, 69, 2945, 3394,
+  3561, 5565, 5644, 5860, 7887, 8270, 11765, 12388, 13594, 14712, 15741, 19916, 20247, 3046, 3783, 3913, 4009, 5567, 5982, 7168, 8954, 9808, 12161, 13251, 13323, 13371, 17609, 19904, 769, 1619, 2271, 5137,
+  6490, 10715, 14738, 615, 1160, 1268, 3987, 6606, 6633, 9636, 15511, 19034, 19598, 20466, 281, 3176, 4352, 6703, 6920, 12986, 13347, 15233, 15553, 15785, 16106, 1419, 1504, 2551, 9957, 10996, 13937, 14925,
+  17236, 19181, 19523, 1425, 2075, 5503, 8126, 11286, 13038, 13416, 13469, 13719, 16152, 16530, 16850, 17568, 19392, 19459, 19692, 315, 5198, 8335, 8499, 10117, 11484, 13398, 18330, 18522, 19453, 1012, 5595, 6708,
+  8476, 10323, 17914, 18240, 20658, 523, 549, 681, 2696, 3018, 4763, 9278, 16933, 18086, 666, 2505, 8243, 10122, 11000, 14646, 19228, 20411, 221, 890, 3443, 3616, 3742, 4028, 9037, 9664, 9905, 10021,
+  10255, 12375, 15687, 15688, 18297, 20731, 457, 464, 1891, 5892, 6013, 6325, 6329, 8520, 9353, 12809, 18364, 352, 1456, 2319, 3103, 3259, 7755, 9974, 16848, 17320, 18664, 18861, 19006, 19163, 19680, 331,
+  4601, 9133, 9404, 11115, 11619, 12046, 15402, 16455, 17251, 17831, 19212, 20708, 2280, 3068, 5590, 6191, 7369, 7764, 9618, 16822, 20602, 5312, 7825, 10258, 11174, 11185, 15197, 17440, 18653, 19443, 25, 2673,
+  3773, 5947, 10871, 11112, 14380, 16501, 19699, 2166, 6596, 9316, 11488, 14653, 15652, 16801, 17545, 284, 3328, 3798, 6825, 8090, 10130, 12736, 15944, 17703, 1225, 2497, 5131, 8312, 14408, 14548, 17688, 19016,
+  20376, 484, 4858, 5249, 8936, 9383, 10357, 13152, 13559, 14864, 15624, 15903, 17460, 18387, 20132, 20475, 1006, 2672, 8487, 9212, 11414, 17188, 18274, 18913, 20499, 20566, 2331, 7021, 8425, 11179, 11806, 12850,
+  14613, 16289, 1599, 4575, 6012, 8556, 13235, 15842, 17296, 17755, 18041, 691, 808, 4375, 5750, 15397, 15818, 16914, 19036, 1392, 1729, 1845, 6750, 12862, 15166, 15385, 15720, 18411, 816, 2997, 8301, 10164,
+  11215, 19567, 19673, 20328, 778, 839, 3308, 4385, 5356, 7215, 12020, 13173, 13245, 14617, 15066, 15941, 17348, 18418, 20083, 348, 2162, 3491, 4694, 6096, 10685, 11120, 11433, 13725, 16873, 18619, 1182, 3129,
+  4520, 4523, 4968, 7008, 8815, 10079, 11613, 14683, 15649, 1393, 2208, 2680, 3054, 3868, 6989, 7450, 10887, 11178, 14414, 15570, 18338, 19168, 1100, 2021, 4819, 6935, 10638, 10890, 11718, 13151, 13311, 14708,
+  15196, 16162, 16716, 19980, 2716, 4457, 4544, 7098, 7977, 8502, 8526, 10952, 11161, 11211, 13238, 13778, 17992, 18452, 1356, 3702, 5766, 7452, 9230, 15399, 20058, 20064, 20393, 4450, 4519, 6907, 7819, 14063,
+  16742, 18214, 20303, 2690, 4831, 6677, 10747, 11403, 11425, 16415, 17418, 17717, 1433, 2811, 5968, 7928, 8913, 14953, 15286, 17432, 1168, 1533, 3402, 4243, 4932, 7278, 13829, 16053, 17363, 17409, 17447, 17474,
+  18793, 20452, 2817, 3809, 6071, 6222, 7808, 9426, 10115, 10428, 12194, 14358, 15418, 17085, 19286, 20682, 6591, 6911, 7336, 9631, 14848, 18551, 19305, 298, 3885, 5604, 7395, 8397, 14896, 14935, 15391, 17623,
+  17658, 1696, 8164, 8660, 11023, 12156, 14118, 19448, 4190, 5851, 11029, 11202, 11580, 11924, 12138, 12847, 14875, 17464, 1832, 4734, 11151, 11319, 12224, 13023, 16474, 17956, 18189, 20047, 4045, 5332, 6120, 8844,
+  9602, 10843, 11497, 12111, 13749, 16430, 16900, 17444, 18095, 612, 1629, 6999, 7875, 12461, 13034, 14814, 20572, 3574, 3666, 4749, 6841, 9603, 15345, 19479, 20528, 20767, 985, 3508, 5032, 5193, 6163, 8029,
+  10206, 15854, 17999, 386, 5497, 7258, 8911, 11554, 11957, 12104, 12292, 15474, 16040, 18167, 18199, 4629, 7442, 7589, 9424, 9866, 10702, 11429, 12087, 13453, 17465, 17633, 17784, 726, 4230, 9135, 12477, 13300,
+  13356, 15540, 16365, 17308, 17906, 18340, 20255, 20262, 162, 2687, 6268, 6894, 6998, 8777, 16962, 19284, 20357, 20599, 1235, 1267, 7612, 10577, 12860, 14038, 15830, 16840, 17862, 850, 5026, 6931, 9723, 10709,
+  11370, 11881, 14092, 16732, 652, 695, 2725, 3750, 3909, 6557, 7974, 8237, 8482, 105, 2983, 3543, 7880, 11240, 11533, 16252, 16256, 16445, 1269, 1597, 1886, 7722, 10723, 13268, 16134, 16367, 18910, 19234,
+  20580, 3294, 4062, 4685, 5774, 5959, 9150, 9458, 11038, 14640, 18560, 20586, 2933, 4617, 5476, 5926, 7193, 8493, 14415, 14573, 18778, 19161, 19428, 20503, 1413, 2752, 7885, 9069, 11343, 13573, 13910, 15602,
+  19948, 1946, 1957, 4086, 5546, 6093, 7853, 9244, 10782, 13051, 16018, 16803, 16919, 18158, 20191, 4097, 9243, 9587, 10806, 17499, 18855, 20588, 575, 1313, 3810, 9267, 10120, 10392, 14767, 15133, 19370, 20488,
+  2351, 6418, 7934, 10229, 12876, 18251, 18654, 19260, 19312, 418, 1768, 4411, 5317, 7312, 9932, 10148, 12387, 12421, 16234, 18735, 18805, 18893, 19983, 5429, 5633, 6365, 9029, 11226, 11253, 11312, 12128, 17037,
+  18057, 1064, 1657, 6929, 6956, 8020, 8308, 10500, 10708, 12662, 14405, 19280, 20296, 3682, 4320, 4326, 6835, 10623, 12126, 14365, 14618, 16350, 18299, 20271, 165, 479, 760, 1194, 2675, 3231, 5888, 6524,
+  7445, 9860, 16327, 19809, 2088, 4801, 4935, 7862, 13242, 15278, 18042, 18482, 20524, 3408, 3497, 4598, 4760, 5634, 6501, 6585, 9899, 10925, 11118, 14284, 14320, 14717, 15603, 629, 2099, 2754, 3737, 3858,
+  4261, 5056, 6536, 7020, 8529, 8951, 1510, 1764, 3709, 5416, 9563, 11270, 13336, 14396, 17400, 19770, 943, 3456, 4861, 6441, 8993, 10240, 12136, 13384, 16855, 20043, 1448, 2538, 3760, 7745, 13092, 13378,
+  15213, 17083, 18465, 19927, 1973, 2824, 3994, 5910, 6016, 7309, 13536, 13616, 15845, 16954, 17455, 20320, 140, 417, 2782, 4073, 8424, 9043, 10220, 15210, 688, 1412, 1919, 9538, 10249, 10595, 12252, 14813,
+  19301, 20089, 1918, 6330, 8628, 9402, 11756, 15024, 15593, 17482, 20587, 5291, 5509, 7181, 12248, 13194, 15031, 15892, 16564, 17777, 20084, 650, 1135, 2972, 3927, 5484, 6495, 6567, 9915, 10262, 5355, 5675,
+  6371, 7185, 7775, 8562, 13019, 15056, 19688, 1936, 2343, 3386, 6602, 8539, 10854, 16182, 16436, 18528, 2755, 7177, 11780, 12249, 13981, 14743, 16075, 16096, 20001, 20289, 20785, 503, 3542, 4157, 4250, 11779,
+  19696, 19775, 19892, 4006, 12014, 12055, 12800, 13744, 13933, 14463, 16541, 17815, 173, 586, 2577, 4185, 10364, 12351, 14534, 15375, 19230, 1400, 2714, 4125, 6728, 9128, 10743, 12330, 14450, 14511, 14747, 815,
+  1469, 3417, 5999, 6687, 7290, 8578, 15246, 16681, 5257, 5839, 7041, 7778, 8432, 10314, 11217, 12900, 18969, 19216, 20480, 494, 927, 1296, 2797, 4260, 8047, 11549, 19761, 1320, 5519, 7581, 7851, 8447,
+  11408, 12854, 14713, 15810, 17780, 892, 1457, 4891, 5116, 8842, 9795, 11255, 16385, 16728, 209, 448, 792, 1519, 2288, 3075, 4054, 5037, 9902, 10475, 13735, 17820, 18419, 19605, 1057, 4042, 4079, 11878,
+  17384, 2926, 4416, 5079, 10707, 11131, 13283, 15030, 15868, 18800, 18804, 19517, 2764, 2908, 8031, 9366, 11427, 14876, 16537, 17690, 1914, 7818, 8236, 11782, 11961, 14164, 15083, 15232, 16360, 17682, 18156, 20665,
+  439, 1151, 1471, 2574, 7404, 8368, 9125, 9731, 10133, 10657, 12204, 14865, 15403, 17526, 18556, 1823, 1830, 2117, 2261, 5306, 5516, 5737, 6254, 7865, 8932, 9232, 9281, 11968, 15245, 17309, 713, 949,
+  2180, 2761, 3008, 4403, 6281, 8791, 10933, 12357, 15484, 15668, 18490, 4208, 7343, 7466, 8935, 10847, 13599, 14622, 14629, 15801, 16176, 2240, 2375, 6667, 10625, 11645, 12496, 13233, 13716, 15583, 17543, 17923,
+  18444, 19896, 4938, 5309, 7006, 7044, 8303, 11934, 15001, 15288, 19138, 2153, 3419, 5846, 6802, 9178, 12698, 14271, 14400, 14833, 16061, 16149, 18901, 19798, 724, 8396, 9628, 12568, 12787, 17211, 19195, 20706,
+  1990, 4622, 5382, 6410, 8533, 9307, 11766, 12424, 14964, 19331, 20523, 3894, 4236, 5824, 7861, 8793, 9585, 12190, 12495, 2652, 5741, 6258, 6625, 8990, 9595, 10209, 10904, 12660, 14741, 18450, 4680, 8567,
+  9530, 10629, 11741, 12746, 14197, 14892, 16788, 20019, 4563, 8988, 9534, 9661, 10485, 11593, 12075, 16691, 16842, 18784, 19877, 4538, 4665, 5930, 5977, 6003, 13838, 17086, 18198, 18470, 20733, 638, 1340, 2137,
+  3945, 10379, 11998, 13679, 14292, 14520, 15924, 17073, 18176, 3433, 5156, 5837, 5894, 7339, 10187, 10585, 12011, 15907, 1644, 7118, 10605, 13926, 14169, 14262, 15813, 16005, 18595, 20764, 20786, 3192, 3329, 4140,
+  4308, 5419, 6462, 6862, 7350, 8265, 11642, 11691, 12912, 13553, 14065, 14204, 16651, 6162, 6220, 10513, 20513, 20538, 20683, 929, 1846, 7028, 9403, 9520, 13288, 13529, 14671, 14958, 15271, 15935, 16215, 19608,
+  2003, 2919, 4034, 4971, 5662, 7332, 7488, 8266, 10014, 10051, 10061, 10655, 11146, 12261, 17064, 18102, 762, 1115, 2120, 8892, 9884, 12734, 15882, 16456, 16629, 17779, 18720, 19382, 19973, 20007, 1568, 2087,
+  3134, 3728, 5251, 6438, 6534, 8269, 10121, 16254, 18256, 20424, 1962, 2175, 3633, 4796, 8675, 16120, 16446, 19548, 37, 41, 648, 1211, 2605, 4637, 5441, 10367, 14067, 14432, 14702, 14903, 15041, 19148,
+  1003, 4136, 6384, 8053, 8351, 9439, 10602, 12759, 13313, 827, 2306, 2946, 4915, 8742, 15116, 15498, 15653, 16225, 1534, 4465, 5279, 7734, 9907, 12301, 15090, 15401, 15421, 18252, 18300, 18422, 19014, 1612,
+  2265, 3704, 3849, 4379, 5951, 6657, 7465, 8083, 10554, 13022, 18233, 20044, 1470, 2164, 3475, 3912, 5767, 6771, 7329, 15598, 16362, 16392, 17343, 20062, 20481, 318, 3019, 4924, 9975, 11641, 11737, 12198,
+  13102, 13136, 17305, 18010, 20382, 20456, 5757, 8258, 9126, 9773, 9933, 13668, 14462, 16441, 18454, 20075, 7089, 7959, 9053, 10107, 10114, 10636, 10869, 12905, 14212, 14364, 20408, 1484, 4172, 4899, 5265, 16364,
+  16643, 17657, 20120, 3300, 6686, 9449, 9937, 12814, 15515, 17067, 19934, 20004, 1049, 1774, 1890, 1970, 4033, 5146, 6486, 11833, 13449, 13925, 16481, 17329, 20031, 20637, 3598, 4217, 5338, 5684, 8230, 9702,
+  14070, 14705, 17671, 17854, 18253, 18311, 18824, 1706, 2954, 3062, 5681, 6036, 10797, 11802, 14732, 15848, 16932, 17446, 19689, 3671, 6875, 8987, 11871, 20215, 1117, 8170, 8537, 9621, 10309, 10404, 11757, 13574,
+  15733, 19325, 19814, 459, 1154, 1737, 3629, 9141, 11913, 14382, 16475, 17198, 18760, 19963, 4164, 6540, 7512, 9709, 10097, 10705, 16116, 17257, 17560, 18752, 20034, 9712, 10789, 12892, 13446, 13542, 13782, 15086,
+  15255, 16189, 19355, 489, 2730, 4024, 4990, 5543, 5933, 9194, 11996, 16512, 18127, 1281, 3756, 5237, 5559, 8210, 9322, 10066, 11188, 11262, 11875, 12801, 17421, 19068, 1040, 2713, 2806, 3668, 10903, 11882,
+  19333, 833, 7772, 9298, 9329, 13683, 14971, 15835, 18651, 19276, 602, 3524, 11119, 13462, 16796, 17344, 18045, 18524, 613, 3089, 3632, 6116, 8027, 8658, 9601, 10571, 10832, 13017, 15599, 15775, 18525, 19020,
+  19259, 20269, 4919, 6408, 6584, 6587, 6883, 12171, 12273, 15044, 18249, 18581, 20794, 3990, 5223, 5408, 6213, 11223, 15304, 16893, 17219, 17380, 18170, 18570, 3083, 3338, 4252, 5088, 5221, 7222, 8200, 8486,
+  10586, 10675, 13337, 3649, 7912, 8582, 10171, 13652, 15368, 16187, 16231, 20421, 1575, 3780, 6762, 12206, 12562, 16927, 18637, 18704, 19793, 2709, 3472, 7362, 7776, 12422, 15693, 17604, 19965, 1997, 5653, 5988,
+  8467, 9129, 9245, 13016, 14586, 14686, 17666, 19921, 20578, 551, 2686, 2965, 3395, 3850, 5517, 7908, 8001, 12546, 15452, 16473, 18909, 24, 2205, 2624, 4263, 9341, 10041, 14288, 15542, 17579, 751, 1654,
+  2071, 3185, 6598, 13050, 14353, 19171, 19177, 20021, 2975, 3969, 6226, 7474, 8735, 15473, 17124, 19646, 1604, 2392, 3490, 3721, 4032, 6404, 9521, 9764, 11045, 15279, 16571, 19059, 20547, 545, 777, 1322,
+  2961, 3710, 3966, 6630, 9218, 13914, 14727, 18163, 19086, 19526, 139, 1350, 5386, 7162, 12069, 14567, 17731, 20735, 20762, 5132, 5373, 6076, 9377, 13738, 13929, 17915, 19752, 2545, 2694, 4167, 4291, 4677,
+  7642, 10939, 11784, 14177, 14223, 15592, 16799, 17438, 18141, 19152, 20770, 2967, 4324, 5512, 6456, 7918, 13061, 14332, 15926, 17110, 20559, 1591, 5106, 8877, 11925, 13196, 15176, 17204, 17983, 19746, 1645, 2849,
+  4031, 6648, 7241, 8559, 11047, 11503, 13154, 13889, 16047, 17365, 18461, 148, 854, 979, 1836, 7425, 7942, 8117, 9395, 9871, 12155, 19293, 20235, 20305, 4674, 5564, 6753, 7656, 9877, 14392, 14698, 15190,
+  15573, 16044, 18124, 917, 1528, 2743, 3296, 5284, 8580, 11592, 12313, 16292, 18263, 18552, 19520, 20558, 2794, 3625, 4415, 10322, 11561, 11897, 13975, 14203, 14672, 79, 367, 1769, 4468, 6424, 8697, 11451,
+  14409, 531, 2539, 2630, 3359, 6142, 8036, 9175, 9593, 9967, 13141, 13275, 13458, 14862, 15316, 18348, 3834, 5645, 6039, 7224, 8619, 9443, 12487, 12691, 13030, 13049, 13869, 124, 1896, 3254, 5669, 7340,
+  12790, 13946, 15767, 16306, 20729, 3589, 6049, 7078, 7217, 9084, 11953, 13088, 15057, 15146, 18347, 19447, 19588, 701, 1048, 1897, 2076, 4560, 7883, 8570, 9324, 10763, 14510, 16317, 17229, 17270, 17630, 20173,
+  1684, 1965, 2599, 2935, 7237, 13814, 14454, 15648, 7171, 7587, 8173, 8479, 12344, 13768, 13927, 13950, 16875, 18510, 2603, 3073, 9007, 10452, 14011, 15918, 17283, 17880, 63, 3484, 4780, 8049, 8378, 9893,
+  13413, 13931, 15891, 23, 3120, 6593, 9952, 12221, 12656, 13534, 19805, 199, 5785, 7993, 8909, 10666, 11978, 14562, 16776, 17379, 19566, 20077, 1536, 4058, 5471, 14317, 16339, 17360, 17935, 19477, 1496, 2732,
+  2841, 4511, 5467, 6496, 7213, 7413, 7482, 10694, 14863, 18588, 19352, 19367, 19564, 20268, 1411, 3739, 10760, 11225, 11249, 12277, 12699, 17535, 18407, 20234, 1880, 8848, 10092, 10543, 13432, 15172, 15351, 15875,
+  17366, 518, 2971, 5489, 8940, 9361, 10918, 13319, 15290, 15793, 116, 1868, 3407, 9209, 14190, 14442, 15650, 20561, 150, 709, 1942, 4955, 5035, 5685, 7243, 11104, 12454, 15160, 15636, 16496, 19035, 20214,
+  20273, 3974, 4353, 5305, 7211, 10796, 11277, 12992, 13193, 13902, 15710, 16048, 16228, 18389, 20483, 1943, 2176, 2364, 7714, 8665, 10032, 10563, 11142, 14798, 15475, 19801, 73, 3048, 5346, 6898, 7847, 8894,
+  9093, 9293, 17888, 18916, 659, 5760, 7478, 8161, 8336, 9993, 13225, 13359, 15480, 16087, 17651, 496, 2790, 5320, 12028, 12832, 13757, 18125, 19607, 190, 1084, 1109, 1197, 1417, 2695, 2941, 3307, 5246,
+  8194, 10385, 11368, 15584, 16443, 16698, 17088, 817, 6433, 6864, 7670, 7837, 7988, 8035, 12813, 12967, 13329, 13569, 15381, 16193, 17209, 17322, 3360, 4463, 6073, 6649, 7321, 9946, 10678, 10802, 11442, 16985,
+  18383, 1152, 5384, 8388, 10366, 11291, 14688, 14804, 14852, 705, 940, 4106, 6515, 9835, 11419, 15643, 16192, 16630, 6203, 6324, 6351, 8640, 12099, 12183, 17047, 17510, 3568, 4806, 6282, 7341, 11606, 13595,
+  14250, 14518, 16610, 17130, 17142, 17165, 18912, 20053, 20095, 2847, 3517, 3722, 3725, 4246, 5712, 5773, 6979, 16666, 16715, 20091, 20274, 7085, 9296, 9659, 9710, 9983, 10549, 12472, 17240, 18737, 1011, 1492,
+  6032, 6234, 6685, 12610, 15284, 15609, 16178, 483, 3326, 10659, 10850, 11562, 12360, 15342, 17504, 17788, 2151, 4446, 8299, 13769, 14424, 14901, 15647, 16236, 17451, 2391, 6207, 9464, 9754, 10034, 10414, 14641,
+  16278, 18286, 19528, 1181, 3675, 4865, 8124, 11627, 16249, 19760, 521, 675, 831, 3358, 3466, 4616, 5049, 5830, 7387, 7638, 7859, 12166, 12731, 15595, 19450, 20473, 93, 1132, 3837, 6511, 6527, 6784,
+  8091, 10532, 10581, 10766, 11138, 11522, 14759, 14821, 16532, 2092, 2227, 5628, 5904, 6269, 9901, 14064, 14500, 15936, 16221, 20158, 1887, 4199, 5085, 6576, 6914, 7794, 8769, 9110, 13185, 15698, 15999, 17462,
+  17837, 19861, 20684, 316, 1991, 2472, 3955, 6247, 10776, 11464, 11759, 13444, 17108, 2146, 3286, 5607, 6866, 8213, 9569, 12347, 15194, 16588, 17659, 17733, 18503, 756, 8382, 10999, 11091, 12535, 12780, 15557,
+  16760, 16996, 19781, 20641, 187, 270, 3137, 4007, 4123, 5417, 7242, 7537, 10143, 11356, 11716, 15266, 18557, 18740, 20304, 4648, 4821, 6872, 7919, 13899, 16812, 17610, 18973, 18986, 20392, 2207, 4926, 5295,
+  6311, 11596, 14072, 20557, 2118, 4754, 5412, 7033, 12510, 14031, 14068, 14659, 16014, 20417, 113, 587, 685, 2785, 2917, 3797, 12230, 17059, 17728, 18925, 19683, 19794, 19803, 20429, 20529, 844, 1283, 6813,
+  7283, 9423, 12024, 12280, 12588, 13200, 14240, 16845, 17600, 20344, 4091, 4141, 4359, 6671, 7510, 7842, 9582, 13209, 14128, 14471, 16085, 16955, 17586, 19357, 19372, 530, 2471, 3848, 7687, 9875, 13571, 14267,
+  16429, 17082, 17288, 17377, 18368, 5203, 6227, 8558, 10672, 15021, 15449, 15577, 16111, 16989, 43, 7549, 10860, 13105, 15589, 16963, 17898, 20660, 2318, 2509, 3458, 4813, 7135, 7826, 8071, 8358, 9454, 10146,
+  10631, 10879, 11456, 18037, 18545, 20008, 1682, 3361, 4882, 7799, 8953, 11662, 13580, 17095, 18171, 19936, 359, 4440, 4510, 6412, 13441, 17357, 19192, 1236, 2623, 4258, 6882, 6927, 8254, 11578, 12139, 12434,
+  14075, 17578, 17587, 18272, 18745, 19205, 19261, 212, 214, 3025, 4301, 5118, 5585, 8549, 8805, 9953, 10324, 13391, 17324, 18507, 19272, 19313, 19852, 2415, 3658, 5070, 5271, 6101, 10085, 10093, 11389, 12775,
+  18894, 19075, 19676, 20005, 20261, 20757, 18, 3876, 6881, 11031, 12678, 12855, 13364, 16563, 17157, 1138, 5534, 6494, 7873, 10246, 12433, 12595, 12730, 18930, 434, 607, 1770, 5387, 6906, 7132, 7436, 8372,
+  11473, 13900, 16714, 19029, 19667, 119, 1550, 6993, 8614, 9519, 13583, 13777, 14398, 15283, 15788, 303, 4908, 12374, 13460, 16679, 17306, 19653, 787, 1525, 2028, 6382, 7112, 7490, 7907, 11435, 12201, 16583,
+  18046, 3246, 5752, 9604, 11021, 12267, 17084, 3365, 4561, 5104, 7860, 11383, 12026, 13214, 15046, 19324, 7501, 7565, 11361, 12006, 14433, 15254, 17284, 20539, 824, 1522, 3899, 4570, 7536, 7547, 7756, 11715,
+  13126, 14095, 15828, 15920, 16540, 16871, 17877, 18381, 576, 6444, 7022, 7913, 8263, 9876, 11660, 14359, 14467, 15851, 15947, 16008, 16658, 17145, 17605, 20778, 1531, 3155, 4750, 5979, 6972, 7263, 8466, 9313,
+  10308, 10721, 11238, 13532, 13619, 14217, 14481, 15560, 470, 835, 1072, 2103, 3576, 3714, 4317, 6944, 7090, 9880, 12694, 12695, 17191, 19291, 10291, 12021, 16207, 16744, 17328, 20310, 297, 1418, 10433, 12747,
+  15973, 16603, 17969, 20509, 300, 754, 3205, 5981, 7534, 7615, 9374, 12508, 13943, 14361, 17701, 499, 1044, 5494, 10427, 13918, 13940, 14296, 14890, 15412, 16720, 18991, 3049, 4579, 4733, 5486, 5711, 6468,
+  6936, 9995, 11788, 11889, 13079, 13878, 14588, 15150, 15203, 19464, 2407, 2995, 5706, 7069, 8930, 9416, 10517, 14006, 14582, 15869, 16054, 16711, 16753, 18500, 20690, 20739, 2494, 3898, 8650, 8857, 9356, 9738,
+  10261, 10511, 11065, 11136, 13924, 14737, 16973, 18161, 19184, 20108, 2770, 4015, 5425, 6178, 6292, 8075, 11646, 12664, 12815, 13445, 15023, 18636, 19013, 4435, 6172, 7902, 9227, 10312, 19054, 1906, 3522, 5488,
+  9311, 9606, 10245, 13570, 15380, 15713, 17871, 17913, 19290, 20169, 20516, 1483, 2136, 3567, 6000, 10866, 13859, 14074, 15608, 18139, 7539, 7872, 10710, 12042, 12143, 16411, 16529, 19954, 20455, 6601, 6605, 9637,
+  12052, 16638, 16974, 18613, 20029, 20673, 1587, 3171, 9216, 12376, 12411, 13712, 14531, 16487, 17527, 767, 2130, 3453, 4345, 4371, 4376, 4404, 4974, 8869, 9435, 9719, 9798, 10119, 12010, 16293, 19531, 2367,
+  3331, 5254, 7878, 10717, 11987, 12824, 13980, 17416, 18747, 20016, 20211, 527, 4194, 9277, 15900, 17415, 17544, 2253, 3954, 4643, 4964, 8146, 10105, 11157, 13562, 14261, 14965, 16580, 16713, 17520, 17785, 18187,
+  19050, 931, 1665, 6221, 6652, 7391, 10046, 10215, 11565, 11683, 12331, 12469, 12884, 14855, 15242, 15678, 552, 1369, 2708, 3753, 6138, 6219, 6499, 8443, 9561, 11090, 12882, 13861, 16065, 17687, 20426, 2636,
+  3277, 5232, 7966, 9986, 13654, 14822, 15501, 16516, 16724, 2010, 4341, 4380, 7621, 15409, 17427, 17588, 19369, 19454, 109, 534, 6113, 12154, 12407, 13267, 14345, 18807, 19941, 2516, 7439, 7800, 9036, 12740,
+  17102, 17963, 20380, 646, 4458, 4673, 4969, 7365, 7624, 7703, 8564, 8610, 9302, 11198, 11346, 15017, 17826, 18962, 19656, 1497, 2025, 2645, 4249, 9959, 10256, 16800, 17158, 17174, 1464, 3302, 4864, 10168,
+  11421, 17339, 18463, 19160, 180, 3425, 6283, 6431, 7448, 7555, 10300, 11444, 11590, 13908, 13976, 14153, 17115, 17390, 18103, 19541, 1008, 5130, 9897, 10104, 10202, 10290, 10793, 13400, 15656, 19568, 591, 4609,
+  5245, 7015, 11491, 11516, 12561, 13305, 13537, 15555, 865, 2582, 5178, 6271, 8886, 9154, 9505, 10450, 11639, 12958, 14264, 15354, 15363, 18273, 19841, 1068, 2665, 3348, 5020, 9132, 10680, 16426, 17412, 17980,
+  18050, 18408, 18415, 20403, 2398, 3061, 3936, 4473, 4756, 5437, 6288, 10654, 10978, 12032, 13870, 17662, 17807, 1560, 7291, 8603, 12830, 14593, 17005, 17392, 18341, 18844, 20046, 20265, 2161, 3278, 3437, 5529,
+  6285, 6572, 8667, 10319, 10509, 11462, 14268, 1089, 5111, 7531, 15794, 15905, 17589, 17720, 18385, 19503, 1221, 4356, 4887, 5064, 6930, 8661, 8873, 13199, 77, 1740, 2098, 6192, 7723, 8409, 8717, 9961,
+  10053, 11525, 11589, 11781, 16021, 16248, 17897, 19968, 247, 1050, 2090, 4004, 4272, 6110, 9867, 10360, 10714, 12806, 15257, 15987, 16675, 20011, 20153, 20477, 620, 1210, 1434, 1963, 4102, 5727, 8298, 12242,
+  17138, 17391, 17767, 17895, 18515, 18520, 556, 686, 1666, 2683, 4437, 4573, 5143, 8536, 9982, 14585, 14673, 2450, 3017, 3817, 4606, 5840, 7868, 8494, 8887, 12124, 13039, 13058, 14104, 17472, 1611, 5073,
+  6279, 6961, 7116, 11483, 13641, 14061, 15027, 501, 3409, 7430, 10800, 11722, 12118, 13091, 13789, 14243, 15189, 15217, 16858, 17428, 18464, 18576, 403, 488, 882, 7891, 9282, 13818, 13961, 17968, 838, 2335,
+  2604, 2776, 2922, 4868, 8175, 10899, 13497, 13528, 13673, 14119, 14249, 15387, 16659, 18216, 438, 4651, 5135, 6328, 13527, 16202, 16825, 2193, 2473, 6983, 7225, 10177, 10429, 10881, 11447, 11663, 12323, 15171,
+  17750, 18643, 358, 2352, 2860, 5215, 5430, 10363, 15544, 15657, 17841, 2372, 2458, 2870, 3010, 3857, 4818, 6904, 10476, 12619, 15964, 16884, 17210, 18685, 20368, 3295, 4368, 10268, 12875, 14179, 15489, 15664,
+  17222, 2610, 4493, 7280, 9740, 9926, 11307, 12924, 15200, 16867, 18298, 18434, 19336, 20223, 2424, 8343, 9041, 9168, 9320, 10095, 10421, 13330, 16246, 17436, 2203, 5763, 6597, 8861, 9052, 9762, 9772, 13713,
+  17757, 18565, 2188, 5060, 5629, 10855, 12885, 15711, 16660, 19913, 20653, 20724, 595, 2209, 3026, 7747, 7967, 9736, 12614, 15323, 15660, 17374, 17561, 19386, 20067, 3447, 3726, 3843, 6332, 9771, 9941, 10512,
+  14324, 15010, 20427, 20494, 693, 2691, 4846, 6133, 8333, 8983, 14030, 15715, 16740, 18210, 19452, 20290, 205, 1732, 1742, 5936, 6656, 8240, 8317, 9612, 10953, 12045, 12663, 5067, 6558, 7236, 8365, 9172,
+  9643, 10486, 13508, 15169, 16314, 17018, 18690, 20721, 377, 3065, 3889, 5394, 5678, 6033, 13375, 14079, 18733, 19677, 20787, 504, 2626, 4994, 8514, 10282, 11461, 15829, 16542, 17099, 17311, 19304, 19306, 412,
+  6305, 6374, 9229, 15002, 16833, 16895, 16986, 19150, 20657, 172, 712, 2814, 3289, 4281, 4296, 7995, 8606, 11320, 11896, 12470, 14995, 15738, 16484, 5324, 9223, 9240, 9802, 11474, 14270, 16102, 16171, 16671,
+  16915, 17052, 17580, 19199, 19510, 922, 3028, 4132, 4608, 6808, 8212, 8729, 9453, 12481, 12808, 15915, 18971, 1110, 2678, 7066, 7301, 8749, 8989, 10926, 12547, 14003, 17806, 19337, 2957, 3001, 4196, 5342,
+  7392, 9526, 9812, 10020, 17304, 19356, 20416, 618, 3717, 3816, 5714, 7016, 12768, 12842, 14202, 15827, 19898, 557, 1798, 2174, 5427, 8018, 11081, 11810, 12225, 12609, 12797, 14372, 14521, 15476, 19463, 6859,
+  8801, 12961, 14167, 14886, 15386, 15910, 271, 877, 901, 1511, 5922, 6675, 7272, 7780, 7828, 8600, 9657, 14346, 15694, 15893, 16153, 19244, 1303, 2148, 3634, 5536, 8840, 9109, 10875, 12101, 14983, 16259,
+  17202, 18915, 19191, 19741, 1200, 4716, 7323, 7684, 8201, 9445, 10759, 12162, 13942, 17612, 18947, 19193, 20573, 20676, 20740, 1224, 1945, 2996, 4959, 6345, 7914, 8099, 14412, 14948, 16201, 17279, 20127, 169,
+  1147, 1829, 2122, 3000, 3441, 6043, 8132, 9161, 9725, 13826, 14897, 15645, 16818, 17689, 19945, 1061, 1717, 3421, 6129, 6159, 7604, 9015, 9912, 11801, 12733, 16922, 18843, 19250, 2807, 2880, 9233, 11098,
+  13699, 13832, 14607, 16894, 20700, 4739, 7558, 8604, 11696, 11946, 12557, 13947, 14321, 7001, 7513, 10153, 12364, 14010, 15995, 16137, 19315, 19366, 19634, 1811, 1967, 3044, 3961, 5301, 5349, 9642, 15372, 15629,
+  15884, 19251, 4738, 9162, 12337, 14423, 14701, 16086, 16656, 16817, 17195, 17411, 18834, 3198, 4098, 6298, 7773, 11799, 13637, 15251, 18967, 18975, 20640, 1223, 3011, 3319, 9152, 11676, 12681, 15084, 16802, 19218,
+  215, 823, 1136, 6889, 7769, 7827, 7879, 9405, 10084, 11615, 11836, 13186, 14192, 14319, 16856, 19415, 1163, 3325, 4439, 5991, 6900, 9248, 12254, 12865, 13149, 13325, 14025, 15512, 15732, 16599, 17539, 20241,
+  1876, 4128, 4729, 4845, 9260, 9732, 10013, 10305, 12929, 14831, 15081, 15155, 16123, 17782, 18089, 909, 5884, 7524, 7915, 8330, 8928, 12937, 15531, 15630, 15877, 17566, 17917, 19640, 19716, 2084, 3306, 7713,
+  9351, 11739, 18469, 18585, 20097, 20788, 11409, 12315, 12989, 15089, 16590, 16726, 18604, 19524, 286, 667, 3733, 4669, 5487, 6399, 7528, 11265, 15691, 17572, 20028, 1245, 1401, 4497, 5112, 5869, 5952, 8727,
+  9931, 18699, 274, 2573, 4429, 5024, 11850, 12401, 12463, 13084, 13248, 15582, 19203, 2039, 2102, 2712, 3706, 7143, 8592, 9654, 19658, 2344, 2659, 4735, 5835, 6505, 7178, 7417, 9381, 11479, 11920, 12456,
+  14651, 15674, 19850, 20672, 1593, 3665, 4124, 6241, 8323, 8435, 9106, 10508, 14233, 14870, 19408, 19703, 20118, 20525, 2299, 3950, 4688, 6786, 10344, 17567, 17878, 18149, 18436, 19578, 19855, 4160, 5357, 6583,
+  6691, 7504, 8599, 12318, 18642, 19624, 20354, 1103, 6029, 6607, 6896, 11369, 13104, 13290, 13858, 13990, 14146, 16768, 17950, 1193, 2910, 14526, 17943, 18406, 112, 2804, 3123, 5528, 7398, 7870, 7886, 8138,
+  8618, 9480, 11072, 11644, 18437, 18794, 19731, 19870, 388, 426, 789, 1311, 2779, 3896, 7300, 8531, 10196, 10769, 13883, 14963, 15843, 15885, 18238, 19187, 1487, 2005, 3378, 3960, 7304, 7718, 10004, 13941,
+  16422, 16710, 16772, 17007, 17387, 17466, 18346, 2427, 2940, 5428, 6390, 7975, 8074, 9490, 9823, 13015, 15586, 17840, 18508, 18558, 19481, 3807, 6488, 7586, 17562, 2376, 5831, 7758, 10616, 12202, 13431, 13561,
+  13632, 16326, 18416, 20476, 3271, 4036, 4286, 7750, 10096, 10804, 13100, 13978, 15118, 15509, 15985, 19848, 20492, 546, 3547, 3821, 10056, 11235, 11774, 12263, 13455, 13775, 14238, 17431, 19902, 20756, 583, 1515,
+  2034, 4462, 7262, 8900, 8931, 10192, 11075, 11440, 12723, 12726, 12752, 13847, 14761, 18235, 4274, 5626, 6020, 10346, 14307, 16994, 19802, 1246, 1670, 5365, 6115, 6541, 7787, 10762, 11077, 11110, 13863, 14348,
+  14648, 15959, 16122, 17617, 18501, 923, 1013, 3593, 3879, 5059, 10618, 10736, 11192, 12846, 13299, 13541, 16284, 17061, 19256, 19515, 4289, 6082, 6137, 7922, 8376, 9063, 13977, 14845, 15282, 15319, 18974, 19374,
+  10726, 12130, 14129, 15625, 15861, 16386, 18173, 18182, 18394, 19999, 197, 2198, 4419, 5784, 7345, 7347, 8151, 9470, 10542, 12040, 12398, 12881, 13812, 16506, 17331, 20645, 263, 2894, 3226, 4640, 6050, 10774,
+  11032, 14789, 16982, 19142, 20206, 2327, 9092, 9844, 9890, 10089, 10100, 12706, 14098, 17759, 18332, 18714, 18970, 2951, 7368, 9442, 9504, 9570, 12438, 15526, 17736, 18111, 20433, 20789, 4948, 7068, 7972, 11422,
+  12371, 14215, 14427, 15051, 16382, 16407, 17743, 19513, 3794, 4348, 5012, 7179, 8118, 8473, 8699, 9768, 11626, 12735, 19422, 19891, 118, 210, 1455, 4149, 5937, 6379, 10284, 15186, 17927, 1366, 1538, 5507,
+  7459, 10008, 14117, 14488, 17939, 20346, 2073, 2974, 4294, 7106, 7464, 7605, 8980, 9196, 12294, 16810, 17104, 18543, 18763, 3232, 4397, 6393, 6590, 6650, 10663, 11160, 11300, 12545, 14373, 15841, 17893, 1944,
+  4960, 5873, 6531, 8611, 9640, 12336, 14259, 16026, 18186, 18601, 19274, 19375, 1336, 1574, 3149, 4461, 5002, 11893, 13148, 14045, 16471, 16750, 17457, 20777, 819, 1399, 2008, 3337, 5718, 8041, 8933, 14163,
+  15195, 15216, 15344, 19078, 4365, 5795, 7287, 8103, 9819, 11055, 13851, 15291, 15726, 18993, 19201, 3462, 3614, 3813, 5415, 6599, 10325, 11210, 15202, 19387, 2083, 2843, 5248, 15125, 15912, 16595, 17958, 20749,
+  1274, 2662, 3005, 9741, 10002, 10867, 11922, 12168, 12661, 14403, 15929, 19429, 7527, 9250, 15117, 16092, 19399, 19652, 327, 431, 732, 879, 1526, 3272, 4565, 6746, 7292, 12648, 12687, 13490, 14016, 14279,
+  15699, 218, 2051, 2827, 4178, 5814, 8096, 8384, 14630, 15095, 18998, 1724, 4195, 5917, 8662, 10409, 18395, 20464, 2586, 2766, 3521, 4790, 7921, 8032, 8726, 9148, 11694, 13489, 14100, 14395, 15185, 15240,
+  19525, 19764, 699, 1566, 1680, 2290, 5744, 9518, 14844, 18351, 18773, 18776, 3392, 3734, 4377, 6990, 7277, 10271, 10810, 11855, 16731, 1280, 2321, 3559, 4664, 8916, 10600, 14386, 15053, 16240, 765, 3597,
+  4325, 10099, 16183, 17622, 17723, 18118, 1613, 2235, 5588, 7175, 7580, 8765, 12043, 14766, 14781, 15159, 16864, 17017, 17647, 661, 1085, 2297, 2899, 6132, 6829, 9337, 9956, 10328, 11798, 12690, 15527, 17111
+};
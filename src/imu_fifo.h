@@ -0,0 +1,122 @@
+#pragma once
+#include <Arduino.h>
+#include <Wire.h>
+#include <MPU6050.h>
+
+// ----------- MPU6050 FIFO acquisition -----------
+//
+// The MPU6050 samples itself at IMU_SAMPLE_RATE_HZ (1 kHz gyro clock /
+// sample rate divider) and queues accel + gyro in its 1 KB FIFO. Each
+// acquisition tick drains whatever accumulated in one burst read, so IMU
+// samples are evenly spaced by the sensor's own clock rather than by when
+// the read happens, and the 400 kHz bus keeps the read short.
+//
+// With IMU_OVERSAMPLE > 1 the sensor runs that many times faster than the
+// acquisition timer and each frame is the mean of the newest IMU_OVERSAMPLE
+// samples (box-filter decimation). 1 keeps the single-sample values the
+// models were trained on.
+//
+// Set IMU_USE_FIFO=0 for the old one-getMotion6()-per-frame path.
+
+#ifndef IMU_USE_FIFO
+#define IMU_USE_FIFO 1
+#endif
+
+#ifndef IMU_I2C_CLOCK_HZ
+#define IMU_I2C_CLOCK_HZ 400000
+#endif
+
+#ifndef IMU_OVERSAMPLE
+#define IMU_OVERSAMPLE 1
+#endif
+
+// MPU6050 INT pin wired to this GPIO paces acquisition from the sensor's
+// data-ready interrupt instead of the hardware timer (acquisition.h).
+// -1 = not wired.
+#ifndef IMU_INT_PIN
+#define IMU_INT_PIN -1
+#endif
+
+#define IMU_GYRO_CLOCK_HZ   1000   // gyro output rate with the DLPF enabled
+#define IMU_FIFO_SAMPLE     12     // accel xyz + gyro xyz, big-endian int16
+#define IMU_FIFO_SIZE       1024
+#define IMU_BURST_MAX       240    // bytes per getFIFOBytes() call (20 samples)
+
+class ImuFifo {
+public:
+  explicit ImuFifo(MPU6050& mpu)
+  : mpu(mpu), overflows(0)
+  {
+    memset(last, 0, sizeof(last));
+  }
+
+  // Program rate divider, DLPF and FIFO. rateHz is rounded to a divider of
+  // the 1 kHz gyro clock.
+  void begin(uint32_t rateHz) {
+    uint32_t hz = constrain(rateHz, 4UL, (uint32_t)IMU_GYRO_CLOCK_HZ);
+    mpu.setDLPFMode(MPU6050_DLPF_BW_42);   // also selects the 1 kHz clock
+    mpu.setRate((uint8_t)(IMU_GYRO_CLOCK_HZ / hz - 1));
+
+    mpu.setFIFOEnabled(false);
+    mpu.setAccelFIFOEnabled(true);
+    mpu.setXGyroFIFOEnabled(true);
+    mpu.setYGyroFIFOEnabled(true);
+    mpu.setZGyroFIFOEnabled(true);
+    mpu.resetFIFO();
+    mpu.setFIFOEnabled(true);
+
+#if IMU_INT_PIN >= 0
+    mpu.setInterruptMode(false);       // active high
+    mpu.setInterruptDrive(false);      // push-pull
+    mpu.setInterruptLatch(false);      // 50 us pulse
+    mpu.setIntDataReadyEnabled(true);
+#endif
+  }
+
+  // Drain the FIFO and return the mean of the newest `oversample` samples.
+  // When nothing new arrived (tick slightly ahead of the sensor clock) the
+  // previous values are repeated.
+  void read(int16_t& ax, int16_t& ay, int16_t& az,
+            int16_t& gx, int16_t& gy, int16_t& gz,
+            uint8_t oversample = IMU_OVERSAMPLE) {
+    uint16_t count = mpu.getFIFOCount();
+    if (count >= IMU_FIFO_SIZE - IMU_FIFO_SAMPLE) {
+      // Overflowed (reader stalled): the byte stream may be misaligned
+      mpu.resetFIFO();
+      overflows++;
+      count = 0;
+    }
+
+    uint16_t samples = count / IMU_FIFO_SAMPLE;
+    uint16_t skip = samples > oversample ? samples - oversample : 0;
+    int32_t sum[6] = {0};
+    uint16_t used = 0;
+
+    uint8_t burst[IMU_BURST_MAX];
+    while (samples > 0) {
+      uint16_t n = min(samples, (uint16_t)(IMU_BURST_MAX / IMU_FIFO_SAMPLE));
+      mpu.getFIFOBytes(burst, (uint8_t)(n * IMU_FIFO_SAMPLE));
+      for (uint16_t i = 0; i < n; ++i) {
+        if (skip) { --skip; continue; }
+        const uint8_t* p = burst + i * IMU_FIFO_SAMPLE;
+        for (int k = 0; k < 6; ++k) sum[k] += (int16_t)((p[2 * k] << 8) | p[2 * k + 1]);
+        used++;
+      }
+      samples -= n;
+    }
+
+    if (used) {
+      for (int k = 0; k < 6; ++k) last[k] = (int16_t)(sum[k] / used);
+    }
+    ax = last[0]; ay = last[1]; az = last[2];
+    gx = last[3]; gy = last[4]; gz = last[5];
+  }
+
+  // FIFO overflows since boot
+  uint32_t overflowCount() const { return overflows; }
+
+private:
+  MPU6050& mpu;
+  int16_t last[6];
+  uint32_t overflows;
+};
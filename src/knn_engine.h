@@ -0,0 +1,177 @@
+#pragma once
+#include <Arduino.h>
+#include "l1_kernel.h"
+
+// ----------- Generic KNN engine -----------
+//
+// One implementation of the KNN building blocks, specialized at compile
+// time on element type (float / int8_t), dimension, K, metric and weights.
+// Used by the gesture model (knn_runtime.h) and the sentence model
+// (sentence_predictor.h).
+//
+// Metric codes match KNN_METRIC: 0 = squared L2, 1 = L1, 2 = L-infinity.
+// Weight codes match KNN_WEIGHTS: 0 = uniform, 1 = 1 / (d + eps).
+//
+// Plain C++11 (no if constexpr): choices are made through template
+// specialization, so every instantiation compiles to straight-line code.
+
+// Element traits: table access and distance accumulator type
+template <typename T> struct KnnElem;
+
+template <> struct KnnElem<float> {
+  typedef float Acc;
+  typedef float Diff;
+  static float load(const float* p) { return pgm_read_float(p); }
+  static Acc maxDist() { return 1e30f; }
+  static Acc absDiff(Diff x) { return fabsf(x); }  // branch-free; sums start at +0
+};
+
+template <> struct KnnElem<int8_t> {
+  typedef uint32_t Acc;
+  typedef int Diff;
+  static int load(const int8_t* p) { return (int8_t)pgm_read_byte(p); }
+  static Acc maxDist() { return UINT32_MAX; }
+  static Acc absDiff(Diff x) { return (uint32_t)(x >= 0 ? x : -x); }
+};
+
+// Per-element metric update
+template <typename T, int M> struct KnnMetric;
+
+template <typename T> struct KnnMetric<T, 0> {   // squared L2
+  static void add(typename KnnElem<T>::Acc& d, typename KnnElem<T>::Diff x) {
+    d += (typename KnnElem<T>::Acc)(x * x);
+  }
+};
+
+template <typename T> struct KnnMetric<T, 1> {   // L1
+  static void add(typename KnnElem<T>::Acc& d, typename KnnElem<T>::Diff x) {
+    d += KnnElem<T>::absDiff(x);
+  }
+};
+
+template <typename T> struct KnnMetric<T, 2> {   // L-infinity
+  static void add(typename KnnElem<T>::Acc& d, typename KnnElem<T>::Diff x) {
+    typename KnnElem<T>::Acc ax = KnnElem<T>::absDiff(x);
+    if (ax > d) d = ax;
+  }
+};
+
+// Fully unrolled accumulation over elements [I, END)
+template <typename T, int M, int I, int END> struct KnnUnroll {
+  static void run(const T* a, const T* b, typename KnnElem<T>::Acc& d) {
+    KnnMetric<T, M>::add(d, (typename KnnElem<T>::Diff)a[I] - KnnElem<T>::load(&b[I]));
+    KnnUnroll<T, M, I + 1, END>::run(a, b, d);
+  }
+};
+
+template <typename T, int M, int END> struct KnnUnroll<T, M, END, END> {
+  static void run(const T*, const T*, typename KnnElem<T>::Acc&) {}
+};
+
+// Distance over D elements in unrolled blocks of BLOCK, checked against the
+// caller's bound after every block (early abandon). Elements are summed in
+// index order, so float results match a plain loop bit for bit.
+template <typename T, int D, int M, int BLOCK>
+struct KnnBlockDistance {
+  typedef typename KnnElem<T>::Acc Acc;
+
+  static Acc full(const T* a, const T* b) {
+    Acc d = 0;
+    KnnUnroll<T, M, 0, D>::run(a, b, d);
+    return d;
+  }
+
+  Acc operator()(const T* a, const T* b, Acc bound) const {
+    Acc d = 0;
+    for (int i0 = 0; i0 + BLOCK <= D; i0 += BLOCK) {
+      KnnUnroll<T, M, 0, BLOCK>::run(a + i0, b + i0, d);
+      if (d >= bound) return d;
+    }
+    KnnUnroll<T, M, 0, D % BLOCK>::run(a + D - D % BLOCK, b + D - D % BLOCK, d);
+    return d;
+  }
+};
+
+// int8 L1 goes through the SWAR kernel (short rows: no abandon checks)
+template <int D, int BLOCK>
+struct KnnBlockDistance<int8_t, D, 1, BLOCK> {
+  typedef uint32_t Acc;
+
+  static Acc full(const int8_t* a, const int8_t* b) { return l1_distance_i8(a, b, D); }
+
+  Acc operator()(const int8_t* a, const int8_t* b, Acc) const { return l1_distance_i8(a, b, D); }
+};
+
+// ----------- Top-K neighbour list -----------
+// Sorted ascending by (distance, row). Ordering ties by row makes the result
+// independent of visiting order; for an ascending scan it is the same as
+// "first row wins", which is what the original loops did.
+template <int K, typename Acc>
+struct KnnTopK {
+  Acc dist[K];
+  int row[K];
+
+  void reset(Acc maxDist) {
+    for (int k = 0; k < K; ++k) {
+      dist[k] = maxDist;
+      row[k] = -1;
+    }
+  }
+
+  Acc bound() const { return dist[K - 1]; }
+
+  static bool before(Acc d, int r, Acc dk, int rk) {
+    return d < dk || (d == dk && (unsigned)r < (unsigned)rk);
+  }
+
+  void insert(Acc d, int r) {
+    if (!before(d, r, dist[K - 1], row[K - 1])) return;  // common case
+
+    // Branch-free shift: every slot selects shift / place / keep
+    bool placeHere = true;  // new entry sorts before slot K-1
+    for (int k = K - 1; k > 0; --k) {
+      bool shift = before(d, r, dist[k - 1], row[k - 1]);
+      dist[k] = shift ? dist[k - 1] : (placeHere ? d : dist[k]);
+      row[k]  = shift ? row[k - 1]  : (placeHere ? r : row[k]);
+      placeHere = shift;
+    }
+    dist[0] = placeHere ? d : dist[0];
+    row[0]  = placeHere ? r : row[0];
+  }
+};
+
+// Brute-force scan of a row-major PROGMEM table with n rows of D elements.
+template <typename T, int D, int K, typename Dist>
+inline void knn_scan(const T* query, const T* table, int n, const Dist& dist,
+                     KnnTopK<K, typename KnnElem<T>::Acc>& top) {
+  for (int i = 0; i < n; ++i) {
+    top.insert(dist(query, table + (size_t)i * D, top.bound()), i);
+  }
+}
+
+// ----------- Voting -----------
+template <int W> struct KnnWeight;
+template <> struct KnnWeight<0> { static float of(float, float) { return 1.0f; } };
+template <> struct KnnWeight<1> { static float of(float d, float eps) { return 1.0f / (d + eps); } };
+
+// Vote over K neighbours; ties go to the lowest class index.
+template <int NC, int K, int W>
+inline uint8_t knn_vote(const float dist[K], const uint8_t labels[K], float eps) {
+  float votes[NC];
+  for (int c = 0; c < NC; ++c) votes[c] = 0.0f;
+
+  for (int k = 0; k < K; ++k) {
+    uint8_t lbl = labels[k];
+    if (lbl < NC) votes[lbl] += KnnWeight<W>::of(dist[k], eps);
+  }
+
+  uint8_t bestClass = 0;
+  float bestVote = votes[0];
+  for (int c = 1; c < NC; ++c) {
+    if (votes[c] > bestVote) {
+      bestVote = votes[c];
+      bestClass = c;
+    }
+  }
+  return bestClass;
+}
@@ -1,111 +1,255 @@
 #pragma once
 #include <Arduino.h>
-#include "glove_knn_model.h"
 #include "label_names.h"
+#include "scaler_params.h"
+#include "knn_engine.h"
+
+// ----------- Model table selection -----------
+// KNN_USE_INT8 = 1 : int8 table (glove_knn_model_q.h, ~250 KB), integer scan
+// KNN_USE_INT8 = 0 : original float table (glove_knn_model.h, ~1 MB)
+// Both headers are written by tools/train_knn.py from the same export set.
+#ifndef KNN_USE_INT8
+#define KNN_USE_INT8 1
+#endif
+
+#if KNN_USE_INT8
+#include "glove_knn_model_q.h"
+#else
+#include "glove_knn_model.h"
+#endif
+
+// KNN_USE_INDEX = 1 : exact K-nearest search through the KD-tree in
+//                     glove_knn_index.h (int8 table only)
+// KNN_USE_INDEX = 0 : brute-force scan over every row
+#ifndef KNN_USE_INDEX
+#define KNN_USE_INDEX KNN_USE_INT8
+#endif
+
+#if KNN_USE_INDEX
+#if !KNN_USE_INT8
+#error "KNN_USE_INDEX requires KNN_USE_INT8 (the index is built over X_train_q)"
+#endif
+#include "glove_knn_index.h"
+static_assert(KNN_INDEX_NUM_SAMPLES == NUM_SAMPLES, "glove_knn_index.h does not match glove_knn_model_q.h, re-run train_knn.py");
+#endif
+
+// ----------- Active tables -----------
+// The search reads the trained data through these pointers. They start at
+// the compiled-in tables; model_loader.h repoints them at a model container
+// mapped from flash, so a retrained model runs without a rebuild. K, metric,
+// weights and the class count stay compile-time and must match.
+struct GestureTables {
+  const float* scalerMean;     // NUM_FEATURES
+  const float* scalerScale;
+#if KNN_USE_INT8
+  uint32_t numSamples;
+  const int8_t* rows;          // numSamples x NUM_FEATURES, 4-byte aligned
+  const uint8_t* labels;
+  const float* qScales;        // NUM_FEATURES
+#if KNN_USE_INDEX
+  uint32_t indexNodes;
+  const uint8_t* indexDim;
+  const int8_t* indexSplit;
+  const uint16_t* indexA;
+  const uint16_t* indexB;
+  const uint16_t* indexPerm;   // numSamples
+#endif
+#endif
+};
+
+inline GestureTables knn_embedded_tables() {
+  GestureTables t;
+  t.scalerMean = SCALER_MEAN;
+  t.scalerScale = SCALER_SCALE;
+#if KNN_USE_INT8
+  t.numSamples = NUM_SAMPLES;
+  t.rows = &X_train_q[0][0];
+  t.labels = y_train;
+  t.qScales = KNN_Q_SCALES;
+#if KNN_USE_INDEX
+  t.indexNodes = KNN_INDEX_NUM_NODES;
+  t.indexDim = KNN_INDEX_DIM;
+  t.indexSplit = KNN_INDEX_SPLIT;
+  t.indexA = KNN_INDEX_A;
+  t.indexB = KNN_INDEX_B;
+  t.indexPerm = KNN_INDEX_PERM;
+#endif
+#endif
+  return t;
+}
+
+GestureTables gestureTables = knn_embedded_tables();
+
+// Raw features -> standardized, with the active scaler
+inline void knn_standardize(float feat[NUM_FEATURES]) {
+  for (int i = 0; i < NUM_FEATURES; ++i) {
+    feat[i] = (feat[i] - gestureTables.scalerMean[i]) / gestureTables.scalerScale[i];
+  }
+}
+
+// Distance kernels for this model, checked against the K-th best every
+// KNN_ABANDON_BLOCK features. All three metrics only grow as features are
+// added, so an abandoned row could never have been inserted.
+#define KNN_ABANDON_BLOCK 4
 
-// Compute distance between two feature vectors (size NUM_FEATURES)
+typedef KnnBlockDistance<float, NUM_FEATURES, KNN_METRIC, KNN_ABANDON_BLOCK> KnnFloatDistance;
+
+// Full float distance between two feature vectors (size NUM_FEATURES)
 inline float knn_distance(const float* a, const float* b) {
-  if (KNN_METRIC == 0) {
-    // Euclidean (squared L2)
-    float d = 0.0f;
-    for (int i = 0; i < NUM_FEATURES; ++i) {
-      float diff = a[i] - b[i];
-      d += diff * diff;
-    }
-    return d;
-  } else if (KNN_METRIC == 1) {
-    // Manhattan (L1)
-    float d = 0.0f;
-    for (int i = 0; i < NUM_FEATURES; ++i) {
-      float diff = a[i] - b[i];
-      d += (diff >= 0 ? diff : -diff);
+  return KnnFloatDistance::full(a, b);
+}
+
+#if KNN_USE_INT8
+typedef KnnBlockDistance<int8_t, NUM_FEATURES, KNN_METRIC, KNN_ABANDON_BLOCK> KnnQDistance;
+typedef KnnTopK<KNN_K, uint32_t> KnnQTopK;
+
+// Abandon bound for a candidate: a row at exactly the K-th distance may
+// still win on the row tie-break, so only stop once it is strictly beyond.
+inline uint32_t knn_tie_bound(uint32_t kth) {
+  return kth == UINT32_MAX ? kth : kth + 1;
+}
+
+// Standardized features -> int8 query in the table's quantized space
+inline void knn_quantize(const float feat[NUM_FEATURES], int8_t qFeat[NUM_FEATURES]) {
+  for (int i = 0; i < NUM_FEATURES; ++i) {
+    float q = feat[i] * pgm_read_float(&gestureTables.qScales[i]);
+    if (q > 127.0f) q = 127.0f; else if (q < -128.0f) q = -128.0f;
+    qFeat[i] = (int8_t)lrintf(q);
+  }
+}
+
+#if KNN_USE_INDEX
+// ----------- KD-tree search -----------
+// Depth-first, near child first. The far child is skipped when a lower
+// bound of its distance is already beyond the K-th best. The bound is kept
+// incrementally: off[] holds the per-axis gap from the query to the current
+// cell (sum of axis terms for L1/L2, max for Linf).
+struct KnnIndexQuery {
+  const int8_t* q;
+  KnnQTopK* top;
+  uint16_t off[NUM_FEATURES];
+};
+
+inline uint32_t knn_axis_dist(uint32_t gap) {
+  return KNN_METRIC == 0 ? gap * gap : gap;
+}
+
+inline void knn_index_search(KnnIndexQuery& s, int node, uint32_t rd) {
+  uint8_t dim = pgm_read_byte(&gestureTables.indexDim[node]);
+
+  if (dim == 0xFF) {
+    const KnnQDistance dist = KnnQDistance();
+    int start = pgm_read_word(&gestureTables.indexA[node]);
+    int count = pgm_read_word(&gestureTables.indexB[node]);
+    for (int j = 0; j < count; ++j) {
+      int row = pgm_read_word(&gestureTables.indexPerm[start + j]);
+      const int8_t* r = gestureTables.rows + (size_t)row * NUM_FEATURES;
+      s.top->insert(dist(s.q, r, knn_tie_bound(s.top->bound())), row);
     }
-    return d;
+    return;
+  }
+
+  int split = (int8_t)pgm_read_byte(&gestureTables.indexSplit[node]);
+  int right = pgm_read_word(&gestureTables.indexA[node]);
+  int qv = s.q[dim];
+
+  // Left holds codes <= split, right holds codes >= split + 1
+  int nearNode, farNode;
+  uint32_t gap;
+  if (qv <= split) {
+    nearNode = node + 1;
+    farNode = right;
+    gap = (uint32_t)(split + 1 - qv);
   } else {
-    // Chebyshev (L-infinity)
-    float dmax = 0.0f;
-    for (int i = 0; i < NUM_FEATURES; ++i) {
-      float diff = a[i] - b[i];
-      float adiff = (diff >= 0 ? diff : -diff);
-      if (adiff > dmax) dmax = adiff;
-    }
-    return dmax;
+    nearNode = right;
+    farNode = node + 1;
+    gap = (uint32_t)(qv - split);
+  }
+
+  knn_index_search(s, nearNode, rd);
+
+  uint16_t oldOff = s.off[dim];
+  uint32_t farRd;
+  if (KNN_METRIC == 2) {
+    farRd = rd > gap ? rd : gap;
+  } else {
+    farRd = rd - knn_axis_dist(oldOff) + knn_axis_dist(gap);
   }
+  // Strict: a row at exactly the K-th distance can still win the tie-break
+  if (farRd > s.top->bound()) return;
+
+  s.off[dim] = (uint16_t)gap;
+  knn_index_search(s, farNode, farRd);
+  s.off[dim] = oldOff;
 }
+#endif
+#endif
 
 // KNN classification.
 // Returns label index (compatible with label_names[]).
 // Optionally returns the best (nearest) distance via out_best_dist.
 inline uint8_t knn_predict(const float feat[NUM_FEATURES], float* out_best_dist = nullptr) {
-  // Store K best neighbors
   float bestDist[KNN_K];
   uint8_t bestLabel[KNN_K];
 
-  for (int k = 0; k < KNN_K; ++k) {
-    bestDist[k] = 1e30f;
-    bestLabel[k] = 0;
-  }
+#if KNN_USE_INT8
+  // Search in integer space, then re-score only the K winners in float
+  static int8_t qFeat[NUM_FEATURES] __attribute__((aligned(4)));
+  knn_quantize(feat, qFeat);
 
-  // Scan all training samples
-  for (int i = 0; i < NUM_SAMPLES; ++i) {
-    float sample[NUM_FEATURES];
-    for (int j = 0; j < NUM_FEATURES; ++j) {
-      sample[j] = X_train[i][j];  // PROGMEM is no-op on ESP32
-    }
+  KnnQTopK top;
+  top.reset(UINT32_MAX);
 
-    float d = knn_distance(feat, sample);
+#if KNN_USE_INDEX
+  KnnIndexQuery query;
+  query.q = qFeat;
+  query.top = &top;
+  for (int j = 0; j < NUM_FEATURES; ++j) query.off[j] = 0;
+  knn_index_search(query, 0, 0);
+#else
+  knn_scan<int8_t, NUM_FEATURES, KNN_K>(qFeat, gestureTables.rows, (int)gestureTables.numSamples, KnnQDistance(), top);
+#endif
 
-    // Insert into sorted bestDist array (largest at the end)
-    int idx = -1;
-    for (int k = 0; k < KNN_K; ++k) {
-      if (d < bestDist[k]) {
-        idx = k;
-        break;
-      }
+  // Dequantize the K neighbors so weights and the reported distance stay in
+  // standardized units (same scale as the float model / UI thresholds)
+  for (int k = 0; k < KNN_K; ++k) {
+    if (top.row[k] < 0) {
+      bestDist[k] = 1e30f;
+      bestLabel[k] = 0;
+      continue;
     }
-    if (idx >= 0) {
-      for (int k = KNN_K - 1; k > idx; --k) {
-        bestDist[k] = bestDist[k - 1];
-        bestLabel[k] = bestLabel[k - 1];
-      }
-      bestDist[idx] = d;
-      bestLabel[idx] = y_train[i];
+    float sample[NUM_FEATURES];
+    const int8_t* row = gestureTables.rows + (size_t)top.row[k] * NUM_FEATURES;
+    for (int j = 0; j < NUM_FEATURES; ++j) {
+      sample[j] = (float)(int8_t)pgm_read_byte(&row[j]) / pgm_read_float(&gestureTables.qScales[j]);
     }
+    bestDist[k] = knn_distance(feat, sample);
+    bestLabel[k] = pgm_read_byte(&gestureTables.labels[top.row[k]]);
   }
 
   if (out_best_dist) {
-    *out_best_dist = bestDist[0];
+    float dmin = bestDist[0];
+    for (int k = 1; k < KNN_K; ++k) {
+      if (bestDist[k] < dmin) dmin = bestDist[k];
+    }
+    *out_best_dist = dmin;
   }
+#else
+  // Scan the float table in place (no per-row copy)
+  KnnTopK<KNN_K, float> top;
+  top.reset(1e30f);
+  knn_scan<float, NUM_FEATURES, KNN_K>(feat, &X_train[0][0], NUM_SAMPLES, KnnFloatDistance(), top);
 
-  // Voting over the K neighbors
-  float votes[NUM_CLASSES];
-  for (int c = 0; c < NUM_CLASSES; ++c) votes[c] = 0.0f;
-
-  if (KNN_WEIGHTS == 0) {
-    // Uniform weights
-    for (int k = 0; k < KNN_K; ++k) {
-      uint8_t lbl = bestLabel[k];
-      if (lbl < NUM_CLASSES) votes[lbl] += 1.0f;
-    }
-  } else {
-    // Distance weights: weight = 1 / (d + eps)
-    const float eps = 1e-3f;
-    for (int k = 0; k < KNN_K; ++k) {
-      uint8_t lbl = bestLabel[k];
-      float w = 1.0f / (bestDist[k] + eps);
-      if (lbl < NUM_CLASSES) votes[lbl] += w;
-    }
+  for (int k = 0; k < KNN_K; ++k) {
+    bestDist[k] = top.dist[k];
+    bestLabel[k] = top.row[k] < 0 ? 0 : pgm_read_byte(&y_train[top.row[k]]);
   }
 
-  // Pick label with max vote
-  uint8_t bestClass = 0;
-  float bestVote = votes[0];
-  for (int c = 1; c < NUM_CLASSES; ++c) {
-    if (votes[c] > bestVote) {
-      bestVote = votes[c];
-      bestClass = c;
-    }
+  if (out_best_dist) {
+    *out_best_dist = bestDist[0];
   }
+#endif
 
-  return bestClass;
+  // Voting over the K neighbors (distance weights: 1 / (d + eps))
+  return knn_vote<NUM_CLASSES, KNN_K, KNN_WEIGHTS>(bestDist, bestLabel, 1e-3f);
 }
@@ -0,0 +1,129 @@
+#pragma once
+#include <Arduino.h>
+
+// ----------- int8 L1 (Manhattan) distance kernels -----------
+//
+// Distances are accumulated in integers, so every kernel returns exactly
+// the same value as the reference loop: sum(|a[i] - b[i]|).
+//
+// Select the kernel at compile time with -DL1_KERNEL=...
+//   L1_KERNEL_SCALAR : one byte per step, integer accumulator
+//   L1_KERNEL_SWAR   : four int8 lanes per 32-bit word (default)
+//
+// The SWAR kernel needs both pointers 4-byte aligned; the exported
+// int8 tables and the query buffers are declared aligned(4) for this.
+
+#define L1_KERNEL_SCALAR 0
+#define L1_KERNEL_SWAR   1
+
+#ifndef L1_KERNEL
+#define L1_KERNEL L1_KERNEL_SWAR
+#endif
+
+// Reference kernel (plain C, also used for the tail of the SWAR kernel)
+inline uint32_t l1_distance_i8_scalar(const int8_t* a, const int8_t* b, int n) {
+  uint32_t d = 0;
+  for (int i = 0; i < n; ++i) {
+    int diff = (int)a[i] - (int)(int8_t)pgm_read_byte(&b[i]);
+    d += (uint32_t)(diff >= 0 ? diff : -diff);
+  }
+  return d;
+}
+
+// Sum of absolute differences of two words holding four int8 lanes each.
+// Lanes are biased to unsigned (x ^ 0x80 keeps |x - y|) and split into
+// even/odd bytes so every lane has 8 spare bits and borrows never cross
+// lanes. Returns two 16-bit partial sums (each <= 510) packed in a word.
+static inline uint32_t l1_sad_word_i8(uint32_t wa, uint32_t wb) {
+  const uint32_t LO  = 0x00FF00FFu;
+  const uint32_t ONE = 0x00010001u;
+  const uint32_t B8  = 0x01000100u;
+
+  wa ^= 0x80808080u;
+  wb ^= 0x80808080u;
+
+  uint32_t xs[2] = { wa & LO, (wa >> 8) & LO };
+  uint32_t ys[2] = { wb & LO, (wb >> 8) & LO };
+  uint32_t sum = 0;
+
+  for (int h = 0; h < 2; ++h) {
+    uint32_t t = (xs[h] | B8) - ys[h];    // 256 + x - y per lane, no cross-lane borrow
+    uint32_t ge = (t >> 8) & ONE;         // 1 where x >= y
+    uint32_t lt = ge ^ ONE;               // 1 where x <  y
+    uint32_t ltMask = (lt << 8) - lt;     // 0xFF where x < y
+    uint32_t d = t & LO;                  // (x - y) mod 256
+    sum += (d ^ ltMask) + lt;             // negate lanes where x < y -> |x - y|
+  }
+  return sum;
+}
+
+// SWAR kernel: 4 lanes per word, 16-bit lane accumulators flushed to a
+// 32-bit total before they can overflow (128 words * 510 < 65536).
+inline uint32_t l1_distance_i8_swar(const int8_t* a, const int8_t* b, int n) {
+  if (((uintptr_t)a | (uintptr_t)b) & 3u) {
+    return l1_distance_i8_scalar(a, b, n);  // unaligned caller, stay safe
+  }
+
+  const uint8_t* pa = (const uint8_t*)__builtin_assume_aligned(a, 4);
+  const uint8_t* pb = (const uint8_t*)__builtin_assume_aligned(b, 4);
+
+  const int words = n >> 2;
+  uint32_t total = 0;
+  int w = 0;
+
+  while (w < words) {
+    int end = w + 128;
+    if (end > words) end = words;
+
+    uint32_t acc = 0;
+    for (; w < end; ++w) {
+      uint32_t wa, wb;
+      memcpy(&wa, pa + 4 * w, 4);
+      memcpy(&wb, pb + 4 * w, 4);
+      acc += l1_sad_word_i8(wa, wb);
+    }
+    total += (acc & 0xFFFFu) + (acc >> 16);
+  }
+
+  int done = words << 2;
+  if (done < n) {
+    total += l1_distance_i8_scalar(a + done, b + done, n - done);
+  }
+  return total;
+}
+
+// Compile-time selected kernel
+inline uint32_t l1_distance_i8(const int8_t* a, const int8_t* b, int n) {
+#if L1_KERNEL == L1_KERNEL_SWAR
+  return l1_distance_i8_swar(a, b, n);
+#else
+  return l1_distance_i8_scalar(a, b, n);
+#endif
+}
+
+// Early-abandoning variant for KNN search. Sums blockLen-byte blocks in the
+// given order and stops as soon as the partial sum reaches `bound` (the
+// current K-th best). An abandoned candidate returns a value >= bound, so it
+// is rejected exactly as the full distance would be; integer sums make the
+// result independent of the visiting order.
+inline uint32_t l1_distance_i8_bounded(const int8_t* a, const int8_t* b,
+                                       const uint16_t* order, int nBlocks,
+                                       int blockLen, uint32_t bound) {
+  uint32_t d = 0;
+  for (int i = 0; i < nBlocks; ++i) {
+    int off = (int)pgm_read_word(&order[i]) * blockLen;
+    d += l1_distance_i8(a + off, b + off, blockLen);
+    if (d >= bound) break;
+  }
+  return d;
+}
+
+// int16 L1, for the coarse sentence prefilter (sums of int8 timesteps)
+inline uint32_t l1_distance_i16(const int16_t* a, const int16_t* b, int n) {
+  uint32_t d = 0;
+  for (int i = 0; i < n; ++i) {
+    int diff = (int)a[i] - (int)(int16_t)pgm_read_word(&b[i]);
+    d += (uint32_t)(diff >= 0 ? diff : -diff);
+  }
+  return d;
+}
@@ -1,11 +1,21 @@
 #include <Arduino.h>
 #include "Calib.h"
 #include "predictor.h"
+#include "acquisition.h"
+#include "wire_protocol.h"
+#include "web_stream.h"
+#include "command_parser.h"
+#include "stage_stats.h"
 
 // Force enable sentence mode (files verified to exist)
 #define SENTENCE_MODE_AVAILABLE 1
 #include "sentence_predictor.h"
 #include "sentence_label_names.h"
+#include "model_loader.h"
+#include "motion_gate.h"
+#include "sentence_worker.h"
+#include "session_recorder.h"
+#include <esp_pm.h>
 
 
 // 0 = DATA COLLECTION (raw log for Python tools)
@@ -15,25 +25,72 @@
 
 // Prediction modes (only used when RUN_MODE == 1)
 // 0 = GESTURE MODE (instant gestures)
-// 1 = SENTENCE MODE (3-second windows)
+// 1 = SENTENCE MODE (continuous, overlapping 4-second windows)
 // 2 = AUTO MODE (gesture by default, sentence via web UI command)
+// This is the boot default; the MODE serial command switches at runtime.
+#define PREDICTION_MODE_GESTURE  0
+#define PREDICTION_MODE_SENTENCE 1
+#define PREDICTION_MODE_AUTO     2
 #define PREDICTION_MODE 2
 
 GlovePredictor predictor;
 SentencePredictor sentencePredictor;
+SentenceWorker sentenceWorker(sentencePredictor);   // owns sentencePredictor once started
+SensorAcquisition acquisition(predictor);
+
+#if WEB_SERVER_ENABLED
+GloveWebServer webServer;
+#endif
+
+// Model container in the "models" flash partition (model_store.h)
+ModelStore modelStore;
+ModelLoadResult modelLoad = { false, false, "not loaded", "not loaded" };
+
+#if RUN_MODE != 0 && SESSION_RECORDER
+// Full-rate recordings on LittleFS (REC commands)
+SessionRecorder sessionRecorder;
+#endif
 
 // Use header-based sentence model (arrays included via sentence_predictor.h)
 // Removed inclusion of sentence_knn_model.cpp (outdated / imbalanced model)
 
+const uint32_t SERIAL_BAUD = 115200;
+
 // Simple timer for collection loop
 uint32_t lastPrintMs = 0;
 const uint32_t COLLECT_PERIOD_MS = 50;   // ~20 Hz
 
+// Gesture window length (sliding mean over samples from the acquisition ring)
+const uint32_t GESTURE_WINDOW_MS = 250;
+const uint8_t GESTURE_WINDOW_FRAMES = (uint8_t)(GESTURE_WINDOW_MS * ACQ_SAMPLE_RATE_HZ / 1000);
+
+// Gesture classification runs on every frame; output is throttled so
+// 115200 baud is not saturated (~250 bytes per JSON frame, 38 binary)
+const uint32_t GESTURE_OUTPUT_PERIOD_MS = 50;   // ~20 Hz
+uint32_t lastGestureOutputMs = 0;
+
+// Rate the gesture window is counted in: the acquisition rate, or the
+// log's own rate while a replay is running
+uint32_t inputRateHz = ACQ_SAMPLE_RATE_HZ;
+
 // Recording state (from PC via serial command)
 bool gRecordingActive = false;
 
-// Sentence mode state
+// Runtime settings (serial commands MODE / FORMAT), compile-time defaults
+uint8_t predictionMode = PREDICTION_MODE;
+uint8_t wireFormat = WIRE_FORMAT;
+
+// Idle power state (motion_gate.h): entered when gesture frames have been
+// static for MOTION_IDLE_AFTER_MS
+MotionIdle motionIdle;
+uint8_t activeWindowFrames = GESTURE_WINDOW_FRAMES;   // restored on wake
+uint32_t activeCpuMhz = 240;
+
+// Sentence mode state (loop() side; the predictor itself lives in the
+// sentence worker, sentence_worker.h)
 bool sentenceModeActive = false;
+bool sentenceRecording = false;                 // one-shot window posted, result pending
+uint8_t sentenceHopSamples = SENTENCE_HOP_SAMPLES;
 bool lastButtonState = HIGH;
 uint32_t lastDebounceTime = 0;
 const uint32_t DEBOUNCE_DELAY_MS = 50;
@@ -69,53 +126,667 @@ static void signalSentenceComplete() {
   beep(150, 1, 0);   // longer beep when complete
 }
 
-static void handleSerialCommands() {
-  // We expect text commands like "START_SENTENCE"
-  static String cmdBuffer = "";
-  
-  while (Serial.available() > 0) {
-    char c = (char)Serial.read();
-    
-    if (c == '\n') {
-      // Check for text commands
-      cmdBuffer.trim();
-      
+// --------------- SERIAL COMMANDS ---------------
+
+static const char* predictionModeName(uint8_t mode) {
+  switch (mode) {
+    case PREDICTION_MODE_GESTURE:  return "gesture";
+    case PREDICTION_MODE_SENTENCE: return "sentence";
+    default:                       return "auto";
+  }
+}
+
+// Gesture window of `ms` at the given input rate
+static void setGestureWindow(uint32_t ms, uint32_t rateHz) {
+  long frames = ((long)ms * (long)rateHz + 500) / 1000;
+  predictor.setWindowFrames((uint8_t)constrain(frames, 1L, (long)FEATURE_WINDOW_MAX_FRAMES));
+}
+
+// ---- Idle power state ----
+
+// Idle: lowest clock, plus automatic light sleep when the build has power
+// management with tickless idle; otherwise only the clock changes.
+static void setIdleClock(bool idle) {
+#if CONFIG_PM_ENABLE && CONFIG_FREERTOS_USE_TICKLESS_IDLE
+#if ESP_IDF_VERSION_MAJOR >= 5
+  esp_pm_config_t pm;
+#else
+  esp_pm_config_esp32_t pm;
+#endif
+  pm.max_freq_mhz = idle ? MOTION_IDLE_CPU_MHZ : activeCpuMhz;
+  pm.min_freq_mhz = pm.max_freq_mhz;
+  pm.light_sleep_enable = idle;
+  esp_pm_configure(&pm);
+#else
+  setCpuFrequencyMhz(idle ? MOTION_IDLE_CPU_MHZ : activeCpuMhz);
+#endif
+#if STATS_ENABLED
+  stageStats.setClockMhz(idle ? MOTION_IDLE_CPU_MHZ : activeCpuMhz);
+#endif
+}
+
+// Acquisition rate, gesture window (same length in ms) and clock for the state
+static void applyIdle(bool idle) {
+  if (idle) activeWindowFrames = predictor.getWindowFrames();
+  acquisition.setIdle(idle, MOTION_IDLE_RATE_HZ);
+  inputRateHz = acquisition.rate();
+  if (idle) setGestureWindow((uint32_t)activeWindowFrames * 1000UL / ACQ_SAMPLE_RATE_HZ, inputRateHz);
+  else predictor.setWindowFrames(activeWindowFrames);
+  setIdleClock(idle);
+  Serial.printf("{\"event\":\"idle\",\"active\":%s,\"rate\":%lu}\n",
+                idle ? "true" : "false", (unsigned long)inputRateHz);
+}
+
+// Back to full rate without waiting for motion (mode change, replay, ...)
+static void wakeFromIdle() {
+  if (!motionIdle.active()) return;
+  motionIdle.wake(millis());
+  applyIdle(false);
+}
+
+// Switch prediction mode without a reflash. Sentence mode needs the model.
+static void setPredictionMode(uint8_t mode) {
+  if (!SENTENCE_MODE_AVAILABLE) mode = PREDICTION_MODE_GESTURE;
+  wakeFromIdle();
+  predictionMode = mode;
+  sentenceWorker.post(SENTENCE_REQ_RESET);
+  sentenceModeActive = false;
+  sentenceRecording = false;
+
 #if SENTENCE_MODE_AVAILABLE
-#if RUN_MODE == 1
-      if (cmdBuffer == "START_SENTENCE") {
-        Serial.println("{\"debug\":\"Command received: START_SENTENCE\"}");
-        if (!sentencePredictor.recording()) {
-          sentenceModeActive = true;
-          sentencePredictor.startRecording();
-          signalSentenceStart();
-          Serial.println("{\"event\":\"sentence_start\",\"recording\":true}");
-        } else {
-          Serial.println("{\"debug\":\"Already recording, ignoring command\"}");
-        }
-      }
+  if (mode == PREDICTION_MODE_SENTENCE) {
+    sentenceModeActive = true;
+    sentenceWorker.post(SENTENCE_REQ_CONTINUOUS);
+    Serial.println("{\"mode\":\"sentence\",\"auto_start\":true,\"continuous\":true}");
+  }
+#endif
+}
+
+// START_SENTENCE from serial or POST /api/sentence
+static void startSentenceCommand() {
+#if SENTENCE_MODE_AVAILABLE && RUN_MODE == 1
+  Serial.println("{\"debug\":\"Command received: START_SENTENCE\"}");
+  if (predictionMode == PREDICTION_MODE_GESTURE) {
+    Serial.println("{\"debug\":\"Gesture mode, ignoring command\"}");
+  } else if (!sentenceRecording) {
+    wakeFromIdle();
+    sentenceModeActive = true;
+    sentenceRecording = true;
+    // SENTENCE mode slides on into continuous recognition after the result
+    sentenceWorker.post(SENTENCE_REQ_RECORD, predictionMode == PREDICTION_MODE_SENTENCE);
+    signalSentenceStart();
+    Serial.println("{\"event\":\"sentence_start\",\"recording\":true}");
+  } else {
+    Serial.println("{\"debug\":\"Already recording, ignoring command\"}");
+  }
 #endif
+}
+
+static void printConfig() {
+  Serial.printf("{\"event\":\"config\",\"mode\":\"%s\",\"windowMs\":%lu,\"hop\":%u,\"format\":\"%s\"}\n",
+                predictionModeName(predictionMode),
+                (unsigned long)predictor.getWindowFrames() * 1000UL / inputRateHz,
+                (unsigned)sentenceHopSamples,
+                wireFormat == WIRE_FORMAT_BINARY ? "binary" : "json");
+}
+
+static void cmdStartSentence(const char*) { startSentenceCommand(); }
+
+static void cmdRecordStart(const char*) {
+  gRecordingActive = true;
+  signalRecordingStart();
+}
+
+static void cmdRecordStop(const char*) {
+  gRecordingActive = false;
+  signalRecordingStop();
+}
+
+// MODE GESTURE | SENTENCE | AUTO (or 0 / 1 / 2)
+static void cmdMode(const char* arg) {
+  int mode = -1;
+  if (strcasecmp(arg, "GESTURE") == 0 || strcmp(arg, "0") == 0) mode = PREDICTION_MODE_GESTURE;
+  else if (strcasecmp(arg, "SENTENCE") == 0 || strcmp(arg, "1") == 0) mode = PREDICTION_MODE_SENTENCE;
+  else if (strcasecmp(arg, "AUTO") == 0 || strcmp(arg, "2") == 0) mode = PREDICTION_MODE_AUTO;
+
+  if (mode < 0) {
+    Serial.println("{\"debug\":\"Usage: MODE GESTURE|SENTENCE|AUTO\"}");
+    return;
+  }
+  setPredictionMode((uint8_t)mode);
+  printConfig();
+}
+
+// WINDOW <ms>: gesture window length, rounded to whole samples
+static void cmdWindow(const char* arg) {
+  long ms = strtol(arg, nullptr, 10);
+  if (ms <= 0) {
+    Serial.println("{\"debug\":\"Usage: WINDOW <ms>\"}");
+    return;
+  }
+  wakeFromIdle();
+  long frames = (ms * (long)inputRateHz + 500) / 1000;
+  predictor.setWindowFrames((uint8_t)constrain(frames, 1L, (long)FEATURE_WINDOW_MAX_FRAMES));
+  printConfig();
+}
+
+// HOP <samples>: continuous sentence hop (at SENTENCE_SAMPLE_RATE_HZ)
+static void cmdHop(const char* arg) {
+  long hop = strtol(arg, nullptr, 10);
+  if (hop <= 0) {
+    Serial.println("{\"debug\":\"Usage: HOP <samples>\"}");
+    return;
+  }
+  sentenceHopSamples = (uint8_t)constrain(hop, 1L, (long)SENTENCE_SAMPLES_PER_WINDOW);
+  sentenceWorker.post(SENTENCE_REQ_HOP, sentenceHopSamples);
+  printConfig();
+}
+
+// FORMAT JSON | BINARY: serial wire format for prediction frames
+static void cmdFormat(const char* arg) {
+  if (strcasecmp(arg, "JSON") == 0) wireFormat = WIRE_FORMAT_JSON;
+  else if (strcasecmp(arg, "BINARY") == 0) wireFormat = WIRE_FORMAT_BINARY;
+  else {
+    Serial.println("{\"debug\":\"Usage: FORMAT JSON|BINARY\"}");
+    return;
+  }
+  printConfig();
+}
+
+static void cmdConfig(const char*) { printConfig(); }
+
+#if STATS_ENABLED
+// One telemetry line: per-stage timing (microseconds) + memory / drops
+static void printStats() {
+  Serial.print("{\"event\":\"stats\",\"stages\":{");
+  for (uint8_t i = 0; i < STAT_NUM_STAGES; ++i) {
+    StageSummary st = stageStats.summary(i);
+    Serial.printf("%s\"%s\":{\"n\":%lu,\"min\":%.1f,\"mean\":%.1f,\"p99\":%.1f,\"max\":%.1f}",
+                  i ? "," : "", STAT_STAGE_NAMES[i], (unsigned long)st.count,
+                  st.minUs, st.meanUs, st.p99Us, st.maxUs);
+  }
+  Serial.printf("},\"heap\":%lu,\"minHeap\":%lu,\"stackLoop\":%lu,\"stackAcq\":%lu,\"dropped\":%lu,\"imuOverflows\":%lu,\"adcOverruns\":%lu,"
+                "\"gestureScans\":%lu,\"gestureReused\":%lu,\"idle\":%s,"
+                "\"stackSentence\":%lu,\"sentenceDropped\":%lu,\"sentenceEventsDropped\":%lu}\n",
+                (unsigned long)ESP.getFreeHeap(), (unsigned long)ESP.getMinFreeHeap(),
+                (unsigned long)uxTaskGetStackHighWaterMark(nullptr),
+                (unsigned long)acquisition.stackHighWater(), (unsigned long)acquisition.dropped(),
+                (unsigned long)predictor.imuOverflows(), (unsigned long)predictor.flexOverruns(),
+                (unsigned long)predictor.motionGate().scanned(), (unsigned long)predictor.motionGate().reused(),
+                motionIdle.active() ? "true" : "false",
+                (unsigned long)sentenceWorker.stackHighWater(), (unsigned long)sentenceWorker.dropped(),
+                (unsigned long)sentenceWorker.droppedEventCount());
+}
+
+// STATS: report, STATS RESET: clear the histograms
+static void cmdStats(const char* arg) {
+  if (strcasecmp(arg, "RESET") == 0) {
+    stageStats.reset();
+    Serial.println("{\"event\":\"stats_reset\"}");
+    return;
+  }
+  printStats();
+}
 #endif
-      
-      // Legacy single character commands (now require newline)
-      if (cmdBuffer == "S") {
-        gRecordingActive = true;
-        signalRecordingStart();
-      } else if (cmdBuffer == "E") {
-        gRecordingActive = false;
-        signalRecordingStop();
+
+// ---- Model container (model_store.h / model_loader.h) ----
+
+#define MODEL_UPLOAD_CHUNK      1024   // bytes per acknowledged chunk
+#define MODEL_UPLOAD_TIMEOUT_MS 3000
+
+uint8_t modelChunk[MODEL_UPLOAD_CHUNK];
+uint16_t modelChunkLen = 0;
+uint32_t modelLastByteMs = 0;
+
+static void printModelInfo() {
+  Serial.printf("{\"event\":\"model\",\"gesture\":\"%s\",\"gestureSamples\":%lu,"
+                "\"sentence\":\"%s\",\"sentenceSamples\":%lu,\"container\":\"%s\",\"capacity\":%lu}\n",
+                modelLoad.gesture ? "flash" : "embedded",
+#if KNN_USE_INT8
+                (unsigned long)gestureTables.numSamples,
+#else
+                (unsigned long)NUM_SAMPLES,
+#endif
+                modelLoad.sentence ? "flash" : "embedded", (unsigned long)sentenceTables.numSamples,
+                modelStore.valid() ? "ok" : modelStore.error(), (unsigned long)modelStore.capacity());
+  if (modelStore.valid() && !modelLoad.gesture) {
+    Serial.printf("{\"debug\":\"Gesture model in flash not used: %s\"}\n", modelLoad.gestureError);
+  }
+  if (modelStore.valid() && !modelLoad.sentence) {
+    Serial.printf("{\"debug\":\"Sentence model in flash not used: %s\"}\n", modelLoad.sentenceError);
+  }
+}
+
+// The sentence worker reads sentenceTables (and the mapped partition) on
+// core 0, so they only change while it is parked. Sentence windows start
+// over afterwards: their samples were quantized for the old tables.
+static bool parkSentenceWorker() {
+  if (sentenceWorker.pause()) return true;
+  Serial.println("{\"event\":\"model_error\",\"error\":\"sentence worker busy\"}");
+  return false;
+}
+
+static void resumeSentenceWorker() {
+  sentenceWorker.resume();
+  setPredictionMode(predictionMode);
+}
+
+// Re-select the tables; cached gesture answers belong to the old model.
+// If the worker cannot be parked the embedded tables stay in use.
+static void reloadModels() {
+  if (!parkSentenceWorker()) return;
+  modelLoad = loadModels(modelStore);
+  predictor.resetMotionGate();
+  resumeSentenceWorker();
+}
+
+static void finishModelUpload(bool ok) {
+  if (ok) ok = modelStore.finishUpload();
+  else modelStore.abortUpload();
+  modelChunkLen = 0;
+  reloadModels();
+  if (!ok) {
+    Serial.printf("{\"event\":\"model_error\",\"error\":\"%s\"}\n", modelStore.error());
+  }
+  printModelInfo();
+}
+
+// Raw bytes of a MODEL UPLOAD. Each full chunk is written to flash and
+// acknowledged; the host sends the next one only after the ack.
+static void receiveModelBytes() {
+  while (Serial.available() > 0 && modelStore.uploadActive()) {
+    modelChunk[modelChunkLen++] = (uint8_t)Serial.read();
+    modelLastByteMs = millis();
+
+    uint32_t total = modelStore.uploadReceived() + modelChunkLen;
+    if (modelChunkLen < MODEL_UPLOAD_CHUNK && total < modelStore.uploadTotal()) continue;
+
+    if (!modelStore.write(modelChunk, modelChunkLen)) {
+      finishModelUpload(false);
+      return;
+    }
+    modelChunkLen = 0;
+    Serial.printf("{\"event\":\"model_ack\",\"received\":%lu}\n", (unsigned long)total);
+    if (total == modelStore.uploadTotal()) {
+      finishModelUpload(true);
+      return;
+    }
+  }
+
+  if (modelStore.uploadActive() && millis() - modelLastByteMs > MODEL_UPLOAD_TIMEOUT_MS) {
+    modelStore.abortUpload();
+    modelChunkLen = 0;
+    reloadModels();
+    Serial.println("{\"event\":\"model_error\",\"error\":\"timeout\"}");
+  }
+}
+
+// MODEL: where the tables come from
+// MODEL UPLOAD <bytes> <crc32 hex>: raw container bytes follow (tools/model_container.py)
+static void cmdModel(const char* arg) {
+  if (strncasecmp(arg, "UPLOAD", 6) != 0) {
+    printModelInfo();
+    return;
+  }
+
+  unsigned long size = 0, crc = 0;
+  if (sscanf(arg + 6, "%lu %lx", &size, &crc) != 2) {
+    Serial.println("{\"debug\":\"Usage: MODEL UPLOAD <bytes> <crc32 hex>\"}");
+    return;
+  }
+
+  // The mapping goes away during the upload: predict with the embedded
+  // tables, switched (and unmapped) while the sentence worker is parked
+  if (!parkSentenceWorker()) return;
+  useEmbeddedModels();
+  modelLoad.gesture = modelLoad.sentence = false;
+  bool started = modelStore.beginUpload((uint32_t)size, (uint32_t)crc);
+  resumeSentenceWorker();
+  if (!started) {
+    finishModelUpload(false);
+    return;
+  }
+  modelChunkLen = 0;
+  modelLastByteMs = millis();
+  Serial.printf("{\"event\":\"model_ack\",\"received\":0,\"chunk\":%d}\n", MODEL_UPLOAD_CHUNK);
+}
+
+#if RUN_MODE != 0
+// ---- Replay (replay_source.h) ----
+
+#define REPLAY_MAX_RATE_HZ 2000   // acquisition timer ceiling while replaying
+#define REPLAY_STOP_WAIT_MS 100   // acquisition task lets go of a stopped replay
+
+bool replayRunning = false;
+uint32_t replayStartMs = 0;
+
+// Back to live sensors; reports what the replay did
+static void finishReplay() {
+  ReplaySource& replay = acquisition.replaySource();
+  replay.stop();
+  replayRunning = false;
+  acquisition.setRate(ACQ_SAMPLE_RATE_HZ);
+  inputRateHz = ACQ_SAMPLE_RATE_HZ;
+  setGestureWindow(GESTURE_WINDOW_MS, inputRateHz);
+
+  Serial.printf("{\"event\":\"replay_done\",\"frames\":%lu,\"ms\":%lu,\"underruns\":%lu,\"overflows\":%lu,\"dropped\":%lu}\n",
+                (unsigned long)replay.frameCount(), (unsigned long)(millis() - replayStartMs),
+                (unsigned long)replay.underrunCount(), (unsigned long)replay.overflowCount(),
+                (unsigned long)acquisition.dropped());
+}
+
+// REPLAY SERIAL [logHz] [speed] : frames follow as FLEX: lines
+// REPLAY FILE <path> [logHz] [speed] : frames from a LittleFS log
+// REPLAY STOP | REPLAY
+static void cmdReplay(const char* arg) {
+  ReplaySource& replay = acquisition.replaySource();
+  char source[8] = "";
+  char path[REPLAY_PATH_MAX] = "";
+  unsigned logHz = REPLAY_DEFAULT_HZ, speed = 1;
+  int n = sscanf(arg, "%7s", source);
+
+  if (n < 1) {
+    Serial.printf("{\"event\":\"replay\",\"active\":%s,\"frames\":%lu}\n",
+                  replayRunning ? "true" : "false", (unsigned long)replay.frameCount());
+    return;
+  }
+  if (strcasecmp(source, "STOP") == 0) {
+    if (replayRunning) finishReplay();
+    return;
+  }
+
+  // Optional numbers keep their defaults when absent
+  bool fromFile = strcasecmp(source, "FILE") == 0;
+  bool valid = fromFile || strcasecmp(source, "SERIAL") == 0;
+  if (fromFile) sscanf(arg, "%*s %47s %u %u", path, &logHz, &speed);
+  else sscanf(arg, "%*s %u %u", &logHz, &speed);
+  if (!valid || (fromFile && path[0] == '\0') || logHz == 0 || speed == 0) {
+    Serial.println("{\"debug\":\"Usage: REPLAY SERIAL [logHz] [speed] | FILE <path> [logHz] [speed] | STOP\"}");
+    return;
+  }
+  if (replayRunning) {
+    Serial.println("{\"debug\":\"Replay running, REPLAY STOP first\"}");
+    return;
+  }
+#if SESSION_RECORDER
+  if (sessionRecorder.active()) {
+    Serial.println("{\"debug\":\"Recording in progress, REC STOP first\"}");
+    return;
+  }
+#endif
+  // After REPLAY STOP the acquisition task drops the old source on its
+  // next sample slot; a start before that would be refused
+  uint32_t waitStart = millis();
+  while (!replay.stopped() && millis() - waitStart < REPLAY_STOP_WAIT_MS) vTaskDelay(1);
+  if (!replay.stopped()) {
+    Serial.println("{\"debug\":\"Previous replay still stopping, try again\"}");
+    return;
+  }
+  if (fromFile && (!LittleFS.begin(false) || !LittleFS.exists(path))) {
+    Serial.printf("{\"debug\":\"Replay file not found: %s\"}\n", path);
+    return;
+  }
+
+  // Start from a clean prediction state, windows counted at the log rate
+  setPredictionMode(predictionMode);
+  inputRateHz = logHz;
+  setGestureWindow(GESTURE_WINDOW_MS, inputRateHz);
+  if (fromFile) replay.startFile(path, logHz);
+  else replay.startSerial(logHz);
+  acquisition.setRate(min((uint32_t)logHz * speed, (uint32_t)REPLAY_MAX_RATE_HZ));
+  replayRunning = true;
+  replayStartMs = millis();
+
+  Serial.printf("{\"event\":\"replay_start\",\"source\":\"%s\",\"logHz\":%u,\"rate\":%lu,\"t0\":%lu}\n",
+                fromFile ? "file" : "serial", logHz, (unsigned long)acquisition.rate(),
+                (unsigned long)replay.startMs());
+}
+
+// One replayed frame (the RUN_MODE 0 line format)
+static void cmdReplayFrame(const char* arg) {
+  RawFrame f;
+  if (parseRawFrameFields(arg, f)) acquisition.replaySource().pushSerialFrame(f);
+}
+#endif
+
+#if RUN_MODE != 0 && SESSION_RECORDER
+// ---- Session recorder (session_recorder.h) ----
+
+#define REC_DUMP_CHUNK      1024
+#define REC_DUMP_SETTLE_MS  100    // host reopens the port at the dump baud
+
+static void printRecordingStatus(const char* event) {
+  Serial.printf("{\"event\":\"%s\",\"active\":%s,\"file\":\"%s\",\"frames\":%lu,\"markers\":%lu,"
+                "\"bytes\":%lu,\"left\":%lu,\"maxFlushUs\":%lu,\"dropped\":%lu,\"reason\":\"%s\"}\n",
+                event, sessionRecorder.active() ? "true" : "false", sessionRecorder.fileName(),
+                (unsigned long)sessionRecorder.frameCount(), (unsigned long)sessionRecorder.markerCount(),
+                (unsigned long)sessionRecorder.bytes(), (unsigned long)sessionRecorder.bytesLeft(),
+                (unsigned long)sessionRecorder.maxFlushMicros(), (unsigned long)acquisition.dropped(),
+                sessionRecorder.error());
+}
+
+// REC STOP, a full filesystem or a failed write
+static void finishRecording(const char* reason) {
+  sessionRecorder.stop(reason);
+  signalRecordingStop();
+  printRecordingStatus("rec_done");
+}
+
+// File names are plain names inside REC_DIR
+static bool recordingPath(const char* name, char* path) {
+  if (!name[0] || strchr(name, '/') || strlen(name) + sizeof(REC_DIR) + 1 > REC_PATH_MAX) return false;
+  snprintf(path, REC_PATH_MAX, REC_DIR "/%s", name);
+  return true;
+}
+
+static void listRecordings() {
+  Serial.print("{\"event\":\"rec_list\",\"files\":[");
+  bool first = true;
+  File dir = LittleFS.open(REC_DIR);
+  if (dir && dir.isDirectory()) {
+    for (File f = dir.openNextFile(); f; f = dir.openNextFile()) {
+      Serial.printf("%s{\"name\":\"%s\",\"bytes\":%lu}", first ? "" : ",", f.name(), (unsigned long)f.size());
+      first = false;
+    }
+  }
+  Serial.printf("],\"free\":%lu}\n", (unsigned long)(LittleFS.totalBytes() - LittleFS.usedBytes()));
+}
+
+// Raw file bytes, optionally at a higher baud rate. loop() is blocked for
+// the transfer (a full filesystem takes ~1 s at 921600), acquisition keeps
+// running and counts what the ring drops meanwhile.
+static void dumpRecording(const char* path, uint32_t baud) {
+  File f = LittleFS.open(path, "r");
+  if (!f) {
+    Serial.printf("{\"debug\":\"Recording not found: %s\"}\n", path);
+    return;
+  }
+  const uint32_t size = f.size();
+  Serial.printf("{\"event\":\"rec_dump\",\"file\":\"%s\",\"bytes\":%lu,\"baud\":%lu}\n",
+                path, (unsigned long)size, (unsigned long)baud);
+  Serial.flush();
+  if (baud != SERIAL_BAUD) {
+    Serial.updateBaudRate(baud);
+    delay(REC_DUMP_SETTLE_MS);
+  }
+
+  static uint8_t buf[REC_DUMP_CHUNK];
+  uint32_t sent = 0, crc = 0;
+  while (sent < size) {
+    size_t n = f.read(buf, min((uint32_t)REC_DUMP_CHUNK, size - sent));
+    if (!n) break;
+    crc = esp_rom_crc32_le(crc, buf, n);
+    Serial.write(buf, n);
+    sent += n;
+  }
+  f.close();
+  Serial.flush();
+
+  if (baud != SERIAL_BAUD) {
+    delay(REC_DUMP_SETTLE_MS);
+    Serial.updateBaudRate(SERIAL_BAUD);
+    delay(REC_DUMP_SETTLE_MS);
+  }
+  Serial.printf("{\"event\":\"rec_dump_done\",\"bytes\":%lu,\"crc32\":\"%08lx\"}\n",
+                (unsigned long)sent, (unsigned long)crc);
+}
+
+// Label of "MARK <label...>": everything after the verb, trimmed. False
+// when it does not fit a marker record (no silent cut) or would break the
+// JSON echo.
+static bool markLabel(const char* arg, char label[REC_LABEL_MAX]) {
+  while (isspace((unsigned char)*arg)) arg++;
+  while (*arg && !isspace((unsigned char)*arg)) arg++;   // the verb
+  while (isspace((unsigned char)*arg)) arg++;
+
+  size_t n = strlen(arg);
+  while (n && isspace((unsigned char)arg[n - 1])) n--;
+  if (n >= REC_LABEL_MAX) return false;
+  for (size_t i = 0; i < n; ++i) {
+    if (arg[i] == '"' || arg[i] == '\\') return false;
+  }
+  memcpy(label, arg, n);
+  label[n] = '\0';
+  return true;
+}
+
+// REC START [name] | MARK [label] | STOP | LIST | DUMP <name> [baud] | DELETE <name|ALL> | REC
+static void cmdRec(const char* arg) {
+  char verb[8] = "", name[REC_PATH_MAX] = "", path[REC_PATH_MAX];
+  unsigned long baud = SERIAL_BAUD;
+  sscanf(arg, "%7s %31s %lu", verb, name, &baud);
+
+  if (!verb[0]) {
+    printRecordingStatus("rec");
+  } else if (strcasecmp(verb, "START") == 0) {
+    if (replayRunning) {
+      Serial.println("{\"debug\":\"Replay running, REPLAY STOP first\"}");
+      return;
+    }
+    if (!name[0]) {
+      // Next free sNN.bin
+      for (int i = 1; i < 100; ++i) {
+        snprintf(name, sizeof(name), "s%02d.bin", i);
+        recordingPath(name, path);
+        if (!LittleFS.exists(path)) break;
+      }
+    }
+    if (!recordingPath(name, path)) {
+      Serial.println("{\"debug\":\"Usage: REC START [name]\"}");
+      return;
+    }
+    // Full rate for the whole recording (no idle, see processPredictionSample)
+    wakeFromIdle();
+    signalRecordingStart();
+    if (!sessionRecorder.begin(name, (uint16_t)inputRateHz)) {
+      Serial.printf("{\"event\":\"rec_error\",\"error\":\"%s\"}\n", sessionRecorder.error());
+      signalRecordingStop();
+      return;
+    }
+    printRecordingStatus("rec_start");
+  } else if (strcasecmp(verb, "MARK") == 0) {
+    // The label is the rest of the line, trimmed: sentence labels have spaces
+    char label[REC_LABEL_MAX];
+    if (!markLabel(arg, label)) {
+      Serial.printf("{\"debug\":\"Usage: REC MARK [label] (at most %d characters, no quotes)\"}\n",
+                    REC_LABEL_MAX - 1);
+      return;
+    }
+    if (!sessionRecorder.active()) {
+      Serial.println("{\"debug\":\"Not recording, REC START first\"}");
+      return;
+    }
+    if (!sessionRecorder.mark(label, millis())) {
+      finishRecording("error");
+      return;
+    }
+    Serial.printf("{\"event\":\"rec_mark\",\"label\":\"%s\",\"frames\":%lu}\n",
+                  sessionRecorder.label(), (unsigned long)sessionRecorder.frameCount());
+  } else if (strcasecmp(verb, "STOP") == 0) {
+    if (sessionRecorder.active()) finishRecording("stopped");
+  } else if (strcasecmp(verb, "LIST") == 0) {
+    if (!LittleFS.begin(false)) Serial.println("{\"debug\":\"LittleFS not mounted\"}");
+    else listRecordings();
+  } else if (strcasecmp(verb, "DUMP") == 0) {
+    if (!recordingPath(name, path) || baud == 0) {
+      Serial.println("{\"debug\":\"Usage: REC DUMP <name> [baud]\"}");
+    } else if (sessionRecorder.active()) {
+      Serial.println("{\"debug\":\"Recording in progress, REC STOP first\"}");
+    } else if (LittleFS.begin(false)) {
+      dumpRecording(path, (uint32_t)baud);
+    }
+  } else if (strcasecmp(verb, "DELETE") == 0) {
+    if (sessionRecorder.active()) {
+      Serial.println("{\"debug\":\"Recording in progress, REC STOP first\"}");
+      return;
+    }
+    if (strcasecmp(name, "ALL") == 0) {
+      // Reopen the folder after each removal rather than iterate a changing one
+      for (;;) {
+        File dir = LittleFS.open(REC_DIR);
+        File f = dir ? dir.openNextFile() : File();
+        if (!f) break;
+        bool named = recordingPath(f.name(), path);
+        f.close();
+        dir.close();
+        if (!named || !LittleFS.remove(path)) break;
       }
-      
-      cmdBuffer = "";
-    } else {
-      cmdBuffer += c;
+    } else if (!recordingPath(name, path) || !LittleFS.remove(path)) {
+      Serial.println("{\"debug\":\"Usage: REC DELETE <name|ALL>\"}");
+      return;
     }
+    listRecordings();
+  } else {
+    Serial.println("{\"debug\":\"Usage: REC START [name] | MARK [label] | STOP | LIST | DUMP <name> [baud] | DELETE <name|ALL>\"}");
+  }
+}
+#endif
+
+static const SerialCommand SERIAL_COMMANDS[] = {
+  { "START_SENTENCE", cmdStartSentence },
+  { "S",              cmdRecordStart },    // legacy: start data recording
+  { "E",              cmdRecordStop },     // legacy: stop data recording
+  { "MODE",           cmdMode },
+  { "WINDOW",         cmdWindow },
+  { "HOP",            cmdHop },
+  { "FORMAT",         cmdFormat },
+  { "CONFIG",         cmdConfig },
+#if STATS_ENABLED
+  { "STATS",          cmdStats },
+#endif
+  { "MODEL",          cmdModel },
+#if RUN_MODE != 0
+  { "REPLAY",         cmdReplay },
+  { "FLEX:",          cmdReplayFrame },
+#endif
+#if RUN_MODE != 0 && SESSION_RECORDER
+  { "REC",            cmdRec },
+#endif
+};
+
+static CommandParser commandParser(SERIAL_COMMANDS, sizeof(SERIAL_COMMANDS) / sizeof(SERIAL_COMMANDS[0]));
+
+// Newline-terminated text commands. Only what has already arrived is
+// consumed, so this never blocks loop().
+static void handleSerialCommands() {
+  if (modelStore.uploadActive()) {
+    receiveModelBytes();
+    return;
+  }
+  while (Serial.available() > 0) {
+    if (!commandParser.feed((char)Serial.read())) continue;
+    if (!commandParser.dispatch()) {
+      Serial.printf("{\"debug\":\"Unknown command: %s\"}\n", commandParser.command());
+    }
+    if (modelStore.uploadActive()) return;   // what follows is container bytes
   }
 }
 
 // ------------------------------------------------------
 
 void setup() {
-  Serial.begin(115200);
+  Serial.setRxBufferSize(MODEL_UPLOAD_CHUNK * 2);  // room for one MODEL UPLOAD chunk
+  Serial.begin(SERIAL_BAUD);
   delay(2000); // Give serial monitor time
 
   // LED + buzzer pins
@@ -154,32 +825,290 @@ void setup() {
   #endif
 #endif
   
-  // FORCE LINKER TO KEEP SENTENCE MODEL DATA
-  // Linker keep-alive for quantized sentence model
-  volatile const int8_t* force_link_data = SENTENCE_TRAINING_DATA_Q;
-  volatile const uint8_t* force_link_labels = SENTENCE_TRAINING_LABELS_Q;
-  Serial.printf("Sentence model (INT8): %d samples at 0x%p\n", SENTENCE_KNN_Q_N_SAMPLES, force_link_data);
+  // Trained models: container in flash if present and compatible,
+  // otherwise the tables compiled into the firmware
+  modelStore.begin();
+  modelLoad = loadModels(modelStore);
+  printModelInfo();
   
-  if (!predictor.begin()) {
+  if (!predictor.begin(RUN_MODE == 0 ? 1000 / COLLECT_PERIOD_MS : ACQ_SAMPLE_RATE_HZ)) {
     Serial.println("WARNING: MPU6050 init FAILED - sensor readings unavailable");
   } else {
     Serial.println("MPU6050 initialized successfully");
     // Power-on beep
     beep(60, 1, 0);
   }
+  Serial.println(predictor.flexDma() ? "Flex ADC: continuous DMA" : "Flex ADC: analogRead");
+
+#if RUN_MODE != 0
+  // Sampling runs on core 0 from here on; loop() only consumes the ring
+  predictor.setWindowFrames(GESTURE_WINDOW_FRAMES);
+  activeCpuMhz = getCpuFrequencyMhz();
+#if STATS_ENABLED
+  stageStats.setClockMhz(activeCpuMhz);
+#endif
+  if (!acquisition.begin()) {
+    Serial.println("WARNING: acquisition task/timer init FAILED");
+  }
+  Serial.println(sentenceWorker.begin() ? "Sentence scoring: core 0 task" : "Sentence scoring: inline in loop()");
+#endif
   
-  // Auto-start sentence mode if PREDICTION_MODE == 1
-  #if SENTENCE_MODE_AVAILABLE && PREDICTION_MODE == 1
-  sentenceModeActive = true;
-  sentencePredictor.startRecording();
-  Serial.println("{\"mode\":\"sentence\",\"auto_start\":true}");
-  #endif
+  // Boot mode (auto-starts continuous recognition in sentence mode)
+#if RUN_MODE != 0
+  setPredictionMode(PREDICTION_MODE);
+#endif
+
+#if WEB_SERVER_ENABLED
+  webServer.begin();
+#endif
+}
+
+#if RUN_MODE != 0
+// Calibrated flex values, normalized to 0-1
+static void normalizeFlex(const SensorSample& s, float out[5]) {
+  const float raw[5] = { s.f1, s.f2, s.f3, s.f4, s.f5 };
+  for (int i = 0; i < 5; ++i) {
+    float f = (float)((int)raw[i] - FLEX_MIN[i]) / (float)(FLEX_MAX[i] - FLEX_MIN[i]);
+    out[i] = constrain(f, 0.0f, 1.0f);
+  }
+}
+
+// ----------- JSON frames -----------
+// Each frame is formatted once into jsonLine and then written to serial
+// (JSON wire format) and / or the WebSocket clients.
+static char jsonLine[256];
+static size_t jsonLen = 0;
+
+// Frame consumers: skip formatting entirely when nobody reads JSON
+static bool jsonWanted() {
+  if (wireFormat == WIRE_FORMAT_JSON) return true;
+#if WEB_SERVER_ENABLED
+  return webServer.hasClients();
+#else
+  return false;
+#endif
+}
+
+static void jsonBegin() { jsonLen = 0; }
+
+static void jsonAppend(const char* fmt, ...) __attribute__((format(printf, 1, 2)));
+static void jsonAppend(const char* fmt, ...) {
+  if (jsonLen >= sizeof(jsonLine)) return;
+  va_list args;
+  va_start(args, fmt);
+  int n = vsnprintf(jsonLine + jsonLen, sizeof(jsonLine) - jsonLen, fmt, args);
+  va_end(args);
+  if (n > 0) jsonLen += (size_t)n;
+  if (jsonLen >= sizeof(jsonLine)) jsonLen = sizeof(jsonLine) - 1;  // truncated
+}
+
+// Send the finished frame. Urgent frames skip the web batching delay.
+static void jsonEmit(bool urgent = false) {
+  if (wireFormat == WIRE_FORMAT_JSON) {
+    jsonLine[jsonLen] = '\n';
+    Serial.write((const uint8_t*)jsonLine, jsonLen + 1);  // one write per frame
+    jsonLine[jsonLen] = '\0';
+  }
+#if WEB_SERVER_ENABLED
+  webServer.publish(jsonLine, jsonLen, urgent);
+#else
+  (void)urgent;
+#endif
+}
+
+// Append the shared sensor fields of a JSON frame ("gdp" .. "gz", no braces).
+// Flex is normalized 0-1 with calibration, accel in g, gyro in deg/s.
+static void appendSensorJson(const SensorSample& s) {
+  float flex[5];
+  normalizeFlex(s, flex);
+
+  // Accel in g (16-bit signed, ±2g range), gyro in deg/s (±250 deg/s range)
+  jsonAppend("\"gdp\":%.1f,\"f1\":%.2f,\"f2\":%.2f,\"f3\":%.2f,\"f4\":%.2f,\"f5\":%.2f,"
+             "\"ax\":%.2f,\"ay\":%.2f,\"az\":%.2f,\"gx\":%.1f,\"gy\":%.1f,\"gz\":%.1f",
+             s.gdp, flex[0], flex[1], flex[2], flex[3], flex[4],
+             s.ax / 16384.0f, s.ay / 16384.0f, s.az / 16384.0f,
+             s.gx / 131.0f, s.gy / 131.0f, s.gz / 131.0f);
+}
+
+// Start a binary frame with the shared sensor block filled in
+static WireFrame sensorFrame(uint8_t type, const SensorSample& s) {
+  float flex[5];
+  normalizeFlex(s, flex);
+  WireFrame frame(type, s.tMs);
+  frame.putSensors(flex, s);
+  return frame;
+}
+
+#if SENTENCE_MODE_AVAILABLE
+// Output one sentence prediction frame
+static void printSentencePrediction(const SensorSample& s, uint8_t labelIdx, float meanDist) {
+  STATS_SCOPE(STAT_OUTPUT);
+  const char* sentenceName = "unknown";
+  if (labelIdx < SENTENCE_NUM_CLASSES) {
+    sentenceName = sentence_label_names[labelIdx];
+  }
+  
+  // Calculate confidence (inverse of distance) and damp if Rest
+  float confidence = 1.0f / (1.0f + meanDist);
+  if (strcmp(sentenceName, "Rest") == 0) {
+    confidence *= 0.2f;  // present Rest as low confidence to UI
+  }
+  
+  // Output sentence prediction
+  if (wireFormat == WIRE_FORMAT_BINARY) {
+    WireFrame frame = sensorFrame(WIRE_TYPE_SENTENCE_RESULT, s);
+    frame.putU8(labelIdx);
+    frame.putF32(meanDist);
+    frame.putU16((uint16_t)lrintf(confidence * 1000.0f));
+    frame.send(Serial);
+  }
+  if (jsonWanted()) {
+    jsonBegin();
+    jsonAppend("{\"mode\":\"sentence\",\"recording\":false,\"sentence\":\"%s\",\"confidence\":%.3f,\"meanD\":%.2f}",
+               sentenceName, confidence, meanDist);
+    jsonEmit(true);
+  }
+}
+
+// Recording progress frame (one-shot sentence mode)
+static void printSentenceProgress(const SensorSample& s, float progress) {
+  STATS_SCOPE(STAT_OUTPUT);
+  if (wireFormat == WIRE_FORMAT_BINARY) {
+    WireFrame frame = sensorFrame(WIRE_TYPE_SENTENCE_PROGRESS, s);
+    frame.putU8((uint8_t)lrintf(progress * 100.0f));
+    frame.send(Serial);
+  }
+  if (jsonWanted()) {
+    jsonBegin();
+    jsonAppend("{\"mode\":\"sentence\",\"recording\":true,\"progress\":%.2f,", progress);
+    appendSensorJson(s);
+    jsonAppend("}");
+    jsonEmit();
+  }
+}
+
+// Continuous sentence mode: per-hop frame keeps the UI sensor view live
+// (no "sentence" field)
+static void printSentenceHop(const SensorSample& s, uint8_t hopIdx, float meanDist) {
+  STATS_SCOPE(STAT_OUTPUT);
+  if (wireFormat == WIRE_FORMAT_BINARY) {
+    WireFrame frame = sensorFrame(WIRE_TYPE_SENTENCE_HOP, s);
+    frame.putU8(hopIdx);
+    frame.putF32(meanDist);
+    frame.send(Serial);
+  }
+  if (jsonWanted()) {
+    jsonBegin();
+    jsonAppend("{\"mode\":\"sentence\",\"continuous\":true,\"hop\":%d,\"meanD\":%.2f,", hopIdx, meanDist);
+    appendSensorJson(s);
+    jsonAppend("}");
+    jsonEmit();
+  }
+}
+
+// Print one result of the sentence worker
+static void handleSentenceEvent(const SentenceEvent& e) {
+  switch (e.kind) {
+    case SENTENCE_EV_PROGRESS:
+      printSentenceProgress(e.s, e.progress);
+      break;
+    case SENTENCE_EV_RESULT:
+      sentenceRecording = false;
+      // AUTO MODE returns to gesture only; SENTENCE MODE is already
+      // continuous again in the worker
+      if (predictionMode != PREDICTION_MODE_SENTENCE) sentenceModeActive = false;
+      signalSentenceComplete();
+      printSentencePrediction(e.s, e.label, e.meanDist);
+      break;
+    case SENTENCE_EV_HOP:
+      printSentenceHop(e.s, e.label, e.meanDist);
+      break;
+    case SENTENCE_EV_SENTENCE:
+      signalSentenceComplete();
+      printSentencePrediction(e.s, e.label, e.meanDist);
+      break;
+  }
+}
+#endif
+
+static bool recordingActive() {
+#if SESSION_RECORDER
+  return sessionRecorder.active();
+#else
+  return false;
+#endif
+}
+
+// Run one acquisition sample through the sentence / gesture pipeline.
+static void processPredictionSample(const SensorSample& s) {
+#if SENTENCE_MODE_AVAILABLE
+  if (sentenceModeActive) {
+    // Scored by the sentence worker (events come back in loop())
+    sentenceWorker.postSample(s);
+    // SENTENCE MODE skips gestures; AUTO MODE keeps classifying them while
+    // the window records and is scored on the other core
+    if (predictionMode == PREDICTION_MODE_SENTENCE) return;
+  }
+#endif
+
+  // Regular gesture prediction on the sliding window, once per frame
+  predictor.pushSample(s);
+  if (!predictor.windowReady()) return;
+
+  float bestDist = 0.0f;
+  uint8_t labelIdx = predictor.predictFromWindow(&bestDist);
+
+  // A real scan means the hand moved; a static stretch drops into idle
+  // (not while recording, which keeps the full rate)
+  if (!replayRunning && !recordingActive() && motionIdle.update(!predictor.reusedLast(), s.tMs)) {
+    applyIdle(motionIdle.active());
+  }
+
+  if (s.tMs - lastGestureOutputMs < GESTURE_OUTPUT_PERIOD_MS) return;
+  lastGestureOutputMs = s.tMs;
+
+  STATS_SCOPE(STAT_OUTPUT);
+  if (wireFormat == WIRE_FORMAT_BINARY) {
+    WireFrame frame = sensorFrame(WIRE_TYPE_GESTURE, s);
+    frame.putU8(labelIdx);
+    frame.putF32(bestDist);
+    frame.send(Serial);
+  }
+  if (jsonWanted()) {
+    const char* gestureName = "unknown";
+    if (labelIdx < NUM_CLASSES) {
+      gestureName = label_names[labelIdx];
+    }
+
+    // Output JSON format for web UI
+    jsonBegin();
+    jsonAppend("{\"mode\":\"gesture\",\"label\":\"%s\",\"meanD\":%.2f,", gestureName, bestDist);
+    appendSensorJson(s);
+    jsonAppend("}");
+    jsonEmit();
+  }
 }
+#endif
 
 void loop() {
   // Always process incoming serial commands
   handleSerialCommands();
 
+#if WEB_SERVER_ENABLED
+  webServer.poll();
+  if (webServer.takeSentenceRequest()) {
+    startSentenceCommand();
+  }
+#endif
+
+#if STATS_ENABLED && STATS_PERIOD_MS > 0
+  static uint32_t lastStatsMs = 0;
+  if (millis() - lastStatsMs >= STATS_PERIOD_MS) {
+    lastStatsMs = millis();
+    printStats();
+  }
+#endif
+
   // Physical button support removed - use web UI command instead
 
 #if RUN_MODE == 0
@@ -221,178 +1150,37 @@ void loop() {
 
 #else
   // --------- REAL-TIME PREDICTION MODE ---------
-  
-  // Read raw sensor data
-  int flex[5];
-  int16_t ax, ay, az, gx, gy, gz;
-  predictor.readRawFrame(flex, ax, ay, az, gx, gy, gz);
-  
-  // Calculate GDP (gyro magnitude)
-  float fgx = (float)gx;
-  float fgy = (float)gy;
-  float fgz = (float)gz;
-  float gdp = sqrtf(fgx * fgx + fgy * fgy + fgz * fgz);
-  
-  // Normalize flex values (0-1 range based on calibration)
-  float f1 = (float)(flex[0] - FLEX_MIN[0]) / (float)(FLEX_MAX[0] - FLEX_MIN[0]);
-  float f2 = (float)(flex[1] - FLEX_MIN[1]) / (float)(FLEX_MAX[1] - FLEX_MIN[1]);
-  float f3 = (float)(flex[2] - FLEX_MIN[2]) / (float)(FLEX_MAX[2] - FLEX_MIN[2]);
-  float f4 = (float)(flex[3] - FLEX_MIN[3]) / (float)(FLEX_MAX[3] - FLEX_MIN[3]);
-  float f5 = (float)(flex[4] - FLEX_MIN[4]) / (float)(FLEX_MAX[4] - FLEX_MIN[4]);
-  
-  // Clamp to 0-1
-  f1 = constrain(f1, 0.0f, 1.0f);
-  f2 = constrain(f2, 0.0f, 1.0f);
-  f3 = constrain(f3, 0.0f, 1.0f);
-  f4 = constrain(f4, 0.0f, 1.0f);
-  f5 = constrain(f5, 0.0f, 1.0f);
-  
-  // Convert accel to g (assuming 16-bit signed, ±2g range)
-  float fax = ax / 16384.0f;
-  float fay = ay / 16384.0f;
-  float faz = az / 16384.0f;
-  
-  // Convert gyro to deg/s (assuming ±250 deg/s range)
-  float fgxDeg = gx / 131.0f;
-  float fgyDeg = gy / 131.0f;
-  float fgzDeg = gz / 131.0f;
 
-#if SENTENCE_MODE_AVAILABLE && (PREDICTION_MODE == 1 || PREDICTION_MODE == 2)
-  // Check if sentence mode is active
-  if (sentenceModeActive) {
-    if (sentencePredictor.recording()) {
-      // Add sample to sentence buffer - use RAW values to match training data!
-      bool windowComplete = sentencePredictor.addSample(
-        (float)flex[0], (float)flex[1], (float)flex[2], (float)flex[3], (float)flex[4],
-        gdp, (float)ax, (float)ay, (float)az, fgx, fgy, fgz
-      );
-      
-      if (windowComplete) {
-        // Send final progress update WITH SENSOR DATA
-        Serial.print("{\"mode\":\"sentence\",\"recording\":true,\"progress\":1.0,");
-        Serial.print("\"gdp\":"); Serial.print(gdp, 1); Serial.print(",");
-        Serial.print("\"f1\":"); Serial.print(f1, 2); Serial.print(",");
-        Serial.print("\"f2\":"); Serial.print(f2, 2); Serial.print(",");
-        Serial.print("\"f3\":"); Serial.print(f3, 2); Serial.print(",");
-        Serial.print("\"f4\":"); Serial.print(f4, 2); Serial.print(",");
-        Serial.print("\"f5\":"); Serial.print(f5, 2); Serial.print(",");
-        Serial.print("\"ax\":"); Serial.print(fax, 2); Serial.print(",");
-        Serial.print("\"ay\":"); Serial.print(fay, 2); Serial.print(",");
-        Serial.print("\"az\":"); Serial.print(faz, 2); Serial.print(",");
-        Serial.print("\"gx\":"); Serial.print(fgxDeg, 1); Serial.print(",");
-        Serial.print("\"gy\":"); Serial.print(fgyDeg, 1); Serial.print(",");
-        Serial.print("\"gz\":"); Serial.print(fgzDeg, 1);
-        Serial.println("}");
-      } else {
-        // Send progress update WITH SENSOR DATA every 20%
-        float progress = sentencePredictor.getRecordingProgress();
-        static int lastProgressPercent = -1;
-        int currentPercent = (int)(progress * 100);
-        
-        if (currentPercent % 20 == 0 && currentPercent != lastProgressPercent) {
-          Serial.print("{\"mode\":\"sentence\",\"recording\":true,\"progress\":");
-          Serial.print(progress, 2); Serial.print(",");
-          Serial.print("\"gdp\":"); Serial.print(gdp, 1); Serial.print(",");
-          Serial.print("\"f1\":"); Serial.print(f1, 2); Serial.print(",");
-          Serial.print("\"f2\":"); Serial.print(f2, 2); Serial.print(",");
-          Serial.print("\"f3\":"); Serial.print(f3, 2); Serial.print(",");
-          Serial.print("\"f4\":"); Serial.print(f4, 2); Serial.print(",");
-          Serial.print("\"f5\":"); Serial.print(f5, 2); Serial.print(",");
-          Serial.print("\"ax\":"); Serial.print(fax, 2); Serial.print(",");
-          Serial.print("\"ay\":"); Serial.print(fay, 2); Serial.print(",");
-          Serial.print("\"az\":"); Serial.print(faz, 2); Serial.print(",");
-          Serial.print("\"gx\":"); Serial.print(fgxDeg, 1); Serial.print(",");
-          Serial.print("\"gy\":"); Serial.print(fgyDeg, 1); Serial.print(",");
-          Serial.print("\"gz\":"); Serial.print(fgzDeg, 1);
-          Serial.println("}");
-          lastProgressPercent = currentPercent;
-        }
-      }
-      
-      if (windowComplete) {
-      // Window complete, predict sentence
-      signalSentenceComplete();
-      
-      float meanDist = 0.0f;
-      uint8_t labelIdx = sentencePredictor.predict(&meanDist);
-      
-      const char* sentenceName = "unknown";
-      if (labelIdx < SENTENCE_NUM_CLASSES) {
-        sentenceName = sentence_label_names[labelIdx];
-      }
-      
-      // Calculate confidence (inverse of distance) and damp if Rest
-      float confidence = 1.0f / (1.0f + meanDist);
-      if (strcmp(sentenceName, "Rest") == 0) {
-        confidence *= 0.2f;  // present Rest as low confidence to UI
-      }
-      
-      // Output sentence prediction
-      Serial.print("{\"mode\":\"sentence\",\"recording\":false,\"sentence\":\"");
-      Serial.print(sentenceName);
-      Serial.print("\",\"confidence\":");
-      Serial.print(confidence, 3);
-      Serial.print(",\"meanD\":");
-      Serial.print(meanDist, 2);
-      Serial.println("}");
-      
-      sentencePredictor.reset();
-      
-      #if PREDICTION_MODE == 1
-        // In pure SENTENCE MODE, automatically restart recording
-        sentencePredictor.startRecording();
-      #else
-        // In AUTO MODE, return to gesture mode after prediction
-        sentenceModeActive = false;
-      #endif
-      }
-    } else {
-      // Recording not started yet or already complete
-      Serial.println("{\"debug\":\"sentenceModeActive=true but recording=false\"}");
-      
-      #if PREDICTION_MODE == 1
-        // In pure SENTENCE MODE, restart recording if it's not active
-        sentencePredictor.startRecording();
-      #else
-        sentenceModeActive = false;
-      #endif
-    }
-    
-    delay(10);  // Small delay for sampling rate control
-    return;  // Skip gesture prediction while in sentence mode
-  }
+  // Drain everything the acquisition task produced since the last pass.
+  // Nothing here blocks, so serial commands are picked up every pass.
+  // (replay end is sampled first, so its last frames are drained below)
+  bool replayEnded = replayRunning && acquisition.replaySource().done();
+
+  SensorSample s;
+  bool gotSample = false;
+  while (acquisition.read(s)) {
+#if SESSION_RECORDER
+    if (sessionRecorder.active() && !sessionRecorder.add(s)) finishRecording("error");
 #endif
+    processPredictionSample(s);
+    gotSample = true;
+  }
 
-#if PREDICTION_MODE == 0 || PREDICTION_MODE == 2 || !SENTENCE_MODE_AVAILABLE
-  // Regular gesture prediction
-  float bestDist = 0.0f;
-  uint8_t labelIdx = predictor.predictGesture(&bestDist, 250, 10);
-  
-  const char* gestureName = "unknown";
-  if (labelIdx < NUM_CLASSES) {
-    gestureName = label_names[labelIdx];
-  }
-
-  // Output JSON format for web UI
-  Serial.print("{");
-  Serial.print("\"mode\":\"gesture\",");
-  Serial.print("\"label\":\""); Serial.print(gestureName); Serial.print("\",");
-  Serial.print("\"meanD\":" ); Serial.print(bestDist, 2); Serial.print(",");
-  Serial.print("\"gdp\":" ); Serial.print(gdp, 1); Serial.print(",");
-  Serial.print("\"f1\":" ); Serial.print(f1, 2); Serial.print(",");
-  Serial.print("\"f2\":" ); Serial.print(f2, 2); Serial.print(",");
-  Serial.print("\"f3\":" ); Serial.print(f3, 2); Serial.print(",");
-  Serial.print("\"f4\":" ); Serial.print(f4, 2); Serial.print(",");
-  Serial.print("\"f5\":" ); Serial.print(f5, 2); Serial.print(",");
-  Serial.print("\"ax\":" ); Serial.print(fax, 2); Serial.print(",");
-  Serial.print("\"ay\":" ); Serial.print(fay, 2); Serial.print(",");
-  Serial.print("\"az\":" ); Serial.print(faz, 2); Serial.print(",");
-  Serial.print("\"gx\":" ); Serial.print(fgxDeg, 1); Serial.print(",");
-  Serial.print("\"gy\":" ); Serial.print(fgyDeg, 1); Serial.print(",");
-  Serial.print("\"gz\":" ); Serial.print(fgzDeg, 1);
-  Serial.println("}");
+#if SENTENCE_MODE_AVAILABLE
+  SentenceEvent ev;
+  while (sentenceWorker.poll(ev)) {
+    handleSentenceEvent(ev);
+  }
 #endif
 
-  delay(100);
+  if (replayEnded) {
+    finishReplay();
+  }
+
+  if (!gotSample) {
+    // Nothing pending; yield until the next sample tick (idle: the whole
+    // sample period, so the CPU can sleep)
+    vTaskDelay(motionIdle.active() ? pdMS_TO_TICKS(1000 / MOTION_IDLE_RATE_HZ) : 1);
+  }
 #endif
 }
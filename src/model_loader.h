@@ -0,0 +1,132 @@
+#pragma once
+#include <Arduino.h>
+#include "model_store.h"
+#include "knn_runtime.h"
+#include "sentence_predictor.h"
+
+// ----------- Model selection -----------
+//
+// Points the gesture / sentence runtimes at the tables of a mapped model
+// container, checking it against what this firmware was compiled for
+// (feature count, K, metric, weights, class count, sentence block layout;
+// those still need a rebuild when they change). A model that fails the
+// check keeps the compiled-in tables, as does a missing or invalid
+// container.
+
+struct ModelLoadResult {
+  bool gesture;           // gesture tables come from the container
+  bool sentence;
+  const char* gestureError;
+  const char* sentenceError;
+};
+
+// Back to the tables compiled into the firmware
+inline void useEmbeddedModels() {
+  gestureTables = knn_embedded_tables();
+  sentenceTables = sentence_embedded_tables();
+}
+
+inline const char* loadGestureModel(const ModelStore& store) {
+#if !KNN_USE_INT8
+  (void)store;
+  return "needs KNN_USE_INT8";
+#else
+  const ModelGestureMeta* meta =
+    (const ModelGestureMeta*)store.section(MODEL_SEC_GESTURE_META, sizeof(ModelGestureMeta));
+  if (!meta) return "missing";
+  if (meta->numFeatures != NUM_FEATURES || meta->k != KNN_K || meta->metric != KNN_METRIC ||
+      meta->weights != KNN_WEIGHTS || meta->numClasses != NUM_CLASSES) {
+    return "architecture differs, rebuild";
+  }
+
+  const uint32_t n = meta->numSamples;
+  const uint32_t fBytes = NUM_FEATURES * sizeof(float);
+  GestureTables t;
+  t.scalerMean = (const float*)store.section(MODEL_SEC_GESTURE_MEAN, fBytes);
+  t.scalerScale = (const float*)store.section(MODEL_SEC_GESTURE_SCALE, fBytes);
+  t.qScales = (const float*)store.section(MODEL_SEC_GESTURE_QSCALES, fBytes);
+  t.numSamples = n;
+  t.rows = (const int8_t*)store.section(MODEL_SEC_GESTURE_ROWS, n * NUM_FEATURES);
+  t.labels = (const uint8_t*)store.section(MODEL_SEC_GESTURE_LABELS, n);
+  if (!n || !t.scalerMean || !t.scalerScale || !t.qScales || !t.rows || !t.labels) return "incomplete";
+
+#if KNN_USE_INDEX
+  const uint32_t nodes = meta->indexNodes;
+  if (!nodes || n > 0xFFFF) return "no KD-tree";
+  t.indexNodes = nodes;
+  t.indexDim = (const uint8_t*)store.section(MODEL_SEC_INDEX_DIM, nodes);
+  t.indexSplit = (const int8_t*)store.section(MODEL_SEC_INDEX_SPLIT, nodes);
+  t.indexA = (const uint16_t*)store.section(MODEL_SEC_INDEX_A, nodes * 2);
+  t.indexB = (const uint16_t*)store.section(MODEL_SEC_INDEX_B, nodes * 2);
+  t.indexPerm = (const uint16_t*)store.section(MODEL_SEC_INDEX_PERM, n * 2);
+  if (!t.indexDim || !t.indexSplit || !t.indexA || !t.indexB || !t.indexPerm) return "incomplete KD-tree";
+#endif
+
+  gestureTables = t;
+  return nullptr;
+#endif
+}
+
+inline const char* loadSentenceModel(const ModelStore& store) {
+#if defined(SENTENCE_KNN_Q_PCA_COMPONENTS)
+  (void)store;
+  return "PCA models are compiled in only";
+#elif !defined(SENTENCE_KNN_Q_HAS_AFFINE) || !defined(SENTENCE_KNN_Q_N_BLOCKS)
+  (void)store;
+  return "needs affine + block order model header";
+#else
+  const ModelSentenceMeta* meta =
+    (const ModelSentenceMeta*)store.section(MODEL_SEC_SENTENCE_META, sizeof(ModelSentenceMeta));
+  if (!meta) return "missing";
+  if (meta->numFeatures != SENTENCE_KNN_Q_N_FEATURES || meta->k != SENTENCE_KNN_Q_N_NEIGHBORS ||
+      meta->numClasses != SENTENCE_NUM_CLASSES || meta->blockLen != SENTENCE_KNN_Q_BLOCK_LEN ||
+      meta->numBlocks != SENTENCE_KNN_Q_N_BLOCKS) {
+    return "architecture differs, rebuild";
+  }
+
+  const uint32_t n = meta->numSamples;
+  const uint32_t fBytes = SENTENCE_KNN_Q_N_FEATURES * sizeof(float);
+  SentenceTables t;
+  t.numSamples = n;
+  t.rows = (const int8_t*)store.section(MODEL_SEC_SENTENCE_ROWS, n * SENTENCE_KNN_Q_N_FEATURES);
+  t.labels = (const uint8_t*)store.section(MODEL_SEC_SENTENCE_LABELS, n);
+  t.affineA = (const float*)store.section(MODEL_SEC_SENTENCE_AFFINE_A, fBytes);
+  t.affineB = (const float*)store.section(MODEL_SEC_SENTENCE_AFFINE_B, fBytes);
+  t.blockOrder = (const uint16_t*)store.section(MODEL_SEC_SENTENCE_BLOCKS, SENTENCE_KNN_Q_N_BLOCKS * 2);
+  if (!n || !t.rows || !t.labels || !t.affineA || !t.affineB || !t.blockOrder) return "incomplete";
+#ifdef SENTENCE_KNN_Q_COARSE_FACTOR
+  // Optional: without a matching coarse table the sentence KNN scans every row
+  t.coarse = meta->coarseFactor == SENTENCE_KNN_Q_COARSE_FACTOR
+    ? (const int16_t*)store.section(MODEL_SEC_SENTENCE_COARSE, n * SENTENCE_KNN_Q_COARSE_FEATURES * 2)
+    : nullptr;
+#endif
+#ifdef SENTENCE_KNN_Q_DTW_BAND
+  const bool dtw = meta->dtwBand == SENTENCE_KNN_Q_DTW_BAND;
+  t.dtwUpper = dtw ? (const int8_t*)store.section(MODEL_SEC_SENTENCE_DTW_UPPER, n * SENTENCE_KNN_Q_N_FEATURES) : nullptr;
+  t.dtwLower = dtw ? (const int8_t*)store.section(MODEL_SEC_SENTENCE_DTW_LOWER, n * SENTENCE_KNN_Q_N_FEATURES) : nullptr;
+#if SENTENCE_USE_DTW
+  // DTW builds have no L1 fallback: the envelopes must match the band
+  if (!t.dtwUpper || !t.dtwLower) return "no DTW envelopes for this band, rebuild";
+#endif
+#endif
+
+  sentenceTables = t;
+  return nullptr;
+#endif
+}
+
+// Use whatever a valid container provides, the compiled-in tables otherwise
+inline ModelLoadResult loadModels(const ModelStore& store) {
+  useEmbeddedModels();
+  ModelLoadResult r;
+  if (!store.valid()) {
+    r.gesture = r.sentence = false;
+    r.gestureError = r.sentenceError = store.error();
+    return r;
+  }
+  r.gestureError = loadGestureModel(store);
+  r.sentenceError = loadSentenceModel(store);
+  r.gesture = r.gestureError == nullptr;
+  r.sentence = r.sentenceError == nullptr;
+  return r;
+}
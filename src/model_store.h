@@ -0,0 +1,239 @@
+#pragma once
+#include <Arduino.h>
+#include <esp_partition.h>
+#include <esp_rom_crc.h>
+
+// ----------- Model container in flash -----------
+//
+// Trained models are packed by tools/model_container.py into one versioned
+// binary and written to the "models" data partition (partitions_models.csv),
+// either with esptool or over serial (MODEL UPLOAD). The partition is
+// memory-mapped, so the KNN runtimes read the tables in place (zero copy,
+// same flash cache path as PROGMEM data).
+//
+// Layout (little-endian, every section 16-byte aligned):
+//   ModelFileHeader
+//   ModelSection[numSections]
+//   section data ...
+// crc32 (zlib polynomial) covers everything after the file header.
+
+#define MODEL_MAGIC            0x444D5345u   // "ESMD"
+#define MODEL_FORMAT_VERSION   1
+#define MODEL_ALIGN            16
+#define MODEL_PARTITION_LABEL  "models"
+#define MODEL_PARTITION_TYPE   0x40          // custom data subtype
+#define MODEL_SECTOR_SIZE      4096
+
+// Section ids (tools/model_container.py)
+enum ModelSectionId : uint32_t {
+  MODEL_SEC_GESTURE_META     = 1,   // ModelGestureMeta
+  MODEL_SEC_GESTURE_MEAN     = 2,   // float[numFeatures]  scaler mean
+  MODEL_SEC_GESTURE_SCALE    = 3,   // float[numFeatures]  scaler scale
+  MODEL_SEC_GESTURE_QSCALES  = 4,   // float[numFeatures]  int8 quantization scales
+  MODEL_SEC_GESTURE_ROWS     = 5,   // int8[numSamples][numFeatures]
+  MODEL_SEC_GESTURE_LABELS   = 6,   // uint8[numSamples]
+  MODEL_SEC_INDEX_DIM        = 7,   // uint8[indexNodes]   KD-tree (glove_knn_index.h)
+  MODEL_SEC_INDEX_SPLIT      = 8,   // int8[indexNodes]
+  MODEL_SEC_INDEX_A          = 9,   // uint16[indexNodes]
+  MODEL_SEC_INDEX_B          = 10,  // uint16[indexNodes]
+  MODEL_SEC_INDEX_PERM       = 11,  // uint16[numSamples]
+
+  MODEL_SEC_SENTENCE_META    = 32,  // ModelSentenceMeta
+  MODEL_SEC_SENTENCE_AFFINE_A = 33, // float[numFeatures]
+  MODEL_SEC_SENTENCE_AFFINE_B = 34, // float[numFeatures]
+  MODEL_SEC_SENTENCE_ROWS    = 35,  // int8[numSamples][numFeatures]
+  MODEL_SEC_SENTENCE_LABELS  = 36,  // uint8[numSamples]
+  MODEL_SEC_SENTENCE_BLOCKS  = 37,  // uint16[numBlocks]
+  MODEL_SEC_SENTENCE_COARSE  = 38,  // int16[numSamples][numFeatures / coarseFactor]
+  MODEL_SEC_SENTENCE_DTW_UPPER = 39, // int8[numSamples][numFeatures]  LB_Keogh envelopes
+  MODEL_SEC_SENTENCE_DTW_LOWER = 40, // int8[numSamples][numFeatures]
+};
+
+struct ModelFileHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t numSections;
+  uint32_t totalSize;     // header included
+  uint32_t crc32;         // bytes [sizeof(ModelFileHeader), totalSize)
+};
+
+struct ModelSection {
+  uint32_t id;
+  uint32_t offset;        // from the start of the file
+  uint32_t size;          // bytes
+  uint32_t reserved;
+};
+
+struct ModelGestureMeta {
+  uint16_t numFeatures;
+  uint8_t k;
+  uint8_t metric;         // KNN_METRIC codes
+  uint8_t weights;        // KNN_WEIGHTS codes
+  uint8_t numClasses;
+  uint16_t leafSize;
+  uint32_t numSamples;
+  uint32_t indexNodes;    // 0 = no KD-tree
+};
+
+struct ModelSentenceMeta {
+  uint16_t numFeatures;
+  uint8_t k;
+  uint8_t numClasses;
+  uint32_t numSamples;
+  uint16_t blockLen;
+  uint16_t numBlocks;
+  uint16_t coarseFactor;  // timesteps per coarse cell, 0 = no coarse table
+  uint16_t dtwBand;       // DTW band of the envelopes, 0 = none (L1 matching)
+};
+
+static_assert(sizeof(ModelFileHeader) == 16 && sizeof(ModelSection) == 16, "model container layout");
+static_assert(sizeof(ModelGestureMeta) == 16 && sizeof(ModelSentenceMeta) == 16, "model container layout");
+
+class ModelStore {
+public:
+  ModelStore()
+  : part(nullptr), base(nullptr), mapped(false), uploading(false),
+    uploadSize(0), uploadCrc(0), received(0), erasedTo(0), lastError("none")
+  {}
+
+  // Find and map the partition; true when it holds a valid container.
+  bool begin() {
+    part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                    (esp_partition_subtype_t)MODEL_PARTITION_TYPE,
+                                    MODEL_PARTITION_LABEL);
+    if (!part) return fail("no models partition");
+    return map();
+  }
+
+  bool valid() const { return mapped; }
+  const char* error() const { return lastError; }
+  const ModelFileHeader* header() const { return (const ModelFileHeader*)base; }
+  uint32_t capacity() const { return part ? part->size : 0; }
+
+  // Section payload, or nullptr when missing / shorter than minSize
+  const void* section(uint32_t id, uint32_t minSize = 0) const {
+    if (!mapped) return nullptr;
+    const ModelSection* sec = (const ModelSection*)(base + sizeof(ModelFileHeader));
+    for (uint16_t i = 0; i < header()->numSections; ++i) {
+      if (sec[i].id == id) return sec[i].size >= minSize ? base + sec[i].offset : nullptr;
+    }
+    return nullptr;
+  }
+
+  // ---- Upload (replaces the container in place) ----
+  // The mapping is dropped first: callers must stop using the tables
+  // (model_loader.h falls back to the compiled-in ones).
+
+  bool beginUpload(uint32_t size, uint32_t crc) {
+    if (!part) return fail("no models partition");
+    if (size < sizeof(ModelFileHeader) || size > part->size) return fail("size");
+    unmap();
+    uploading = true;
+    uploadSize = size;
+    uploadCrc = crc;
+    received = 0;
+    erasedTo = 0;
+    return true;
+  }
+
+  bool uploadActive() const { return uploading; }
+  uint32_t uploadReceived() const { return received; }
+  uint32_t uploadTotal() const { return uploadSize; }
+
+  // Next bytes of the file, in order. Sectors are erased as they are reached.
+  bool write(const uint8_t* data, uint32_t len) {
+    if (!uploading || received + len > uploadSize) return fail("overrun");
+    while (erasedTo < received + len) {
+      if (esp_partition_erase_range(part, erasedTo, MODEL_SECTOR_SIZE) != ESP_OK) return fail("erase");
+      erasedTo += MODEL_SECTOR_SIZE;
+    }
+    if (esp_partition_write(part, received, data, len) != ESP_OK) return fail("write");
+    received += len;
+    return true;
+  }
+
+  // Verify what landed in flash and map it. False on a short upload or
+  // CRC mismatch (the partition then holds no valid container).
+  bool finishUpload() {
+    if (!uploading) return fail("no upload");
+    uploading = false;
+    if (received != uploadSize) return fail("short upload");
+
+    uint8_t buf[256];
+    uint32_t crc = 0;
+    for (uint32_t off = 0; off < uploadSize; off += sizeof(buf)) {
+      uint32_t n = min((uint32_t)sizeof(buf), uploadSize - off);
+      if (esp_partition_read(part, off, buf, n) != ESP_OK) return fail("read");
+      crc = esp_rom_crc32_le(crc, buf, n);
+    }
+    if (crc != uploadCrc) return fail("upload crc");
+    return map();
+  }
+
+  void abortUpload() {
+    uploading = false;
+  }
+
+private:
+  bool map() {
+    unmap();
+    ModelFileHeader h;
+    if (esp_partition_read(part, 0, &h, sizeof(h)) != ESP_OK) return fail("read");
+    if (h.magic != MODEL_MAGIC) return fail("empty");
+    if (h.version != MODEL_FORMAT_VERSION) return fail("version");
+    if (h.totalSize > part->size || h.totalSize < sizeof(h) + h.numSections * sizeof(ModelSection)) {
+      return fail("size");
+    }
+
+    const void* ptr = nullptr;
+    if (esp_partition_mmap(part, 0, h.totalSize, ESP_PARTITION_MMAP_DATA, &ptr, &handle) != ESP_OK) {
+      return fail("mmap");
+    }
+    base = (const uint8_t*)ptr;
+    mapped = true;
+
+    uint32_t crc = esp_rom_crc32_le(0, base + sizeof(h), h.totalSize - sizeof(h));
+    const ModelSection* sec = (const ModelSection*)(base + sizeof(h));
+    bool inBounds = true;
+    for (uint16_t i = 0; i < h.numSections; ++i) {
+      if (sec[i].offset % MODEL_ALIGN || sec[i].offset + sec[i].size > h.totalSize) inBounds = false;
+    }
+    if (crc != h.crc32 || !inBounds) {
+      unmap();
+      return fail(crc != h.crc32 ? "crc" : "section bounds");
+    }
+    return true;
+  }
+
+  void unmap() {
+    if (!mapped) return;
+#if ESP_IDF_VERSION_MAJOR >= 5
+    esp_partition_munmap(handle);
+#else
+    spi_flash_munmap(handle);
+#endif
+    mapped = false;
+    base = nullptr;
+  }
+
+  bool fail(const char* why) {
+    lastError = why;
+    return false;
+  }
+
+  const esp_partition_t* part;
+  const uint8_t* base;
+#if ESP_IDF_VERSION_MAJOR >= 5
+  esp_partition_mmap_handle_t handle;
+#else
+  spi_flash_mmap_handle_t handle;
+#endif
+  bool mapped;
+
+  bool uploading;
+  uint32_t uploadSize;
+  uint32_t uploadCrc;
+  uint32_t received;
+  uint32_t erasedTo;
+  const char* lastError;
+};
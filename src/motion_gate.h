@@ -0,0 +1,117 @@
+#pragma once
+#include <Arduino.h>
+#include "scaler_params.h"
+
+// ----------- Motion gate + idle state -----------
+//
+// MotionGate: change detector on the standardized gesture feature vector.
+// When no feature moved more than MOTION_GATE_THRESHOLD (in feature
+// standard deviations) from the vector that was last classified, the
+// KNN answer cannot meaningfully differ, so its label and distance are
+// reused. The reference is the last *classified* vector, so slow drift
+// still triggers a new scan once it adds up past the threshold.
+//
+// MotionIdle: after MOTION_IDLE_AFTER_MS without a real scan the glove
+// goes idle (main.cpp): the acquisition task drops to MOTION_IDLE_RATE_HZ
+// and paces itself without the hardware timer, and the CPU runs at
+// MOTION_IDLE_CPU_MHZ, light-sleeping between samples where the build has
+// tickless idle (CONFIG_FREERTOS_USE_TICKLESS_IDLE). The first vector
+// that passes the gate wakes it.
+//
+// Set MOTION_GATE=0 to classify every frame.
+
+#ifndef MOTION_GATE
+#define MOTION_GATE 1
+#endif
+
+#ifndef MOTION_GATE_THRESHOLD
+#define MOTION_GATE_THRESHOLD 0.1f    // max |delta| of any standardized feature
+#endif
+
+#ifndef MOTION_IDLE_AFTER_MS
+#define MOTION_IDLE_AFTER_MS 3000     // static this long -> idle (0 = never)
+#endif
+
+#define MOTION_IDLE_RATE_HZ  20       // acquisition rate while idle
+#define MOTION_IDLE_CPU_MHZ  80       // lowest clock that keeps the APB (UART, timers) at 80 MHz
+
+class MotionGate {
+public:
+  MotionGate() : valid(false), lastLabel(0), lastDist(0.0f), reusedCount(0), scannedCount(0) {}
+
+  // True (with the cached label / distance) when feat is close enough to
+  // the last classified vector.
+  bool reuse(const float feat[NUM_FEATURES], uint8_t& label, float& dist) {
+#if MOTION_GATE
+    if (valid) {
+      bool still = true;
+      for (int i = 0; i < NUM_FEATURES && still; ++i) {
+        still = fabsf(feat[i] - lastFeat[i]) < MOTION_GATE_THRESHOLD;
+      }
+      if (still) {
+        label = lastLabel;
+        dist = lastDist;
+        reusedCount++;
+        return true;
+      }
+    }
+#else
+    (void)feat; (void)label; (void)dist;
+#endif
+    return false;
+  }
+
+  // Result of a real scan; becomes the new reference
+  void store(const float feat[NUM_FEATURES], uint8_t label, float dist) {
+    memcpy(lastFeat, feat, sizeof(lastFeat));
+    lastLabel = label;
+    lastDist = dist;
+    valid = true;
+    scannedCount++;
+  }
+
+  // Next vector is always classified (new window length, model, ...)
+  void invalidate() { valid = false; }
+
+  uint32_t reused() const { return reusedCount; }
+  uint32_t scanned() const { return scannedCount; }
+
+private:
+  float lastFeat[NUM_FEATURES];
+  bool valid;
+  uint8_t lastLabel;
+  float lastDist;
+  uint32_t reusedCount;
+  uint32_t scannedCount;
+};
+
+class MotionIdle {
+public:
+  MotionIdle() : idle(false), lastMoveMs(0) {}
+
+  // Feed one classification (moved = it was a real scan). True when the
+  // idle state changed; active() tells which way.
+  bool update(bool moved, uint32_t nowMs) {
+    if (moved) {
+      lastMoveMs = nowMs;
+      if (!idle) return false;
+      idle = false;
+      return true;
+    }
+    if (idle || MOTION_IDLE_AFTER_MS == 0 || nowMs - lastMoveMs < MOTION_IDLE_AFTER_MS) return false;
+    idle = true;
+    return true;
+  }
+
+  // Leave idle without a motion event (mode change, replay, ...)
+  void wake(uint32_t nowMs) {
+    idle = false;
+    lastMoveMs = nowMs;
+  }
+
+  bool active() const { return idle; }
+
+private:
+  bool idle;
+  uint32_t lastMoveMs;
+};
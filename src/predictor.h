@@ -5,23 +5,37 @@
 #include "Calib.h"
 #include "scaler_params.h"
 #include "knn_runtime.h"
+#include "sensor_ring.h"
+#include "feature_window.h"
+#include "stage_stats.h"
+#include "imu_fifo.h"
+#include "flex_adc.h"
+#include "motion_gate.h"
 
 // ----------- Sensor + feature helper -----------
 
 class GlovePredictor {
 public:
   GlovePredictor()
-  : mpu(MPU6050(MPU6050_ADDR))
+  : mpu(MPU6050(MPU6050_ADDR)), imu(mpu)
   {}
 
-  bool begin() {
+  // frameRateHz: how often readRawFrame() will be called; sizes the
+  // MPU6050 FIFO rate (imu_fifo.h) and the flex ADC averaging (flex_adc.h)
+  bool begin(uint32_t frameRateHz = 100) {
+    // ESP32 ADC config
+    analogReadResolution(12); // 0..4095
+    flexAdc.begin(frameRateHz);
+
     Wire.begin(PIN_I2C_SDA, PIN_I2C_SCL);
+    Wire.setClock(IMU_I2C_CLOCK_HZ);
     mpu.initialize();
     bool ok = mpu.testConnection();
     if (!ok) return false;
 
-    // ESP32 ADC config
-    analogReadResolution(12); // 0..4095
+#if IMU_USE_FIFO
+    imu.begin(frameRateHz * IMU_OVERSAMPLE);
+#endif
 
     return true;
   }
@@ -32,13 +46,22 @@ public:
                     int16_t& ax, int16_t& ay, int16_t& az,
                     int16_t& gx, int16_t& gy, int16_t& gz) {
 
-    for (int i = 0; i < 5; ++i) {
-      rawFlex[i] = analogRead(PIN_FLEX[i]);
-    }
+    flexAdc.read(rawFlex);
 
+#if IMU_USE_FIFO
+    imu.read(ax, ay, az, gx, gy, gz);
+#else
     mpu.getMotion6(&ax, &ay, &az, &gx, &gy, &gz);
+#endif
   }
 
+  // MPU6050 FIFO overflows (reads fell more than ~85 samples behind)
+  uint32_t imuOverflows() const { return imu.overflowCount(); }
+
+  // True when the flex channels are sampled by the ADC DMA engine
+  bool flexDma() const { return flexAdc.dma(); }
+  uint32_t flexOverruns() const { return flexAdc.overrunCount(); }
+
   // Build a smoothed feature vector by averaging several raw frames
   // over ~windowMs milliseconds.
   //
@@ -70,28 +93,8 @@ public:
       int16_t ax, ay, az, gx, gy, gz;
       readRawFrame(flex, ax, ay, az, gx, gy, gz);
 
-      float f1 = (float)flex[0];
-      float f2 = (float)flex[1];
-      float f3 = (float)flex[2];
-      float f4 = (float)flex[3];
-      float f5 = (float)flex[4];
-
-      // GDP = gyro magnitude
-      float fgx = (float)gx;
-      float fgy = (float)gy;
-      float fgz = (float)gz;
-      float gdp = sqrtf(fgx * fgx + fgy * fgy + fgz * fgz);
-
-      float fax = (float)ax;
-      float fay = (float)ay;
-      float faz = (float)az;
-
-      float v[NUM_FEATURES] = {
-        f1, f2, f3, f4, f5,
-        gdp,
-        fax, fay, faz,
-        fgx, fgy, fgz
-      };
+      float v[NUM_FEATURES];
+      sampleToFeatures(makeSensorSample(flex, ax, ay, az, gx, gy, gz, millis()), v);
 
       for (int i = 0; i < NUM_FEATURES; ++i) {
         acc[i] += v[i];
@@ -120,12 +123,76 @@ public:
     float feat[NUM_FEATURES];
     buildFeatureVector(feat, windowMs, sampleDelayMs);
 
-    // Normalize with exported scaler parameters
-    standardizeFeatures(feat);
+    // Normalize with the active scaler parameters
+    knn_standardize(feat);
 
     return knn_predict(feat, outBestDist);
   }
 
+  // Unpack a SensorSample into the strict feature order above.
+  static void sampleToFeatures(const SensorSample& s, float v[NUM_FEATURES]) {
+    v[0] = s.f1;  v[1] = s.f2;  v[2] = s.f3;  v[3] = s.f4;  v[4] = s.f5;
+    v[5] = s.gdp;
+    v[6] = s.ax;  v[7] = s.ay;  v[8] = s.az;
+    v[9] = s.gx;  v[10] = s.gy; v[11] = s.gz;
+  }
+
+  // Push one acquisition sample into the sliding gesture window (O(1)).
+  void pushSample(const SensorSample& s) {
+    window.push(s);
+  }
+
+  // True once the window holds a full window of frames.
+  bool windowReady() const {
+    return window.full();
+  }
+
+  // Window length in frames (at ACQ_SAMPLE_RATE_HZ). Clears the window.
+  void setWindowFrames(uint8_t frames) {
+    window.setLength(frames);
+  }
+
+  uint8_t getWindowFrames() const {
+    return window.getLength();
+  }
+
+  // Standardize and classify the running mean of the current window.
+  // Unlike predictGesture() this never waits; it can run after every frame.
+  // While the hand is static the previous answer is reused (motion_gate.h).
+  uint8_t predictFromWindow(float* outBestDist = nullptr) {
+    float feat[NUM_FEATURES];
+    {
+      STATS_SCOPE(STAT_GESTURE_FEATURES);
+      window.mean(feat);
+      knn_standardize(feat);
+    }
+
+    uint8_t label;
+    float dist;
+    lastReused = gate.reuse(feat, label, dist);
+    if (!lastReused) {
+      STATS_SCOPE(STAT_GESTURE_KNN);
+      label = knn_predict(feat, &dist);
+      gate.store(feat, label, dist);
+    }
+    if (outBestDist) *outBestDist = dist;
+    return label;
+  }
+
+  // Last predictFromWindow() answer came from the motion gate, not a scan
+  bool reusedLast() const { return lastReused; }
+
+  // Drop the cached answer (e.g. a different model was loaded)
+  void resetMotionGate() { gate.invalidate(); }
+
+  const MotionGate& motionGate() const { return gate; }
+
 private:
   MPU6050 mpu;
+  ImuFifo imu;
+  FlexAdc flexAdc;
+
+  SlidingFeatureWindow window;
+  MotionGate gate;
+  bool lastReused = false;
 };
@@ -0,0 +1,176 @@
+#pragma once
+#include <Arduino.h>
+#include <LittleFS.h>
+#include "sensor_ring.h"
+
+// ----------- Replay input source -----------
+//
+// Feeds recorded frames in the RUN_MODE 0 / tools/collect_* text format
+//   FLEX: f1 f2 f3 f4 f5 | ACC: ax ay az | GYRO: gx gy gz | GDP=val
+// into the acquisition task in place of GlovePredictor::readRawFrame(), so
+// logged sessions run through the real prediction path on the device.
+//
+// Two inputs:
+//   serial : the host streams FLEX lines (tools/replay_log.py); limited by
+//            the baud rate to ~100 frames/s at 115200
+//   file   : a log stored on LittleFS, read by the acquisition task; any
+//            rate the pipeline can keep up with
+//
+// Samples get virtual timestamps at the log's own rate (logHz), so time
+// based logic (output throttling, sentence decimation) behaves as it did
+// when the log was recorded, whatever the replay speed.
+//
+// Control calls (start / stop / pushSerialFrame) come from loop() on core 1;
+// the file is only opened, read and closed by the consumer on core 0. A
+// start is refused until the consumer has dropped the previous source
+// (stopped()), so its counters and path never change under a running replay.
+
+#define REPLAY_RING_SIZE   64
+#define REPLAY_LINE_MAX    128
+#define REPLAY_PATH_MAX    48
+#define REPLAY_DEFAULT_HZ  20    // tools/collect_* log at 20 Hz (COLLECT_PERIOD_MS)
+
+#define REPLAY_OFF    0
+#define REPLAY_SERIAL 1
+#define REPLAY_FILE   2
+
+struct RawFrame {
+  int flex[5];
+  int16_t ax, ay, az, gx, gy, gz;
+};
+
+// Parse the fields after "FLEX:" (the part the command parser passes on)
+inline bool parseRawFrameFields(const char* s, RawFrame& out) {
+  int ax, ay, az, gx, gy, gz;
+  int n = sscanf(s, "%d %d %d %d %d | ACC: %d %d %d | GYRO: %d %d %d",
+                 &out.flex[0], &out.flex[1], &out.flex[2], &out.flex[3], &out.flex[4],
+                 &ax, &ay, &az, &gx, &gy, &gz);
+  if (n != 11) return false;
+  out.ax = (int16_t)ax; out.ay = (int16_t)ay; out.az = (int16_t)az;
+  out.gx = (int16_t)gx; out.gy = (int16_t)gy; out.gz = (int16_t)gz;
+  return true;
+}
+
+class ReplaySource {
+public:
+  ReplaySource()
+  : requestedMode(REPLAY_OFF), activeMode(REPLAY_OFF), finished(false),
+    logHz(REPLAY_DEFAULT_HZ), baseMs(0), frames(0), underruns(0), overflows(0)
+  {
+    path[0] = '\0';
+  }
+
+  // ---- control (core 1) ----
+
+  // False while the previous replay is still active (see stopped())
+  bool startSerial(uint16_t hz) {
+    return begin(REPLAY_SERIAL, hz);
+  }
+
+  bool startFile(const char* filePath, uint16_t hz) {
+    if (!stopped() || strlen(filePath) >= REPLAY_PATH_MAX) return false;
+    strcpy(path, filePath);
+    return begin(REPLAY_FILE, hz);
+  }
+
+  void stop() { requestedMode = REPLAY_OFF; }
+
+  // One FLEX line received on serial
+  void pushSerialFrame(const RawFrame& f) {
+    if (requestedMode != REPLAY_SERIAL || !ring.push(f)) overflows++;
+  }
+
+  bool requested() const { return requestedMode != REPLAY_OFF; }
+  // No replay requested and the consumer has let go of the last one
+  bool stopped() const { return requestedMode == REPLAY_OFF && activeMode == REPLAY_OFF; }
+  bool done() const { return finished; }
+  uint32_t startMs() const { return baseMs; }   // virtual time of frame 0
+  uint32_t frameCount() const { return frames; }
+  uint32_t underrunCount() const { return underruns; }
+  uint32_t overflowCount() const { return overflows; }
+
+  // ---- consumer (acquisition task, core 0) ----
+
+  // Apply a pending start / stop. Returns true while replay is active.
+  bool service() {
+    uint8_t want = requestedMode;
+    if (want == activeMode) return activeMode != REPLAY_OFF;
+
+    if (file) file.close();
+    if (want == REPLAY_OFF) {
+      RawFrame stale;
+      while (ring.pop(stale)) {}  // drop what the host sent after stopping
+    }
+    activeMode = want;
+    if (activeMode == REPLAY_FILE) {
+      file = LittleFS.open(path, "r");
+      if (!file) {
+        finished = true;
+        activeMode = REPLAY_OFF;
+        requestedMode = REPLAY_OFF;
+      }
+    }
+    return activeMode != REPLAY_OFF;
+  }
+
+  // Next frame and its virtual timestamp. False when none is due this tick
+  // (serial underrun, or end of file: done() turns true).
+  bool next(RawFrame& out, uint32_t& tMs) {
+    bool ok = false;
+    if (activeMode == REPLAY_SERIAL) {
+      ok = ring.pop(out);
+      if (!ok) underruns++;
+    } else if (activeMode == REPLAY_FILE) {
+      ok = readFileFrame(out);
+      if (!ok) {
+        file.close();
+        finished = true;
+        activeMode = REPLAY_OFF;
+        requestedMode = REPLAY_OFF;
+      }
+    }
+    if (!ok) return false;
+
+    tMs = baseMs + (uint32_t)((uint64_t)frames * 1000u / logHz);
+    frames++;
+    return true;
+  }
+
+private:
+  bool begin(uint8_t mode, uint16_t hz) {
+    if (!stopped()) return false;
+    logHz = hz ? hz : REPLAY_DEFAULT_HZ;
+    baseMs = millis();
+    frames = 0;
+    underruns = 0;
+    overflows = 0;
+    finished = false;
+    requestedMode = mode;
+    return true;
+  }
+
+  bool readFileFrame(RawFrame& out) {
+    char line[REPLAY_LINE_MAX];
+    while (file.available()) {
+      size_t n = file.readBytesUntil('\n', line, sizeof(line) - 1);
+      line[n] = '\0';
+      if (strncmp(line, "FLEX:", 5) == 0 && parseRawFrameFields(line + 5, out)) return true;
+      // comments (# label=...) and anything unparsable are skipped
+    }
+    return false;
+  }
+
+  SpscRing<RawFrame, REPLAY_RING_SIZE> ring;
+  File file;
+  char path[REPLAY_PATH_MAX];
+
+  volatile uint8_t requestedMode;
+  volatile uint8_t activeMode;
+  volatile bool finished;
+
+  uint16_t logHz;
+  uint32_t baseMs;
+  volatile uint32_t frames;
+  volatile uint32_t underruns;
+  volatile uint32_t overflows;
+};
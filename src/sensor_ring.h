@@ -0,0 +1,80 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+
+// ----------- Shared sensor sample + SPSC ring -----------
+
+// One raw sensor frame, in the strict feature order used by both models:
+// f1..f5, gdp, ax, ay, az, gx, gy, gz (RAW values, match training logs)
+struct SensorSample {
+  float f1, f2, f3, f4, f5;  // Flex sensors (raw ADC)
+  float gdp;                  // Gyro magnitude
+  float ax, ay, az;           // Accelerometer (raw int16)
+  float gx, gy, gz;           // Gyroscope (raw int16)
+  uint32_t tMs;               // Acquisition timestamp (millis)
+};
+
+// Build a SensorSample from one raw frame (as returned by readRawFrame).
+inline SensorSample makeSensorSample(const int rawFlex[5],
+                                     int16_t ax, int16_t ay, int16_t az,
+                                     int16_t gx, int16_t gy, int16_t gz,
+                                     uint32_t tMs) {
+  SensorSample s;
+  s.f1 = (float)rawFlex[0];
+  s.f2 = (float)rawFlex[1];
+  s.f3 = (float)rawFlex[2];
+  s.f4 = (float)rawFlex[3];
+  s.f5 = (float)rawFlex[4];
+
+  s.gx = (float)gx;
+  s.gy = (float)gy;
+  s.gz = (float)gz;
+  s.gdp = sqrtf(s.gx * s.gx + s.gy * s.gy + s.gz * s.gz);
+
+  s.ax = (float)ax;
+  s.ay = (float)ay;
+  s.az = (float)az;
+  s.tMs = tMs;
+  return s;
+}
+
+// Lock-free single-producer / single-consumer ring.
+// The producer only writes head, the consumer only writes tail, so no lock
+// is needed even when both sides run on different cores.
+// N must be a power of two.
+template <typename T, uint32_t N>
+class SpscRing {
+  static_assert(N > 0 && (N & (N - 1)) == 0, "SpscRing size must be a power of two");
+
+public:
+  // Producer side. Returns false (and drops the item) if the ring is full.
+  bool push(const T& item) {
+    uint32_t h = head.load(std::memory_order_relaxed);
+    uint32_t t = tail.load(std::memory_order_acquire);
+    if (h - t >= N) return false;
+    items[h & (N - 1)] = item;
+    head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer side. Returns false if the ring is empty.
+  bool pop(T& out) {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    uint32_t h = head.load(std::memory_order_acquire);
+    if (h == t) return false;
+    out = items[t & (N - 1)];
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+  }
+
+  uint32_t size() const {
+    return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+  }
+
+  static constexpr uint32_t capacity() { return N; }
+
+private:
+  T items[N];
+  std::atomic<uint32_t> head{0};
+  std::atomic<uint32_t> tail{0};
+};
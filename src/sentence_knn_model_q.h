@@ -106,7 +106,7 @@ static const float SENTENCE_Q_SCALES[SENTENCE_KNN_Q_N_FEATURES] PROGMEM = {
 };
 
 // Quantized training data (int8)
-static const int8_t SENTENCE_TRAINING_DATA_Q[SENTENCE_KNN_Q_N_SAMPLES * SENTENCE_KNN_Q_N_FEATURES] PROGMEM = {
+static const int8_t SENTENCE_TRAINING_DATA_Q[SENTENCE_KNN_Q_N_SAMPLES * SENTENCE_KNN_Q_N_FEATURES] PROGMEM __attribute__((aligned(4))) = {
   -7, -6, 65, 25, 55, 30, 61, 69, -92, 28, 14, 49, 2, -8, 52, 25, 50, 11, 45, 70, -98, 22, 9, 26, 8, -27, 58, 33, 53, -16, 55, 75,
   -97, 8, -24, -8, -5, -32, 53, 19, 49, -32, 63, 60, -88, -9, -19, -27, -1, -47, 53, 21, 52, -35, 68, 63, -82, -18, -27, -55, 1, -48, 48, 13,
   53, -6, 61, 79, -96, -65, -37, -67, 28, -74, 52, 11, 31, 28, 37, 59, -68, -80, -34, -75, 33, -80, 47, 7, 41, 46, 23, 49, -46, -71, -39, -89,
@@ -4018,6 +4018,875 @@ static const uint8_t SENTENCE_TRAINING_LABELS_Q[SENTENCE_KNN_Q_N_SAMPLES] PROGME
   11, 11
 };
 
+#define SENTENCE_KNN_Q_BLOCK_LEN 12
+#define SENTENCE_KNN_Q_N_BLOCKS 80
+
+// Block visiting order for early-abandon distance (highest variance first)
+static const uint16_t SENTENCE_Q_BLOCK_ORDER[SENTENCE_KNN_Q_N_BLOCKS] PROGMEM = {
+  34, 12, 5, 33, 13, 32, 38, 39, 29, 6, 37, 11, 36, 14, 30, 4, 35, 28, 7, 42,
+  25, 48, 31, 3, 15, 10, 40, 26, 27, 41, 53, 54, 2, 45, 9, 59, 17, 56, 55, 16,
+  43, 52, 49, 58, 50, 47, 57, 8, 60, 51, 20, 1, 24, 63, 62, 44, 46, 72, 61, 73,
+  18, 0, 64, 65, 67, 71, 69, 68, 76, 77, 19, 74, 75, 78, 70, 66, 21, 23, 22, 79
+};
+
+#define SENTENCE_KNN_Q_COARSE_FACTOR 8
+#define SENTENCE_KNN_Q_COARSE_FEATURES 120
+
+// Sums of 8 consecutive timesteps per channel, for the cascaded search
+static const int16_t SENTENCE_Q_COARSE[SENTENCE_KNN_Q_N_SAMPLES * SENTENCE_KNN_Q_COARSE_FEATURES] PROGMEM __attribute__((aligned(4))) = {
+  59, -322, 428, 154, 384, 26, 413, 524, -667, -185, -157, -246, 352, -437, 305, 44, 154, 328, -385, -247, 302, -223, -176, -356,
+  120, -160, 323, 114, 99, 424, -195, -168, 114, -380, 23, 461, -18, -359, 316, 106, 282, 517, -210, -377, 85, 85, -112, -191,
+  66, -416, 223, 43, 253, 526, -170, -405, 6, 424, -41, -58, 192, -404, 277, 57, 172, 653, 121, 166, 16, 531, -245, 524,
+  433, -302, 349, 117, 254, 331, 100, 96, -6, -354, 125, -626, 377, -302, 130, 82, 134, -325, -326, -126, 206, 63, 9, 25,
+  290, -235, 82, 85, 104, -306, -276, -20, 135, 47, 53, 8, 240, -201, 83, 83, 101, -212, -236, -12, 95, 56, 17, 63,
+  -45, -192, 561, 270, 419, -16, 440, 526, -629, 20, -10, -168, 343, -294, 289, 160, 188, 453, -241, -100, -63, -413, -243, -684,
+  399, -257, 340, 73, 187, -56, -273, -198, 34, 52, -135, 185, 105, -364, 282, 170, 279, 661, -84, -580, 302, -51, 80, 490,
+  42, -425, 297, 111, 243, 683, -339, -448, 81, 15, -101, 187, 100, -347, 284, 124, 118, 554, -448, -651, -81, -5, -381, -94,
+  143, -232, 252, 98, 158, 394, 345, 159, 129, 362, -341, 133, 411, -250, 365, 137, 87, 153, -328, -161, 223, -137, -205, -331,
+  326, -253, 209, 86, -38, -307, -274, -51, 154, 42, 63, 2, 294, -222, 278, 69, 4, -210, -235, -48, 103, 54, 17, 61,
+  164, -69, 680, 252, 338, 129, 462, 416, -618, 222, 101, 172, 366, -300, 276, 95, 146, 508, -174, -203, -87, -412, -116, -694,
+  298, -238, 337, 115, 129, 255, -308, -204, 8, -279, -167, 365, 48, -404, 273, 159, 263, 617, -126, -405, 191, -59, -45, 70,
+  5, -421, 327, 113, 213, 522, -107, -522, 122, 174, -122, -110, 130, -231, 310, 88, 123, 397, 158, -101, 205, 365, -317, 618,
+  444, -235, 410, 117, 156, 274, -51, -3, 129, -96, -151, -621, 367, -260, 465, 158, 114, -341, -298, -89, 186, 50, 9, 50,
+  348, -227, 312, 123, 91, -299, -283, -24, 128, 49, 56, 2, 275, -236, 383, 99, 142, -205, -235, -16, 83, 59, 21, 58,
+  224, -224, 646, 301, 365, 236, 456, 291, -638, 328, 149, 296, 358, -280, 406, 139, 118, 469, -104, -115, -48, -463, -104, -658,
+  350, -275, 276, 135, 42, -24, -215, -60, 19, -21, -80, 163, 149, -297, 325, 136, 218, 709, 34, -599, 283, 84, 11, 379,
+  183, -398, 336, 153, 139, 755, -103, -480, 102, 102, -147, 69, 155, -319, 319, 81, 107, 554, -430, -449, 101, 104, -455, 289,
+  388, -272, 416, 142, 231, 266, 398, 210, -6, 49, -217, -285, 418, -226, 108, 147, 86, -32, -383, -225, 249, -72, -8, -161,
+  377, -208, 23, 109, 54, -309, -280, -47, 145, 39, 60, 12, 349, -233, 9, 121, 59, -213, -234, -46, 108, 48, 11, 59,
+  -22, 485, 330, 173, 53, 437, -13, 146, 180, 492, 249, 319, 11, -5, 380, 140, 155, 167, 435, 172, -560, -12, -67, -329,
+  336, -245, 402, 100, 123, 194, -355, -232, 124, -186, -129, -75, 119, -378, 329, 164, 303, 638, -22, -532, 272, -79, -15, 428,
+  94, -424, 451, 104, 220, 666, -150, -492, 102, 70, -134, -16, 111, -228, 274, 75, 80, 568, -275, -293, 237, 120, -359, 266,
+  295, -245, 462, 114, 129, 334, 188, 186, 60, -12, -156, -463, 442, -238, 481, 139, 117, -276, -361, -196, 194, 45, -22, -2,
+  289, -180, 331, 95, 120, -310, -288, -72, 135, 42, 55, 8, 226, -197, 359, 71, 138, -135, -216, -210, 77, 73, -33, 148,
+  -77, 486, 456, 280, 232, -45, 295, 482, -432, 200, -103, 41, 164, 244, 686, 341, 277, 218, 147, 208, -418, -277, -192, -547,
+  486, -229, 791, 228, 162, -61, -431, -288, 108, 6, -121, -126, 274, -289, 541, 190, 130, 303, -401, -386, 122, -434, -177, 494,
+  149, -310, 432, 217, 137, 690, -44, -402, 160, 47, -71, 85, 142, -266, 396, 187, 94, 429, -223, -403, 136, 207, -139, -170,
+  90, 341, 352, 128, 89, 413, 190, 112, 140, 517, -359, 619, 144, 314, 430, 192, 156, 380, 158, 106, -46, -277, 20, -593,
+  305, -37, 410, 184, 120, -208, -333, -130, 162, 53, -2, -20, 262, -81, 391, 197, 124, -206, -232, -54, 121, 58, 13, 59,
+  137, 420, 400, 396, 459, -73, -21, 485, 57, 178, -230, 36, 73, 362, 466, 244, 323, 61, 363, 258, -318, 346, -39, 37,
+  213, -192, 499, 200, 135, 355, -239, -104, -37, -303, -59, -527, 303, -336, 420, 253, 156, 199, -376, -93, 113, -367, -124, 419,
+  172, -389, 420, 211, 243, 666, -7, -270, 203, -92, -107, 151, 125, -308, 388, 187, 171, 517, 4, -370, 177, -15, -117, -158,
+  116, 318, 458, 184, 179, 273, 209, 63, 351, 465, -351, 440, 111, 180, 418, 178, 174, 398, 217, 148, -17, -165, -25, -558,
+  343, -75, 410, 151, 156, -212, -297, 4, 149, 54, -7, -11, 323, -104, 422, 198, 133, -207, -205, 118, 108, 55, 9, 60,
+  249, 385, 263, 338, 241, -19, -77, -21, 449, 90, 23, 36, -7, 241, 562, 415, 151, 163, 409, 236, -407, 495, 125, 163,
+  408, -189, 512, 204, 109, 360, -252, -409, 16, -359, -98, -572, 394, -389, 439, 251, 152, 189, -359, -292, 79, -208, -109, 433,
+  152, -262, 372, 248, 263, 555, 191, -263, 138, -15, 13, 101, 82, -311, 366, 216, 217, 544, 9, -472, 262, -50, -117, -54,
+  127, -174, 321, 195, 176, 417, -133, -198, 472, 361, -386, 459, 134, -154, 539, 254, 261, 306, 462, 275, -122, 101, -101, -351,
+  407, -141, 412, 180, 171, 83, -356, -192, 187, -127, 47, -301, 330, -152, 417, 213, 169, -207, -229, -34, 103, 53, 21, 54,
+  128, 162, 407, 320, 306, 451, -82, -11, 209, 359, 218, 356, 109, -83, 487, 278, 178, 127, 381, 184, -527, -14, 26, -284,
+  519, -267, 413, 251, 47, 186, -420, -377, 90, -138, -63, -305, 492, -388, 313, 270, 192, 374, -379, -494, 119, -452, -357, 526,
+  413, -387, 97, 238, 176, 703, 103, -532, 189, 53, -173, -17, 334, -302, 37, 171, 126, 562, 147, -414, 209, 163, -4, -149,
+  345, -262, 134, 177, 142, 570, -203, -503, 458, 286, -434, 621, 331, -221, 333, 237, 219, 393, 441, 212, -17, 173, -137, -509,
+  508, -160, 288, 210, 141, 71, -392, -454, 158, -43, 57, -173, 407, -209, 272, 211, 197, -206, -254, -243, 100, 57, 18, 67,
+  642, -71, 619, 485, 464, 155, 412, 266, -532, -459, -213, -586, 554, -320, 490, 360, 289, -76, -519, -386, 246, -86, -72, -279,
+  464, -190, 439, 297, 244, 19, -346, -283, -13, -172, -152, 203, 337, -293, 331, 331, 310, 655, 119, -500, 242, 175, -128, 423,
+  279, -340, 340, 274, 214, 627, -80, -440, 202, 63, -180, 106, 215, -138, 253, 164, 112, 502, -314, -290, 334, 8, -408, 30,
+  158, 191, 367, 185, 155, 170, 474, 259, -79, 322, -173, -17, 496, -97, 381, 197, 192, 230, -320, -240, 204, -204, 5, -434,
+  478, -83, 243, 167, 139, -310, -288, -54, 117, 31, 51, 10, 408, -100, 302, 206, 142, -209, -248, -63, 79, 55, 17, 65,
+  151, 175, -61, 61, -278, -165, 272, -382, 467, 21, -40, -185, -14, 320, 539, 283, 163, 254, 228, 240, -105, 817, 266, 241,
+  353, -178, 385, 175, 179, 473, 32, -263, -278, -421, -93, -647, 449, -403, 396, 188, 146, -129, -340, -358, 3, 52, 133, 88,
+  283, -262, 612, 243, 258, 283, -333, -397, -683, 65, 658, -124, 420, -177, 535, 234, 246, 291, 84, -400, -222, -608, -143, 157,
+  173, 154, 281, 159, 100, 492, -118, 517, -129, 264, -586, 331, 246, 155, 605, 207, 207, 458, 174, -87, -91, -335, -115, -565,
+  530, -117, 594, 224, 243, -251, -317, -125, 151, 69, 35, -2, 472, -126, 638, 221, 233, -203, -232, -18, 95, 61, 15, 66,
+  416, 634, 914, 507, 612, 13, 502, 307, -626, 226, -82, 225, 578, 237, 749, 331, 374, 352, 373, 20, -521, -440, -101, -640,
+  544, -211, 549, 147, 328, 203, -359, -378, 64, 148, 237, -46, 574, 203, 458, 181, 259, 398, -450, -750, -719, 208, 454, -409,
+  580, 99, 544, 167, 205, 248, 12, -397, -396, -645, -23, 316, 368, 211, 553, 162, 143, 252, -222, 302, -253, -8, -640, 73,
+  358, 452, 508, 176, 161, 173, 556, 220, -202, 67, -129, 212, 558, 10, 752, 188, 260, 342, -265, -272, 153, -359, 32, -543,
+  503, -108, 559, 130, 209, -298, -315, -141, 108, 44, 63, 12, 466, -89, 667, 162, 238, -191, -272, -151, 51, 72, 24, 69,
+  65, 397, 653, 364, 421, 606, 6, 134, 162, 560, 425, 439, 328, 275, 680, 311, 371, 115, 556, 111, -654, 154, 20, -177,
+  421, -197, 571, 198, 207, 500, -298, -434, 60, -195, -73, -328, 367, 172, 497, 223, 96, 493, -249, -473, -456, 414, 617, -360,
+  443, 150, 694, 468, 236, 343, -201, -703, -673, -676, 169, 306, 295, -66, 482, 241, 146, 239, -221, 140, -158, 200, -540, -194,
+  204, 419, 571, 232, 206, 359, 407, 136, -302, 106, -307, 456, 500, -62, 611, 247, 279, 373, -257, -320, 87, -387, 193, -495,
+  454, -126, 405, 193, 210, -297, -321, -122, 76, 39, 46, 12, 345, -91, 403, 232, 217, -208, -276, -148, 33, 60, 16, 63,
+  586, 345, 901, 420, 616, 37, 502, 510, -506, 160, -15, 168, 485, -259, 640, 305, 318, 411, -1, -307, -55, -368, -339, -604,
+  338, 23, 564, 196, 247, 551, -127, -117, -185, 505, 721, -190, 392, 219, 635, 220, 209, 365, -433, -807, -888, -285, 118, 15,
+  402, -272, 679, 198, 142, 164, 33, -102, -140, -11, -418, -48, 325, 318, 637, 164, 58, 413, -18, 277, -274, 61, -448, 669,
+  702, 129, 889, 364, 251, 515, 275, -88, -131, -568, -61, -655, 746, -121, 823, 308, 304, -227, -394, -281, 169, 42, 86, 22,
+  551, -106, 689, 245, 228, -307, -315, -115, 88, 38, 50, 8, 523, -61, 750, 281, 262, -202, -265, -126, 47, 59, 14, 70,
+  247, 273, 617, 365, 564, 194, 415, 258, -429, 269, 4, 292, 455, -360, 520, 248, 278, 321, -211, -231, 42, -274, -226, -653,
+  343, -170, 404, 159, 229, 312, -215, -144, -241, 244, 627, -109, 441, 291, 412, 156, 165, 238, -373, -770, -878, -61, 256, -117,
+  392, -206, 397, 184, 82, 120, 97, -237, -233, -390, -123, 148, 208, 119, 397, 82, 78, 457, -112, 362, -355, 13, -681, 494,
+  551, 222, 756, 293, 284, 364, 567, -46, -235, -359, -162, -395, 627, -123, 714, 319, 312, -113, -442, -283, 205, -44, 49, -142,
+  517, -124, 563, 201, 238, -304, -315, -89, 84, 33, 60, 7, 409, -85, 637, 245, 213, -206, -272, -97, 30, 40, 15, 61,
+  107, 525, 514, 473, 387, 398, 84, 261, -177, 580, -16, 447, 334, 693, 726, 332, 339, -79, 515, 205, -783, 90, -83, -107,
+  509, -138, 729, 163, 172, 337, -297, -334, -44, -328, 23, -491, 498, -83, 694, 201, 104, 395, -263, -295, -227, 200, 625, -177,
+  475, 208, 726, 169, 87, 211, -288, -426, -879, -424, 235, 136, 425, -162, 709, 149, 99, -165, 95, 51, -172, -217, -165, -4,
+  273, 199, 676, 169, 114, 508, -309, 389, -138, 237, -625, 470, 405, 261, 783, 316, 318, 390, 558, 104, -329, -202, 46, -236,
+  453, -125, 518, 199, 194, 69, -421, -294, 114, -114, 154, -278, 394, -112, 523, 198, 169, -197, -282, -80, 12, 56, 26, 57,
+  540, 6, 704, 385, 554, 434, 512, 96, -765, -213, 27, -422, 429, -303, 607, 286, 298, 214, -394, -435, 394, -54, -1, -164,
+  350, -18, 385, 193, 156, 480, -233, -265, -786, 534, 565, -312, 520, -120, 295, 226, 158, 364, -96, -512, -467, -734, -7, 280,
+  211, 347, 479, 279, 114, 443, -297, 333, -206, 319, -624, 116, 561, 109, 749, 248, 170, 223, 492, 187, -333, -343, -43, -191,
+  685, -221, 643, 205, 222, -173, -475, -468, 294, -211, 68, -149, 554, -166, 605, 243, 236, -381, -298, -101, 192, 31, 80, 53,
+  468, -158, 480, 193, 197, -314, -300, -78, 122, 37, 59, 3, 409, -122, 541, 194, 192, -209, -255, -82, 71, 53, 23, 62,
+  511, 56, 419, 372, 530, 293, 578, 152, -735, -411, -257, -611, 374, -387, 370, 246, 229, 171, -470, -346, 288, 55, 3, -83,
+  223, 248, 330, 136, 3, 532, -254, -306, -660, 453, 581, -510, 378, 73, 259, 185, 80, 372, -193, -581, -592, -693, -20, 303,
+  308, -144, 264, 223, 62, 41, -95, 238, -248, 227, -410, -197, 288, 491, 729, 200, 98, 305, 217, 274, -300, 96, -350, 600,
+  606, -47, 745, 213, 240, 329, -114, -279, 81, -512, 31, -560, 537, -174, 647, 235, 251, -324, -299, -67, 168, -14, 39, 44,
+  478, -111, 464, 171, 196, -282, -289, -104, 146, 43, 69, 17, 237, -114, 324, 180, 168, -178, -248, 14, 60, 59, 35, 76,
+  541, 167, 506, 241, 500, 115, 569, 382, -699, 53, 53, -31, 395, -359, 246, 198, 194, 397, -269, -254, 70, -276, -158, -618,
+  283, -26, 395, 125, 104, 432, -190, -136, -303, 285, 669, -171, 377, 88, 241, 190, 78, 382, -467, -767, -840, -306, 265, 61,
+  308, -205, 229, 136, -47, 155, 7, 12, -215, -88, -456, 29, 0, 263, 584, 171, 77, 414, 97, 246, -314, -8, -560, 690,
+  361, 138, 608, 264, 324, 445, 273, -194, -195, -511, 45, -626, 480, -150, 535, 265, 257, -276, -381, -239, 139, 65, 14, 21,
+  416, -130, 429, 210, 228, -306, -328, -103, 66, 39, 55, -1, 378, -91, 504, 232, 261, -207, -286, -120, 9, 58, 14, 61,
+  30, 81, 623, 340, 377, 441, 362, 143, -433, 617, 257, 258, 418, -226, 453, 285, 362, 493, -81, -145, -143, -301, -280, -710,
+  383, -58, 389, 161, 193, 332, -147, -123, -169, 287, 603, -90, 430, 309, 384, 193, 180, 441, -485, -671, -901, -294, 298, -97,
+  393, -212, 352, 162, 99, 91, 115, -161, -135, -89, -222, 44, 280, 290, 467, 133, 101, 356, -521, 111, -222, 118, -542, 71,
+  369, 364, 685, 278, 333, 267, 487, 157, -291, -19, -76, 189, 465, -54, 351, 292, 300, 130, -298, -369, 179, -174, 120, -259,
+  447, -106, 333, 229, 226, -289, -306, -56, 99, 50, 49, 5, 386, -69, 316, 214, 250, -202, -256, -51, 51, 61, 13, 54,
+  43, 25, 500, 236, 262, 656, 181, -10, 156, 711, 414, 348, 393, -406, 147, 210, 344, 126, 520, 81, -525, -19, -102, -412,
+  405, -300, 117, 83, 145, 283, -511, -394, 66, -222, 21, -143, 267, 704, 301, 229, 359, 262, -93, 237, -61, -144, 297, 496,
+  459, 755, 270, 493, 636, -94, -124, 147, 19, -148, 232, -233, 511, 607, 317, 331, 389, -370, -305, 76, 115, 16, 29, 23,
+  178, 352, 47, 107, 145, 39, -157, 34, -284, 452, 232, 148, 65, 574, 69, 85, 54, -106, -246, 382, -354, -66, -85, 63,
+  -44, 583, 281, 205, 214, 544, 239, 270, -237, 71, -550, 638, 212, -62, 281, 217, 262, 516, -28, -82, -13, -437, -71, -622,
+  635, -369, 471, 424, 826, 64, 528, 339, -663, -244, -124, -341, 478, -391, 372, 295, 414, 217, -459, -444, 224, -228, -77, -409,
+  208, 378, 398, 252, 310, 291, -341, -2, -110, -141, 266, 497, 515, 925, 517, 455, 574, 34, -229, 73, 93, -123, 138, 1,
+  616, 692, 502, 375, 417, -122, -234, 187, 96, 331, 87, 90, 251, 379, 47, 35, 20, -150, -136, -65, -515, 124, 174, 29,
+  176, 447, 315, 155, 100, -274, -196, 511, -358, -159, -45, 119, 18, 397, 181, 230, 222, 309, 267, 310, -144, -7, -432, 340,
+  264, -116, 325, 269, 409, 437, -245, -145, 56, -308, -109, -617, 380, -158, 233, 247, 446, -179, -255, -65, 41, 55, 20, 96,
+  192, 382, 786, 347, 636, -9, 622, 304, -725, 31, -219, -70, 448, -255, 724, 301, 314, 536, -210, -208, -29, -430, -167, -685,
+  318, -20, 552, 174, 159, 13, -382, -22, -36, -22, 157, 230, 352, 808, 369, 299, 487, 24, -156, 205, -106, -179, 168, 268,
+  641, 596, 495, 508, 533, -270, -187, 246, 55, -108, 73, -107, 419, 342, 387, 247, 315, -12, -172, 153, 23, 334, 173, 63,
+  123, 329, -159, -25, -73, -319, -192, -172, -400, -65, 119, 87, 97, 525, 237, 178, 101, -28, -228, 571, -258, -30, -208, 159,
+  50, 507, 108, 109, 145, 357, 368, 384, -167, 99, -307, 374, 198, -45, 69, 91, 259, 535, -97, 106, -30, -208, -206, -734,
+  -149, 579, 714, 488, 649, 212, 394, 271, -480, 400, 1, 365, 205, 331, 541, 273, 386, 164, 472, 128, -666, -229, -86, -467,
+  298, -190, 494, 169, 254, 151, -418, -371, 32, -133, -6, -367, 179, 232, 430, 182, 267, 147, -478, -53, -13, -122, 124, 489,
+  508, 787, 573, 366, 408, 68, 33, 80, -13, -365, 281, 55, 534, 577, 631, 310, 302, -137, -326, 153, 320, 182, 29, 116,
+  97, 360, -118, 32, 11, 22, -184, 35, -335, 398, 234, 32, 40, 501, -1, 40, -58, -181, -101, 390, -242, -77, -6, 53,
+  -25, 461, 256, 146, 199, 538, 33, 341, -215, 39, -525, 696, 155, 230, 427, 198, 291, 497, 447, 58, -248, -380, 6, -599,
+  -89, 389, 372, 266, 356, 208, 242, 125, -64, 422, -68, 202, 275, 286, 775, 382, 444, 185, 460, 149, -655, -41, 60, -429,
+  408, -165, 750, 202, 262, 115, -475, -297, -78, -145, 2, -223, 233, 794, 537, 302, 353, 210, -316, 140, -74, -181, 154, 523,
+  514, 1013, 690, 538, 607, -110, -86, 212, 83, -159, 184, -168, 358, 610, 489, 276, 237, -19, -228, 143, 135, 304, 93, 114,
+  106, 474, 11, 74, -79, -208, -172, -103, -404, -13, 71, 119, 75, 637, 419, 269, 139, 77, -172, 633, -152, -26, -293, 261,
+  18, 487, 348, 279, 388, 343, 615, 218, -315, 145, -252, 256, 259, -50, 334, 241, 348, 473, -183, -233, -48, -310, 24, -586,
+  63, 586, 583, 365, 326, 425, 61, 287, -153, 592, -107, 504, 115, 441, 649, 323, 270, 1, 485, 155, -694, 50, 31, -305,
+  345, -153, 592, 235, 129, 260, -335, -324, 10, -272, -113, -461, 611, -319, 592, 162, 163, -301, -341, -195, 39, 3, -4, 7,
+  330, 113, 539, 118, 80, 89, -451, 51, -93, -121, 342, 491, 276, 568, 661, 313, 362, 96, 59, 61, 77, -523, 267, -84,
+  228, 445, 394, 258, 228, 165, -225, 131, 230, 572, 178, 102, 47, 578, 82, 100, 4, -44, -33, 62, -416, -26, 99, 55,
+  8, 534, 408, 170, 186, 537, 123, 325, -365, 31, -509, 563, 256, 14, 544, 193, 165, 449, -38, -410, -7, -333, -41, -506,
+  46, 373, 584, 467, 403, 248, -23, 111, 194, 399, 27, 212, 330, 176, 670, 342, 254, 166, 471, 134, -580, 103, -108, -247,
+  380, -239, 746, 246, 109, 240, -357, -320, -18, -79, 131, -232, 201, 251, 482, 222, 150, 356, -449, 232, -362, -392, 128, 365,
+  368, 751, 605, 442, 300, 40, -2, -101, 161, -303, 190, 12, 407, 514, 616, 311, 171, -188, -168, 120, 222, 196, 147, -41,
+  90, 350, 10, 94, -54, -24, -176, 0, -390, 361, 231, 45, 24, 544, 30, 48, -69, -138, -240, 301, -369, -54, 8, 21,
+  -19, 430, 440, 208, 214, 543, 287, 222, -333, 44, -532, 615, 159, -45, 477, 178, 134, 473, -100, -98, -49, -308, 25, -610,
+  386, -168, 529, 241, 289, 262, 521, 178, -593, -366, -227, -467, 211, -37, 393, 183, 1, 418, -709, -388, 40, -241, 67, 341,
+  130, 588, 467, 294, 260, 535, -2, 97, 98, 136, -79, -98, 262, 836, 433, 413, 244, 626, -76, 197, 20, -2, -44, 18,
+  202, 806, 367, 334, 152, 146, -238, 388, 111, 77, -61, 216, 181, 513, 366, 229, 98, 104, 409, 299, -155, 51, 267, 153,
+  -46, 307, 117, 101, 27, 30, -40, 369, -124, 129, 402, -293, 3, 456, 161, 111, 32, 341, -104, 579, -43, -1, -483, 432,
+  148, 61, 413, 184, 185, 580, 344, -181, -135, -353, -192, -523, 243, -132, 376, 190, 139, -159, -288, -16, 57, 75, -11, 53,
+  6, 449, 501, 377, 354, 472, -29, 222, -3, 533, 192, 447, 297, 163, 711, 344, 217, 291, 485, 68, -603, -175, 31, -439,
+  448, -228, 686, 200, 96, 156, -448, -394, 116, -101, -7, -136, 265, -253, 491, 258, 84, 81, -180, 226, 82, 65, -15, 344,
+  177, 382, 391, 258, 214, 174, -76, 301, -123, -440, 164, 262, 447, 276, 673, 373, 318, 465, -38, 59, 263, -22, -86, -112,
+  374, 284, 593, 321, 330, 405, -36, -9, 350, 199, 213, -75, 75, 458, -99, 78, -4, 268, -147, 191, -253, 317, 473, 64,
+  -11, 535, 58, 83, 117, 130, -189, 627, -236, -95, -183, 112, -25, 361, 392, 193, 254, 543, 541, 328, -424, 75, -398, 219,
+  319, 485, 727, 482, 546, 139, 332, 420, -309, 275, -9, 309, 342, -78, 642, 282, 222, 339, 256, -86, -346, -337, -52, -635,
+  377, -187, 736, 204, 177, -119, -459, -132, 19, 45, -18, 113, 218, 672, 552, 355, 280, 197, -105, 146, -8, -291, 185, 422,
+  439, 572, 789, 574, 265, -266, -228, 181, 190, 14, 126, -56, 174, 360, 100, 120, 77, 153, -75, 109, -102, 448, 221, 14,
+  134, 418, 69, 82, -48, -347, -180, 322, -292, -45, 13, 1, 50, 506, 315, 206, 171, 478, 29, 256, -245, 37, -526, 685,
+  221, 79, 305, 140, 192, 303, 505, 246, -197, -160, 133, -542, 339, -82, 272, 207, 164, 36, -388, -233, 30, -30, 10, -151,
+  -251, 357, 8, 113, 259, 245, -117, 30, 260, 326, 212, -35, -497, 807, 214, 390, 563, 95, 357, 114, -69, 257, 123, 543,
+  -521, 768, 161, 343, 430, -215, 554, 279, -2, 127, -93, -63, -578, 599, 210, 328, 473, 18, 499, 366, -189, 291, -94, -225,
+  -604, 875, 214, 321, 383, 289, 92, 125, -128, -190, 11, -721, -380, 601, 202, 230, 217, -143, -505, -52, 54, -143, 42, 240,
+  16, 433, 621, 258, 167, -130, 144, 413, 65, 69, -33, 356, 613, -410, 722, 238, 172, 172, -70, 224, 121, -217, 94, -468,
+  630, -421, 619, 165, 161, -262, -268, 91, 130, 55, 43, 16, 546, -486, 635, 188, 159, -195, -209, 151, 88, 53, 21, 66,
+  -614, 961, 263, 476, 747, -25, 82, 519, -281, -5, -229, 315, -638, 808, 140, 402, 490, -280, 430, 230, -172, 104, -2, 243,
+  -841, 658, 155, 337, 421, -148, 538, 148, -92, 41, -5, 74, -892, 817, 143, 386, 379, -159, 623, 195, 27, 204, -163, -140,
+  -570, 719, 170, 338, 346, -35, 393, 366, -291, 190, 76, -299, -639, 527, 157, 257, 258, 271, -32, 124, -10, -442, -47, -786,
+  -732, 514, 142, 266, 231, -427, -490, -279, 222, -5, 63, 35, -334, 754, 409, 308, 224, 278, -149, 145, 119, 136, 38, 725,
+  185, 471, 491, 252, 224, -91, 357, 574, -98, 69, 63, -16, 537, -293, 822, 166, 202, 320, -90, 352, 54, -241, 28, -481,
+  -325, 69, -309, -66, 63, 105, 40, 130, 290, 369, 1, -229, -485, 759, 173, 395, 475, -92, 105, 243, -125, 372, -34, 347,
+  -655, 885, 153, 341, 418, 10, 530, 256, -164, 69, 155, 157, -685, 964, 98, 323, 436, -275, 573, 392, -20, 110, -121, -65,
+  -680, 913, 85, 306, 292, 37, 304, 422, -196, 67, 210, -434, -690, 639, 106, 223, 193, 34, -266, -19, 89, -290, 29, -586,
+  -609, 581, 100, 215, 229, -213, -445, -70, 209, -2, 129, 331, -152, 620, 309, 274, 160, 129, 212, 359, 4, 201, -6, 535,
+  586, -175, 536, 195, 162, 252, 170, 351, -9, -216, 48, -593, 732, -418, 599, 226, 210, -128, -234, 128, 115, 53, -39, 11,
+  -782, 963, 116, 522, 649, 69, 164, 393, -340, -22, -181, 442, -757, 761, -27, 425, 422, -250, 553, 197, -105, 119, 87, 186,
+  -775, 735, 77, 350, 316, -149, 515, 309, -92, 230, -16, -155, -644, 916, 92, 393, 283, 173, 348, 397, -219, 70, 106, -515,
+  -640, 815, 106, 335, 215, 5, -381, -297, 106, -164, -82, -363, -234, 506, 235, 200, 121, 173, -186, 79, 75, 26, 52, 647,
+  452, 64, 648, 218, 169, -76, 269, 448, -33, -90, 39, -197, 823, -440, 788, 273, 190, -24, -317, -42, 236, -102, 21, -197,
+  730, -372, 608, 218, 155, -305, -241, 95, 150, 43, 55, 6, 670, -417, 666, 217, 160, -206, -193, 147, 112, 59, 11, 64,
+  -347, 335, 53, 425, 460, 97, -149, 119, 303, 233, 65, -32, -615, 482, -504, 396, 363, 44, 91, 172, -105, 372, 21, 484,
+  -712, 464, -596, 278, 297, -115, 599, 223, -177, 93, 78, 61, -741, 457, -567, 319, 342, -53, 555, 404, -83, 275, 11, -210,
+  -700, 463, -578, 303, 201, 423, 119, 20, -116, -317, 2, -791, -678, 348, -412, 240, 147, -326, -458, -239, 219, -73, 66, 62,
+  -29, 395, 393, 254, 166, 130, 9, 236, 68, 184, 72, 615, 713, -90, 861, 246, 155, 231, -107, 90, 110, -296, 80, -481,
+  740, -278, 629, 102, 120, -272, -242, 9, 172, 61, 47, 22, 673, -339, 692, 203, 131, -203, -210, 49, 130, 57, 19, 67,
+  -733, 742, 305, 439, 598, 93, -142, 318, -6, 208, -59, 153, -906, 746, 205, 511, 514, -9, 348, 207, -221, 178, 46, 463,
+  -983, 633, 225, 374, 395, -247, 600, 212, -97, 83, 0, -52, -917, 734, 193, 439, 379, 125, 481, 365, -142, 223, 38, -439,
+  -803, 733, 183, 367, 242, 274, -280, -130, 16, -258, -20, -589, -575, 531, 362, 311, 205, 3, -335, -53, 94, -31, 85, 493,
+  218, 442, 688, 297, 183, -184, 218, 454, 3, 40, 59, 145, 695, -371, 765, 290, 197, 220, -228, -54, 210, -253, 29, -382,
+  670, -380, 633, 229, 187, -287, -241, 61, 166, 57, 48, 15, 588, -405, 690, 264, 197, -208, -189, 106, 131, 54, 12, 68,
+  -649, 590, 480, 495, 687, 62, -156, 264, 188, 187, -480, 116, -1009, 599, 319, 587, 488, 85, 506, -37, 20, 180, 43, 524,
+  -986, 583, 336, 384, 402, 40, 499, 134, 116, 325, 22, -347, -900, 642, 360, 498, 433, 338, 176, 353, -154, -21, 71, -690,
+  -820, 698, 302, 486, 303, -201, -430, -436, 118, -98, 9, -125, -206, 486, 423, 280, 139, 227, -58, 106, 20, 89, -2, 619,
+  720, -147, 780, 232, 162, 171, -105, 57, 132, -355, 52, -449, 715, -406, 736, 222, 208, -345, -253, -24, 228, 66, 40, 68,
+  612, -377, 514, 233, 162, -306, -252, 29, 169, 41, 53, 19, 581, -404, 632, 196, 237, -210, -206, 70, 126, 55, 23, 65,
+  253, 507, 225, 321, 117, -377, 165, -43, 307, -205, -173, -174, -176, 506, 322, 373, 242, 89, -153, 54, 541, 566, 118, 261,
+  -630, 430, 16, 413, 346, 210, 497, 111, -168, 207, 119, 437, -885, 348, -83, 534, 411, -51, 563, 325, 43, 224, -127, -196,
+  -802, 384, -119, 478, 268, 414, 185, 21, -182, -218, 109, -769, -637, 309, -2, 296, 150, 3, -504, -196, 169, -10, 111, 365,
+  311, 206, 505, 243, 103, 10, 270, 385, -49, -92, 20, 56, 721, -289, 761, 240, 175, 92, -268, -122, 287, -148, 31, -219,
+  662, -265, 608, 210, 147, -296, -233, 31, 194, 47, 74, -1, 597, -294, 654, 241, 139, -203, -184, 72, 151, 60, 15, 66,
+  -304, 345, 211, 372, 204, 77, -120, 62, 329, 177, 165, -110, -764, 422, 50, 509, 419, 193, 178, 123, -75, 316, -92, 665,
+  -961, 389, 6, 405, 369, -122, 639, 104, -83, 98, 15, 37, -925, 415, 11, 487, 307, 286, 471, 267, -129, 250, 178, -592,
+  -858, 408, -30, 469, 218, 175, -344, -166, 47, -177, -4, -541, -355, 376, 228, 263, 115, -45, -302, -38, 142, 0, 69, 455,
+  464, 177, 669, 211, 132, -61, 151, 436, 13, -43, 36, 18, 719, -310, 780, 184, 177, 34, -264, -187, 287, -217, 28, -208,
+  661, -289, 661, 200, 171, -293, -237, -73, 204, 59, 46, 16, 612, -292, 712, 189, 206, -197, -181, -48, 187, 62, 5, 72,
+  -244, 480, 45, 330, 403, 61, -170, -81, 349, 213, -8, 8, -900, 402, -180, 494, 459, 167, 303, 105, -131, 278, -68, 633,
+  -978, 404, -217, 371, 386, -180, 634, 85, -20, 96, 37, -7, -959, 371, -154, 396, 349, 22, 528, 287, -73, 314, -29, -291,
+  -895, 476, -172, 467, 256, 340, 144, 140, -110, -258, 125, -739, -709, 272, -89, 230, 205, -186, -478, -326, 201, -101, 140, 144,
+  77, 418, 411, 234, 121, 54, 37, 275, 80, 111, 81, 604, 626, 55, 854, 232, 132, 183, 104, 326, 54, -169, 27, -534,
+  692, -259, 680, 317, 189, -193, -325, -27, 196, 20, -4, -65, 661, -257, 738, 316, 239, -203, -202, 64, 132, 60, 13, 68,
+  -501, 687, 184, 421, 624, 282, -522, -28, -126, -368, 349, 188, -569, 683, 68, 437, 438, -95, -107, -20, 371, -163, -25, 128,
+  -541, 639, 60, 270, 209, -284, -106, 52, 204, 71, -119, -34, -517, 732, 86, 405, 213, 68, -90, -106, 88, 249, 252, -250,
+  -462, 705, 78, 365, 138, -395, -427, -37, -100, 22, -4, 27, -466, 516, 206, 317, 296, 115, -36, -9, 220, -231, -585, 145,
+  -625, 445, 251, 379, 339, 65, 112, -145, 397, 54, 436, -35, -773, 606, 190, 423, 344, 263, -55, -32, 232, 54, -383, 194,
+  -709, 616, 132, 349, 349, 424, -113, 56, 198, 12, 108, -11, -647, 741, 135, 403, 364, 364, 140, -58, 251, 80, 454, -116,
+  -138, 642, 66, 293, 442, 144, -430, -70, 240, -58, 361, -13, -509, 703, -155, 508, 399, 122, -43, -30, 97, -364, -77, 421,
+  -499, 649, -198, 315, 446, -171, 37, -169, 397, -1, -58, -22, -480, 743, -159, 416, 553, 30, 60, -166, 173, 237, 244, -189,
+  -469, 706, -212, 431, 351, -241, -403, -51, -58, 134, 114, -88, -426, 471, -108, 309, 299, -144, -244, 16, 151, -267, -360, 66,
+  -584, 430, -104, 361, 387, 19, 78, -157, 454, -14, 142, 65, -706, 580, -195, 424, 403, 235, -54, -53, 262, 26, -203, 113,
+  -706, 595, -181, 292, 362, 365, -173, 44, 225, 96, 169, -27, -645, 686, -171, 319, 406, 441, 327, -21, 252, 88, 253, 3,
+  -90, 479, -185, 85, 134, -189, -626, -405, 9, -98, 18, -275, -445, 638, -335, 273, 343, 46, -464, -110, -302, -147, 37, 410,
+  -635, 573, -442, 178, 190, 14, -100, -53, 56, -339, 13, 21, -583, 677, -407, 177, 196, -283, -320, -102, 263, -5, -108, 32,
+  -599, 575, -476, 136, 152, -326, -57, -73, 232, 117, 53, -4, -570, 423, -462, 142, 178, -276, -316, -106, 36, 12, 209, -196,
+  -664, 422, -443, 150, 193, -534, -372, -61, 148, -35, 25, 53, -599, 553, -441, 174, 233, 41, -291, -30, 258, -17, -410, 66,
+  -571, 499, -356, 172, 246, 102, 251, 15, 345, 88, 14, 92, -701, 592, -290, 209, 277, 489, -48, 15, 119, 90, -114, 145,
+  -364, -14, -602, -422, -237, 35, -117, -309, 362, -70, 296, -247, -354, 989, 386, 404, 517, 118, -437, -8, -197, -21, 350, 291,
+  -464, 934, 183, 443, 480, 138, -95, 4, -11, -455, -186, 96, -504, 968, 88, 385, 433, -200, -14, -313, 356, -26, -171, 56,
+  -477, 871, 49, 413, 592, -188, 123, -167, 266, 184, 178, -52, -479, 655, 43, 264, 379, -137, -350, 19, -68, 105, 280, -186,
+  -525, 596, 92, 261, 345, -133, -348, 9, 209, -188, -338, 64, -560, 702, 60, 321, 368, 209, 279, -23, 421, -15, -339, 150,
+  -626, 738, -15, 224, 323, 519, 5, -38, 117, 117, -51, 59, -731, 913, -33, 297, 363, 559, 66, 85, 172, 78, 148, -16,
+  -374, 464, 118, 255, 340, 115, -611, -136, -18, -131, 277, -37, -513, 696, -159, 413, 482, 24, -191, -42, -10, -378, 36, 240,
+  -652, 629, -350, 252, 307, -178, -161, -126, 284, -67, -79, -30, -620, 738, -348, 262, 233, -326, -196, -111, 253, 61, -96, 16,
+  -642, 702, -388, 255, 245, -146, -110, -95, 102, 184, 266, -94, -684, 510, -391, 201, 225, -375, -377, -69, 16, -60, -67, -50,
+  -681, 476, -332, 200, 300, 195, -230, -45, 313, -149, -637, 154, -774, 597, -419, 284, 338, 295, 165, -185, 272, 101, 321, -129,
+  -804, 565, -400, 205, 326, 636, 361, -61, 119, 129, 23, 36, -774, 700, -397, 274, 370, 454, 184, 39, 111, 56, -335, 333,
+  -266, -133, -405, -227, -517, -227, -409, -293, 145, -177, -20, -246, -236, 520, 197, 221, 255, -4, -571, -102, -185, -23, 168, 322,
+  -524, 715, 248, 353, 421, 167, -58, -51, -57, -465, -119, 156, -598, 752, 127, 327, 419, -179, -304, -338, 337, -33, -57, 31,
+  -588, 696, 101, 265, 370, -224, -14, -240, 247, 80, 150, 22, -696, 529, 131, 214, 243, -200, -362, -129, -56, 54, 246, -99,
+  -705, 491, 97, 223, 301, -72, -349, -76, 212, 23, -402, 18, -736, 629, 41, 249, 368, 425, 310, -107, 346, 54, -289, 111,
+  -816, 619, 45, 207, 331, 504, -122, -132, 129, 58, -213, 99, -850, 720, 38, 237, 351, 476, -23, -73, 184, 75, 299, -153,
+  12, 300, 1, 90, 79, 134, -25, -71, 200, -244, 387, -340, -437, 799, 301, 474, 612, 293, -491, -155, -355, -427, 213, 438,
+  -487, 687, 141, 336, 447, 129, -119, -228, 125, -419, 60, -19, -481, 816, 95, 330, 543, -98, -130, -262, 269, 132, -160, 56,
+  -468, 753, 108, 296, 393, 26, -348, -145, -189, 285, 228, -127, -457, 517, 259, 257, 396, 245, -197, 21, 120, -142, -715, 203,
+  -818, 515, 487, 417, 394, 464, -56, -244, 86, 0, 51, -19, -842, 632, 386, 430, 430, 577, 55, -163, 123, 24, 46, -8,
+  -777, 701, 321, 352, 368, 540, 77, -81, 96, 25, 74, -73, -734, 718, 368, 366, 427, 587, 147, -204, 27, 94, 215, -152,
+  254, -52, 92, 405, 187, -264, 111, -213, 337, -285, -47, -210, 50, 535, 345, 363, 604, 343, -471, -156, 157, -27, 673, 213,
+  -394, 521, 215, 340, 535, 263, -165, -7, -190, -513, -33, 276, -448, 613, 116, 293, 513, -138, -185, -376, 210, -178, 75, -43,
+  -435, 570, 76, 257, 423, -321, -98, -216, 308, -5, -133, 112, -558, 350, 113, 229, 305, -81, -239, -180, -14, 143, 359, -195,
+  -635, 360, 88, 214, 329, -407, -393, -37, 194, 15, -81, 24, -606, 476, 28, 211, 380, 178, -301, -72, 149, -108, -304, 46,
+  -726, 519, 18, 215, 370, 552, 50, -211, 212, 120, 42, -120, -805, 582, 15, 217, 435, 761, 101, 9, 79, 164, -208, 142,
+  -121, 556, 119, 359, 208, -339, 81, -121, 317, -232, -135, -192, -252, 794, 391, 481, 482, 323, -553, -170, -27, -30, 621, 72,
+  -545, 697, 160, 282, 352, 304, -114, -159, -172, -557, -154, 299, -629, 797, 130, 342, 401, -242, -220, -357, 352, -51, -81, 4,
+  -671, 765, 94, 327, 343, -149, 52, -239, 232, 117, 175, 24, -641, 557, 68, 246, 248, -220, -410, -136, -81, 25, 207, -149,
+  -678, 501, 105, 278, 323, -336, -397, -182, 207, 58, -126, -16, -835, 663, 131, 286, 409, 285, 124, -101, 275, 31, -496, 267,
+  -977, 669, 97, 270, 376, 569, -104, -153, 136, 134, -5, -22, -969, 792, 115, 275, 394, 562, -68, -169, 136, 69, 239, -192,
+  -219, -293, -701, -401, -566, -420, 122, -278, 355, -198, -222, -165, -223, 247, -348, -159, -54, 175, -192, -108, 360, 134, 595, -99,
+  -441, 897, 503, 405, 541, 361, -240, -100, -375, -482, -201, 403, -541, 960, 220, 377, 599, 25, 60, -485, 292, -376, -92, 49,
+  -570, 727, 191, 474, 548, -426, -12, -302, 364, 42, -55, 86, -585, 617, 166, 281, 399, 14, 34, -295, 208, 190, 438, -189,
+  -634, 506, 166, 307, 375, -406, -384, -8, 203, 15, -46, -20, -894, 702, 83, 330, 390, 58, -306, -53, 206, 23, -363, 50,
+  -1005, 714, 66, 283, 351, 581, 246, -183, 212, 126, 147, -36, -974, 840, 90, 313, 348, 732, 226, -164, 12, 86, -10, -38,
+  -200, -48, -467, 82, -33, -109, 245, 189, -81, 82, -124, 8, -280, 65, -599, -102, -123, -320, 169, 400, -347, 252, -85, 1,
+  -168, -16, -452, -141, -190, -99, 244, 480, -270, 57, -43, -111, -78, -50, 134, 35, 110, 623, -229, 384, -395, -522, 387, -355,
+  -118, 181, 421, 119, 84, 184, -14, -160, 263, -253, -204, 97, 66, 153, 286, 44, 136, 393, -98, -368, -647, 521, 478, -359,
+  119, 179, 326, 137, 215, 202, -27, -520, -263, -474, -79, 249, 26, 303, 314, 132, 357, 430, -243, 133, -613, 65, 17, -146,
+  -52, 277, 301, 150, 237, 257, -27, 8, 201, -530, -138, 88, -10, 279, 322, 131, 134, -206, -76, 238, 237, 54, 28, 60,
+  5, 7, -72, 170, 81, 293, -112, -140, 265, 401, 90, 97, -258, -13, -571, -98, -122, -219, 267, 316, -392, 343, -134, 105,
+  -179, 82, -370, -140, -182, -116, 287, 453, -355, 72, 73, -170, -1, -90, 164, 115, 123, 625, -292, 328, -291, -716, 362, -267,
+  -70, 391, 457, 285, 157, -73, -101, -183, 281, -273, -64, 106, 14, 306, 409, 82, 66, 525, -21, -446, -282, 672, 460, -334,
+  155, 211, 404, 161, 296, 180, -183, -480, -612, -581, -53, 271, 46, 132, 239, 150, 223, 246, -43, -48, -105, 456, 71, -397,
+  75, 384, 252, 102, 277, 279, -310, -135, -682, -335, 20, 105, 62, 425, 448, 202, 299, 349, -19, 58, 177, -487, -88, 138,
+  190, -51, -74, 10, 50, -34, 40, 222, 142, 143, -129, 47, -207, -97, -625, -31, -23, -307, 272, 298, -198, 342, -128, 74,
+  -156, 50, -466, -57, -92, -144, 240, 497, -335, 249, -49, -82, -120, -88, -357, -131, -170, -51, 317, 619, -255, -19, -21, -88,
+  -15, -22, 519, 200, 175, 580, -223, 307, -395, -519, 405, -354, -18, 248, 552, 181, 186, -95, -65, -67, 345, -431, -3, 18,
+  34, 261, 484, 148, 235, 425, -45, -244, -274, 712, 529, -7, 13, 435, 542, 219, 282, 230, 26, -133, -585, -559, -180, 302,
+  -1, 316, 313, 139, 211, 233, -8, 333, -153, 388, 62, -304, 22, 495, 673, 280, 508, 545, -116, 136, -638, -610, -192, 188,
+  133, 71, -89, 93, 191, 391, -414, -150, 160, -78, 649, 114, -63, 100, -328, 107, 79, -73, 13, 267, -147, 134, 67, 314,
+  -81, 201, -166, 46, 69, -150, 34, 472, -385, 131, -72, -53, -35, 93, -20, 71, 128, -209, 65, 685, -220, 71, 20, -28,
+  290, -44, 656, 274, 368, 224, -126, 503, -363, -298, 272, -170, 666, 103, 701, 209, 341, 116, -97, -120, 360, -583, 27, 9,
+  530, 217, 346, 185, 242, 403, -22, -426, 126, 675, 305, -288, 512, 138, 320, 155, 267, 288, -295, -219, -723, -346, 177, 330,
+  384, 52, 56, 128, 211, 163, 173, 4, -49, 212, -61, -196, 331, 394, -75, 142, 240, 665, -296, -229, -943, -330, -211, 130,
+  187, 86, 8, 162, 60, 461, -197, 83, 126, 96, 584, 292, -41, 94, -352, 231, 181, -232, 77, 344, -36, 274, -18, 44,
+  14, 134, -133, 118, 175, -196, 64, 497, -251, 128, 21, -56, 143, -80, 515, 221, 269, 247, -185, 527, -318, -158, 313, -266,
+  561, 83, 786, 248, 345, 238, -72, 35, 128, -577, -66, 158, 473, 267, 618, 202, 220, -189, 83, -128, 394, 210, 61, -75,
+  520, 58, 407, 190, 216, 394, -370, -317, -654, 401, 322, -366, 494, 19, 365, 196, 218, 291, 41, -175, -189, -440, -5, 382,
+  418, 139, 55, 174, 175, 497, -264, -22, -539, 217, 36, -303, 312, 341, -79, 149, 211, 396, 155, -201, 177, -442, -229, 252,
+  -233, -181, -636, 61, 66, -333, 346, 592, -323, -115, -294, -95, -117, 34, -528, 40, -158, -407, 275, 369, -206, 218, -32, -3,
+  -87, 77, -413, 5, -173, -122, 282, 492, -270, 140, -56, -56, -30, -27, 7, 29, -111, 420, 211, 404, -341, -127, 553, -461,
+  572, -105, 834, 322, 208, 465, -284, 228, -360, -755, -114, 186, 458, 136, 445, 165, 120, 126, 60, -278, 401, 178, 152, -79,
+  540, 80, 256, 152, 184, 301, -518, -481, -834, 106, 310, -108, 329, -42, 12, 179, 126, 317, 168, -319, 48, -78, -36, 116,
+  382, 284, -35, 130, 95, 608, -363, -337, -798, -174, -108, 33, 248, 379, -102, 172, 62, 109, 116, -66, 335, -219, -93, 145,
+  75, 127, -49, 181, 6, -2, -21, -45, 457, 183, -160, 20, -179, -53, -596, 66, -31, -164, 294, 224, -169, 478, -78, 154,
+  -182, 108, -454, 13, -8, -49, 312, 495, -315, 271, 14, -57, -128, -60, -293, 55, -9, -57, 373, 540, -240, -11, 183, -133,
+  362, -97, 838, 261, 113, 701, -361, 90, -535, -486, 417, -312, 522, 110, 762, 155, 163, 96, -1, -178, 283, -531, -181, 140,
+  392, 176, 568, 118, 107, 488, -168, -569, -288, 685, 437, -395, 345, 89, 479, 108, 56, 264, -83, -289, -435, -487, 14, 419,
+  361, 117, 221, 161, 146, 509, -252, -107, -510, 316, -25, -316, 220, 545, 141, 215, 5, 429, -11, -223, 194, -395, -190, 230,
+  27, 320, -66, 135, -71, 159, 151, 14, 216, 472, -384, -49, -213, 77, -511, 176, 183, -254, 289, 230, -442, 331, -84, 10,
+  -143, 128, -205, 37, -17, -53, 355, 426, -325, 89, 116, -105, 256, 166, 527, 104, 155, 844, -332, -179, -567, -627, 522, -430,
+  533, 106, 671, 213, 164, 309, 8, -251, 121, -644, -292, 251, 489, 135, 387, 114, 87, 483, -68, -651, -278, 560, 463, -465,
+  523, -15, 379, 116, 154, 186, -172, -512, -350, -554, -17, 457, 452, -13, 202, 147, 149, 348, -265, -239, -532, 424, 66, -362,
+  351, 163, 64, 98, 130, 598, -5, -296, -75, -750, -388, 344, 252, 579, -4, 138, 41, -196, -31, 138, 296, 62, 22, 68,
+  116, 282, 63, 84, -180, -94, 93, -36, 446, 143, -112, -134, 21, 257, -140, -20, -147, -14, 198, 232, -259, 547, -81, 238,
+  -132, 169, -373, -6, -150, -72, 288, 437, -451, 218, 73, -42, -27, 87, 60, -31, -189, 507, 251, 332, -360, -120, 485, -550,
+  402, -92, 806, 342, 230, 570, -285, 27, -248, -857, -127, 158, 358, 257, 430, 152, 133, 258, 190, -561, 330, 385, 394, -314,
+  507, 59, 326, 115, 155, 398, -485, -475, -826, -211, 174, 184, 360, 4, 130, 139, 163, 433, 69, -271, 37, 303, -216, -240,
+  355, 140, -37, 118, 142, 659, -357, -495, -630, -525, -126, 314, 176, 186, -50, 98, 60, -51, 81, 7, 395, -92, 27, 96,
+  -50, 19, -330, 58, -5, 98, 74, 214, 156, 291, -158, 92, -255, -163, -754, 108, -34, -257, 278, 293, -132, 397, -134, 65,
+  -259, 65, -477, -39, -34, -66, 290, 456, -334, 217, -66, -62, -157, -74, -321, -83, -147, 176, 328, 422, -245, -82, 148, -260,
+  243, -181, 739, 199, 191, 565, -502, -316, -498, -332, 509, -302, 612, -81, 717, 137, 212, 431, 148, -398, 75, -847, -236, 389,
+  413, 186, 474, 93, 144, 337, 41, -382, 158, 594, 320, -316, 318, 85, 397, 128, 204, 316, -418, -283, -770, -272, 157, 251,
+  275, -35, 258, 105, 87, 280, 162, -74, 6, 55, -61, -91, 310, 32, 86, 55, 194, 716, -192, 167, -419, -558, -290, 158,
+  -133, -299, -679, -515, -235, -232, -83, -418, 352, -307, -485, -132, -42, -81, -674, -535, -270, -455, -10, -190, 604, 150, -28, -4,
+  4, -71, -643, -420, -254, -335, 13, -132, 275, 97, -58, -65, 100, -55, -565, -465, -417, -380, -21, -223, 259, 24, -65, -12,
+  64, -85, -634, -435, -379, -520, 6, -179, 294, -6, -1, 38, 34, -73, -559, -359, -233, -563, 26, -188, 402, -120, 31, -29,
+  -8, -61, -586, -274, -184, -559, -26, -187, 495, -33, 50, 42, -52, -1, -680, -294, -196, -392, 27, -100, 480, 34, 60, 50,
+  -5, 20, -587, -264, -218, -312, 50, -72, 376, 43, 57, 7, -60, 83, -652, -275, -237, -211, 78, -71, 393, 55, 20, 63,
+  -155, -293, -682, -647, -371, -423, -86, -463, 368, -189, -243, -161, -30, -76, -718, -511, -378, -521, -40, -196, 596, 149, -88, 13,
+  -17, 16, -598, -390, -303, -340, 12, -137, 273, 97, -66, -65, 41, -69, -537, -452, -403, -396, -13, -233, 262, 25, -84, -10,
+  21, -95, -617, -503, -381, -524, 20, -183, 298, -5, -5, 39, 35, -84, -610, -315, -236, -565, 42, -190, 409, -120, 27, -29,
+  33, -11, -613, -234, -169, -560, -7, -190, 502, -34, 47, 42, -73, 21, -666, -282, -192, -393, 46, -100, 485, 35, 61, 51,
+  -61, 40, -590, -254, -199, -312, 70, -71, 384, 44, 57, 6, -76, 128, -673, -287, -219, -210, 97, -73, 398, 56, 17, 60,
+  19, -184, -548, -508, -433, -403, 43, -381, 376, -190, -249, -158, 20, -55, -553, -443, -374, -200, 83, -135, 597, 368, -32, -200,
+  98, 31, -345, -217, -86, 45, -60, -29, 182, -31, -206, -50, 130, 46, -233, -197, -130, -149, 132, -54, 220, 64, -85, 83,
+  103, 18, -234, -185, -137, -291, 148, -86, 263, -49, 3, 35, 137, -19, -232, -109, -59, -466, 179, -121, 380, -147, 36, 3,
+  63, 91, -223, -90, -49, -363, 113, -97, 500, -28, 20, -36, 16, 171, -369, -136, -14, -242, 170, -25, 492, 36, 112, 215,
+  -14, 78, -362, -112, -34, -232, 201, 18, 388, 58, 97, 86, -37, 111, -388, -67, -23, -140, 216, 58, 394, 55, 5, -3,
+  -588, -684, -771, -973, -415, -424, 254, -1003, 403, -189, -243, -163, -339, -404, -813, -968, -466, -521, 228, -457, 636, 149, -88, 14,
+  -277, -299, -740, -698, -369, -342, 251, -417, 297, 97, -63, -65, -259, -458, -654, -816, -480, -396, 252, -642, 280, 25, -83, -9,
+  -231, -391, -680, -869, -411, -524, 250, -551, 320, -5, -6, 39, -243, -342, -666, -585, -246, -566, 278, -520, 429, -121, 28, -29,
+  -259, -280, -640, -518, -210, -560, 238, -528, 522, -34, 48, 41, -311, -247, -776, -514, -193, -392, 275, -381, 507, 34, 60, 51,
+  -327, -212, -679, -489, -251, -312, 311, -382, 403, 43, 56, 5, -323, -241, -760, -552, -236, -210, 329, -489, 422, 57, 17, 60,
+  -527, -655, -809, -908, -339, -424, 256, -985, 400, -189, -242, -160, -354, -395, -839, -918, -388, -521, 228, -450, 637, 149, -89, 14,
+  -271, -263, -721, -673, -329, -342, 251, -409, 299, 97, -64, -65, -257, -476, -666, -777, -407, -396, 249, -630, 283, 24, -83, -10,
+  -257, -425, -724, -803, -385, -524, 249, -541, 319, -5, -4, 38, -236, -354, -705, -539, -241, -565, 279, -512, 430, -120, 28, -29,
+  -358, -213, -697, -468, -174, -560, 237, -515, 522, -34, 48, 42, -371, -241, -744, -560, -234, -392, 276, -374, 507, 34, 61, 51,
+  -320, -183, -692, -471, -188, -314, 312, -371, 404, 43, 56, 5, -319, -183, -728, -503, -228, -211, 330, -478, 422, 56, 17, 60,
+  -115, -119, -420, -352, -256, -427, -20, -374, 366, -201, -252, -156, -124, -41, -404, -433, -276, -521, 11, -183, 609, 146, -94, 16,
+  -99, -9, -275, -258, -206, -339, 60, -129, 280, 96, -58, -69, -6, -45, -233, -380, -158, -385, 26, -203, 266, 30, -82, -12,
+  58, -38, -313, -326, -268, -521, 62, -165, 302, -6, -5, 41, 37, -52, -301, -248, -164, -560, 86, -174, 413, -122, 26, -29,
+  -13, -34, -315, -190, -110, -557, 38, -174, 509, -33, 48, 41, -66, 28, -354, -202, -115, -391, 90, -88, 493, 34, 58, 51,
+  -71, 95, -322, -212, -105, -309, 116, -58, 389, 42, 54, 9, -125, 104, -375, -218, -140, -211, 142, -54, 407, 55, 18, 63,
+  -223, -302, -482, -414, -416, -357, 156, -609, 399, -260, -256, -91, -133, -131, -512, -409, -452, -518, 157, -206, 624, 147, -90, 12,
+  -69, -84, -421, -354, -404, -338, 187, -151, 290, 95, -68, -64, -8, -158, -355, -309, -464, -395, 184, -253, 275, 23, -88, -8,
+  -19, -125, -380, -382, -468, -522, 191, -209, 312, -6, -6, 39, -8, -127, -370, -237, -255, -562, 223, -211, 424, -121, 29, -32,
+  -96, -85, -353, -206, -215, -556, 177, -216, 518, -32, 51, 42, -66, -22, -459, -204, -223, -391, 219, -119, 502, 35, 60, 51,
+  -149, 9, -406, -190, -228, -311, 252, -92, 397, 43, 57, 7, -127, 71, -441, -222, -245, -209, 272, -101, 417, 56, 16, 63,
+  -411, -766, -817, -734, -717, -424, 283, -988, 396, -190, -241, -163, -200, -557, -824, -719, -634, -522, 252, -451, 629, 148, -90, 14,
+  -195, -318, -744, -557, -583, -341, 271, -412, 293, 95, -64, -65, -179, -468, -636, -639, -762, -396, 276, -636, 277, 25, -82, -10,
+  -108, -427, -741, -659, -676, -523, 272, -546, 315, -5, -5, 40, -144, -329, -652, -443, -430, -564, 301, -515, 425, -121, 28, -30,
+  -197, -280, -678, -396, -394, -560, 262, -517, 518, -34, 49, 42, -214, -266, -769, -412, -396, -392, 296, -374, 504, 34, 61, 52,
+  -249, -210, -654, -377, -396, -313, 333, -374, 399, 41, 55, 7, -250, -212, -746, -419, -430, -211, 354, -481, 415, 55, 18, 63,
+  18, -428, -333, -247, -251, -421, -328, -379, 240, -189, -241, -160, 52, -200, -339, -246, -270, -519, -228, -154, 450, 149, -88, 13,
+  54, -104, -300, -178, -283, -339, -156, -93, 181, 96, -64, -64, 128, -168, -264, -224, -312, -395, -195, -170, 193, 23, -83, -9,
+  105, -179, -254, -198, -300, -519, -141, -129, 221, -5, -1, 41, 149, -198, -224, -128, -195, -562, -123, -141, 324, -120, 26, -29,
+  125, -138, -230, -76, -152, -559, -178, -140, 415, -33, 47, 42, 123, -99, -361, -71, -124, -392, -115, -55, 400, 35, 61, 51,
+  59, -11, -300, -88, -192, -312, -99, -20, 310, 43, 57, 6, 10, -2, -337, -73, -157, -210, -66, -7, 302, 57, 17, 61,
+  -122, -466, -415, -281, -380, -420, 88, 318, 154, -191, -242, -163, -37, -280, -422, -385, -395, -516, 94, 188, 344, 150, -86, 13,
+  -30, -132, -360, -260, -383, -333, 135, 273, 116, 96, -57, -64, 53, -247, -316, -236, -422, -389, 115, 373, 142, 27, -74, -7,
+  73, -267, -299, -284, -391, -513, 129, 356, 164, -9, -13, 40, 50, -253, -302, -178, -239, -543, 165, 288, 265, -115, 13, -43,
+  42, -178, -275, -129, -215, -555, 106, 307, 349, -34, 52, 41, -34, -112, -348, -166, -215, -389, 156, 309, 338, 32, 68, 56,
+  -87, -99, -350, -120, -186, -299, 187, 374, 260, 37, 55, 5, -62, -42, -371, -162, -206, -210, 208, 521, 243, 52, 20, 62,
+  44, -158, -589, -523, -574, -426, 227, -488, 383, -191, -240, -163, 22, 3, -606, -504, -575, -510, 207, -212, 621, 159, -88, 18,
+  38, 64, -478, -265, -358, -196, 223, -70, 275, 200, -2, 33, 115, 100, -372, -205, -363, -349, 233, -80, 238, 19, -57, 6,
+  155, 95, -380, -289, -272, -471, 203, -61, 288, -20, 6, -24, 160, 54, -374, -146, -205, -516, 213, -103, 407, -144, 31, -89,
+  149, 83, -346, -156, -180, -425, 49, -133, 500, -48, 188, 4, 36, 152, -440, -146, -154, -370, 39, -62, 477, 33, 75, 56,
+  21, 147, -394, -117, -108, -312, 69, -27, 376, 42, 58, 8, -1, 269, -458, -142, -131, -211, 95, -16, 389, 55, 21, 62,
+  49, -120, -371, -256, -91, -423, -513, -394, 48, -189, -240, -159, 121, -21, -419, -243, -128, -522, -373, -159, 230, 148, -89, 14,
+  114, 131, -334, -151, -62, -342, -288, -99, 43, 96, -63, -65, 152, 28, -271, -204, -120, -396, -340, -176, 85, 24, -82, -10,
+  180, 58, -297, -223, -145, -524, -269, -135, 110, -5, -4, 39, 183, 49, -288, -114, -63, -565, -254, -146, 198, -122, 29, -29,
+  183, 48, -298, -67, 5, -560, -313, -144, 295, -34, 48, 41, 71, 139, -362, -82, -7, -393, -243, -61, 276, 34, 62, 50,
+  72, 147, -319, -76, -24, -313, -236, -28, 198, 43, 56, 5, 20, 233, -361, -67, -31, -212, -194, -14, 166, 56, 18, 61,
+  29, 142, -307, -331, -399, -421, 121, -504, 400, -191, -231, -166, -8, 156, -325, -298, -458, -522, 121, -215, 633, 148, -87, 12,
+  41, 235, -286, -197, -351, -340, 155, -158, 296, 94, -62, -67, 144, 225, -233, -243, -458, -397, 143, -267, 278, 24, -84, -8,
+  128, 174, -258, -283, -407, -523, 155, -214, 318, -6, -5, 39, 126, 119, -241, -150, -279, -564, 182, -219, 427, -122, 29, -30,
+  72, 187, -257, -128, -215, -558, 137, -217, 520, -33, 48, 44, -4, 261, -285, -114, -204, -393, 182, -123, 505, 34, 59, 52,
+  -12, 254, -290, -125, -257, -313, 214, -96, 403, 42, 57, 6, -26, 369, -313, -139, -211, -210, 234, -108, 419, 56, 20, 63,
+  24, 22, -345, -290, -375, -418, 19, -74, 305, -185, -237, -168, 24, 123, -341, -312, -372, -522, 43, -5, 526, 148, -90, 14,
+  52, 179, -278, -237, -322, -342, 87, 67, 228, 94, -66, -64, 112, 165, -254, -252, -409, -398, 73, 64, 228, 24, -84, -10,
+  106, 131, -250, -299, -374, -524, 92, 78, 260, -5, -4, 38, 151, 88, -215, -197, -230, -565, 117, 46, 367, -121, 29, -30,
+  75, 131, -247, -137, -177, -560, 69, 49, 462, -35, 51, 47, 56, 207, -310, -146, -187, -392, 121, 102, 447, 34, 59, 48,
+  -7, 234, -262, -140, -193, -311, 147, 152, 348, 43, 56, 7, -36, 290, -287, -185, -206, -211, 174, 223, 353, 57, 17, 61,
+  49, 44, -378, -316, -311, -428, -6, 752, -408, -202, -233, -156, 40, 46, -317, -309, -384, -523, 37, 399, -271, 123, -77, 24,
+  -16, 139, -307, -181, -288, -325, 91, 498, -246, 112, -77, -74, 152, 161, -258, -258, -351, -372, 44, 700, -175, 48, -93, -25,
+  154, 130, -278, -271, -347, -525, 67, 645, -166, -8, -2, 42, 140, 40, -269, -174, -190, -564, 104, 556, -101, -128, 36, -13,
+  76, 110, -276, -140, -171, -546, 69, 567, 2, -28, 54, 60, 32, 164, -317, -149, -136, -395, 122, 541, -27, 28, 60, 43,
+  28, 203, -288, -135, -161, -310, 146, 634, -65, 42, 56, 4, 1, 278, -312, -154, -182, -210, 170, 871, -162, 56, 19, 62,
+  31, 109, -48, 8, -19, -424, 20, -167, 330, -189, -241, -161, 60, 242, -104, -55, -145, -521, 46, -49, 556, 149, -88, 14,
+  79, 263, -35, 0, -146, -342, 85, 18, 250, 97, -64, -65, 168, 276, -18, -6, -143, -397, 71, -3, 243, 25, -82, -10,
+  215, 225, 53, -12, -136, -524, 93, 21, 275, -5, -5, 39, 216, 173, -11, 40, -71, -565, 117, -8, 384, -121, 27, -29,
+  176, 174, 13, 50, -11, -560, 71, -6, 476, -34, 48, 41, 103, 271, -51, 50, -16, -393, 118, 56, 458, 35, 61, 50,
+  29, 305, -69, 71, -21, -313, 145, 103, 360, 43, 57, 6, 11, 379, -66, 25, -37, -211, 170, 159, 370, 56, 17, 61,
+  32, -370, -649, -355, -141, -424, 266, -529, 382, -189, -239, -161, -28, -139, -665, -439, -230, -521, 235, -225, 611, 149, -89, 14,
+  15, -150, -588, -315, -99, -342, 259, -172, 282, 97, -64, -65, 158, -162, -544, -327, -193, -397, 261, -284, 270, 24, -82, -10,
+  112, -131, -560, -376, -196, -524, 258, -232, 307, -6, -4, 40, 115, -155, -551, -260, -114, -565, 286, -233, 416, -122, 29, -30,
+  107, -61, -561, -186, -40, -560, 243, -235, 509, -34, 48, 42, 53, -28, -621, -205, -55, -393, 281, -136, 495, 34, 61, 51,
+  18, -8, -557, -168, -86, -314, 316, -111, 393, 42, 56, 5, -39, 32, -636, -222, -76, -212, 336, -124, 407, 55, 17, 60,
+  -20, -206, -421, -294, -245, -426, 106, 753, -558, -192, -239, -158, -3, -48, -479, -281, -278, -524, 114, 400, -459, 146, -89, 14,
+  42, 5, -401, -164, -283, -336, 151, 498, -385, 100, -68, -67, 108, -5, -355, -242, -305, -398, 135, 700, -251, 23, -83, -10,
+  133, -6, -387, -219, -326, -523, 149, 650, -248, -4, -4, 40, 137, -26, -368, -111, -203, -563, 176, 553, -192, -120, 27, -29,
+  83, -25, -370, -92, -119, -560, 130, 563, -91, -33, 48, 43, 22, 57, -428, -83, -154, -390, 175, 535, -121, 36, 62, 52,
+  -5, 103, -385, -171, -150, -313, 207, 629, -155, 42, 58, 7, 2, 145, -434, -115, -161, -210, 231, 868, -268, 57, 19, 61,
+  9, 265, -223, -264, -381, -424, 23, -21, 289, -192, -243, -158, -16, 253, -231, -264, -391, -522, 52, 21, 507, 148, -90, 14,
+  30, 325, -186, -207, -316, -339, 94, 95, 217, 98, -67, -65, 109, 317, -166, -234, -405, -396, 81, 108, 220, 24, -82, -10,
+  100, 328, -175, -205, -384, -524, 101, 119, 252, -5, -5, 40, 44, 239, -122, -154, -240, -564, 126, 81, 356, -121, 28, -30,
+  26, 229, -146, -116, -191, -560, 80, 85, 451, -34, 49, 42, -5, 279, -176, -86, -198, -392, 127, 132, 434, 34, 61, 51,
+  38, 357, -265, -130, -206, -312, 152, 183, 339, 43, 58, 5, -55, 430, -212, -95, -238, -211, 179, 270, 341, 55, 16, 62,
+  92, 3, -110, -192, -515, -424, 303, -195, 309, -192, -236, -163, 47, 76, -164, -202, -511, -521, 263, -62, 529, 145, -84, 13,
+  100, 146, -83, -160, -438, -342, 283, 3, 231, 93, -65, -65, 141, 127, -74, -177, -601, -394, 283, -28, 232, 26, -82, -11,
+  174, 166, -74, -174, -501, -522, 277, -6, 266, -7, -4, 39, 192, 24, -119, -130, -280, -565, 309, -32, 372, -123, 29, -30,
+  165, 56, -17, -64, -271, -556, 268, -28, 466, -33, 49, 41, 52, 177, -133, -91, -308, -390, 303, 32, 444, 37, 59, 53,
+  19, 170, -411, -206, -342, -284, 344, 41, 350, -5, 61, 26, -28, 200, -538, -247, -391, -211, 372, 40, 373, 54, 17, 64,
+  45, -411, -99, 97, 120, -135, -143, -65, 307, -162, 88, -200, -182, -388, -325, 99, 265, 234, -311, 136, -215, 124, 497, 417,
+  -577, -495, -793, 153, 391, -150, 115, 467, -227, -8, -59, 110, -573, -691, -804, 143, 526, -361, 150, 692, -95, 15, -92, 4,
+  -599, -709, -828, 110, 422, -234, 194, 674, -78, 42, -284, 117, -610, -496, 114, 143, 244, 22, 243, 487, -143, -362, -305, -374,
+  -919, -378, 536, 279, 210, 95, 60, -278, 489, -466, -289, -178, -921, -379, 335, 285, 219, -381, 168, -252, 522, 29, 71, 65,
+  -845, -331, 340, 216, 206, -305, 196, -228, 410, 45, 55, 6, -813, -342, 301, 234, 196, -199, 219, -286, 434, 70, 21, 71,
+  -6, -429, -54, 72, 29, 214, -667, -191, -217, -151, 419, 113, -511, -443, -660, 158, 327, -151, -121, 242, -275, -28, -56, 331,
+  -648, -476, -846, 125, 275, -243, 88, 474, -233, 56, -73, 16, -657, -664, -802, 149, 363, -302, 56, 676, -101, 14, -79, -6,
+  -654, -656, -876, 190, 289, -457, 101, 637, -70, -10, -44, 56, -621, -602, -796, 116, 199, -165, 243, 556, -69, -35, -332, 105,
+  -696, -389, -130, 168, 173, 91, 155, 494, -4, -383, -201, -358, -805, -313, 297, 203, 148, 199, 88, -462, 480, -424, -216, -244,
+  -808, -263, 142, 158, 86, -303, 162, -457, 408, 40, 48, 16, -772, -239, 153, 145, 100, -209, 194, -608, 419, 45, 16, 77,
+  -181, -758, -79, 325, 503, -82, -388, 222, -655, -344, -71, 221, -403, -610, -541, 332, 437, -368, 8, 324, -422, 83, -115, 145,
+  -362, -538, -876, 238, 355, -289, 71, 476, -358, 37, -77, -24, -431, -680, -802, 204, 382, -397, 75, 716, -205, 18, -88, -12,
+  -405, -687, -899, 171, 324, -229, 76, 693, -184, 49, -232, 217, -352, -525, -396, 161, 222, -207, 410, 427, -318, -132, -198, 9,
+  -576, -292, 245, 181, 160, 541, 150, 156, 123, -876, -403, -394, -823, -189, 259, 195, 126, -291, 194, -490, 569, -29, 48, 18,
+  -815, -148, 102, 128, 94, -309, 241, -415, 405, 36, 52, 14, -737, -213, 139, 132, 75, -203, 263, -534, 432, 63, 18, 70,
+  -28, -415, -275, -29, 141, 244, -642, 8, -276, 49, 466, -10, -210, -538, -692, 87, 381, -143, -161, 182, -596, 61, 85, 328,
+  -382, -484, -845, 75, 317, -196, 138, 480, -403, 27, -67, 41, -376, -758, -846, 91, 400, -252, 79, 708, -266, -8, -65, 15,
+  -376, -648, -880, 86, 327, -298, 135, 660, -240, 17, -116, 149, -378, -576, -715, 92, 267, -235, 385, 493, -296, -117, -244, 74,
+  -540, -313, -66, 87, 202, 603, 156, 210, 63, -900, -524, -350, -963, -280, 263, 100, 170, -164, 345, -594, 557, -81, -22, -7,
+  -907, -282, 174, 113, 112, -297, 348, -474, 390, 38, 58, 29, -863, -258, 110, 86, 192, -201, 371, -614, 397, 63, 20, 64,
+  252, -395, -21, 53, -77, -173, -339, -291, 189, -164, 46, -239, 80, -242, -134, 87, 52, 306, -551, -129, -302, -124, 590, 332,
+  -495, -466, -634, 177, 318, -63, -38, 359, -261, -74, -17, 166, -508, -741, -753, 208, 450, -266, 8, 661, -125, 31, -105, 21,
+  -555, -707, -844, 220, 399, -330, 10, 663, -179, -8, -63, 88, -487, -566, -250, 199, 261, 60, 278, 520, -317, 20, -460, 177,
+  -657, -316, 404, 148, 136, 608, 145, 168, 57, -827, -656, -305, -881, -374, 350, 175, 125, -281, 296, -533, 583, -3, 65, 47,
+  -841, -327, 194, 108, 87, -305, 317, -413, 398, 42, 58, 20, -785, -293, 182, 82, 111, -203, 333, -541, 421, 63, 20, 68,
+  82, -225, 6, 40, 19, -185, -373, -329, 215, -99, 24, -216, 23, -229, -164, 17, -1, 250, -423, 39, -307, 131, 616, 300,
+  -360, -515, -710, 71, 260, -101, -26, 387, -373, -54, 4, 160, -421, -708, -792, 125, 394, -262, 66, 675, -191, -24, -79, 48,
+  -402, -661, -862, 135, 341, -417, 77, 634, -220, 2, -2, 31, -421, -605, -830, 110, 268, -461, 128, 566, -151, -144, 26, -16,
+  -442, -448, -727, 112, 272, 10, 173, 542, -104, 140, -341, 354, -426, -385, -3, 172, 166, 162, 301, 417, -252, -371, -276, -208,
+  -589, -256, 8, 132, 157, 459, 235, -327, 271, -648, -331, -314, -761, -180, 16, 72, 121, -197, 270, -601, 435, 52, 23, 72,
+  162, -64, -173, -5, 140, 118, -698, -199, -346, -119, 340, 12, -277, -342, -292, -82, -70, -216, -219, 187, -551, 65, 110, 248,
+  -515, -461, -556, -74, -34, -216, -22, 454, -414, 57, -52, 42, -527, -701, -712, -79, 47, -273, 51, 687, -231, 12, -81, 8,
+  -505, -708, -809, -96, 93, -377, 43, 616, -275, -21, -19, 72, -481, -558, -777, -46, 110, -452, 85, 509, -211, -110, 32, -44,
+  -575, -451, -759, -16, 127, -219, 90, 580, -90, 20, -217, 220, -575, -321, -82, 77, 199, 164, 202, 469, -182, -230, -417, -112,
+  -738, -302, 704, 328, 393, 456, 173, -209, 294, -614, -445, -206, -819, -306, 870, 509, 447, -184, 291, -476, 439, 68, 28, 80,
+  17, 151, -288, -26, -60, 295, -662, -50, -359, -94, 525, 68, -94, 63, -791, 90, 339, -113, -77, 241, -334, 15, -109, 385,
+  -254, 97, -787, 202, 399, -218, 110, 482, -272, 77, -40, -33, -274, -98, -696, 172, 389, -267, 115, 712, -157, 41, -64, -19,
+  -239, -65, -749, 78, 293, -371, 86, 681, -176, -26, -59, 83, -275, -104, -251, 86, 252, -35, 280, 557, -227, -52, -442, 42,
+  -630, -178, 384, 150, 199, 510, 160, -24, 174, -806, -532, -301, -877, -300, 301, 170, 168, -361, 172, -472, 552, 31, 73, 45,
+  -801, -235, 188, 135, 129, -300, 209, -390, 411, 49, 51, 12, -751, -202, 177, 128, 127, -202, 238, -499, 428, 63, 20, 74,
+  -40, -163, -204, -35, 63, -313, -512, -364, 45, -184, -143, -234, -73, -21, -217, -19, 118, -8, -544, -161, -29, 108, 367, 157,
+  -293, -217, -630, 65, 320, 115, -139, 215, -331, -209, 97, 306, -369, -564, -754, 84, 408, -244, 11, 640, -106, 2, -97, 62,
+  -370, -562, -794, 43, 337, -376, 64, 608, -96, 19, -13, 43, -366, -483, -731, 83, 261, -420, 68, 531, -62, -137, -12, 3,
+  -432, -362, -694, 70, 254, -195, 121, 588, 40, 58, -256, 155, -507, -160, 283, 139, 242, 340, 212, 431, -55, -395, -469, -279,
+  -787, -223, 340, 177, 220, 141, 224, -447, 429, -289, -198, -194, -758, -231, 383, 188, 201, -206, 247, -416, 435, 56, 14, 69,
+  290, 35, -51, -79, -117, -423, -200, -256, 287, -189, -240, -162, 123, 170, -32, 17, -191, -520, -127, -92, 505, 147, -86, 10,
+  175, 158, -18, 43, -81, -34, -159, -31, 204, 190, 288, -40, 11, -157, -307, 66, 275, 238, -261, 292, -206, -122, 430, 400,
+  -386, -550, -804, 60, 238, -317, 110, 613, -201, -7, -51, 137, -462, -492, -806, 48, 191, -380, 104, 546, -101, -146, -62, 28,
+  -525, -359, -230, 135, 247, 36, 211, 571, -134, -68, -459, 49, -719, -230, 380, 210, 246, 488, 168, -81, 224, -626, -515, -361,
+  -882, -268, 317, 136, 159, -286, 221, -418, 441, 27, 73, 22, -822, -268, 279, 146, 173, -206, 243, -474, 432, 59, 8, 69,
+  -174, -469, -760, -661, -892, 221, -400, -139, 52, -263, 410, 56, -223, -416, -853, -817, -813, -199, -223, -55, 270, -84, 24, 203,
+  -243, -316, -773, -662, -765, -95, -160, 295, -97, 320, -62, 31, -225, -520, -695, -752, -973, -237, -159, 495, -33, -126, -116, 99,
+  -218, -492, -755, -764, -874, -84, -28, 372, 6, 249, 246, -25, -234, -380, -747, -472, -539, 7, -239, -103, -484, 282, 140, -256,
+  -304, -342, -750, -401, -475, -536, -291, -215, -379, -31, 38, 50, -318, -290, -833, -419, -520, -19, -283, -92, -364, 35, -313, 222,
+  -172, -58, -653, -239, -367, 323, 57, 108, 197, -222, -532, 204, -60, 142, -390, -146, -301, -30, 242, 246, 371, 155, -25, 74,
+  -63, -543, -763, -632, -962, -422, 154, -109, 318, -189, -238, -162, -73, -370, -764, -653, -936, -10, -58, -17, 563, 128, 406, 110,
+  -136, -301, -726, -558, -782, 246, -131, 40, 72, -142, 450, 272, -90, -482, -694, -669, -890, -233, -241, 209, 76, 137, -50, 71,
+  -95, -460, -701, -713, -826, -339, -60, 598, -84, 17, -48, 105, -105, -371, -678, -480, -545, -197, 33, 286, 130, -30, 217, -88,
+  -279, -335, -727, -453, -480, 29, -300, -64, -368, 347, 249, -169, -303, -285, -783, -459, -537, 72, -272, 29, -309, 95, -406, 244,
+  -163, -129, -653, -282, -465, 354, 196, 217, 115, -186, -483, 296, -51, -28, -622, -255, -439, -30, 280, 313, 372, 102, 103, 24,
+  32, -530, -723, -604, -939, -422, 151, -5, 289, -190, -232, -165, -16, -340, -742, -640, -995, -246, 19, 3, 566, 131, 174, 12,
+  -104, -258, -696, -513, -764, 430, -217, 95, 6, -216, 571, 261, -141, -400, -609, -647, -978, -241, -178, 69, 144, 15, -66, 47,
+  -144, -462, -691, -689, -880, -315, -86, 446, 4, 92, -123, 66, -168, -393, -688, -449, -558, -319, 48, 263, 222, -246, 26, 123,
+  -233, -285, -678, -379, -488, 411, -142, 44, 32, 633, 448, -360, -319, -260, -772, -424, -527, -271, -324, -200, -399, 79, 59, 19,
+  -316, -198, -659, -356, -505, 72, -323, -56, -244, 48, -339, 140, -196, -128, -729, -324, -548, 427, 72, 180, 226, 36, -711, 191,
+  -191, -661, -762, -720, -970, 263, -377, -99, 155, -391, 309, 408, -232, -409, -800, -741, -836, -355, -141, -9, 437, 195, -38, 89,
+  -228, -291, -745, -552, -787, -195, -84, 374, -70, 136, -115, -55, -217, -478, -643, -663, -952, 41, -30, 291, 73, 189, 230, -22,
+  -223, -431, -721, -670, -840, 47, -353, -60, -391, 347, 147, -260, -218, -420, -684, -446, -581, -545, -308, -138, -333, -120, 29, -31,
+  -321, -332, -704, -391, -486, -545, -373, -134, -236, -26, 41, 41, -321, -279, -823, -434, -581, -382, -300, -55, -267, 35, 60, 50,
+  -253, -233, -692, -361, -541, -221, -302, -28, -269, 77, -35, 27, -186, -94, -745, -308, -542, 115, -268, 54, -143, 0, -357, 108,
+  -349, -570, -848, -665, -914, 196, -230, 40, 118, -358, 278, 430, -321, -469, -840, -728, -808, -403, -125, 133, 310, 230, -107, 10,
+  -249, -329, -753, -543, -723, -151, -26, 419, -107, 219, -46, -48, -132, -446, -665, -648, -978, -351, -89, 548, -16, -7, -98, -41,
+  -187, -369, -715, -711, -825, -36, 68, 325, 135, -66, 185, 177, -237, -345, -706, -458, -567, 188, -331, -274, -394, 314, 290, -444,
+  -320, -271, -725, -358, -539, -537, -374, -258, -246, -42, 29, 52, -282, -218, -773, -398, -577, -378, -313, -151, -282, 42, 59, 60,
+  -309, -263, -670, -367, -512, -306, -306, -121, -296, 49, 57, 12, -349, -203, -725, -439, -611, -207, -259, -135, -451, 52, 23, 60,
+  -244, -580, -694, -697, -875, -25, -285, 69, 106, -366, 95, 128, -155, -363, -631, -755, -811, -442, -180, 125, 297, 179, -13, 43,
+  -113, -116, -480, -502, -561, -91, -103, 325, -55, 291, 89, 73, -84, -259, -466, -573, -687, -353, -42, 639, -123, 8, -102, -10,
+  -49, -244, -504, -645, -732, -206, -48, 510, -1, -329, -93, 44, -129, -327, -542, -457, -463, -8, 76, 59, 281, 107, 319, -70,
+  -194, -239, -596, -385, -445, 46, -380, -176, -326, 354, 282, -240, -269, -157, -658, -434, -460, -362, -273, -95, -331, 35, 57, 60,
+  -265, -169, -611, -368, -451, -306, -274, -65, -340, 44, 50, 11, -262, -156, -655, -423, -520, -200, -233, -48, -485, 55, 8, 69,
+  52, -572, -555, -595, -774, 156, -229, 17, 141, -369, 154, 477, -14, -357, -610, -720, -840, -440, -85, 122, 363, 163, -11, 23,
+  0, -268, -563, -529, -739, -105, -80, 284, 42, 292, 93, 41, 54, -450, -478, -637, -943, -257, -10, 686, -156, 79, -49, 13,
+  36, -434, -551, -672, -856, -263, 19, 525, 11, -212, 24, 135, -35, -394, -526, -446, -514, 160, -8, 234, 14, 292, 319, -401,
+  -190, -302, -548, -387, -468, -299, -445, -258, -309, 127, 73, -115, -214, -264, -622, -449, -473, -384, -313, -163, -274, 35, 55, 53,
+  -207, -220, -562, -352, -477, -296, -312, -132, -288, 50, 50, 12, -193, -224, -614, -407, -549, -205, -269, -155, -434, 58, 18, 66,
+  -102, -538, -655, -576, -850, -423, 54, -100, 317, -189, -244, -163, -98, -323, -655, -560, -788, -233, -22, 6, 550, 199, 195, 30,
+  -273, -272, -584, -359, -649, 179, -24, 76, 127, 8, 243, 393, -298, -451, -521, -601, -871, -133, -5, 304, 125, 217, 98, 30,
+  -278, -421, -560, -657, -765, -408, -2, 634, -85, 16, -23, 24, -253, -332, -589, -401, -438, -245, 3, 391, 149, -367, -176, 15,
+  -306, -249, -588, -317, -362, 52, 216, 50, 416, 172, 342, 176, -224, -164, -635, -389, -446, 361, -327, -114, -229, 565, 312, -442,
+  -253, -138, -547, -311, -484, -295, -321, -144, -267, 33, 51, 12, -256, -105, -671, -370, -531, -205, -278, -173, -407, 62, 14, 66,
+  -159, -603, -721, -593, -905, -128, -108, -213, 393, -161, 17, 22, -74, -370, -758, -664, -831, 107, 40, -45, 477, 56, 227, 537,
+  -48, -328, -729, -569, -721, -137, 84, 64, 226, 237, 58, 6, -85, -558, -646, -665, -919, -182, -15, 571, -7, 178, -62, -23,
+  -86, -476, -670, -701, -787, -161, -7, 393, 122, -311, -163, 98, -117, -354, -634, -405, -464, 293, 143, -36, 269, 344, 503, -40,
+  -220, -232, -613, -350, -444, -66, -448, -197, -283, 292, 95, -231, -223, -244, -720, -392, -460, -381, -315, -108, -237, 33, 58, 46,
+  -213, -212, -637, -349, -451, -306, -319, -97, -256, 46, 52, 9, -228, -207, -734, -376, -490, -203, -276, -95, -398, 62, 18, 60,
+  129, -490, -679, -580, -788, -427, 66, -189, 339, -192, -243, -163, 61, -235, -685, -551, -742, -467, 58, -62, 586, 156, -31, 26,
+  103, -101, -609, -408, -693, 397, -76, 48, 211, 36, 464, 496, 245, -245, -550, -581, -844, -20, 85, 18, 177, 220, 25, 31,
+  312, -312, -624, -646, -692, -100, 78, 386, 142, -213, 9, 197, 259, -274, -574, -403, -436, 369, -204, -204, -188, 373, 451, -428,
+  173, -212, -598, -352, -389, -181, -452, -159, -137, 26, -248, 174, 86, -113, -594, -318, -408, 270, 233, 110, 253, 9, -407, 269,
+  51, 79, -517, -230, -383, -252, 268, 179, 349, 45, 112, -18, 57, 160, -537, -300, -428, -207, 299, 263, 337, 58, 15, 58,
+  280, -67, 433, 228, 273, 157, 12, 72, 229, 114, -31, 147, 336, 90, 982, 591, 540, -179, 293, 144, 36, 19, -181, 255,
+  721, -16, 840, 382, 372, -116, 375, 57, 163, -65, -161, -28, 690, -17, 690, 377, 484, -85, 456, -23, 172, 86, 75, -54,
+  219, -287, -254, 23, -149, 600, 78, 87, -400, 640, 791, -166, 31, -304, -715, -182, -247, -89, -138, 12, -471, -148, 21, -20,
+  -42, -239, -721, -172, -154, -218, -204, 9, -381, -57, 6, -38, -74, -172, -799, -175, -128, -323, -11, 75, -525, 51, 46, 84,
+  -68, -124, -733, -125, -147, -309, -53, 153, -466, 36, 44, 4, -75, -156, -766, -182, -162, -208, -26, 232, -652, 58, 16, 60,
+  672, -187, 1008, 448, 643, -24, 183, 211, -73, -211, -381, 283, 601, -118, 874, 382, 423, -275, 407, 9, 434, 72, -138, 34,
+  553, -15, 772, 188, 361, -92, 353, 130, 54, -7, -125, -31, 597, -109, 633, 236, 475, -112, 455, -2, 149, 86, -49, -20,
+  586, -118, 628, 217, 331, -258, 458, 40, 167, 18, 60, 16, 293, -156, -88, 53, 6, 533, 72, -9, -162, 309, 893, -427,
+  74, -196, -762, -173, -219, -97, -282, -85, -366, -96, 93, -16, -23, -140, -803, -250, -247, -102, -83, 12, -496, 20, 39, -40,
+  -22, -107, -713, -197, -187, -112, -30, 46, -498, 122, 76, 140, -40, -71, -785, -182, -173, -192, -47, 140, -667, 63, 3, 66,
+  -79, 64, 193, 126, 128, 17, -240, -268, 293, 56, 211, -222, 227, 181, 712, 363, 338, 171, -314, 131, -190, 79, -150, 503,
+  593, 0, 777, 163, 326, 92, 383, 4, 88, -277, -277, 148, 646, -62, 752, 96, 397, -118, 490, -94, 213, 94, -153, -19,
+  601, -73, 667, 86, 323, -153, 425, -195, 266, -70, -37, 53, 282, -162, 58, 30, 13, 604, 117, -44, -179, 470, 917, -312,
+  93, -198, -714, -194, -254, 3, -283, -98, -372, -36, 112, 44, 10, -93, -842, -248, -239, 44, -136, 4, -431, -28, -46, -39,
+  13, -76, -726, -210, -212, 9, -67, 57, -468, 35, 46, -29, -5, -55, -770, -229, -230, -33, -13, 97, -680, 143, 85, 162,
+  65, -155, -456, -330, -317, 104, 3, -361, 369, 64, 305, -217, 63, 311, 713, 393, 480, 18, -216, 169, 31, 239, -175, 371,
+  557, 135, 933, 426, 507, 112, 401, -21, 96, -269, -313, 171, 667, 84, 803, 430, 575, -145, 371, -27, 150, 36, -93, -20,
+  625, 16, 794, 387, 423, -275, 413, -46, 210, -25, 37, 59, 607, -31, 653, 266, 298, -319, 411, -73, 290, -119, 76, -35,
+  227, -79, -25, 102, 83, 605, 102, -32, 74, 567, 919, -196, 5, -161, -838, -265, -230, 120, -278, 3, -434, 30, 139, -66,
+  -77, -49, -700, -229, -290, 103, -38, 36, -469, 59, 76, -27, 14, -9, -806, -265, -297, 188, 51, 1, -697, 77, 8, 58,
+  316, -210, -223, -208, -95, -421, 17, -343, 367, -195, -231, -172, 157, -49, -23, -40, -72, -73, -199, -123, 578, 332, 271, 32,
+  259, -1, 890, 417, 471, 134, 112, 99, 14, 5, -413, 298, 924, -158, 1016, 666, 599, -175, 379, -58, 205, -46, -126, -7,
+  1015, -190, 989, 688, 454, -289, 334, -1, 214, -52, 26, 47, 1014, -169, 950, 512, 345, -409, 448, -127, 398, -106, 1, -23,
+  915, -127, 883, 426, 339, -334, 351, -92, 467, 7, 35, 39, 689, -95, 692, 488, 391, -200, 395, 6, 430, -6, 84, 60,
+  442, -19, 389, 386, 302, 222, 378, 12, 291, 335, 518, -104, -3, -83, -680, -148, -349, 465, -131, 269, -607, 267, 247, -195,
+  41, 141, 320, 83, 108, 60, -315, 47, 191, 163, -172, 33, 472, 23, 777, 336, 465, 8, 370, -59, 220, -215, -381, 255,
+  624, -15, 651, 182, 394, -85, 372, 8, 214, 140, 21, -70, 684, -104, 562, 169, 296, -93, 406, -104, 176, 51, 76, -32,
+  335, -272, -121, -16, -178, 653, 56, -48, -400, 576, 852, -350, 181, -278, -671, -279, -330, 73, -288, -117, -386, -154, 124, 44,
+  138, -229, -750, -286, -289, -77, -186, -96, -410, -28, 26, -84, 67, -195, -855, -315, -270, 91, 30, -101, -537, -79, -26, -107,
+  17, -132, -725, -235, -222, -41, -156, 83, -384, 131, -36, 167, 28, -18, -749, -260, -212, 116, -214, 211, -389, -11, -189, 74,
+  -1, -97, -5, -25, -161, -68, -154, -220, 298, -58, 154, -250, 120, 33, 679, 373, 361, 84, -348, 144, 22, 394, -160, 379,
+  619, -38, 850, 328, 461, 111, 361, 125, -35, -231, -303, 220, 768, -12, 638, 355, 475, -115, 495, 42, 158, 47, -136, -10,
+  681, -115, 472, 284, 354, -187, 452, 126, 133, -40, -18, 54, 372, -141, 177, 142, 135, 395, 298, -21, 53, 327, 791, -312,
+  27, -255, -621, -246, -307, 124, -214, -108, -492, -58, 180, -242, -68, -205, -777, -349, -387, 245, 132, -121, -497, 99, 46, 129,
+  -106, -178, -702, -303, -353, 228, -178, -21, -356, 148, 137, 240, -71, -147, -786, -356, -361, 248, -135, 15, -539, -106, -153, -230,
+  -76, -24, 165, 119, 265, 52, -291, -19, 271, 64, -212, 101, 408, 106, 801, 479, 515, -96, 389, 52, 78, -8, -316, 325,
+  574, 51, 759, 285, 395, -67, 428, 12, 147, 16, -60, -28, 637, -16, 653, 284, 439, -155, 437, 8, 120, 55, -86, -22,
+  442, -126, 161, 115, 153, 282, 463, -147, 114, 385, 468, -192, 123, -249, -635, -145, -221, 377, -153, 233, -457, -76, 215, -291,
+  99, -133, -704, -187, -147, 270, -128, 101, -209, -69, -55, -26, -5, -216, -635, -197, -28, 157, 45, 145, -412, 393, 161, 356,
+  -101, -91, -612, -149, -25, -286, 23, 316, -443, 51, 54, -11, -90, -6, -675, -163, -62, -209, 60, 430, -627, 52, 14, 59,
+  465, 77, 770, 454, 656, 53, 305, -113, 31, -416, -543, 353, 493, -1, 738, 359, 418, -207, 445, -193, 550, 73, -120, 42,
+  467, 61, 670, 262, 270, -170, 389, -88, 183, 137, -69, -76, 482, -32, 405, 235, 243, 153, 444, -250, 192, 246, 283, -164,
+  115, -125, -260, -181, -246, 650, 102, 278, -509, 391, 546, -276, 95, -150, -509, -217, -216, 43, -74, 102, -381, -36, -46, 122,
+  4, -94, -493, -201, -191, 136, -265, 163, -165, 138, 70, 190, 42, -23, -599, -220, -185, -346, 81, 206, -508, 34, 23, 43,
+  -28, 28, -501, -186, -174, -311, 54, 297, -455, 31, 43, 1, -86, 65, -615, -204, -177, -210, 70, 431, -629, 53, 14, 56,
+  215, -393, -251, -57, -124, -410, -213, -290, 286, -187, -220, -167, 29, -142, 320, 178, 125, 69, -369, 13, 282, 314, 103, 208,
+  408, -61, 644, 225, 302, 154, 129, -39, 33, -268, -271, 331, 621, -184, 522, 209, 338, -162, 354, -294, 248, 8, -84, 36,
+  553, -144, 370, 137, 188, -178, 366, -320, 319, -65, -75, 64, 502, -99, 158, 111, 73, -102, 360, -222, 374, 1, 165, -96,
+  73, -185, -344, -87, -141, 585, 123, 46, -306, 630, 706, -135, -117, -209, -764, -344, -336, 244, -59, 23, -333, 64, 100, 184,
+  -77, -106, -692, -329, -342, 301, -257, 117, -306, -51, -4, -159, -79, -89, -740, -347, -379, 169, 155, 168, -646, 22, -7, -86,
+  45, -226, -282, -52, -289, -247, 122, -88, 307, -216, -40, -267, 17, -88, -243, -433, -562, 420, -497, -56, -25, 115, 700, 192,
+  85, -127, -216, -566, -649, 276, -26, 154, -138, -546, 31, 263, 71, -260, -175, -748, -867, -217, -32, -204, 282, -171, -12, 3,
+  74, -252, -204, -759, -792, -74, -50, -209, 408, 361, -195, 22, 153, -243, -217, -534, -550, 122, 124, -83, -511, 436, -122, -36,
+  158, -214, -228, -486, -478, -532, 6, 193, -465, -32, 19, 39, 68, -147, -295, -535, -513, -387, 67, 226, -478, 34, 60, 43,
+  49, -145, -257, -462, -528, -305, 81, 281, -469, 47, 47, 4, -17, -8, -333, -551, -546, -207, 105, 406, -655, 49, 10, 61,
+  151, -425, -315, -475, -656, 222, -549, 60, -380, -430, 107, 414, 32, -321, -287, -729, -690, 152, -53, -62, 246, -580, -76, 164,
+  -99, -203, -194, -588, -714, -165, -79, -363, 375, -41, 12, -59, -127, -336, -192, -638, -861, -388, -108, -550, 260, -1, -80, -21,
+  -29, -344, -230, -691, -845, 188, 21, -686, 460, 556, -320, -58, 161, -290, -239, -467, -546, -23, 73, -116, -667, 305, 1, -117,
+  185, -243, -253, -402, -486, -530, 4, 157, -462, -34, 31, 50, 94, -178, -291, -451, -504, -387, 47, 204, -483, 31, 54, 49,
+  41, -158, -294, -392, -515, -318, 66, 270, -472, 29, 51, 3, 22, -104, -309, -436, -546, -211, 87, 410, -642, 38, 8, 57,
+  56, -189, -249, -179, -179, 78, -105, -292, 270, -198, 320, -333, -6, -130, -260, -481, -439, 289, -510, -142, -484, -150, 500, 361,
+  -245, -454, -450, -764, -640, 437, -35, -93, -80, -835, -25, 88, -263, -672, -398, -1016, -945, -283, -191, -512, 316, -49, -41, -25,
+  -210, -568, -414, -1015, -825, 1, -82, -243, 315, 436, -212, 134, -109, -477, -412, -659, -549, 325, 188, 279, -138, 638, -105, 82,
+  40, -194, -283, -524, -472, -122, -63, -252, -626, 221, -133, -54, -120, -295, -438, -642, -589, -389, -28, -72, -545, 9, 57, 63,
+  -694, -881, -934, -977, -940, -319, -11, -14, -531, 28, 49, 1, -650, -901, -997, -1016, -979, -197, 7, 32, -724, 20, -6, 59,
+  -527, -914, -597, -648, -684, -298, 77, -168, 330, -216, -87, -248, -340, -731, -628, -816, -764, 472, -503, -154, 7, 12, 702, 171,
+  -357, -524, -528, -810, -792, 375, 25, 65, -138, -657, -143, 283, -147, -431, -173, -684, -740, -72, -32, -655, 330, -333, 20, -6,
+  -244, -477, -252, -677, -642, -72, -42, -615, 430, 409, -137, 55, -426, -649, -658, -746, -711, 234, 137, -196, -457, 557, 19, -53,
+  -907, -976, -988, -1013, -958, -519, 23, -13, -542, -22, 10, 55, -74, -311, -411, -544, -563, -382, 72, 72, -536, 31, 61, 41,
+  -99, -212, -359, -424, -495, -312, 89, 124, -523, 36, 51, -2, -162, -237, -448, -527, -595, -208, 110, 204, -729, 55, 13, 58,
+  27, 32, -366, -348, -473, 392, -342, -189, 93, -52, 673, -301, -19, 31, -258, -688, -495, 367, -182, -29, -216, -598, 149, 443,
+  16, -28, -169, -620, -530, 5, -73, -269, 340, -277, 51, -47, 39, -81, -207, -718, -757, 125, -145, -379, 353, 488, -323, 18,
+  143, -141, -337, -823, -588, 199, 84, -208, -511, 614, -66, 38, 133, -108, -290, -504, -455, -536, 75, 107, -596, -117, 2, -16,
+  146, -100, -280, -494, -390, -559, 24, 134, -474, -37, 42, 37, 95, -12, -326, -534, -355, -392, 65, 170, -510, 33, 56, 45,
+  44, 9, -305, -426, -347, -311, 85, 225, -489, 35, 53, 0, -9, 52, -299, -445, -356, -209, 102, 339, -674, 49, 10, 49,
+  84, -353, -175, -647, -522, 294, -469, -76, -700, -656, 192, 155, -28, -202, -246, -776, -678, 323, -120, -51, 137, -766, -28, 71,
+  25, 145, -194, -616, -689, -223, -173, -257, 366, 43, 19, -81, 79, -84, -176, -750, -902, -212, -215, -433, 312, 67, -249, -9,
+  70, -227, -251, -857, -955, 398, 76, -666, -192, 798, -213, 100, -328, -651, -580, -851, -833, -491, 78, 93, -643, -94, -23, -56,
+  -151, -329, -389, -613, -654, -560, 49, 94, -489, -43, 35, 47, -168, -326, -494, -678, -674, -385, 84, 142, -525, 34, 53, 46,
+  -340, -403, -553, -657, -738, -312, 104, 205, -503, 37, 56, 0, -347, -437, -622, -724, -799, -207, 130, 304, -699, 34, 11, 48,
+  -42, -571, -199, -603, -529, 423, -645, -226, -497, -588, 288, 306, -137, -495, -296, -750, -797, 221, -88, 8, 163, -645, -38, 191,
+  -13, -179, -220, -480, -705, -203, -91, -293, 361, -44, -3, -57, 15, -398, -194, -640, -941, 215, -139, -462, 336, 584, -288, -62,
+  13, -505, -295, -767, -1012, 214, 87, -134, -535, 649, -80, 122, -556, -873, -678, -844, -910, -539, 73, 23, -625, -116, 9, -25,
+  -718, -976, -867, -883, -988, -566, 35, 45, -499, -44, 46, 39, -728, -1016, -977, -1001, -1016, -391, 84, 113, -535, 15, 55, 40,
+  -632, -824, -757, -786, -874, -313, 89, 187, -504, 35, 51, 1, -393, -621, -610, -684, -790, -209, 123, 279, -699, 49, 21, 58,
+  -73, -363, -410, -349, -405, -345, -393, 10, 117, -129, -185, -208, 0, -126, -328, -655, -683, 140, -381, 128, -108, 12, 347, 340,
+  11, -191, -345, -548, -595, 233, -16, -7, 44, -565, 88, 121, 71, -230, -279, -737, -886, -201, -126, -256, 341, 115, -153, -11,
+  61, -294, -322, -710, -827, 427, 56, -18, -61, 873, -94, 117, 181, -274, -275, -485, -546, -432, 155, 230, -609, -50, -35, -2,
+  73, -203, -291, -417, -475, -547, 84, 272, -414, -38, 38, 33, 44, -168, -375, -457, -504, -387, 118, 284, -452, 31, 53, 45,
+  12, -120, -353, -388, -499, -313, 136, 358, -440, 38, 51, -1, 21, -113, -379, -449, -553, -212, 160, 508, -618, 54, 10, 56,
+  103, -340, -437, -388, -490, -189, -375, 316, -93, -154, -29, -56, 4, -156, -322, -621, -527, -73, -81, 210, -134, -184, 123, 267,
+  112, -208, -153, -517, -603, 18, -25, 85, 129, -334, 93, 3, 87, -250, -145, -659, -769, -379, -105, -103, 238, 8, -53, -16,
+  105, -294, -174, -795, -795, -53, -30, -84, 370, 341, -248, 95, 109, -286, -221, -567, -580, 289, 189, 27, -342, 606, -151, -14,
+  218, -231, -246, -525, -528, -474, 22, 31, -550, 6, -15, 13, 133, -220, -291, -564, -575, -386, 81, 112, -530, 20, 59, 48,
+  71, -164, -284, -521, -552, -312, 105, 199, -502, 28, 48, 5, 33, -168, -295, -524, -618, -206, 122, 287, -702, 56, 10, 58,
+  -64, -336, -258, -228, -329, -275, -224, 302, 23, -122, -83, -232, -36, -229, -236, -501, -486, -41, -305, 317, -111, 105, 65, 286,
+  -16, -288, -220, -538, -594, 275, 158, -104, 11, -610, -17, 140, -37, -459, -124, -653, -800, -172, 22, -825, 361, -124, 45, -9,
+  -32, -515, -154, -719, -755, -73, -24, -709, 464, 395, 16, 72, 51, -359, -227, -521, -565, 210, 105, -301, -436, 536, -36, 69,
+  14, -296, -184, -477, -483, -509, 26, 75, -512, -16, 2, 48, 6, -283, -301, -467, -532, -396, 75, 157, -516, 19, 55, 43,
+  4, -252, -249, -419, -500, -306, 84, 220, -494, 34, 52, 4, -4, -182, -325, -419, -536, -204, 112, 352, -681, 30, 12, 52,
+  78, 147, 425, 115, 202, 322, 178, 321, -396, 473, 132, 398, 489, -310, 393, 82, 162, 152, 194, 246, -358, -247, -168, -499,
+  469, -333, 357, 19, 32, 181, -386, -354, 133, -76, -26, -202, 290, -193, 231, 48, 57, 369, -82, 207, 2, 458, -150, 211,
+  -251, 438, 151, 36, 263, 628, -95, 151, -265, -179, -148, 130, -114, 265, 22, 126, 172, 527, -313, -38, -300, -192, -17, -246,
+  150, -206, 309, 77, 16, 318, 483, 327, 49, 57, -176, 48, 249, -225, 266, 56, 22, 549, 194, 198, 129, -97, 258, 82,
+  202, -155, 275, 83, 145, 522, 339, 382, -175, 359, 215, 17, 313, -186, 445, 133, 248, 421, -175, -146, 144, -378, 76, -407,
+  443, -10, 599, 273, 449, 174, 453, 306, -669, 214, 119, 283, 596, -399, 593, 149, 257, 558, -122, -146, 9, -508, -271, -717,
+  645, -243, 592, 168, 248, -256, -236, -139, 114, 130, -22, -29, 654, -456, 529, 103, 275, -152, -360, -335, 148, 174, -38, 5,
+  411, -370, 417, 95, 184, 340, 90, 279, -157, 393, -231, 551, -146, 92, 60, 67, 237, 225, -114, 240, -103, -110, 301, -432,
+  -463, 117, -339, 88, 307, 392, 124, 236, 14, -28, 34, -26, -280, 164, -69, 81, 276, 316, -39, 333, 33, -127, -249, 258,
+  142, -181, 273, 70, 181, 568, 106, 312, 125, 10, 97, 115, 99, 160, 357, 79, 154, 583, 591, 442, -503, 445, 235, -27,
+  277, 152, 629, 249, 263, 755, 290, -139, -237, 793, 506, 479, 437, -246, 659, 182, 101, 599, 60, -386, -253, -501, -159, -652,
+  422, -200, 557, 114, 69, 255, -354, -217, 8, 486, -9, 368, -288, 227, 8, 94, 310, 598, 5, 310, -343, -21, -382, 82,
+  -324, 165, 15, 116, 266, 495, -19, 139, -182, -32, -151, -40, 319, -264, 445, 99, 86, 431, 287, 62, 6, -148, -130, 49,
+  264, -134, 387, 112, 127, 466, 419, 272, -10, 472, 361, 49, 410, -217, 438, 138, 229, 427, 102, -150, -71, -469, 98, -526,
+  464, -237, 271, 85, 183, -281, -209, 76, 210, 47, 53, 18, 367, -178, 289, 120, 193, -202, -148, 140, 184, 62, 21, 63,
+  58, 355, 577, 382, 194, 39, 464, 350, -799, 95, -76, 72, 378, -235, 598, 209, 95, 517, -198, -266, 6, -494, -152, -641,
+  421, -209, 593, 122, 73, -84, -266, -122, 75, 321, -86, 89, 104, 53, 326, 218, 290, 429, -180, 438, -99, 105, 89, 163,
+  -342, 141, -82, 113, 332, 436, -74, 139, -231, 180, -149, 170, -82, 73, 263, 91, 216, 289, 97, 298, -209, 136, 186, 312,
+  148, -163, 346, 140, 168, 553, 282, 332, 20, -262, -324, -84, 219, -191, 278, 143, 146, 520, 235, 207, 135, 344, 236, 261,
+  254, -162, 399, 153, 212, 519, 123, -217, -116, -312, 192, -596, 348, -175, 393, 150, 201, -164, -179, 91, 170, 63, 17, 69,
+  2, 231, 482, 289, 13, 371, 247, 261, -435, 558, 262, 223, 288, -259, 533, 167, -76, 346, 14, -104, -127, -461, -135, -601,
+  358, -233, 465, 119, -43, -189, -249, -169, 78, 168, -91, 47, 177, 0, 278, 139, 61, 250, -318, 296, -58, 155, 76, 35,
+  -428, 165, -201, 128, 152, 423, -182, 155, -151, 146, 35, -40, -235, 165, 84, 150, 94, 656, -89, 163, -4, -84, -318, 59,
+  347, -263, 261, 117, 37, 448, 190, 171, 109, -35, -79, 59, 188, -179, 342, 130, 85, 463, 289, 363, 158, 392, 305, 233,
+  321, -149, 434, 139, 199, 380, 517, 267, -376, -56, 72, -250, 326, -155, 390, 137, 151, 190, -229, -286, 227, -210, 13, -235,
+  -15, 291, 569, 349, 178, 328, 169, 168, -249, 415, 160, 340, 368, -130, 603, 274, 59, 369, 270, -13, -452, -487, -147, -575,
+  421, -238, 505, 201, 46, -116, -323, -337, 241, 122, -122, -72, 426, -331, 443, 179, 7, -290, -238, -209, 153, 80, -13, 29,
+  397, -259, 254, 172, -11, 25, -166, 250, 19, 298, 59, 409, -168, 183, 186, 123, 190, 269, 73, 258, -73, -126, -253, 0,
+  -216, 100, 143, 146, 213, 423, -190, 41, -48, -110, 54, 23, 119, -166, 197, 187, 141, 456, 269, 263, -3, 62, 153, -65,
+  87, 75, 299, 133, 90, 619, 184, 220, -100, 544, 292, 245, 294, -17, 412, 190, 185, 652, 156, 96, -177, -680, 141, -717,
+  -26, 422, 316, 470, 483, 274, -228, 10, 404, 222, 269, 1, -425, 168, 194, 387, 341, 83, 357, 124, -243, 421, 39, 467,
+  190, -193, 379, 251, 154, 461, 365, 46, -444, -224, 39, -686, 479, -386, 335, 251, 142, -242, -470, -385, 100, 30, -43, -18,
+  111, -10, 155, 216, 156, 192, -129, -67, 82, 343, -181, 341, -513, -16, -433, 174, 213, 429, 115, 117, -218, -221, -109, 62,
+  -197, -20, -67, 160, 191, 523, -327, -12, -127, 67, 13, 156, 275, -180, 272, 202, 163, 382, 116, 178, 93, 24, 33, -45,
+  146, -23, 180, 175, 117, 676, 199, 273, 44, 132, 322, 26, 55, 249, 208, 171, 44, 595, 616, 278, -624, 110, 121, -34,
+  120, 299, 380, 358, 215, 304, -151, -26, 446, 251, 341, 67, 213, -83, 491, 332, 107, 571, 288, -309, -419, -107, 98, -261,
+  194, -136, 314, 194, 102, 214, -241, -222, 100, 484, -248, 239, -353, 171, -143, 223, 359, 430, -144, 314, -195, -35, -182, 69,
+  -317, 9, -182, 176, 347, 275, -145, 111, -35, 30, -67, -70, 265, -131, 300, 176, 116, 300, 268, 254, -29, 23, -161, 140,
+  282, -183, 263, 150, 110, 437, 76, 178, 228, 25, 197, 76, 134, 40, 574, 206, 204, 336, 533, 196, -382, 280, 236, -166,
+  458, -99, 345, 164, 125, 236, -176, -255, 220, -299, -19, -393, 451, -142, 365, 169, 158, -194, -176, 49, 181, 70, 24, 66,
+  192, 254, 586, 319, 371, 274, 555, 101, -775, 346, 204, 209, 376, -279, 514, 218, 97, 506, -45, -404, -75, -503, -165, -650,
+  265, -116, 470, 136, 53, 127, -182, -135, 120, 462, -208, 169, -309, 122, -51, 162, 360, 486, -187, 250, -231, -6, -132, 147,
+  -394, 9, -66, 158, 259, 276, -201, 129, -125, -60, -22, -66, 228, -215, 291, 75, 170, 211, 277, 261, 72, 66, -265, 222,
+  359, -214, 344, 131, 157, 351, 83, 103, 180, -149, -10, 10, 123, 0, 448, 175, 168, 523, 575, 205, -338, 435, 329, -219,
+  345, -131, 248, 123, 158, 206, -145, -337, 245, -287, 4, -371, 381, -119, 330, 153, 175, -192, -128, 38, 236, 61, 16, 69,
+  83, 49, 508, 311, 181, 399, 170, 268, -200, 616, 297, 38, 289, -333, 433, 239, 95, 303, -171, -192, 37, -315, -237, -489,
+  289, -228, 336, 147, 102, -109, -304, -211, 80, 228, 28, 93, -11, 203, 59, 190, 216, 313, -101, 482, -263, 251, -110, 19,
+  -388, 63, -140, 113, 256, 285, 100, 198, 33, -3, -161, -20, -226, 6, -18, 72, 136, 46, -34, 323, 160, -143, -4, 53,
+  277, -188, 275, 194, 99, 333, 273, 163, 18, 134, -124, 301, 226, -190, 173, 140, 83, 380, 49, 316, 149, 100, 171, 160,
+  119, 5, 211, 145, 187, 527, 481, 199, -463, 29, 143, -291, 379, -113, 402, 214, 411, 191, -169, -328, 293, -186, 28, -241
+};
+
+#define SENTENCE_KNN_Q_HAS_AFFINE 1
+
+// Fused standardize + quantize coefficients: q = x_raw * A + B
+static const float SENTENCE_Q_AFFINE_A[SENTENCE_KNN_Q_N_FEATURES] PROGMEM = {
+  0.509116142f, 0.667340341f, 0.425049882f, 0.410645441f, 0.4497259f, 0.0037227597f, 0.00770462045f, 0.0124189031f, 0.00646063847f, 0.00460682909f,
+  0.00462163186f, 0.00595385664f, 0.49990418f, 0.545437056f, 0.375706905f, 0.442630349f, 0.497008942f, 0.00362139653f, 0.00529803687f, 0.0134491775f,
+  0.00655767619f, 0.00484329272f, 0.00471631977f, 0.00727963054f, 0.705879174f, 0.611338536f, 0.403224151f, 0.482513689f, 0.441579293f, 0.00356121981f,
+  0.00508815784f, 0.0132014607f, 0.00606619572f, 0.00497283535f, 0.00489315657f, 0.00610289708f, 0.738928974f, 0.656844724f, 0.377983719f, 0.486247863f,
+  0.484501668f, 0.00384518273f, 0.00578845285f, 0.0128231271f, 0.00599364929f, 0.0050166262f, 0.00502178644f, 0.00474131274f, 0.642332179f, 0.607056273f,
+  0.380817378f, 0.432743325f, 0.4634773f, 0.00434675776f, 0.00662055779f, 0.0125556039f, 0.00599978185f, 0.00488160871f, 0.00489550203f, 0.00496751749f,
+  0.582374701f, 0.583643487f, 0.39591725f, 0.424127106f, 0.47487288f, 0.00524365617f, 0.00666624778f, 0.0123970669f, 0.00682261734f, 0.00571053167f,
+  0.00477766458f, 0.00399417157f, 0.528490453f, 0.674273395f, 0.425994939f, 0.440255519f, 0.446965685f, 0.0036249109f, 0.00630368643f, 0.012313543f,
+  0.0072550677f, 0.00422641253f, 0.00471381992f, 0.00357821893f, 0.464734649f, 0.668973011f, 0.411799502f, 0.458587728f, 0.466487809f, 0.00353637221f,
+  0.00554914501f, 0.0123439849f, 0.00720131334f, 0.00379363044f, 0.00461361875f, 0.00357865927f, 0.419566295f, 0.490788931f, 0.388838003f, 0.38757049f,
+  0.380006323f, 0.00387151262f, 0.0050185762f, 0.00632225553f, 0.00744570379f, 0.00382641262f, 0.00451036254f, 0.003697112f, 0.378082336f, 0.546044748f,
+  0.399507921f, 0.418795365f, 0.344807739f, 0.00400587841f, 0.00405339038f, 0.00564338998f, 0.00866003702f, 0.00395186287f, 0.00436548765f, 0.00380904328f,
+  0.358970588f, 0.500696265f, 0.413100188f, 0.46507726f, 0.359190049f, 0.00453795143f, 0.00475993087f, 0.00645693749f, 0.0071069541f, 0.00453043108f,
+  0.00428728406f, 0.00393866902f, 0.342646976f, 0.473851543f, 0.411907122f, 0.453431876f, 0.398053663f, 0.00421849995f, 0.00508234907f, 0.00661667156f,
+  0.00850314545f, 0.00436517016f, 0.00416427691f, 0.00404673712f, 0.335214645f, 0.47023492f, 0.376117253f, 0.442622462f, 0.395754778f, 0.00412490999f,
+  0.00507788436f, 0.00914150219f, 0.00934783496f, 0.00463112312f, 0.00413658174f, 0.00412472003f, 0.343289768f, 0.465817649f, 0.368656728f, 0.461873786f,
+  0.418621467f, 0.00399337541f, 0.004708336f, 0.00552318247f, 0.00707839516f, 0.00476062248f, 0.00415738528f, 0.00409199153f, 0.341237972f, 0.453860653f,
+  0.385243209f, 0.465082443f, 0.427426909f, 0.00421977683f, 0.0049282863f, 0.00493677397f, 0.00529203512f, 0.00476342161f, 0.00409030733f, 0.00381709662f,
+  0.348011118f, 0.434934951f, 0.387421983f, 0.413268055f, 0.411893951f, 0.00433795112f, 0.00465634789f, 0.004899565f, 0.00657658816f, 0.00447959716f,
+  0.00427817418f, 0.00377697335f, 0.345243778f, 0.41217429f, 0.380417243f, 0.3326915f, 0.356807933f, 0.003992288f, 0.00470635389f, 0.00600610633f,
+  0.00672926655f, 0.00451437793f, 0.0046127934f, 0.00376313573f, 0.363287187f, 0.403110584f, 0.388842496f, 0.376554582f, 0.421940556f, 0.00318095075f,
+  0.00455275386f, 0.00572159283f, 0.00673566824f, 0.00444809313f, 0.00411630066f, 0.00373234546f, 0.335847767f, 0.396557648f, 0.380548771f, 0.358515954f,
+  0.384703897f, 0.00358842197f, 0.0039025024f, 0.00476169934f, 0.00371647221f, 0.00424082197f, 0.00413125877f, 0.00364096993f, 0.352877992f, 0.424186599f,
+  0.369476265f, 0.260024295f, 0.250434177f, 0.00351657695f, 0.00446391152f, 0.0062506063f, 0.00546084232f, 0.00433959323f, 0.00411539461f, 0.00359315911f,
+  0.338028464f, 0.48177804f, 0.393761592f, 0.484582898f, 0.426193818f, 0.00338407007f, 0.00441309972f, 0.00832906615f, 0.00438715925f, 0.00403364162f,
+  0.00406429405f, 0.00352996824f, 0.354553929f, 0.416982337f, 0.365502193f, 0.28186665f, 0.327239212f, 0.00359754316f, 0.00367780451f, 0.00794606512f,
+  0.00396118829f, 0.0038422552f, 0.0040737162f, 0.00356370768f, 0.354680354f, 0.423762801f, 0.326552837f, 0.278539108f, 0.310033594f, 0.00350410055f,
+  0.00474916422f, 0.00581221874f, 0.00335109155f, 0.00377726268f, 0.00389253547f, 0.00357476277f, 0.364371215f, 0.403585355f, 0.327463814f, 0.262197305f,
+  0.312062921f, 0.00338073858f, 0.00387626936f, 0.00816036582f, 0.003254543f, 0.00398627576f, 0.00420245782f, 0.00363259187f, 0.365179968f, 0.493041917f,
+  0.36350892f, 0.349281492f, 0.44437025f, 0.00357399161f, 0.00446379159f, 0.00699091132f, 0.00344028206f, 0.00390908984f, 0.00420479944f, 0.00372878544f,
+  0.356036775f, 0.56358349f, 0.338541406f, 0.405362715f, 0.457283394f, 0.00347271944f, 0.00619308286f, 0.0101979814f, 0.00367135512f, 0.00393038205f,
+  0.00424623768f, 0.0040047811f, 0.381364096f, 0.529416362f, 0.340405376f, 0.410432871f, 0.434322677f, 0.00330304823f, 0.0044276433f, 0.0106144696f,
+  0.00364972974f, 0.0038279487f, 0.00419292708f, 0.00377951591f, 0.401460355f, 0.555388064f, 0.338332944f, 0.398204963f, 0.444431568f, 0.00344596679f,
+  0.00473494908f, 0.00981375572f, 0.00354766788f, 0.00389512907f, 0.00416517584f, 0.00380015683f, 0.3977038f, 0.554417481f, 0.320650993f, 0.435137371f,
+  0.455879681f, 0.00401101887f, 0.0047363447f, 0.010082417f, 0.00348121998f, 0.00394832931f, 0.00422826394f, 0.00388022786f, 0.396198073f, 0.561700355f,
+  0.343754028f, 0.42492854f, 0.444724044f, 0.00389011576f, 0.0046421729f, 0.00989828025f, 0.00334409597f, 0.00394938742f, 0.00399394038f, 0.00390515635f,
+  0.387491615f, 0.538570569f, 0.361188237f, 0.371637464f, 0.424055062f, 0.00389189436f, 0.00435410886f, 0.0107991128f, 0.00371803251f, 0.00381262627f,
+  0.00415290175f, 0.00391173262f, 0.370399346f, 0.491741639f, 0.344607311f, 0.375889351f, 0.395508005f, 0.00419342216f, 0.00400743635f, 0.00937793533f,
+  0.0039830515f, 0.00382685158f, 0.00423542799f, 0.00378470761f, 0.375159142f, 0.508139774f, 0.35161668f, 0.388899299f, 0.419651167f, 0.00423889843f,
+  0.00425800342f, 0.00964596743f, 0.00398705701f, 0.00379032448f, 0.00416493523f, 0.00375005575f, 0.412464965f, 0.513484336f, 0.336719465f, 0.389237039f,
+  0.410998213f, 0.00429817885f, 0.00399601509f, 0.0101346694f, 0.00402623069f, 0.00384124609f, 0.00408270922f, 0.00378556634f, 0.357816532f, 0.513822653f,
+  0.404762031f, 0.403173045f, 0.385645729f, 0.0040869433f, 0.0043189411f, 0.0102968846f, 0.00384737133f, 0.00377448846f, 0.00402026177f, 0.0041309626f,
+  0.397352587f, 0.415089643f, 0.401468698f, 0.405267934f, 0.379534571f, 0.0039087311f, 0.00397332302f, 0.00875397453f, 0.00379527955f, 0.00362154024f,
+  0.00374845527f, 0.00361708608f, 0.447386531f, 0.522999962f, 0.349686382f, 0.419345237f, 0.370350443f, 0.00342954356f, 0.00474986365f, 0.00858596763f,
+  0.0037351147f, 0.00363035021f, 0.00386959265f, 0.00363467815f, 0.36350512f, 0.534969878f, 0.374308598f, 0.432926283f, 0.40367873f, 0.00395344237f,
+  0.00471785055f, 0.00609723966f, 0.00413453964f, 0.0037676732f, 0.00377179105f, 0.00370625961f, 0.38040545f, 0.539277014f, 0.360100911f, 0.423982343f,
+  0.386876417f, 0.00393828095f, 0.00345433969f, 0.00931852002f, 0.00376085145f, 0.00381906954f, 0.00356491359f, 0.00391473461f, 0.401617504f, 0.558869356f,
+  0.382320299f, 0.438141588f, 0.346174643f, 0.00383783173f, 0.00342452911f, 0.00650043394f, 0.00360371538f, 0.00376233395f, 0.00367586686f, 0.00380875766f,
+  0.421818942f, 0.514114562f, 0.370206299f, 0.309882406f, 0.283930011f, 0.00398306807f, 0.00457141568f, 0.00575605128f, 0.00328141457f, 0.00353232518f,
+  0.00368174294f, 0.00372765617f, 0.420113622f, 0.484508415f, 0.372429499f, 0.297726173f, 0.280444448f, 0.00410227969f, 0.00377645106f, 0.00655296085f,
+  0.00391497421f, 0.00335552211f, 0.00377617342f, 0.00374997187f, 0.405554296f, 0.50591476f, 0.434265193f, 0.368429587f, 0.300091945f, 0.00371491844f,
+  0.00355710356f, 0.00883220401f, 0.00449864825f, 0.00332941291f, 0.00380635959f, 0.00383779077f, 0.410122325f, 0.324079514f, 0.358175671f, 0.267114902f,
+  0.229322787f, 0.0038293733f, 0.0045635897f, 0.00918022169f, 0.00494671902f, 0.00333313721f, 0.00379712514f, 0.00385005556f, 0.344211364f, 0.256172418f,
+  0.316761589f, 0.226880541f, 0.209885053f, 0.00370171339f, 0.00458853193f, 0.00805860166f, 0.00492325779f, 0.00330688106f, 0.00386625251f, 0.00384509346f,
+  0.40660651f, 0.349699393f, 0.357272432f, 0.246366649f, 0.296303109f, 0.00379890631f, 0.00493495745f, 0.00799131484f, 0.00466116391f, 0.00363957698f,
+  0.00384178465f, 0.00374645466f, 0.409805978f, 0.363679451f, 0.332725662f, 0.27835891f, 0.246229798f, 0.00405229128f, 0.00401621041f, 0.00571045812f,
+  0.00391665178f, 0.00367038714f, 0.00370649786f, 0.00363763696f, 0.425978589f, 0.424973713f, 0.374603425f, 0.283052728f, 0.277719976f, 0.00334837138f,
+  0.00377086444f, 0.010027336f, 0.00372249592f, 0.00340149373f, 0.00365551929f, 0.00364879824f, 0.462957239f, 0.446133039f, 0.38183021f, 0.287625192f,
+  0.297238165f, 0.00380957536f, 0.00484911826f, 0.0096049595f, 0.00396515172f, 0.00403619329f, 0.00403075784f, 0.00375856775f, 0.45365642f, 0.378014121f,
+  0.399479473f, 0.267109843f, 0.26990313f, 0.00400794068f, 0.00362729547f, 0.00709716927f, 0.00413678798f, 0.00349683919f, 0.00372088655f, 0.00382247923f,
+  0.414172569f, 0.323539091f, 0.37377213f, 0.265024654f, 0.23520194f, 0.00427265386f, 0.00435769235f, 0.00866505254f, 0.0042060381f, 0.00357449126f,
+  0.00372324868f, 0.00368879052f, 0.44370963f, 0.325773704f, 0.363800677f, 0.268013558f, 0.238140089f, 0.00394031972f, 0.00485932333f, 0.00873716689f,
+  0.004014547f, 0.00367537283f, 0.00364199862f, 0.0037079814f, 0.391399968f, 0.320109955f, 0.385585584f, 0.26888024f, 0.256808452f, 0.00351314625f,
+  0.00497415127f, 0.00812759612f, 0.00400527866f, 0.0037681852f, 0.00367924248f, 0.00368509707f, 0.397802352f, 0.336588901f, 0.365714334f, 0.263045684f,
+  0.242878552f, 0.00430967892f, 0.00376315803f, 0.00739753445f, 0.00443454417f, 0.00381202943f, 0.00371328145f, 0.00367230782f, 0.422202798f, 0.343277006f,
+  0.351216413f, 0.244618107f, 0.254436404f, 0.00378126644f, 0.00468267302f, 0.00665098325f, 0.00446135839f, 0.00384059834f, 0.00369375446f, 0.00359882776f,
+  0.378987709f, 0.347281761f, 0.354036639f, 0.268058312f, 0.263106041f, 0.00425110058f, 0.00389363674f, 0.00666972362f, 0.00430934271f, 0.00386546368f,
+  0.0037444436f, 0.0035658653f, 0.394876225f, 0.389543502f, 0.325695001f, 0.271430627f, 0.27295738f, 0.0040955014f, 0.00469841328f, 0.00736863633f,
+  0.00430027392f, 0.00379908491f, 0.00400801192f, 0.00361065212f, 0.389799042f, 0.380610544f, 0.400361593f, 0.315264828f, 0.257392274f, 0.00365991072f,
+  0.00348273494f, 0.00587243567f, 0.00474958258f, 0.00387606464f, 0.00399441816f, 0.00363200113f, 0.388466682f, 0.441739878f, 0.415939141f, 0.325423483f,
+  0.280795082f, 0.0035256596f, 0.00402752315f, 0.0048534368f, 0.00454308085f, 0.00382338905f, 0.00364841445f, 0.00375454228f, 0.406399523f, 0.408929386f,
+  0.43492317f, 0.281050195f, 0.26103315f, 0.00340026123f, 0.00366699838f, 0.00748850449f, 0.00472910422f, 0.00383170408f, 0.00350953271f, 0.0037440193f,
+  0.36822753f, 0.371185317f, 0.424443865f, 0.249803867f, 0.275071714f, 0.00352828673f, 0.00365470008f, 0.0081586149f, 0.00435860943f, 0.00384663963f,
+  0.00356227557f, 0.00377096462f, 0.345484295f, 0.382505997f, 0.406386074f, 0.305482948f, 0.288602277f, 0.00325709543f, 0.00389830302f, 0.00724777469f,
+  0.00377152937f, 0.00397462662f, 0.00360472964f, 0.00368517161f, 0.356646827f, 0.388239318f, 0.373033317f, 0.319570343f, 0.274900899f, 0.00348334032f,
+  0.00408235944f, 0.00636359843f, 0.00381273969f, 0.00380936026f, 0.00415395394f, 0.00366155659f, 0.349052482f, 0.415276975f, 0.326321526f, 0.28786062f,
+  0.267313008f, 0.00383101624f, 0.00538313079f, 0.00568375783f, 0.00399548884f, 0.00373091019f, 0.00370063139f, 0.00366218225f, 0.354068352f, 0.324818297f,
+  0.280322696f, 0.217677162f, 0.235370281f, 0.00357853096f, 0.00488603206f, 0.00601567014f, 0.00387483741f, 0.00374777285f, 0.0038160288f, 0.00377486188f,
+  0.350341417f, 0.377855053f, 0.339341161f, 0.247858268f, 0.26171144f, 0.00344884484f, 0.00338935129f, 0.00555122113f, 0.00418197991f, 0.00390401854f,
+  0.00377676019f, 0.00385578889f, 0.34296142f, 0.366479754f, 0.329775468f, 0.286810631f, 0.255935341f, 0.00365810993f, 0.00396117811f, 0.00576019815f,
+  0.00359206084f, 0.0038799704f, 0.00367305818f, 0.00390057312f, 0.340365844f, 0.423205761f, 0.364460945f, 0.278712759f, 0.264387704f, 0.00357271665f,
+  0.00445913714f, 0.0065033882f, 0.00393491293f, 0.00382480041f, 0.00358646181f, 0.00384970843f, 0.345398747f, 0.406004507f, 0.348538416f, 0.240660065f,
+  0.261679348f, 0.00345665939f, 0.00412741212f, 0.00686367151f, 0.00389562433f, 0.00373942813f, 0.00359865015f, 0.00383131362f, 0.340789829f, 0.401713217f,
+  0.344310864f, 0.252718752f, 0.260817117f, 0.00325230686f, 0.00515734641f, 0.00796940243f, 0.00350072257f, 0.00403130702f, 0.00365229517f, 0.00394170235f,
+  0.345345016f, 0.377570936f, 0.321068154f, 0.245620678f, 0.256781276f, 0.00346939283f, 0.00440474872f, 0.00953659667f, 0.00348028288f, 0.00378426259f,
+  0.00359762722f, 0.00392976691f, 0.345593684f, 0.386926192f, 0.344422015f, 0.25064563f, 0.260979485f, 0.00343350097f, 0.00427238309f, 0.0101559391f,
+  0.00386816673f, 0.00391780982f, 0.00357692327f, 0.00394905668f, 0.333286697f, 0.457041237f, 0.391400117f, 0.251681201f, 0.288233238f, 0.00337399556f,
+  0.00381046019f, 0.0115495061f, 0.00433129494f, 0.00387156515f, 0.00372603135f, 0.00374039779f, 0.337909361f, 0.482371376f, 0.377457977f, 0.265618138f,
+  0.298373808f, 0.00343750024f, 0.00429878285f, 0.0103449044f, 0.00348168999f, 0.00383528965f, 0.00386385628f, 0.00370440434f, 0.33164813f, 0.457921568f,
+  0.375205009f, 0.282587415f, 0.277669422f, 0.00335489007f, 0.00387537575f, 0.0104230773f, 0.00356801953f, 0.00398658956f, 0.00385886148f, 0.00418509987f,
+  0.315967272f, 0.459529689f, 0.399151228f, 0.278414695f, 0.272849107f, 0.00350455258f, 0.00391125031f, 0.008362908f, 0.00410892342f, 0.00408758043f,
+  0.00382470055f, 0.00426864532f, 0.322310331f, 0.459789682f, 0.403186132f, 0.273214895f, 0.299193604f, 0.00322324647f, 0.00350713228f, 0.0080382724f,
+  0.00495365827f, 0.00410911042f, 0.00385777494f, 0.00424594365f, 0.32093434f, 0.410491007f, 0.376269837f, 0.296141397f, 0.315157706f, 0.0032938244f,
+  0.00521352218f, 0.0111599287f, 0.00509886913f, 0.00409687159f, 0.00374856638f, 0.00413126847f, 0.336150824f, 0.428225228f, 0.374966491f, 0.289350725f,
+  0.2701626f, 0.00322949595f, 0.00472847215f, 0.0102881303f, 0.00576162401f, 0.00403756224f, 0.00368625827f, 0.00403113003f, 0.310937425f, 0.353211749f,
+  0.34539749f, 0.291451518f, 0.257938525f, 0.00311694608f, 0.00394181118f, 0.00820792748f, 0.0062314114f, 0.00398860921f, 0.0037004444f, 0.0039202801f
+};
+
+static const float SENTENCE_Q_AFFINE_B[SENTENCE_KNN_Q_N_FEATURES] PROGMEM = {
+  -1334.67244f, -1740.21827f, -1057.18897f, -1099.4084f, -1140.32759f, -36.5493386f, 20.0349765f, -101.119008f, -80.5415495f, -23.9519676f,
+  -24.4370118f, -16.6189313f, -1310.17389f, -1421.91696f, -935.784473f, -1186.52258f, -1260.83141f, -42.8259914f, 11.5091932f, -112.510299f,
+  -75.5532861f, -29.5296418f, -27.5396491f, -25.5368252f, -1848.96132f, -1593.39176f, -1007.32058f, -1293.21726f, -1124.91331f, -51.1483899f,
+  12.4376798f, -113.169548f, -62.7929285f, -35.9448959f, -35.4168317f, -26.0545557f, -1934.43898f, -1712.70567f, -945.449858f, -1305.1478f,
+  -1236.79707f, -59.0430663f, 13.5773403f, -113.656157f, -55.1657348f, -37.3797904f, -37.5488764f, -23.6686568f, -1682.65536f, -1581.09498f,
+  -953.15716f, -1161.14151f, -1187.50647f, -66.9224357f, 13.3900169f, -114.382731f, -47.3922418f, -32.9556732f, -33.4109165f, -25.480858f,
+  -1526.71179f, -1519.59865f, -993.059923f, -1140.43293f, -1220.59618f, -80.5286042f, 9.34113649f, -114.430317f, -45.4951124f, -30.809926f,
+  -29.5497362f, -19.5204824f, -1386.44627f, -1752.53282f, -1068.98349f, -1183.59653f, -1149.45947f, -55.0710228f, 5.1070755f, -114.680222f,
+  -41.8071369f, -16.0075055f, -27.457736f, -14.2341053f, -1219.47939f, -1736.75881f, -1033.07047f, -1234.31522f, -1201.95325f, -52.5279875f,
+  4.00758767f, -114.467887f, -38.1886628f, -7.68383869f, -24.1744469f, -9.73449157f, -1100.20792f, -1270.05985f, -974.450279f, -1042.3581f,
+  -979.243548f, -57.873486f, 4.89097633f, -57.1914128f, -37.9572989f, -1.61610978f, -20.7910492f, -5.85303454f, -991.82745f, -1412.18955f,
+  -1000.69961f, -1126.55851f, -890.120632f, -60.6473837f, 4.81543566f, -51.0511141f, -42.2820363f, 2.49464422f, -16.0439354f, -2.18526983f,
+  -942.576634f, -1292.91757f, -1036.33719f, -1251.31544f, -929.05774f, -71.02044f, 6.92252227f, -58.9360333f, -34.0190897f, 7.97427278f,
+  -13.4814367f, 2.06230742f, -900.067963f, -1221.10764f, -1033.97847f, -1219.4494f, -1030.69267f, -68.9899089f, 8.78595631f, -59.3270293f,
+  -41.8454111f, 16.0378971f, -9.45086041f, 5.60348133f, -880.150931f, -1208.41955f, -943.943888f, -1190.53213f, -1024.22618f, -72.4132032f,
+  11.6234157f, -75.7196456f, -50.5105711f, 24.7526434f, -8.54337198f, 8.15882523f, -900.914192f, -1193.62841f, -925.384297f, -1242.91045f,
+  -1083.08374f, -71.9577502f, 17.1191842f, -39.7339952f, -43.8548968f, 28.9960783f, -9.22504262f, 7.08637805f, -894.094323f, -1162.94666f,
+  -966.627445f, -1251.39862f, -1106.00781f, -71.4139174f, 23.6658228f, -31.7190131f, -37.3065681f, 26.4611636f, -7.0271012f, 1.92519515f,
+  -911.183583f, -1111.8544f, -971.110829f, -1110.80291f, -1063.94403f, -69.154031f, 20.2814577f, -32.9573772f, -48.8146776f, 19.7874395f,
+  -3.43660379f, -3.23613798f, -904.336032f, -1051.7976f, -953.351261f, -894.666684f, -922.91655f, -60.9144164f, 19.8862447f, -41.9918503f,
+  -52.2475596f, 20.9271357f, -8.4859768f, -3.68956909f, -950.204167f, -1028.23839f, -972.513682f, -1012.44665f, -1090.45052f, -44.7383375f,
+  19.8517845f, -37.1452102f, -57.0311596f, 18.7551161f, -7.87882392f, -4.69850505f, -878.036379f, -1012.38542f, -951.431862f, -963.649167f,
+  -993.255783f, -45.5982472f, 17.9569682f, -31.239212f, -30.84649f, 11.9632535f, -8.36895679f, -7.69269853f, -921.145219f, -1081.02788f,
+  -922.775606f, -697.931064f, -646.948903f, -39.1920086f, 21.046461f, -40.6523853f, -48.4326705f, 9.41879237f, -7.84913597f, -9.2593611f,
+  -882.604867f, -1229.78454f, -982.181547f, -1299.2551f, -1103.10793f, -39.8217322f, 17.6084527f, -57.3445459f, -37.1174343f, 5.00102386f,
+  -6.17472227f, -11.3299993f, -923.817319f, -1065.47945f, -911.400982f, -757.200311f, -845.17823f, -43.6538732f, 12.2637672f, -56.1315611f,
+  -32.2076593f, 5.26723803f, -6.48345867f, -10.2244261f, -921.582766f, -1084.52155f, -813.51764f, -747.549876f, -800.459682f, -43.7703412f,
+  15.9710052f, -40.9529696f, -28.0392988f, 3.23043448f, -7.64264138f, -9.86217396f, -946.793722f, -1034.41314f, -814.454318f, -703.276486f,
+  -805.302335f, -41.8513899f, 10.7324283f, -57.7364673f, -25.8443537f, -0.183641844f, -10.7019348f, -8.01564777f, -947.637972f, -1265.33165f,
+  -903.95731f, -937.403804f, -1145.81161f, -44.7304456f, 13.2701879f, -52.1834431f, -26.3991849f, -1.9638509f, -10.7786636f, -4.81515773f,
+  -924.355623f, -1448.46554f, -841.296985f, -1087.56596f, -1177.97037f, -43.0146108f, 17.6158533f, -75.1792806f, -26.5463338f, -2.33852948f,
+  -12.1364714f, -4.34850937f, -989.484424f, -1360.38522f, -845.710515f, -1099.60641f, -1119.54277f, -40.3895124f, 16.5172931f, -79.4457908f,
+  -24.6482734f, -1.56577871f, -10.38964f, -3.15282378f, -1038.09649f, -1427.47495f, -839.94699f, -1068.00873f, -1146.68916f, -42.6728178f,
+  17.114349f, -72.273404f, -21.0892697f, 0.635588255f, -9.4803179f, -2.47645943f, -1027.89979f, -1427.07431f, -796.438329f, -1167.38041f,
+  -1177.57184f, -53.4436141f, 16.3692754f, -71.6773944f, -20.8670317f, 2.37885447f, -11.5475242f, -0.143426748f, -1023.00252f, -1445.68989f,
+  -854.748449f, -1139.89517f, -1149.31925f, -57.7991957f, 16.1114928f, -68.6627943f, -20.1646858f, 3.76846404f, -7.17420486f, 0.964162949f,
+  -1001.02243f, -1384.88348f, -897.521865f, -997.727762f, -1096.23957f, -62.5865833f, 14.4823024f, -76.125517f, -22.4634225f, 2.07167466f,
+  -9.07813302f, 1.17965448f, -956.446219f, -1262.93575f, -855.69355f, -1008.54617f, -1023.62666f, -71.4837515f, 12.5872864f, -68.9451195f,
+  -24.3203612f, 1.60555381f, -11.7822683f, 2.9864867f, -968.27949f, -1305.02793f, -873.647662f, -1044.09839f, -1086.01978f, -73.9776125f,
+  13.3477995f, -69.7093591f, -26.217697f, 2.80243748f, -9.47243396f, 4.12192381f, -1064.7627f, -1318.5559f, -837.428483f, -1046.11675f,
+  -1063.31116f, -75.4989022f, 13.2686052f, -69.2159634f, -28.4256414f, 1.13388994f, -6.77813312f, 5.98584246f, -923.952447f, -1320.22378f,
+  -1006.10825f, -1083.37239f, -997.553741f, -71.2830941f, 14.5230619f, -69.8525513f, -26.2528314f, -3.31756265f, -4.73191612f, 8.36338266f,
+  -1026.29441f, -1065.83628f, -997.112355f, -1089.32667f, -982.879284f, -65.1645975f, 15.4604746f, -60.682999f, -23.0942765f, -8.32936932f,
+  -4.17061866f, 8.47894109f, -1155.79648f, -1341.82884f, -868.849272f, -1125.97059f, -958.211722f, -57.2930358f, 22.2630827f, -60.0433646f,
+  -19.1391555f, -8.04068443f, 0.205056382f, 7.90250166f, -939.85992f, -1372.62214f, -929.355719f, -1161.27185f, -1044.70483f, -66.2681047f,
+  23.8083009f, -42.4770197f, -19.8653901f, -3.54088596f, 4.62099217f, 5.55699181f, -983.143486f, -1386.08843f, -894.127669f, -1138.02615f,
+  -998.676643f, -68.6661156f, 17.7194286f, -65.4383178f, -18.7526032f, -1.85672879f, 10.1884779f, 1.2780241f, -1037.98562f, -1438.4683f,
+  -948.215346f, -1174.84057f, -894.289522f, -65.2449699f, 17.7475075f, -43.3392507f, -20.6019013f, -3.71584193f, 6.55287022f, -2.19462832f,
+  -1090.29564f, -1325.12772f, -917.993971f, -830.58212f, -731.796081f, -72.4759294f, 22.7961488f, -37.1738318f, -20.6971226f, -11.2527692f,
+  6.36033012f, -4.85216381f, -1083.73555f, -1250.01691f, -925.085049f, -797.117547f, -721.712625f, -76.951754f, 17.4049036f, -45.5100324f,
+  -21.6077052f, -17.0462524f, 3.26612665f, -4.1209215f, -1047.12589f, -1303.83458f, -1078.35527f, -986.350353f, -772.801665f, -73.778499f,
+  16.8257874f, -63.536029f, -20.4072083f, -17.9017977f, 2.98143261f, -1.24327185f, -1058.84534f, -835.589603f, -887.892073f, -715.295215f,
+  -588.951885f, -76.7839817f, 22.5397073f, -68.4171709f, -17.2113923f, -17.7797612f, 2.57960164f, 0.845230121f, -888.244882f, -660.098046f,
+  -783.839235f, -606.1516f, -538.435808f, -75.9649415f, 23.3570148f, -62.1276443f, -13.5945649f, -18.6401206f, -0.310638991f, -1.00397702f,
+  -1049.78615f, -902.195024f, -885.340134f, -657.823451f, -760.195993f, -74.2692108f, 27.8722072f, -59.7734165f, -12.8531703f, -20.443045f,
+  1.11624138f, -4.23617456f, -1058.98888f, -939.888022f, -825.028957f, -743.427568f, -631.574727f, -74.6593087f, 19.6813673f, -43.5680376f,
+  -8.36808908f, -19.855498f, 5.54918444f, -7.8019113f, -1101.80264f, -1097.72603f, -929.53814f, -755.523956f, -712.996179f, -60.0438784f,
+  13.7709647f, -76.5190896f, -5.02125463f, -15.5398533f, 7.21960032f, -7.43618021f, -1199.61276f, -1151.35534f, -948.615702f, -767.297368f,
+  -762.107657f, -68.3909778f, 12.3338208f, -71.2922087f, -2.84296938f, -16.3445923f, 9.45555054f, -3.8392507f, -1176.07926f, -974.579435f,
+  -991.862945f, -712.180188f, -691.063378f, -71.4365729f, 8.14441077f, -52.4829586f, -1.4182174f, -12.4155731f, 5.07771081f, 1.74882426f,
+  -1073.58667f, -832.393033f, -926.422884f, -705.783654f, -600.976568f, -74.589084f, 12.9739311f, -65.6874051f, -1.48884124f, -9.87107029f,
+  5.00030983f, 6.12940137f, -1152.80612f, -836.658837f, -901.269152f, -713.020125f, -607.774694f, -68.8191086f, 16.7123059f, -66.2733718f,
+  -2.37992275f, -6.56538298f, 7.66263122f, 5.50057468f, -1018.57445f, -821.440054f, -954.603325f, -715.149996f, -655.323252f, -64.0984843f,
+  17.7460402f, -63.2162012f, -2.92924319f, -3.52410715f, 6.44226223f, 6.25042429f, -1034.72454f, -861.982339f, -905.818765f, -700.223159f,
+  -619.056574f, -82.8821614f, 13.425222f, -54.417135f, -3.37344023f, -2.08742017f, 5.32690652f, 7.45206327f, -1099.14599f, -877.907588f,
+  -869.79604f, -649.625036f, -648.894154f, -73.471491f, 20.0645819f, -44.9248467f, -3.46532429f, -1.15127264f, 5.96674646f, 9.07721033f,
+  -987.24453f, -886.566758f, -878.503266f, -710.769925f, -671.52293f, -76.8604236f, 17.0277293f, -41.7453975f, -3.10039584f, -0.336485885f,
+  4.305818f, 10.1572914f, -1029.38214f, -992.516353f, -810.049253f, -720.800879f, -695.54949f, -67.666733f, 21.3059214f, -43.3601952f,
+  -3.82273625f, -2.51158586f, 4.33453415f, 9.66107366f, -1018.37173f, -968.924976f, -995.08529f, -837.6588f, -655.465434f, -52.6238805f,
+  17.1548036f, -33.1908892f, -5.00089886f, 0.758881657f, 3.88909358f, 7.99021948f, -1015.25611f, -1124.21939f, -1033.88948f, -864.739154f,
+  -716.239593f, -47.6062506f, 21.9138672f, -28.9914258f, -6.91429701f, -1.71518926f, 7.45240295f, 3.97491417f, -1061.9504f, -1040.76565f,
+  -1082.98866f, -747.348934f, -665.095056f, -48.7160515f, 18.4787582f, -48.1350751f, -5.45507698f, -1.44272193f, 12.0031409f, 4.31971877f,
+  -964.484573f, -943.386865f, -1061.26015f, -664.388196f, -702.390833f, -50.4132392f, 15.731128f, -52.770235f, -4.04131158f, 0.957159677f,
+  10.2749173f, 3.43680235f, -903.469394f, -972.28015f, -1016.32191f, -812.159584f, -736.042134f, -43.7856804f, 18.4615736f, -47.6372412f,
+  -4.92905654f, 6.33868818f, 8.88382461f, 6.91299126f, -934.118855f, -984.728769f, -934.0505f, -849.698219f, -701.67511f, -47.6107712f,
+  21.4203154f, -38.4999068f, -8.1158805f, 7.76822911f, 9.11676148f, 7.57392981f, -915.125159f, -1053.43036f, -816.257154f, -765.336389f,
+  -681.850446f, -53.2668494f, 29.3629133f, -33.9340902f, -9.64531043f, 4.74926431f, 5.74141159f, 7.00127364f, -928.736242f, -824.002503f,
+  -700.487009f, -578.911564f, -601.628641f, -51.101858f, 29.8122459f, -34.5187646f, -8.65206674f, 4.19672785f, 1.96018382f, 3.30910016f,
+  -918.243874f, -958.706801f, -849.044966f, -659.195625f, -669.325734f, -45.1487595f, 21.5145492f, -30.3581581f, -10.1711493f, 2.14054305f,
+  3.24689765f, -0.653510225f, -899.127711f, -928.936563f, -826.332711f, -763.92291f, -654.900659f, -42.5752024f, 22.4886779f, -31.8047798f,
+  -9.29534932f, 0.138869033f, 6.64490291f, -2.67476105f, -893.335851f, -1071.28991f, -912.344135f, -742.076725f, -677.033517f, -39.144605f,
+  22.2111792f, -37.0480517f, -9.62284299f, 1.67276547f, 9.48240598f, -0.852754931f, -907.255769f, -1027.57453f, -871.826595f, -640.364475f,
+  -670.209891f, -38.8550445f, 21.3476547f, -38.0249039f, -10.6407594f, 4.47015908f, 9.08303021f, 1.4593481f, -894.842623f, -1017.02869f,
+  -861.397641f, -673.624263f, -667.997429f, -36.5619447f, 28.9503573f, -41.3940773f, -12.2883219f, 5.09786839f, 7.32524564f, 2.16170374f,
+  -906.627302f, -956.27004f, -803.799478f, -655.090678f, -658.28046f, -39.2658044f, 24.5239103f, -51.1562917f, -12.9580912f, 3.00106671f,
+  9.11654852f, 1.77060345f, -907.026817f, -978.614658f, -862.707224f, -667.944033f, -668.208685f, -37.73517f, 22.3162315f, -56.0950886f,
+  -14.869779f, 1.37879153f, 9.79495638f, 2.40268857f, -875.66739f, -1153.86752f, -980.158122f, -671.144313f, -737.463403f, -35.3779652f,
+  17.9683604f, -61.3762458f, -17.0822603f, -0.13655325f, 4.90913156f, 4.43838534f, -887.988991f, -1218.76518f, -944.693427f, -707.489945f,
+  -764.130056f, -35.4413513f, 20.1148463f, -55.2655513f, -13.2800725f, 1.32906371f, 0.393021809f, 7.48930328f, -871.978258f, -1154.9006f,
+  -937.143605f, -752.823811f, -710.798202f, -30.8926758f, 20.6727877f, -54.4896866f, -15.183688f, 3.63256818f, -0.552825585f, 10.1373515f,
+  -831.735003f, -1159.11308f, -996.033064f, -741.848899f, -699.199116f, -31.7314074f, 23.9653884f, -45.2797806f, -17.7132468f, 6.94183545f,
+  -1.67221252f, 12.874971f, -848.281561f, -1157.99576f, -1006.04274f, -727.626633f, -766.603968f, -28.0017923f, 25.4476562f, -41.3311452f,
+  -25.1525351f, 7.64732907f, -0.588431349f, 12.1310801f, -844.397936f, -1033.21906f, -940.061964f, -788.238756f, -806.643578f, -25.1422092f,
+  39.5493021f, -55.8567039f, -27.1445224f, 7.24628727f, 4.17072677f, 8.37340639f, -884.441418f, -1079.95291f, -935.180941f, -771.380402f,
+  -692.392184f, -22.0590058f, 37.6273259f, -51.0241125f, -33.8688175f, 5.3028397f, 6.21237622f, 5.09206791f, -818.524832f, -888.877744f,
+  -861.660461f, -775.771077f, -660.932748f, -19.5336146f, 31.4347313f, -42.4911778f, -37.5169314f, 3.69874471f, 5.74753736f, 1.45973891f
+};
+
 inline void quantizeSentenceFeatures(const float* inFeat, int8_t* outQ) {
   for (int i = 0; i < SENTENCE_KNN_Q_N_FEATURES; ++i) {
     float q = inFeat[i] * pgm_read_float(&SENTENCE_Q_SCALES[i]);
@@ -4025,3 +4894,12 @@ inline void quantizeSentenceFeatures(const float* inFeat, int8_t* outQ) {
     outQ[i] = (int8_t)lrintf(q);
   }
 }
+
+// Raw (unstandardized) features [first, first + count) -> int8 in one pass
+inline void quantizeSentenceRawFeatures(const float* inRaw, int8_t* outQ, int first, int count) {
+  for (int i = 0; i < count; ++i) {
+    float q = inRaw[i] * pgm_read_float(&SENTENCE_Q_AFFINE_A[first + i]) + pgm_read_float(&SENTENCE_Q_AFFINE_B[first + i]);
+    if (q > 127.0f) q = 127.0f; else if (q < -128.0f) q = -128.0f;
+    outQ[i] = (int8_t)lrintf(q);
+  }
+}
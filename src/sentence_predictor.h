@@ -3,6 +3,10 @@
 #include "sentence_label_names.h"
 #include "sentence_scaler_params.h"
 #include "sentence_knn_model_q.h" // Use quantized INT8 model for memory efficiency
+#include "sensor_ring.h"             // SensorSample
+#include "knn_engine.h"              // shared KNN engine (int8 L1 kernels)
+#include "dtw_kernel.h"
+#include "stage_stats.h"
 
 // Note: Remove obsolete hardcoded sample/count defines; rely on header values
 // SENTENCE_KNN_N_NEIGHBORS, SENTENCE_KNN_N_SAMPLES, SENTENCE_KNN_N_FEATURES now come from sentence_knn_model.h
@@ -11,7 +15,10 @@
  * Sentence Predictor
  * 
  * Collects 4-second windows of sensor data and predicts complete sentences.
- * Uses a circular buffer to continuously store recent sensor readings.
+ * One-shot mode records a single window after startRecording().
+ * Continuous mode keeps a circular buffer of the last 80 samples and
+ * predicts on overlapping windows every SENTENCE_HOP_SAMPLES, with vote()
+ * debouncing the per-hop labels.
  */
 
 // Configuration
@@ -20,38 +27,284 @@
 #define SENTENCE_SAMPLES_PER_WINDOW 80    // 4 sec * 20 Hz = 80 samples
 #define SENTENCE_SAMPLES_FOR_PREDICTION 80 // Use all 80 samples (4 sec) - matches training data!
 #define SENTENCE_SAMPLE_INTERVAL_MS (1000 / SENTENCE_SAMPLE_RATE_HZ)  // 50ms
+#define SENTENCE_FEATURES_PER_SAMPLE 12   // f1..f5, gdp, ax, ay, az, gx, gy, gz
+#define SENTENCE_GDP_CHANNEL 5            // only unsigned channel (0 .. 56756)
+
+// Continuous mode: overlapping windows over the last 80 samples
+#define SENTENCE_HOP_SAMPLES 10           // predict every 10 samples (500 ms)
+#define SENTENCE_VOTE_AGREE 3             // consecutive agreeing hops before a sentence is emitted
+
+// Cascaded search: rank rows by a cheap lower bound on the downsampled
+// table (SENTENCE_Q_COARSE, 8x fewer features) and compute the full 960-d
+// distance only for rows whose bound can still beat the current K-th best.
+// The result is identical to the full scan. Needs a model header with the
+// coarse table; SENTENCE_CASCADE=0 always scans.
+#ifndef SENTENCE_CASCADE
+#define SENTENCE_CASCADE 1
+#endif
+#define SENTENCE_CASCADE_SHORTLIST 16     // rows ranked by bound in the first pass
+#if SENTENCE_CASCADE && defined(SENTENCE_KNN_Q_COARSE_FACTOR)
+#define SENTENCE_USE_CASCADE 1
+#else
+#define SENTENCE_USE_CASCADE 0
+#endif
+
+// Banded DTW matching (dtw_kernel.h): models exported with
+// SENTENCE_DTW_BAND (train_sentence_knn.py) carry LB_Keogh envelopes, and
+// neighbours are then ranked by DTW distance over the 80 timesteps instead
+// of rigid L1, so a sentence signed slightly faster or slower still lines
+// up. The same cascade runs with LB_Keogh as the bound, so most rows are
+// dropped before any DTW cell is computed. SENTENCE_DTW=0 ignores the
+// envelopes and matches with L1.
+#ifndef SENTENCE_DTW
+#define SENTENCE_DTW 1
+#endif
+#if SENTENCE_DTW && defined(SENTENCE_KNN_Q_DTW_BAND)
+#define SENTENCE_USE_DTW 1
+#else
+#define SENTENCE_USE_DTW 0
+#endif
+
+// Active sentence tables: compiled-in by default, repointed at a model
+// container by model_loader.h (same layout, K and class count).
+struct SentenceTables {
+  uint32_t numSamples;
+  const int8_t* rows;           // numSamples x SENTENCE_KNN_Q_N_FEATURES
+  const uint8_t* labels;
+#ifdef SENTENCE_KNN_Q_HAS_AFFINE
+  const float* affineA;         // fused standardize + quantize
+  const float* affineB;
+#endif
+#ifdef SENTENCE_KNN_Q_N_BLOCKS
+  const uint16_t* blockOrder;
+#endif
+#ifdef SENTENCE_KNN_Q_COARSE_FACTOR
+  const int16_t* coarse;        // numSamples x SENTENCE_KNN_Q_COARSE_FEATURES, nullptr = none
+#endif
+#ifdef SENTENCE_KNN_Q_DTW_BAND
+  const int8_t* dtwUpper;       // numSamples x SENTENCE_KNN_Q_N_FEATURES LB_Keogh envelopes
+  const int8_t* dtwLower;
+#endif
+};
+
+inline SentenceTables sentence_embedded_tables() {
+  SentenceTables t;
+  t.numSamples = SENTENCE_KNN_Q_N_SAMPLES;
+  t.rows = SENTENCE_TRAINING_DATA_Q;
+  t.labels = SENTENCE_TRAINING_LABELS_Q;
+#ifdef SENTENCE_KNN_Q_HAS_AFFINE
+  t.affineA = SENTENCE_Q_AFFINE_A;
+  t.affineB = SENTENCE_Q_AFFINE_B;
+#endif
+#ifdef SENTENCE_KNN_Q_N_BLOCKS
+  t.blockOrder = SENTENCE_Q_BLOCK_ORDER;
+#endif
+#ifdef SENTENCE_KNN_Q_COARSE_FACTOR
+  t.coarse = SENTENCE_Q_COARSE;
+#endif
+#ifdef SENTENCE_KNN_Q_DTW_BAND
+  t.dtwUpper = SENTENCE_Q_DTW_UPPER;
+  t.dtwLower = SENTENCE_Q_DTW_LOWER;
+#endif
+  return t;
+}
+
+SentenceTables sentenceTables = sentence_embedded_tables();
+
+// PCA sentence models (SENTENCE_PCA_COMPONENTS in train_sentence_knn.py)
+// keep the KNN in the projected space: SENTENCE_KNN_Q_N_FEATURES is then
+// the component count and the query is W * standardized window.
+#if defined(SENTENCE_KNN_Q_PCA_COMPONENTS) && \
+    SENTENCE_KNN_Q_RAW_FEATURES != SENTENCE_SAMPLES_FOR_PREDICTION * SENTENCE_FEATURES_PER_SAMPLE
+#error "PCA sentence model was trained on a different window"
+#endif
+#if defined(SENTENCE_KNN_Q_PCA_COMPONENTS) && defined(SENTENCE_KNN_Q_DTW_BAND)
+#error "DTW needs the per-timestep sentence features, not PCA components"
+#endif
+
+// Sentence KNN distance: L1 over the variance-ordered timestep blocks,
+// abandoned once it reaches the current K-th best.
+struct SentenceQDistance {
+  uint32_t operator()(const int8_t* a, const int8_t* b, uint32_t bound) const {
+#ifdef SENTENCE_KNN_Q_N_BLOCKS
+    return l1_distance_i8_bounded(a, b, sentenceTables.blockOrder, SENTENCE_KNN_Q_N_BLOCKS,
+                                  SENTENCE_KNN_Q_BLOCK_LEN, bound);
+#else
+    (void)bound;
+    return l1_distance_i8(a, b, SENTENCE_KNN_Q_N_FEATURES);
+#endif
+  }
+};
+
+#if SENTENCE_USE_CASCADE
+// Cascade bound: L1 between the downsampled query and row (<= full L1)
+struct SentenceCoarseBound {
+  int16_t q[SENTENCE_KNN_Q_COARSE_FEATURES];
+
+  explicit SentenceCoarseBound(const int8_t* qQuery) {
+    const int F = SENTENCE_KNN_Q_COARSE_FACTOR;
+    const int B = SENTENCE_FEATURES_PER_SAMPLE;
+    // Same sums as the exported table
+    for (int c = 0; c < SENTENCE_KNN_Q_COARSE_FEATURES; c++) {
+      const int8_t* p = qQuery + (c / B) * F * B + c % B;
+      int sum = 0;
+      for (int k = 0; k < F; k++) sum += p[k * B];
+      q[c] = (int16_t)sum;
+    }
+  }
+
+  uint32_t operator()(int i, uint32_t) const {
+    const int C = SENTENCE_KNN_Q_COARSE_FEATURES;
+    return l1_distance_i16(q, sentenceTables.coarse + (size_t)i * C, C);
+  }
+};
+#endif
+
+#if SENTENCE_USE_DTW
+struct SentenceDtwDistance {
+  uint32_t operator()(const int8_t* a, const int8_t* b, uint32_t bound) const {
+    return dtw_distance_i8<SENTENCE_SAMPLES_FOR_PREDICTION, SENTENCE_FEATURES_PER_SAMPLE,
+                           SENTENCE_KNN_Q_DTW_BAND>(a, b, bound);
+  }
+};
+
+// Cascade bound: LB_Keogh of the query against row i's envelopes (<= DTW)
+struct SentenceKeoghBound {
+  const int8_t* q;
+
+  explicit SentenceKeoghBound(const int8_t* qQuery) : q(qQuery) {}
+
+  uint32_t operator()(int i, uint32_t bound) const {
+    const size_t off = (size_t)i * SENTENCE_KNN_Q_N_FEATURES;
+    return lb_keogh_i8(q, sentenceTables.dtwUpper + off, sentenceTables.dtwLower + off,
+                       SENTENCE_KNN_Q_N_FEATURES, bound);
+  }
+};
+#endif
+
+// One window of raw samples as int16 channels (struct of arrays): the
+// sources are 12-bit ADC and int16 IMU values, so this is exact except for
+// gdp, which is rounded to an integer and kept as uint16.
+struct SentenceWindow {
+  int16_t ch[SENTENCE_FEATURES_PER_SAMPLE][SENTENCE_SAMPLES_PER_WINDOW];
+  uint8_t count;              // samples in the window (one-shot may end short)
+
+  void put(uint8_t t, const SensorSample& s) {
+    ch[0][t] = toInt16(s.f1);  ch[1][t] = toInt16(s.f2);  ch[2][t] = toInt16(s.f3);
+    ch[3][t] = toInt16(s.f4);  ch[4][t] = toInt16(s.f5);
+    ch[SENTENCE_GDP_CHANNEL][t] = toUint16Bits(s.gdp);
+    ch[6][t] = toInt16(s.ax);  ch[7][t] = toInt16(s.ay);  ch[8][t] = toInt16(s.az);
+    ch[9][t] = toInt16(s.gx);  ch[10][t] = toInt16(s.gy); ch[11][t] = toInt16(s.gz);
+  }
 
-// Circular buffer for sensor samples
-struct SensorSample {
-  float f1, f2, f3, f4, f5;  // Flex sensors (RAW values, match training logs)
-  float gdp;                  // Gyro magnitude
-  float ax, ay, az;           // Accelerometer (g)
-  float gx, gy, gz;           // Gyroscope (deg/s)
+  // Raw value of channel j at sample t, in the units the model was trained on
+  float value(int j, int t) const {
+    return j == SENTENCE_GDP_CHANNEL ? (float)(uint16_t)ch[j][t] : (float)ch[j][t];
+  }
+
+  static int16_t toInt16(float v) {
+    long r = lrintf(v);
+    return (int16_t)(r > 32767 ? 32767 : (r < -32768 ? -32768 : r));
+  }
+
+  static int16_t toUint16Bits(float v) {
+    long r = lrintf(v);
+    return (int16_t)(uint16_t)(r > 65535 ? 65535 : (r < 0 ? 0 : r));
+  }
 };
 
 class SentencePredictor {
 private:
-  SensorSample buffer[SENTENCE_SAMPLES_PER_WINDOW];
-  uint8_t bufferIndex;
+  // Double buffer: addSample() fills windows[fillWindow] while predict()
+  // reads the other one. A finished one-shot window is handed over by
+  // flipping fillWindow; continuous mode copies its ring out oldest-first
+  // on every hop, so inference always sees one linear window.
+  SentenceWindow windows[2];
+  uint8_t fillWindow;
+  uint8_t bufferIndex;        // one-shot: samples so far; continuous: ring slot of the oldest
   uint32_t lastSampleTime;
   bool bufferFilled;
   bool isRecording;
   uint32_t recordingStartTime;
   int restLabelIndex = -1;  // resolved lazily from label names
 
+  // Continuous mode state (windows[fillWindow] is used as a true ring)
+  bool isContinuous;
+  uint8_t sampleCount;      // samples in the ring, saturates at SENTENCE_SAMPLES_PER_WINDOW
+  uint8_t hopCounter;       // samples since the last hop prediction
+  uint8_t hopSamples;       // samples per hop (SENTENCE_HOP_SAMPLES by default)
+  uint8_t lastHopLabel;
+  uint8_t voteRun;          // consecutive hops that agreed on lastHopLabel
+  int lastEmittedLabel;     // -1 = nothing emitted since the last Rest
+  uint8_t lastPrediction;   // result of the latest predict()
+
 public:
   SentencePredictor() 
-    : bufferIndex(0), lastSampleTime(0), bufferFilled(false), 
-      isRecording(false), recordingStartTime(0) 
-  {}
+    : fillWindow(0), bufferIndex(0), lastSampleTime(0), bufferFilled(false), 
+      isRecording(false), recordingStartTime(0),
+      isContinuous(false), sampleCount(0), hopCounter(0),
+      hopSamples(SENTENCE_HOP_SAMPLES), lastHopLabel(0), voteRun(0), lastEmittedLabel(-1),
+      lastPrediction(0)
+  {
+    memset(windows, 0, sizeof(windows));
+  }
+
+  // Start continuous recognition: the window slides over the last 80
+  // samples and addSample() signals a prediction every SENTENCE_HOP_SAMPLES.
+  // keepLastWindow: right after a one-shot prediction, start from that
+  // window instead of an empty one, so the next hop comes after
+  // hopSamples rather than a whole new window (that sentence is not
+  // emitted again).
+  void startContinuous(bool keepLastWindow = false) {
+    const SentenceWindow& last = windows[fillWindow ^ 1];
+    bool keep = keepLastWindow && last.count > 0;
+
+    isContinuous = true;
+    isRecording = false;
+    bufferFilled = false;
+    hopCounter = 0;
+    voteRun = 0;
+    lastEmittedLabel = -1;
+
+    SentenceWindow& ring = windows[fillWindow];
+    if (keep) {
+      memcpy(ring.ch, last.ch, sizeof(ring.ch));
+      sampleCount = last.count;
+      bufferIndex = (uint8_t)(sampleCount % SENTENCE_SAMPLES_PER_WINDOW);
+      resolveRestLabel();
+      if ((int)lastPrediction != restLabelIndex) lastEmittedLabel = lastPrediction;
+    } else {
+      memset(ring.ch, 0, sizeof(ring.ch));
+      sampleCount = 0;
+      bufferIndex = 0;
+    }
+    ring.count = sampleCount;
+  }
+
+  bool continuous() const {
+    return isContinuous;
+  }
+
+  // Continuous mode hop length in samples (1 .. one full window)
+  void setHopSamples(uint8_t samples) {
+    if (samples < 1) samples = 1;
+    if (samples > SENTENCE_SAMPLES_PER_WINDOW) samples = SENTENCE_SAMPLES_PER_WINDOW;
+    hopSamples = samples;
+    hopCounter = 0;
+  }
+
+  uint8_t getHopSamples() const {
+    return hopSamples;
+  }
 
   // Start recording a 4-second window
   void startRecording() {
+    isContinuous = false;
     isRecording = true;
     recordingStartTime = millis();
     bufferIndex = 0;
     bufferFilled = false;
-    memset(buffer, 0, sizeof(buffer));
+    windows[fillWindow].count = 0;
   }
 
   // Check if currently recording
@@ -60,7 +313,9 @@ public:
   }
 
   // Get recording progress (0.0 to 1.0)
+  // In continuous mode this is how full the sliding window is.
   float getRecordingProgress() const {
+    if (isContinuous) return (float)sampleCount / (float)SENTENCE_SAMPLES_PER_WINDOW;
     if (!isRecording) return 0.0f;
     uint32_t elapsed = millis() - recordingStartTime;
     return min(1.0f, (float)elapsed / (float)SENTENCE_WINDOW_DURATION_MS);
@@ -79,47 +334,48 @@ public:
   bool addSample(float f1, float f2, float f3, float f4, float f5,
                  float gdp, float ax, float ay, float az,
                  float gx, float gy, float gz) {
+    SensorSample s;
+    s.f1 = f1; s.f2 = f2; s.f3 = f3; s.f4 = f4; s.f5 = f5;
+    s.gdp = gdp;
+    s.ax = ax; s.ay = ay; s.az = az;
+    s.gx = gx; s.gy = gy; s.gz = gz;
+    s.tMs = millis();
+    return addSample(s);
+  }
+
+  // Same as above for a timestamped sample from the acquisition ring.
+  // Decimation to SENTENCE_SAMPLE_RATE_HZ uses the sample timestamp, so the
+  // window spacing follows the acquisition timer rather than loop() timing.
+  bool addSample(const SensorSample& s) {
     
+    if (isContinuous) return addContinuousSample(s);
     if (!isRecording) return false;
 
-    uint32_t now = millis();
+    uint32_t now = s.tMs;
     
     // Check if enough time has passed since last sample
     if (now - lastSampleTime < SENTENCE_SAMPLE_INTERVAL_MS) {
       return false;
     }
     
-    // Store sample
-    buffer[bufferIndex].f1 = f1;
-    buffer[bufferIndex].f2 = f2;
-    buffer[bufferIndex].f3 = f3;
-    buffer[bufferIndex].f4 = f4;
-    buffer[bufferIndex].f5 = f5;
-    buffer[bufferIndex].gdp = gdp;
-    buffer[bufferIndex].ax = ax;
-    buffer[bufferIndex].ay = ay;
-    buffer[bufferIndex].az = az;
-    buffer[bufferIndex].gx = gx;
-    buffer[bufferIndex].gy = gy;
-    buffer[bufferIndex].gz = gz;
+    // Store sample; the window is timed from the first sample's timestamp
+    // so replayed logs (virtual time) close it at the same point
+    if (bufferIndex == 0) recordingStartTime = now;
+    windows[fillWindow].put(bufferIndex, s);
     
     lastSampleTime = now;
     bufferIndex++;
     
-    // Check if window is complete
-    if (bufferIndex >= SENTENCE_SAMPLES_PER_WINDOW) {
+    // Window complete after 80 samples, or when 4 seconds elapsed (fallback)
+    if (bufferIndex >= SENTENCE_SAMPLES_PER_WINDOW ||
+        now - recordingStartTime >= SENTENCE_WINDOW_DURATION_MS) {
+      windows[fillWindow].count = bufferIndex;
+      fillWindow ^= 1;      // hand the window to predict()
       bufferFilled = true;
       isRecording = false;  // Stop recording
       return true;  // Ready for prediction
     }
     
-    // Check if 3 seconds elapsed (fallback)
-    if (now - recordingStartTime >= SENTENCE_WINDOW_DURATION_MS) {
-      bufferFilled = true;
-      isRecording = false;
-      return true;
-    }
-    
     return false;
   }
 
@@ -131,75 +387,48 @@ public:
       return 0;
     }
 
-    // Build feature vector (flatten buffer)
-    float features[SENTENCE_NUM_FEATURES];
-    int idx = 0;
-    
-    // If we collected fewer than target samples (due to timing), resample to 80 via linear interpolation
-    int collected = min((int)SENTENCE_SAMPLES_PER_WINDOW, (int)bufferIndex);
-    if (collected < (int)SENTENCE_SAMPLES_FOR_PREDICTION) {
-      // Precompute mapping from target index to source fractional index
-      for (int t = 0; t < SENTENCE_SAMPLES_FOR_PREDICTION; t++) {
-        float srcPos = (collected > 1)
-          ? (float)t * (float)(collected - 1) / (float)(SENTENCE_SAMPLES_FOR_PREDICTION - 1)
-          : 0.0f;
-        int i0 = (int)floorf(srcPos);
-        int i1 = (int)ceilf(srcPos);
-        float w = srcPos - (float)i0;
-
-        const SensorSample& s0 = buffer[i0];
-        const SensorSample& s1 = buffer[i1];
-
-        auto lerp = [w](float a, float b) { return a + w * (b - a); };
-
-        features[idx++] = lerp(s0.f1, s1.f1);
-        features[idx++] = lerp(s0.f2, s1.f2);
-        features[idx++] = lerp(s0.f3, s1.f3);
-        features[idx++] = lerp(s0.f4, s1.f4);
-        features[idx++] = lerp(s0.f5, s1.f5);
-        features[idx++] = lerp(s0.gdp, s1.gdp);
-        features[idx++] = lerp(s0.ax, s1.ax);
-        features[idx++] = lerp(s0.ay, s1.ay);
-        features[idx++] = lerp(s0.az, s1.az);
-        features[idx++] = lerp(s0.gx, s1.gx);
-        features[idx++] = lerp(s0.gy, s1.gy);
-        features[idx++] = lerp(s0.gz, s1.gz);
-      }
-    } else {
-      // Exact 80 samples collected; copy directly
-      for (int t = 0; t < SENTENCE_SAMPLES_FOR_PREDICTION; t++) {
-        features[idx++] = buffer[t].f1;
-        features[idx++] = buffer[t].f2;
-        features[idx++] = buffer[t].f3;
-        features[idx++] = buffer[t].f4;
-        features[idx++] = buffer[t].f5;
-        features[idx++] = buffer[t].gdp;
-        features[idx++] = buffer[t].ax;
-        features[idx++] = buffer[t].ay;
-        features[idx++] = buffer[t].az;
-        features[idx++] = buffer[t].gx;
-        features[idx++] = buffer[t].gy;
-        features[idx++] = buffer[t].gz;
+    // Flatten the buffer (resampled to 80 if needed) straight into the int8
+    // query. Standardize + quantize are fused into one multiply-add per
+    // feature (or, for PCA models, accumulated into the projection), so no
+    // 960-float feature vector is built on the stack.
+    static int8_t qQuery[SENTENCE_KNN_Q_N_FEATURES] __attribute__((aligned(4)));
+    const SentenceWindow& window = windows[fillWindow ^ 1];
+    {
+      STATS_SCOPE(STAT_SENTENCE_QUANTIZE);
+      beginQuery();
+
+      // If we collected fewer than target samples (due to timing), resample to 80 via linear interpolation
+      int collected = window.count;
+      if (collected < (int)SENTENCE_SAMPLES_FOR_PREDICTION) {
+        float frame[SENTENCE_FEATURES_PER_SAMPLE];
+        // Precompute mapping from target index to source fractional index
+        for (int t = 0; t < SENTENCE_SAMPLES_FOR_PREDICTION; t++) {
+          float srcPos = (collected > 1)
+            ? (float)t * (float)(collected - 1) / (float)(SENTENCE_SAMPLES_FOR_PREDICTION - 1)
+            : 0.0f;
+          int i0 = (int)floorf(srcPos);
+          int i1 = (int)ceilf(srcPos);
+          float w = srcPos - (float)i0;
+
+          for (int j = 0; j < SENTENCE_FEATURES_PER_SAMPLE; j++) {
+            float v0 = window.value(j, i0);
+            frame[j] = v0 + w * (window.value(j, i1) - v0);
+          }
+          quantizeFrame(t, frame, qQuery);
+        }
+      } else {
+        // Exact 80 samples collected; quantize channel by channel
+        for (int j = 0; j < SENTENCE_FEATURES_PER_SAMPLE; j++) {
+          quantizeChannel(j, window, qQuery);
+        }
       }
+      finishQuery(qQuery);
     }
 
-    // Standardize features
-    standardizeSentenceFeatures(features);
-
     // KNN prediction (Manhattan distance with distance-weighted voting)
-    uint8_t rawPred = predictSentenceKNN(features, meanDistance);
-
-    // Resolve 'Rest' index lazily (or 'Unknown' if present)
-    if (restLabelIndex < 0) {
-      for (int i = 0; i < SENTENCE_NUM_CLASSES; ++i) {
-        const char* nm = sentence_label_names[i];
-        if ((nm && strcmp(nm, "Rest") == 0) || (nm && strcmp(nm, "Unknown") == 0)) {
-          restLabelIndex = i;
-          break;
-        }
-      }
-      if (restLabelIndex < 0) restLabelIndex = 0; // fallback
-    }
+    uint8_t rawPred = predictSentenceKNN(qQuery, meanDistance);
+
+    resolveRestLabel();
 
     // TEMPORARY: Raise rejection threshold until we collect int8 distance stats.
     // Previous 12000 value was for float space; int8 Manhattan distances are larger.
@@ -211,6 +440,7 @@ public:
       finalPred = (uint8_t)restLabelIndex;
       overridden = true;
     }
+    lastPrediction = finalPred;
 
 #ifdef SENTENCE_DEBUG
   Serial.print("{\"debug\":\"sentence_pred\",\"rawPred\":");
@@ -227,82 +457,231 @@ public:
     return finalPred;
   }
 
+  // Continuous mode debounce. Feed every hop prediction; returns true (and
+  // the sentence in outLabel) only when SENTENCE_VOTE_AGREE consecutive
+  // overlapping windows agree on a label that was not just emitted.
+  // Rest is never emitted, but it re-arms the same sentence.
+  bool vote(uint8_t label, uint8_t* outLabel) {
+    if (voteRun > 0 && label == lastHopLabel) {
+      if (voteRun < 255) voteRun++;
+    } else {
+      lastHopLabel = label;
+      voteRun = 1;
+    }
+
+    if (voteRun < SENTENCE_VOTE_AGREE) return false;
+
+    resolveRestLabel();
+    if ((int)label == restLabelIndex) {
+      lastEmittedLabel = -1;
+      return false;
+    }
+    if ((int)label == lastEmittedLabel) return false;
+
+    lastEmittedLabel = label;
+    *outLabel = label;
+    return true;
+  }
+
   // Reset buffer
   void reset() {
     bufferIndex = 0;
     bufferFilled = false;
     isRecording = false;
+    isContinuous = false;
+    sampleCount = 0;
+    hopCounter = 0;
   }
 
 private:
-  // KNN prediction using Manhattan distance (L1) with distance-weighted voting
-  uint8_t predictSentenceKNN(const float* queryStd, float* outMeanDist) {
-    // Quantize query (already standardized) to int8
-    static int8_t qQuery[SENTENCE_KNN_Q_N_FEATURES];
-    quantizeSentenceFeatures(queryStd, qQuery);
+  // Continuous mode: push into the ring, return true every hop once full.
+  bool addContinuousSample(const SensorSample& s) {
+    uint32_t now = s.tMs;
+    if (sampleCount > 0 && now - lastSampleTime < SENTENCE_SAMPLE_INTERVAL_MS) {
+      return false;
+    }
+    lastSampleTime = now;
 
-    const int K = SENTENCE_KNN_Q_N_NEIGHBORS;
-    const int N = SENTENCE_KNN_Q_N_SAMPLES;
-    const int D = SENTENCE_KNN_Q_N_FEATURES;
+    windows[fillWindow].put(bufferIndex, s);
+    bufferIndex = (uint8_t)((bufferIndex + 1) % SENTENCE_SAMPLES_PER_WINDOW);
 
-    // Arrays to store K nearest neighbors
-    float nearestDist[K];
-    uint8_t nearestLabels[K];
-    
-    // Initialize with large distances
-    for (int i = 0; i < K; i++) {
-      nearestDist[i] = 1e9;
-      nearestLabels[i] = 0;
+    if (sampleCount < SENTENCE_SAMPLES_PER_WINDOW) {
+      sampleCount++;
+      if (sampleCount < SENTENCE_SAMPLES_PER_WINDOW) return false;
+      // First full window: predict right away
+      hopCounter = 0;
+      publishRing();
+      return true;
     }
 
-    // Find K nearest neighbors
-    for (int i = 0; i < N; i++) {
-      // Calculate Manhattan distance (must match training)
-      float dist = 0.0f;
-      
-      for (int d = 0; d < D; d++) {
-        int8_t train_q = pgm_read_byte(&SENTENCE_TRAINING_DATA_Q[i * D + d]);
-        int diff = (int)qQuery[d] - (int)train_q;
-        dist += (diff >= 0 ? diff : -diff); // Manhattan distance in quantized space
-      }
+    if (++hopCounter < hopSamples) return false;
+    hopCounter = 0;
+    publishRing();
+    return true;
+  }
 
-      // Insert into K nearest if closer than current worst
-      if (dist < nearestDist[K-1]) {
-        // Find insertion position
-        int pos = K - 1;
-        while (pos > 0 && dist < nearestDist[pos - 1]) {
-          pos--;
-        }
-        
-        // Shift and insert
-        for (int j = K - 1; j > pos; j--) {
-          nearestDist[j] = nearestDist[j - 1];
-          nearestLabels[j] = nearestLabels[j - 1];
-        }
-        
-        nearestDist[pos] = dist;
-        nearestLabels[pos] = pgm_read_byte(&SENTENCE_TRAINING_LABELS_Q[i]);
+  // Copy the continuous ring, oldest first, into the window predict() reads
+  void publishRing() {
+    const SentenceWindow& ring = windows[fillWindow];
+    SentenceWindow& out = windows[fillWindow ^ 1];
+    const size_t older = (SENTENCE_SAMPLES_PER_WINDOW - bufferIndex) * sizeof(int16_t);
+    for (int j = 0; j < SENTENCE_FEATURES_PER_SAMPLE; j++) {
+      memcpy(out.ch[j], ring.ch[j] + bufferIndex, older);
+      memcpy((uint8_t*)out.ch[j] + older, ring.ch[j], bufferIndex * sizeof(int16_t));
+    }
+    out.count = SENTENCE_SAMPLES_PER_WINDOW;
+    bufferFilled = true;
+  }
+
+  // Resolve 'Rest' index lazily (or 'Unknown' if present)
+  void resolveRestLabel() {
+    if (restLabelIndex >= 0) return;
+    for (int i = 0; i < SENTENCE_NUM_CLASSES; ++i) {
+      const char* nm = sentence_label_names[i];
+      if ((nm && strcmp(nm, "Rest") == 0) || (nm && strcmp(nm, "Unknown") == 0)) {
+        restLabelIndex = i;
+        break;
       }
     }
+    if (restLabelIndex < 0) restLabelIndex = 0; // fallback
+  }
 
-    // Distance-weighted voting (matches training weights='distance')
-    const int numClasses = SENTENCE_NUM_CLASSES;
-    float weightSums[numClasses];
-    for (int i = 0; i < numClasses; i++) weightSums[i] = 0.0f;
-    for (int i = 0; i < K; i++) {
-      float w = 1.0f / (nearestDist[i] + 1e-6f); // inverse distance weighting
-      weightSums[nearestLabels[i]] += w;
+  // Raw value v of window element idx (t * 12 + j) -> query
+  static void queryElement(int idx, float v, int8_t* qQuery) {
+#if defined(SENTENCE_KNN_Q_PCA_COMPONENTS)
+    // Standardize, then accumulate this element's column of the projection
+    (void)qQuery;
+    const float z = (v - SENTENCE_SCALER_MEAN[idx]) / SENTENCE_SCALER_SCALE[idx];
+    const int8_t* w = SENTENCE_Q_PCA_W + (size_t)idx * SENTENCE_KNN_Q_PCA_COMPONENTS;
+    for (int k = 0; k < SENTENCE_KNN_Q_PCA_COMPONENTS; k++) {
+      pcaAcc[k] += (float)(int8_t)pgm_read_byte(&w[k]) * z;
     }
+#else
+#ifdef SENTENCE_KNN_Q_HAS_AFFINE
+    float q = v * pgm_read_float(&sentenceTables.affineA[idx]) + pgm_read_float(&sentenceTables.affineB[idx]);
+#else
+    // Older model headers: standardize and quantize per element
+    float q = (v - SENTENCE_SCALER_MEAN[idx]) / SENTENCE_SCALER_SCALE[idx] * pgm_read_float(&SENTENCE_Q_SCALES[idx]);
+#endif
+    if (q > 127.0f) q = 127.0f; else if (q < -128.0f) q = -128.0f;
+    qQuery[idx] = (int8_t)lrintf(q);
+#endif
+  }
 
-    // Pick label with largest accumulated weight
-    uint8_t bestLabel = 0;
-    float bestWeight = -1.0f;
-    for (int i = 0; i < numClasses; i++) {
-      if (weightSums[i] > bestWeight) {
-        bestWeight = weightSums[i];
-        bestLabel = i;
-      }
+  // Raw frame t -> query elements [t * 12, t * 12 + 12)
+  static void quantizeFrame(int t, const float* frame, int8_t* qQuery) {
+    const int first = t * SENTENCE_FEATURES_PER_SAMPLE;
+    for (int j = 0; j < SENTENCE_FEATURES_PER_SAMPLE; j++) queryElement(first + j, frame[j], qQuery);
+  }
+
+  // Channel j of a full window -> query elements t * 12 + j (the model's
+  // layout is time-major)
+  static void quantizeChannel(int j, const SentenceWindow& window, int8_t* qQuery) {
+    for (int t = 0; t < SENTENCE_SAMPLES_FOR_PREDICTION; t++) {
+      queryElement(t * SENTENCE_FEATURES_PER_SAMPLE + j, window.value(j, t), qQuery);
+    }
+  }
+
+#if defined(SENTENCE_KNN_Q_PCA_COMPONENTS)
+  // Projected window, before the per-component gain / offset
+  static float pcaAcc[SENTENCE_KNN_Q_PCA_COMPONENTS];
+#endif
+
+  static void beginQuery() {
+#if defined(SENTENCE_KNN_Q_PCA_COMPONENTS)
+    for (int k = 0; k < SENTENCE_KNN_Q_PCA_COMPONENTS; k++) pcaAcc[k] = 0.0f;
+#endif
+  }
+
+  // PCA models: components -> int8 query (int8 weights * gain + offset)
+  static void finishQuery(int8_t* qQuery) {
+#if defined(SENTENCE_KNN_Q_PCA_COMPONENTS)
+    for (int k = 0; k < SENTENCE_KNN_Q_PCA_COMPONENTS; k++) {
+      float q = pcaAcc[k] * pgm_read_float(&SENTENCE_Q_PCA_GAIN[k]) + pgm_read_float(&SENTENCE_Q_PCA_OFFSET[k]);
+      if (q > 127.0f) q = 127.0f; else if (q < -128.0f) q = -128.0f;
+      qQuery[k] = (int8_t)lrintf(q);
+    }
+#else
+    (void)qQuery;
+#endif
+  }
+
+#if SENTENCE_USE_CASCADE || SENTENCE_USE_DTW
+  // Full distance of row i, unless it provably cannot enter `nearest`.
+  // Rows are not visited in index order here, so only candidates strictly
+  // worse than the K-th best are dropped (bound + 1); ties then resolve by
+  // row exactly as in the ascending full scan.
+  template <typename Dist>
+  static void cascadeVisit(const int8_t* qQuery, int i, uint32_t lowerBound, const Dist& dist,
+                           KnnTopK<SENTENCE_KNN_Q_N_NEIGHBORS, uint32_t>& nearest) {
+    uint32_t bound = nearest.bound();
+    if (lowerBound > bound) return;
+    if (bound < UINT32_MAX) bound++;
+    const int8_t* row = sentenceTables.rows + (size_t)i * SENTENCE_KNN_Q_N_FEATURES;
+    nearest.insert(dist(qQuery, row, bound), i);
+  }
+
+  // lowerBound(i, bound) never exceeds dist() of row i (it may stop early
+  // once it reaches `bound`), so the result equals a full scan with dist.
+  template <typename Bound, typename Dist>
+  static void cascadeSearch(const int8_t* qQuery, int n, const Bound& lowerBound, const Dist& dist,
+                            KnnTopK<SENTENCE_KNN_Q_N_NEIGHBORS, uint32_t>& nearest) {
+    // Pass 1: the SHORTLIST smallest bounds, then full distances in that order
+    KnnTopK<SENTENCE_CASCADE_SHORTLIST, uint32_t> shortlist;
+    shortlist.reset(UINT32_MAX);
+    for (int i = 0; i < n; i++) {
+      shortlist.insert(lowerBound(i, shortlist.bound()), i);
+    }
+    for (int m = 0; m < SENTENCE_CASCADE_SHORTLIST && shortlist.row[m] >= 0; m++) {
+      cascadeVisit(qQuery, shortlist.row[m], shortlist.dist[m], dist, nearest);
+    }
+
+    // Pass 2: rows past the shortlist all have bounds >= its last entry;
+    // only needed while that can still beat the K-th best
+    if (shortlist.row[SENTENCE_CASCADE_SHORTLIST - 1] < 0 || shortlist.bound() > nearest.bound()) return;
+    for (int i = 0; i < n; i++) {
+      bool listed = false;
+      for (int m = 0; m < SENTENCE_CASCADE_SHORTLIST; m++) listed |= shortlist.row[m] == i;
+      if (listed) continue;
+      const uint32_t bound = nearest.bound();
+      cascadeVisit(qQuery, i, lowerBound(i, bound < UINT32_MAX ? bound + 1 : bound), dist, nearest);
     }
+  }
+#endif
+
+  // KNN prediction using Manhattan distance (L1) with distance-weighted voting
+  uint8_t predictSentenceKNN(const int8_t* qQuery, float* outMeanDist) {
+    const int K = SENTENCE_KNN_Q_N_NEIGHBORS;
+    const int N = (int)sentenceTables.numSamples;
+
+    // Find K nearest neighbors (integer L1 or banded DTW distances in
+    // quantized space, must match training)
+    KnnTopK<K, uint32_t> nearest;
+    nearest.reset(UINT32_MAX);
+    {
+      STATS_SCOPE(STAT_SENTENCE_SCAN);
+#if SENTENCE_USE_DTW
+      cascadeSearch(qQuery, N, SentenceKeoghBound(qQuery), SentenceDtwDistance(), nearest);
+#else
+#if SENTENCE_USE_CASCADE
+      if (sentenceTables.coarse) cascadeSearch(qQuery, N, SentenceCoarseBound(qQuery), SentenceQDistance(), nearest);
+      else
+#endif
+      knn_scan<int8_t, SENTENCE_KNN_Q_N_FEATURES, K>(qQuery, sentenceTables.rows, N, SentenceQDistance(), nearest);
+#endif
+    }
+
+    STATS_SCOPE(STAT_SENTENCE_VOTE);
+
+    float nearestDist[K];
+    uint8_t nearestLabels[K];
+    for (int i = 0; i < K; i++) {
+      nearestDist[i] = (float)nearest.dist[i];
+      nearestLabels[i] = nearest.row[i] < 0 ? 0 : pgm_read_byte(&sentenceTables.labels[nearest.row[i]]);
+    }
+
+    // Distance-weighted voting (matches training weights='distance')
+    uint8_t bestLabel = knn_vote<SENTENCE_NUM_CLASSES, K, 1>(nearestDist, nearestLabels, 1e-6f);
 
     // Calculate mean distance of K neighbors
     float sumDist = 0.0f;
@@ -313,3 +692,7 @@ private:
     return bestLabel;
   }
 };
+
+#if defined(SENTENCE_KNN_Q_PCA_COMPONENTS)
+float SentencePredictor::pcaAcc[SENTENCE_KNN_Q_PCA_COMPONENTS];
+#endif
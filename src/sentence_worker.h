@@ -0,0 +1,295 @@
+#pragma once
+#include <Arduino.h>
+#include "sensor_ring.h"
+#include "sentence_predictor.h"
+
+// ----------- Sentence scoring task (core 0) -----------
+//
+// SentencePipeline turns acquisition samples and control requests (record
+// one window, run continuously, hop length, reset) into result events:
+// recording progress, the one-shot result, per-hop labels and voted
+// sentences. SentenceWorker runs it as a FreeRTOS task on core 0, next to
+// acquisition and below it in priority, so in AUTO mode loop() keeps
+// classifying gestures on core 1 while a sentence window is scored.
+//
+// loop() forwards each acquisition sample (the predictor decimates to
+// SENTENCE_SAMPLE_RATE_HZ itself) and prints the events, so all output
+// still leaves from one place and in one stream, tagged by source
+// ("mode":"gesture" / "sentence", binary: frame type).
+//
+// Both directions are SPSC rings; requests are applied in order with the
+// samples, so the predictor is only ever touched by the task.
+//
+// The model tables (sentenceTables) are not: loop() repoints them and
+// unmaps the models partition on MODEL UPLOAD. pause() parks the task
+// between two inputs and returns once it is parked, so no scan is running
+// while the tables or the mapping change; resume() lets it go on.
+// SENTENCE_WORKER=0 (or a failed task start) runs the pipeline inline in
+// loop().
+
+#ifndef SENTENCE_WORKER
+#define SENTENCE_WORKER 1
+#endif
+
+#define SENTENCE_WORKER_CORE   0
+#define SENTENCE_WORKER_PRIO   2      // below ACQ_TASK_PRIO
+#define SENTENCE_WORKER_STACK  6144
+#define SENTENCE_INPUT_RING    32     // ~320 ms of 100 Hz samples
+#define SENTENCE_EVENT_RING    8
+#define SENTENCE_POST_WAIT_MS  50     // control requests wait this long for room
+#define SENTENCE_PAUSE_WAIT_MS 2000   // pause() gives up when a scan takes longer
+
+enum SentenceRequest : uint8_t {
+  SENTENCE_REQ_SAMPLE = 0,
+  SENTENCE_REQ_RECORD,          // one-shot window; arg 1 = go continuous after the result
+  SENTENCE_REQ_CONTINUOUS,      // continuous recognition from an empty window
+  SENTENCE_REQ_HOP,             // arg = hop samples
+  SENTENCE_REQ_RESET,
+  SENTENCE_REQ_PAUSE,           // park the task until resume() (model swap)
+};
+
+enum SentenceEventKind : uint8_t {
+  SENTENCE_EV_PROGRESS = 0,     // one-shot recording, progress 0..1
+  SENTENCE_EV_RESULT,           // one-shot window scored
+  SENTENCE_EV_HOP,              // continuous: label of one hop
+  SENTENCE_EV_SENTENCE,         // continuous: hops agreed on a sentence
+};
+
+struct SentenceInput {
+  uint8_t request;
+  uint8_t arg;
+  SensorSample s;
+};
+
+struct SentenceEvent {
+  uint8_t kind;
+  uint8_t label;
+  float meanDist;
+  float progress;
+  SensorSample s;               // sample that produced the event (sensor fields of the frame)
+};
+
+#define SENTENCE_MAX_EVENTS 2   // per input
+
+class SentencePipeline {
+public:
+  explicit SentencePipeline(SentencePredictor& p)
+  : predictor(p), continueAfterRecording(false), lastProgressPercent(-1)
+  {}
+
+  // Apply one input; returns the number of events written to out
+  uint8_t handle(const SentenceInput& in, SentenceEvent out[SENTENCE_MAX_EVENTS]) {
+    switch (in.request) {
+      case SENTENCE_REQ_RECORD:
+        continueAfterRecording = in.arg != 0;
+        lastProgressPercent = -1;
+        predictor.startRecording();
+        return 0;
+      case SENTENCE_REQ_CONTINUOUS:
+        predictor.startContinuous();
+        return 0;
+      case SENTENCE_REQ_HOP:
+        predictor.setHopSamples(in.arg);
+        return 0;
+      case SENTENCE_REQ_RESET:
+        predictor.reset();
+        return 0;
+      default:
+        break;
+    }
+
+    if (predictor.continuous()) return continuousSample(in.s, out);
+    if (!predictor.recording()) return 0;   // between windows
+
+    const bool windowComplete = predictor.addSample(in.s);
+    if (!windowComplete) {
+      // Progress every 20%
+      float progress = predictor.getRecordingProgress();
+      int currentPercent = (int)(progress * 100);
+      if (currentPercent % 20 != 0 || currentPercent == lastProgressPercent) return 0;
+      lastProgressPercent = currentPercent;
+      out[0] = event(SENTENCE_EV_PROGRESS, in.s, 0, 0.0f, progress);
+      return 1;
+    }
+
+    out[0] = event(SENTENCE_EV_PROGRESS, in.s, 0, 0.0f, 1.0f);
+    float meanDist = 0.0f;
+    uint8_t label = predictor.predict(&meanDist);
+    out[1] = event(SENTENCE_EV_RESULT, in.s, label, meanDist, 1.0f);
+
+    predictor.reset();
+    // Slide on from the window just predicted
+    if (continueAfterRecording) predictor.startContinuous(true);
+    return 2;
+  }
+
+private:
+  // Predict on every hop of the sliding window; a sentence only once
+  // consecutive overlapping windows agree
+  uint8_t continuousSample(const SensorSample& s, SentenceEvent out[SENTENCE_MAX_EVENTS]) {
+    if (!predictor.addSample(s)) return 0;
+
+    float meanDist = 0.0f;
+    uint8_t hopIdx = predictor.predict(&meanDist);
+    out[0] = event(SENTENCE_EV_HOP, s, hopIdx, meanDist, 1.0f);
+
+    uint8_t labelIdx = 0;
+    if (!predictor.vote(hopIdx, &labelIdx)) return 1;
+    out[1] = event(SENTENCE_EV_SENTENCE, s, labelIdx, meanDist, 1.0f);
+    return 2;
+  }
+
+  static SentenceEvent event(uint8_t kind, const SensorSample& s, uint8_t label, float meanDist, float progress) {
+    SentenceEvent e;
+    e.kind = kind;
+    e.label = label;
+    e.meanDist = meanDist;
+    e.progress = progress;
+    e.s = s;
+    return e;
+  }
+
+  SentencePredictor& predictor;
+  bool continueAfterRecording;
+  int lastProgressPercent;
+};
+
+class SentenceWorker {
+public:
+  explicit SentenceWorker(SentencePredictor& p)
+  : pipeline(p), taskHandle(nullptr), droppedInputs(0), droppedEvents(0),
+    pauseRequested(false), parked(false)
+  {}
+
+  // Start the scoring task; false = the pipeline runs inline in loop()
+  bool begin() {
+#if SENTENCE_WORKER
+    BaseType_t ok = xTaskCreatePinnedToCore(
+      taskEntry, "sentence", SENTENCE_WORKER_STACK, this, SENTENCE_WORKER_PRIO, &taskHandle,
+      SENTENCE_WORKER_CORE);
+    if (ok != pdPASS) taskHandle = nullptr;
+#endif
+    return taskHandle != nullptr;
+  }
+
+  bool threaded() const { return taskHandle != nullptr; }
+
+  // ---- loop() side ----
+
+  // Samples are dropped when the task is more than SENTENCE_INPUT_RING
+  // behind; control requests wait briefly for room instead.
+  void post(uint8_t request, uint8_t arg = 0) {
+    SentenceInput in;
+    in.request = request;
+    in.arg = arg;
+    memset(&in.s, 0, sizeof(in.s));
+    submit(in, SENTENCE_POST_WAIT_MS);
+  }
+
+  void postSample(const SensorSample& s) {
+    if (pauseRequested) return;   // the window restarts after a model swap
+    SentenceInput in;
+    in.request = SENTENCE_REQ_SAMPLE;
+    in.arg = 0;
+    in.s = s;
+    submit(in, 0);
+  }
+
+  bool poll(SentenceEvent& out) { return events.pop(out); }
+
+  // True once the task is parked (always, inline); false when it did not
+  // get there within SENTENCE_PAUSE_WAIT_MS. Every pause() needs resume().
+  bool pause() {
+    if (!taskHandle) return true;
+    pauseRequested = true;
+    SentenceInput in;
+    in.request = SENTENCE_REQ_PAUSE;
+    in.arg = 0;
+    memset(&in.s, 0, sizeof(in.s));
+
+    uint32_t t0 = millis();
+    bool posted = false;
+    while (!parked) {
+      if (!posted && inputs.push(in)) {
+        posted = true;
+        xTaskNotifyGive(taskHandle);
+      }
+      if (millis() - t0 >= SENTENCE_PAUSE_WAIT_MS) {
+        resume();   // a late PAUSE finds pauseRequested cleared and goes on
+        return false;
+      }
+      vTaskDelay(1);
+    }
+    return true;
+  }
+
+  void resume() {
+    if (!taskHandle) return;
+    pauseRequested = false;
+    xTaskNotifyGive(taskHandle);
+  }
+
+  uint32_t dropped() const { return droppedInputs; }     // inputs lost to a full ring
+  uint32_t droppedEventCount() const { return droppedEvents; }
+
+  // Unused stack of the scoring task, in bytes
+  uint32_t stackHighWater() const {
+    return taskHandle ? (uint32_t)uxTaskGetStackHighWaterMark(taskHandle) : 0;
+  }
+
+private:
+  void submit(const SentenceInput& in, uint32_t waitMs) {
+    if (!taskHandle) {
+      process(in);
+      return;
+    }
+    uint32_t t0 = millis();
+    while (!inputs.push(in)) {
+      if (millis() - t0 >= waitMs) {
+        droppedInputs++;
+        return;
+      }
+      vTaskDelay(1);
+    }
+    xTaskNotifyGive(taskHandle);
+  }
+
+  void process(const SentenceInput& in) {
+    SentenceEvent out[SENTENCE_MAX_EVENTS];
+    uint8_t n = pipeline.handle(in, out);
+    for (uint8_t i = 0; i < n; ++i) {
+      if (!events.push(out[i])) droppedEvents++;
+    }
+  }
+
+  static void taskEntry(void* arg) {
+    static_cast<SentenceWorker*>(arg)->run();
+  }
+
+  void run() {
+    for (;;) {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      SentenceInput in;
+      while (inputs.pop(in)) {
+        if (in.request == SENTENCE_REQ_PAUSE) park();
+        else process(in);
+      }
+    }
+  }
+
+  // Between two inputs: nothing of the predictor's scan is on the stack
+  void park() {
+    parked = true;
+    while (pauseRequested) ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    parked = false;
+  }
+
+  SentencePipeline pipeline;
+  SpscRing<SentenceInput, SENTENCE_INPUT_RING> inputs;   // loop() -> task
+  SpscRing<SentenceEvent, SENTENCE_EVENT_RING> events;   // task -> loop()
+  TaskHandle_t taskHandle;
+  volatile uint32_t droppedInputs;
+  volatile uint32_t droppedEvents;
+  volatile bool pauseRequested;   // loop() -> task
+  volatile bool parked;           // task -> loop()
+};
@@ -0,0 +1,235 @@
+#pragma once
+#include <Arduino.h>
+#include <LittleFS.h>
+#include "sensor_ring.h"
+
+// ----------- On-device session recorder (LittleFS) -----------
+//
+// Data collection at the full acquisition rate: loop() hands every sample
+// it drains from the acquisition ring to the recorder, which packs it into
+// a 24-byte record and appends whole REC_BLOCK_BYTES blocks to a file
+// under /rec/ on LittleFS. Nothing goes over the serial line while
+// recording, so the 20 Hz text log limit of RUN_MODE 0 does not apply.
+//
+// Segment markers (REC MARK <label>) are records in the same stream: the
+// frames after a marker belong to its label, an empty label ends the
+// segment. tools/fetch_recording.py downloads a file (REC DUMP) and cuts
+// the segments into raw_<label>_<id>.txt / sentence_raw_*.txt logs.
+//
+// File layout (little endian):
+//   RecFileHeader, then RecFrame / RecMarker records in sample order.
+//   A marker has REC_MARKER_TAG where a frame has flex[0] (the ADC is
+//   12 bit, so no frame can carry it).
+//   tMs is the low 16 bits of the acquisition timestamp; the full start
+//   time is in the header and the host unwraps (frames are < 65 s apart).
+//   A marker carries the time of the command, and samples still in the
+//   acquisition ring are appended after it, so the host splits by tMs.
+//
+// Space: the web UI files leave roughly 100 KB of the 640 KB partition,
+// about 40 s at 100 Hz (2.4 KB/s). Recording stops by itself REC_MIN_FREE
+// bytes before the filesystem is full. `pio run -t uploadfs` erases the
+// recordings, so fetch them first.
+
+#ifndef SESSION_RECORDER
+#define SESSION_RECORDER 1
+#endif
+
+#define REC_DIR          "/rec"
+#define REC_PATH_MAX     32
+#define REC_LABEL_MAX    20
+#define REC_BLOCK_BYTES  4096    // one flash sector per write
+#define REC_MIN_FREE     (2 * REC_BLOCK_BYTES)   // left for LittleFS metadata
+#define REC_MAGIC        0x43455247UL   // "GREC"
+#define REC_VERSION      1
+#define REC_MARKER_TAG   0xFFFF
+
+struct RecFileHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t recordSize;
+  uint16_t rateHz;        // acquisition rate at REC START
+  uint16_t reserved;
+  uint32_t startMs;       // millis() of the first sample
+};
+
+struct RecFrame {
+  uint16_t tMs;
+  uint16_t flex[5];       // raw ADC
+  int16_t acc[3];
+  int16_t gyro[3];
+};
+
+struct RecMarker {
+  uint16_t tMs;
+  uint16_t tag;           // REC_MARKER_TAG
+  char label[REC_LABEL_MAX];   // NUL padded, "" = end of segment
+};
+
+static_assert(sizeof(RecFileHeader) == 16, "RecFileHeader layout");
+static_assert(sizeof(RecFrame) == 24 && sizeof(RecMarker) == sizeof(RecFrame), "record layout");
+
+class SessionRecorder {
+public:
+  SessionRecorder()
+  : recording(false), used(0), headerPending(false), rateHz(0),
+    frames(0), markers(0), written(0), budget(0), maxFlushUs(0), stopReason("")
+  {
+    path[0] = '\0';
+    lastLabel[0] = '\0';
+  }
+
+  // Open REC_DIR/<name> for writing; false with error() set otherwise
+  bool begin(const char* name, uint16_t sampleRateHz) {
+    if (recording) return fail("already recording");
+    if (!LittleFS.begin(false)) return fail("LittleFS not mounted");
+    if (!LittleFS.exists(REC_DIR)) LittleFS.mkdir(REC_DIR);
+
+    size_t freeBytes = LittleFS.totalBytes() - LittleFS.usedBytes();
+    if (freeBytes < REC_MIN_FREE + REC_BLOCK_BYTES) return fail("filesystem full");
+
+    snprintf(path, sizeof(path), REC_DIR "/%s", name);
+    file = LittleFS.open(path, "w");
+    if (!file) return fail("cannot create file");
+
+    used = 0;
+    frames = markers = written = 0;
+    maxFlushUs = 0;
+    budget = freeBytes - REC_MIN_FREE;
+    rateHz = sampleRateHz;
+    lastLabel[0] = '\0';
+    headerPending = true;   // written with the first sample's timestamp
+    stopReason = "";
+    recording = true;
+    return true;
+  }
+
+  // One acquisition sample; false when recording had to stop (error())
+  bool add(const SensorSample& s) {
+    if (!recording) return false;
+    if (headerPending) writeHeader(s.tMs);
+
+    RecFrame r;
+    r.tMs = (uint16_t)s.tMs;
+    r.flex[0] = (uint16_t)s.f1;
+    r.flex[1] = (uint16_t)s.f2;
+    r.flex[2] = (uint16_t)s.f3;
+    r.flex[3] = (uint16_t)s.f4;
+    r.flex[4] = (uint16_t)s.f5;
+    r.acc[0] = (int16_t)s.ax;
+    r.acc[1] = (int16_t)s.ay;
+    r.acc[2] = (int16_t)s.az;
+    r.gyro[0] = (int16_t)s.gx;
+    r.gyro[1] = (int16_t)s.gy;
+    r.gyro[2] = (int16_t)s.gz;
+    if (!append(&r, sizeof(r))) return false;
+    frames++;
+    return true;
+  }
+
+  // Frames from here on belong to label ("" ends the segment). Labels of
+  // REC_LABEL_MAX characters or more are refused, not cut.
+  bool mark(const char* label, uint32_t tMs) {
+    if (!recording) return false;
+    if (strlen(label) >= REC_LABEL_MAX) return false;
+    if (headerPending) writeHeader(tMs);
+
+    RecMarker m;
+    memset(&m, 0, sizeof(m));
+    m.tMs = (uint16_t)tMs;
+    m.tag = REC_MARKER_TAG;
+    strcpy(m.label, label);
+    if (!append(&m, sizeof(m))) return false;
+    strcpy(lastLabel, m.label);
+    markers++;
+    return true;
+  }
+
+  // Write what is buffered and close the file
+  void stop(const char* reason = "stopped") {
+    if (!recording) return;
+    flush();
+    file.close();
+    recording = false;
+    if (!stopReason[0]) stopReason = reason;
+  }
+
+  bool active() const { return recording; }
+  const char* fileName() const { return path; }
+  const char* label() const { return lastLabel; }   // as stored by the last mark()
+  uint32_t frameCount() const { return frames; }
+  uint32_t markerCount() const { return markers; }
+  uint32_t bytes() const { return written + used; }
+  uint32_t bytesLeft() const { return budget > bytes() ? budget - bytes() : 0; }
+  uint32_t maxFlushMicros() const { return maxFlushUs; }   // longest block write
+  const char* error() const { return stopReason; }
+
+private:
+  bool fail(const char* why) {
+    stopReason = why;
+    return false;
+  }
+
+  void writeHeader(uint32_t firstMs) {
+    RecFileHeader h;
+    h.magic = REC_MAGIC;
+    h.version = REC_VERSION;
+    h.recordSize = sizeof(RecFrame);
+    h.rateHz = rateHz;
+    h.reserved = 0;
+    h.startMs = firstMs;
+    headerPending = false;
+    memcpy(block, &h, sizeof(h));
+    used = sizeof(h);
+  }
+
+  bool append(const void* rec, size_t n) {
+    if (bytes() + n > budget) {
+      stopReason = "filesystem full";
+      stop();
+      return false;
+    }
+    // Records straddle block boundaries; the file is one sequential stream
+    const uint8_t* p = (const uint8_t*)rec;
+    while (n) {
+      size_t take = min((size_t)(REC_BLOCK_BYTES - used), n);
+      memcpy(block + used, p, take);
+      used += take;
+      p += take;
+      n -= take;
+      if (used == REC_BLOCK_BYTES && !flush()) return false;
+    }
+    return true;
+  }
+
+  bool flush() {
+    if (!used) return true;
+    uint32_t t0 = micros();
+    size_t n = file.write(block, used);
+    uint32_t dt = micros() - t0;
+    if (dt > maxFlushUs) maxFlushUs = dt;
+    written += n;
+    bool ok = n == used;
+    used = 0;
+    if (!ok) {
+      stopReason = "write failed";
+      file.close();
+      recording = false;
+    }
+    return ok;
+  }
+
+  File file;
+  bool recording;
+  uint8_t block[REC_BLOCK_BYTES];
+  size_t used;
+  bool headerPending;
+  uint16_t rateHz;
+  uint32_t frames;
+  uint32_t markers;
+  uint32_t written;
+  uint32_t budget;
+  uint32_t maxFlushUs;
+  const char* stopReason;
+  char path[REC_PATH_MAX];
+  char lastLabel[REC_LABEL_MAX];
+};
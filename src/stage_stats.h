@@ -0,0 +1,153 @@
+#pragma once
+#include <Arduino.h>
+
+// ----------- Hot-path stage timing -----------
+//
+// Cycle-counter timing of the acquisition / inference / output stages.
+// Enable with -DSTATS_ENABLED=1; the STATS serial command (or a periodic
+// frame every STATS_PERIOD_MS) reports per-stage min / mean / p99 / max
+// together with heap, stack watermarks and dropped samples.
+//
+// Disabled (default): STATS_SCOPE() expands to nothing and no tables exist.
+//
+// Cycle counts are converted to nanoseconds when they are recorded, at the
+// clock in effect then: main.cpp calls setClockMhz() whenever it changes
+// the CPU clock (idle), so one histogram can hold samples taken at 240 and
+// 80 MHz. Only a scope that straddles the switch is converted at the new
+// clock.
+//
+// Each stage is only timed by one task (STAT_ACQ_READ by acquisition, the
+// sentence stages by the sentence worker, both on core 0, the rest on
+// core 1), so counters are written by a single producer. Reports read
+// them without locking; a value may be one sample stale.
+
+#ifndef STATS_ENABLED
+#define STATS_ENABLED 0
+#endif
+
+#ifndef STATS_PERIOD_MS
+#define STATS_PERIOD_MS 0   // 0 = only on the STATS command
+#endif
+
+enum StatStage : uint8_t {
+  STAT_ACQ_READ = 0,        // flex ADC + MPU6050 I2C read (core 0)
+  STAT_GESTURE_FEATURES,    // sliding window -> standardized features
+  STAT_GESTURE_KNN,         // knn_predict (quantize, scan / index, re-score, vote)
+  STAT_SENTENCE_QUANTIZE,   // resample + fused standardize / quantize
+  STAT_SENTENCE_SCAN,       // int8 L1 scan over the sentence table
+  STAT_SENTENCE_VOTE,       // dequantize K winners + weighted vote
+  STAT_OUTPUT,              // JSON / binary frame formatting and serial write
+  STAT_NUM_STAGES
+};
+
+#if STATS_ENABLED
+
+// Log-linear histogram: 4 buckets per power of two (~25% resolution)
+#define STATS_HIST_BUCKETS 128
+
+static const char* const STAT_STAGE_NAMES[STAT_NUM_STAGES] = {
+  "acq_read", "gesture_features", "gesture_knn",
+  "sentence_quantize", "sentence_scan", "sentence_vote", "output"
+};
+
+struct StageSummary {
+  uint32_t count;
+  float minUs, meanUs, p99Us, maxUs;
+};
+
+class StageStats {
+public:
+  StageStats() { setClockMhz(240); reset(); }
+
+  void reset() {
+    memset(stages, 0, sizeof(stages));
+    for (int i = 0; i < STAT_NUM_STAGES; ++i) stages[i].minNs = UINT32_MAX;
+  }
+
+  // CPU clock the following record() calls were counted at
+  void setClockMhz(uint32_t mhz) {
+    if (!mhz) mhz = 1;
+    nsPerCycleQ16 = ((1000u << 16) + mhz / 2) / mhz;
+  }
+
+  void record(uint8_t stage, uint32_t cycles) {
+    uint64_t ns64 = ((uint64_t)cycles * nsPerCycleQ16) >> 16;
+    uint32_t ns = ns64 > UINT32_MAX ? UINT32_MAX : (uint32_t)ns64;
+    Stage& st = stages[stage];
+    st.count++;
+    st.sumNs += ns;
+    if (ns < st.minNs) st.minNs = ns;
+    if (ns > st.maxNs) st.maxNs = ns;
+    st.hist[bucketOf(ns)]++;
+  }
+
+  StageSummary summary(uint8_t stage) const {
+    const Stage& st = stages[stage];
+    StageSummary out = { st.count, 0.0f, 0.0f, 0.0f, 0.0f };
+    if (st.count == 0) return out;
+
+    out.minUs = st.minNs / 1000.0f;
+    out.maxUs = st.maxNs / 1000.0f;
+    out.meanUs = (float)((double)st.sumNs / st.count / 1000.0);
+
+    // p99: upper edge of the bucket holding the 99th percentile
+    uint32_t target = st.count - st.count / 100;
+    uint32_t seen = 0;
+    for (int b = 0; b < STATS_HIST_BUCKETS; ++b) {
+      seen += st.hist[b];
+      if (seen >= target) {
+        uint32_t edge = bucketUpper(b);
+        out.p99Us = (edge < st.maxNs ? edge : st.maxNs) / 1000.0f;
+        break;
+      }
+    }
+    return out;
+  }
+
+private:
+  struct Stage {
+    uint32_t count;
+    uint64_t sumNs;
+    uint32_t minNs;
+    uint32_t maxNs;
+    uint32_t hist[STATS_HIST_BUCKETS];
+  };
+
+  // Values < 4 map to themselves; otherwise 4 sub-buckets per octave
+  static uint8_t bucketOf(uint32_t c) {
+    if (c < 4) return (uint8_t)c;
+    int msb = 31 - __builtin_clz(c);
+    return (uint8_t)(msb * 4 + ((c >> (msb - 2)) & 3));
+  }
+
+  static uint32_t bucketUpper(int b) {
+    if (b < 4) return (uint32_t)b;
+    int msb = b / 4;
+    uint64_t upper = ((uint64_t)(4 + (b & 3) + 1) << (msb - 2)) - 1;
+    return upper > UINT32_MAX ? UINT32_MAX : (uint32_t)upper;
+  }
+
+  Stage stages[STAT_NUM_STAGES];
+  volatile uint32_t nsPerCycleQ16;   // 16.16 fixed point
+};
+
+StageStats stageStats;
+
+// Times the enclosing scope into one stage
+class StageTimer {
+public:
+  explicit StageTimer(uint8_t stage) : stage(stage), start(ESP.getCycleCount()) {}
+  ~StageTimer() { stageStats.record(stage, ESP.getCycleCount() - start); }
+
+private:
+  uint8_t stage;
+  uint32_t start;
+};
+
+#define STATS_CONCAT_(a, b) a##b
+#define STATS_CONCAT(a, b) STATS_CONCAT_(a, b)
+#define STATS_SCOPE(stage) StageTimer STATS_CONCAT(stageTimer_, __LINE__)(stage)
+
+#else
+#define STATS_SCOPE(stage)
+#endif
@@ -0,0 +1,186 @@
+#pragma once
+#include <Arduino.h>
+
+// ----------- On-glove web UI + WebSocket stream -----------
+//
+// Serves the web UI (index.html, main.js, style.css, hand.glb) from LittleFS
+// and pushes the same JSON frames the serial port carries to every client
+// on /ws, so a browser can connect to the glove directly without the
+// Python bridge. Also answers the two HTTP routes main.js uses:
+//   GET  /data          latest frame (polling fallback)
+//   POST /api/sentence  same as the START_SENTENCE serial command
+//
+// Frames are batched: everything published within WEB_BATCH_MS goes out as
+// one JSON array message; urgent frames (sentence results) flush at once.
+//
+// Upload the UI with `pio run -t uploadfs` (tools/pio_fs_web.py stages only
+// the web files from data/ into the filesystem image).
+//
+// WiFi: station mode when WEB_WIFI_SSID is set, otherwise a soft AP
+// (WEB_AP_SSID / WEB_AP_PASS, UI at http://192.168.4.1/).
+
+#ifndef WEB_SERVER_ENABLED
+#define WEB_SERVER_ENABLED 0
+#endif
+
+#if WEB_SERVER_ENABLED
+#include <WiFi.h>
+#include <LittleFS.h>
+#include <ESPAsyncWebServer.h>
+
+#ifndef WEB_WIFI_SSID
+#define WEB_WIFI_SSID ""
+#endif
+#ifndef WEB_WIFI_PASS
+#define WEB_WIFI_PASS ""
+#endif
+#ifndef WEB_AP_SSID
+#define WEB_AP_SSID "EchoSign"
+#endif
+#ifndef WEB_AP_PASS
+#define WEB_AP_PASS "echosign"   // >= 8 chars required by WPA2
+#endif
+
+#define WEB_PORT            80
+#define WEB_BATCH_MS        20     // max time a frame waits for its batch
+#define WEB_BATCH_MAX       1400   // ~one TCP segment per message
+#define WEB_FRAME_MAX       320
+#define WEB_WIFI_TIMEOUT_MS 10000
+#define WEB_CLEANUP_MS      1000
+
+class GloveWebServer {
+public:
+  GloveWebServer()
+  : server(WEB_PORT), ws("/ws"), batchLen(0), batchStartMs(0), lastCleanupMs(0),
+    lastFrameLen(0), sentenceRequested(false)
+  {
+    lastFrameLock = portMUX_INITIALIZER_UNLOCKED;
+    lastFrame[0] = '\0';
+  }
+
+  bool begin() {
+    startWiFi();
+
+    if (!LittleFS.begin(true)) {
+      Serial.println("{\"debug\":\"LittleFS mount failed, web UI files unavailable\"}");
+    }
+
+    ws.onEvent([](AsyncWebSocket*, AsyncWebSocketClient* client, AwsEventType type,
+                  void*, uint8_t*, size_t) {
+      if (type == WS_EVT_CONNECT) {
+        Serial.printf("{\"event\":\"ws_connect\",\"client\":%u}\n", client->id());
+      } else if (type == WS_EVT_DISCONNECT) {
+        Serial.printf("{\"event\":\"ws_disconnect\",\"client\":%u}\n", client->id());
+      }
+    });
+    server.addHandler(&ws);
+
+    server.on("/data", HTTP_GET, [this](AsyncWebServerRequest* request) {
+      char copy[WEB_FRAME_MAX];
+      portENTER_CRITICAL(&lastFrameLock);
+      memcpy(copy, lastFrame, lastFrameLen + 1);
+      portEXIT_CRITICAL(&lastFrameLock);
+      request->send(200, "application/json", copy[0] ? copy : "{\"label\":\"unknown\",\"gdp\":0}");
+    });
+
+    server.on("/api/sentence", HTTP_POST, [this](AsyncWebServerRequest* request) {
+      sentenceRequested = true;   // picked up by loop(), not the TCP task
+      request->send(200, "application/json", "{\"status\":\"ok\",\"message\":\"Sentence prediction started\"}");
+    });
+
+    server.serveStatic("/", LittleFS, "/").setDefaultFile("index.html");
+    server.begin();
+    return true;
+  }
+
+  // True while at least one WebSocket client is connected.
+  bool hasClients() { return ws.count() > 0; }
+
+  // Queue one JSON object (no trailing newline). Urgent frames flush now.
+  void publish(const char* json, size_t len, bool urgent = false) {
+    if (len >= WEB_FRAME_MAX) return;
+
+    portENTER_CRITICAL(&lastFrameLock);
+    memcpy(lastFrame, json, len);
+    lastFrame[len] = '\0';
+    lastFrameLen = len;
+    portEXIT_CRITICAL(&lastFrameLock);
+
+    if (!hasClients()) return;
+
+    if (batchLen + len + 2 > WEB_BATCH_MAX) flush();
+    if (batchLen == 0) {
+      batch[batchLen++] = '[';
+      batchStartMs = millis();
+    } else {
+      batch[batchLen++] = ',';
+    }
+    memcpy(batch + batchLen, json, len);
+    batchLen += len;
+
+    if (urgent) flush();
+  }
+
+  // Call from loop(): sends a batch once it is WEB_BATCH_MS old.
+  void poll() {
+    uint32_t now = millis();
+    if (batchLen > 0 && now - batchStartMs >= WEB_BATCH_MS) flush();
+    if (now - lastCleanupMs >= WEB_CLEANUP_MS) {
+      lastCleanupMs = now;
+      ws.cleanupClients();
+    }
+  }
+
+  // Returns true once per POST /api/sentence.
+  bool takeSentenceRequest() {
+    if (!sentenceRequested) return false;
+    sentenceRequested = false;
+    return true;
+  }
+
+private:
+  void startWiFi() {
+    if (strlen(WEB_WIFI_SSID) > 0) {
+      WiFi.mode(WIFI_STA);
+      WiFi.begin(WEB_WIFI_SSID, WEB_WIFI_PASS);
+      uint32_t start = millis();
+      while (WiFi.status() != WL_CONNECTED && millis() - start < WEB_WIFI_TIMEOUT_MS) {
+        delay(100);
+      }
+      if (WiFi.status() == WL_CONNECTED) {
+        WiFi.setSleep(false);  // modem sleep adds 100+ ms of latency
+        Serial.printf("{\"event\":\"wifi\",\"mode\":\"sta\",\"ip\":\"%s\"}\n", WiFi.localIP().toString().c_str());
+        return;
+      }
+      Serial.println("{\"debug\":\"WiFi connect failed, starting soft AP\"}");
+    }
+    WiFi.mode(WIFI_AP);
+    WiFi.softAP(WEB_AP_SSID, WEB_AP_PASS);
+    Serial.printf("{\"event\":\"wifi\",\"mode\":\"ap\",\"ip\":\"%s\"}\n", WiFi.softAPIP().toString().c_str());
+  }
+
+  void flush() {
+    if (batchLen == 0) return;
+    batch[batchLen++] = ']';
+    if (ws.availableForWriteAll()) {
+      ws.textAll(batch, batchLen);
+    }
+    // else: a client's queue is full, drop this batch rather than block
+    batchLen = 0;
+  }
+
+  AsyncWebServer server;
+  AsyncWebSocket ws;
+
+  char batch[WEB_BATCH_MAX + 1];
+  size_t batchLen;
+  uint32_t batchStartMs;
+  uint32_t lastCleanupMs;
+
+  char lastFrame[WEB_FRAME_MAX];
+  size_t lastFrameLen;
+  portMUX_TYPE lastFrameLock;
+
+  volatile bool sentenceRequested;
+};
+#endif
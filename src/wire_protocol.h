@@ -0,0 +1,123 @@
+#pragma once
+#include <Arduino.h>
+#include "sensor_ring.h"
+
+// ----------- Binary serial frames -----------
+//
+// Compact alternative to the JSON prediction lines. Select with
+// -DWIRE_FORMAT=WIRE_FORMAT_BINARY; debug / event messages stay JSON lines
+// either way, so the stream is a mix of text lines and binary frames.
+// Decoder: tools/wire_protocol.py
+//
+// Frame layout (little-endian):
+//   0  u8   sync 0xA5
+//   1  u8   sync 0x5A
+//   2  u8   type            (WIRE_TYPE_*)
+//   3  u8   sequence number (wraps)
+//   4  u8   payload length
+//   5  u32  timestamp (ms)
+//   9  ...  payload
+//   n  u16  CRC-16/CCITT-FALSE over bytes [2, n)
+//
+// Sensor block (22 bytes), first in every payload:
+//   u16 f1..f5  normalized flex * 1000 (0..1000)
+//   i16 ax, ay, az, gx, gy, gz  raw MPU6050 counts
+// The decoder derives gdp, g and deg/s from the raw IMU values.
+
+#define WIRE_FORMAT_JSON   0
+#define WIRE_FORMAT_BINARY 1
+
+#ifndef WIRE_FORMAT
+#define WIRE_FORMAT WIRE_FORMAT_JSON
+#endif
+
+#define WIRE_SYNC0 0xA5
+#define WIRE_SYNC1 0x5A
+
+#define WIRE_TYPE_GESTURE           1  // sensors, u8 label, f32 meanD
+#define WIRE_TYPE_SENTENCE_HOP      2  // sensors, u8 hop label, f32 meanD
+#define WIRE_TYPE_SENTENCE_RESULT   3  // sensors, u8 label, f32 meanD, u16 confidence * 1000
+#define WIRE_TYPE_SENTENCE_PROGRESS 4  // sensors, u8 progress percent
+
+#define WIRE_HEADER_SIZE   9
+#define WIRE_CRC_SIZE      2
+#define WIRE_MAX_PAYLOAD   48
+#define WIRE_MAX_FRAME     (WIRE_HEADER_SIZE + WIRE_MAX_PAYLOAD + WIRE_CRC_SIZE)
+
+inline uint16_t wireCrc16(const uint8_t* data, size_t n) {
+  uint16_t crc = 0xFFFF;
+  for (size_t i = 0; i < n; ++i) {
+    crc ^= (uint16_t)data[i] << 8;
+    for (int b = 0; b < 8; ++b) {
+      crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+    }
+  }
+  return crc;
+}
+
+// Builds one frame in a fixed buffer; send() writes it with a single call.
+class WireFrame {
+public:
+  WireFrame(uint8_t type, uint32_t tMs) : len(WIRE_HEADER_SIZE) {
+    buf[0] = WIRE_SYNC0;
+    buf[1] = WIRE_SYNC1;
+    buf[2] = type;
+    buf[3] = nextSeq++;
+    buf[4] = 0;
+    putAt(5, tMs);
+  }
+
+  void putU8(uint8_t v) { if (room(1)) buf[len++] = v; }
+
+  void putU16(uint16_t v) {
+    if (!room(2)) return;
+    buf[len++] = (uint8_t)(v & 0xFF);
+    buf[len++] = (uint8_t)(v >> 8);
+  }
+
+  void putI16(int16_t v) { putU16((uint16_t)v); }
+
+  void putF32(float v) {
+    uint32_t u;
+    memcpy(&u, &v, 4);
+    if (!room(4)) return;
+    putAt(len, u);
+    len += 4;
+  }
+
+  // Shared sensor block. flexNorm is the calibrated 0..1 flex value.
+  void putSensors(const float flexNorm[5], const SensorSample& s) {
+    for (int i = 0; i < 5; ++i) {
+      float f = flexNorm[i] < 0.0f ? 0.0f : (flexNorm[i] > 1.0f ? 1.0f : flexNorm[i]);
+      putU16((uint16_t)lrintf(f * 1000.0f));
+    }
+    putI16((int16_t)s.ax); putI16((int16_t)s.ay); putI16((int16_t)s.az);
+    putI16((int16_t)s.gx); putI16((int16_t)s.gy); putI16((int16_t)s.gz);
+  }
+
+  // Finalize length + CRC and write the whole frame at once.
+  size_t send(Print& out) {
+    buf[4] = (uint8_t)(len - WIRE_HEADER_SIZE);
+    uint16_t crc = wireCrc16(buf + 2, len - 2);
+    buf[len] = (uint8_t)(crc & 0xFF);
+    buf[len + 1] = (uint8_t)(crc >> 8);
+    return out.write(buf, len + WIRE_CRC_SIZE);
+  }
+
+private:
+  bool room(uint8_t n) const { return len + n <= WIRE_HEADER_SIZE + WIRE_MAX_PAYLOAD; }
+
+  void putAt(uint8_t pos, uint32_t v) {
+    buf[pos]     = (uint8_t)(v & 0xFF);
+    buf[pos + 1] = (uint8_t)((v >> 8) & 0xFF);
+    buf[pos + 2] = (uint8_t)((v >> 16) & 0xFF);
+    buf[pos + 3] = (uint8_t)(v >> 24);
+  }
+
+  uint8_t buf[WIRE_MAX_FRAME];
+  uint8_t len;
+
+  static uint8_t nextSeq;
+};
+
+uint8_t WireFrame::nextSeq = 0;
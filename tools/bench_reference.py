@@ -0,0 +1,117 @@
+"""Export sklearn's predictions for the native benchmark (bench/knn_bench.cpp).
+
+Refits KNeighborsClassifier on exactly the tables the firmware ships
+(parsed from the exported headers in src/) and predicts every row of
+data/dataset.csv and data/sentence_dataset.csv. The benchmark reports how
+often the on-device runtime agrees, so quantization / indexing / kernel
+changes can be checked against the reference implementation.
+
+Gesture: float table (glove_knn_model.h) with the exported K / metric /
+weights. Sentence: the int8 table (sentence_knn_model_q.h), queried with the
+same fused standardize + quantize (or PCA projection) as the firmware.
+
+Writes bench/reference/gesture_dataset.txt and sentence_dataset.txt (one
+predicted class index per line). Re-run after retraining.
+"""
+import os
+import re
+
+import numpy as np
+import pandas as pd
+from sklearn.neighbors import KNeighborsClassifier
+
+ROOT = os.path.join(os.path.dirname(__file__), "..")
+SRC_DIR = os.path.join(ROOT, "src")
+DATA_DIR = os.path.join(ROOT, "data")
+OUT_DIR = os.path.join(ROOT, "bench", "reference")
+
+METRICS = {0: "euclidean", 1: "manhattan", 2: "chebyshev"}
+WEIGHTS = {0: "uniform", 1: "distance"}
+
+
+def read_header(name: str) -> str:
+    with open(os.path.join(SRC_DIR, name), "r", encoding="utf-8") as f:
+        return f.read()
+
+
+def header_define(text: str, name: str) -> int:
+    m = re.search(r"#define\s+%s\s+(-?\d+)" % name, text)
+    if not m:
+        raise ValueError("missing #define " + name)
+    return int(m.group(1))
+
+
+def header_array(text: str, name: str) -> np.ndarray:
+    """Flat numeric contents of `... name[...] ... = { ... };`."""
+    m = re.search(r"\b%s\s*\[[^=]*=\s*\{(.*?)\};" % re.escape(name), text, re.S)
+    if not m:
+        raise ValueError("missing array " + name)
+    body = re.sub(r"//[^\n]*", "", m.group(1))
+    values = re.findall(r"-?\d+\.?\d*(?:[eE][-+]?\d+)?", body.replace("f", ""))
+    return np.array([float(v) for v in values])
+
+
+def gesture_reference() -> np.ndarray:
+    model = read_header("glove_knn_model.h")
+    scaler = read_header("scaler_params.h")
+    n_features = header_define(scaler, "NUM_FEATURES")
+
+    X = header_array(model, "X_train").reshape(-1, n_features)
+    y = header_array(model, "y_train").astype(int)
+    knn = KNeighborsClassifier(n_neighbors=header_define(model, "KNN_K"),
+                               metric=METRICS[header_define(model, "KNN_METRIC")],
+                               weights=WEIGHTS[header_define(model, "KNN_WEIGHTS")])
+    knn.fit(X, y)
+
+    mean = header_array(scaler, "SCALER_MEAN")
+    scale = header_array(scaler, "SCALER_SCALE")
+    df = pd.read_csv(os.path.join(DATA_DIR, "dataset.csv"))
+    Q = (df.iloc[:, :n_features].to_numpy(dtype=np.float32) - mean) / scale
+    return knn.predict(Q.astype(np.float32))
+
+
+def sentence_reference() -> np.ndarray:
+    model = read_header("sentence_knn_model_q.h")
+    n_features = header_define(model, "SENTENCE_KNN_Q_N_FEATURES")
+
+    X = header_array(model, "SENTENCE_TRAINING_DATA_Q").reshape(-1, n_features)
+    y = header_array(model, "SENTENCE_TRAINING_LABELS_Q").astype(int)
+    knn = KNeighborsClassifier(n_neighbors=header_define(model, "SENTENCE_KNN_Q_N_NEIGHBORS"),
+                               metric="manhattan", weights="distance")
+    knn.fit(X, y)
+
+    df = pd.read_csv(os.path.join(DATA_DIR, "sentence_dataset.csv"))
+    if "SENTENCE_KNN_Q_PCA_COMPONENTS" in model:
+        # Standardize, int8 projection, per-component gain / offset
+        scaler = read_header("sentence_scaler_params.h")
+        n_raw = header_define(model, "SENTENCE_KNN_Q_RAW_FEATURES")
+        W = header_array(model, "SENTENCE_Q_PCA_W").reshape(n_raw, n_features)
+        raw = df.iloc[:, :n_raw].to_numpy(dtype=np.float32)
+        Z = (raw - header_array(scaler, "SENTENCE_SCALER_MEAN")) / header_array(scaler, "SENTENCE_SCALER_SCALE")
+        acc = Z @ W
+        Q = np.clip(np.rint(acc * header_array(model, "SENTENCE_Q_PCA_GAIN")
+                            + header_array(model, "SENTENCE_Q_PCA_OFFSET")), -128, 127)
+        return knn.predict(Q)
+
+    a = header_array(model, "SENTENCE_Q_AFFINE_A").astype(np.float32)
+    b = header_array(model, "SENTENCE_Q_AFFINE_B").astype(np.float32)
+    raw = df.iloc[:, :n_features].to_numpy(dtype=np.float32)
+    Q = np.clip(np.rint(raw * a + b), -127, 127)
+    return knn.predict(Q)
+
+
+def write_labels(path: str, labels: np.ndarray) -> None:
+    with open(path, "w", encoding="utf-8") as f:
+        for v in labels:
+            f.write("%d\n" % int(v))
+    print("Wrote %s (%d rows)" % (path, len(labels)))
+
+
+def main() -> None:
+    os.makedirs(OUT_DIR, exist_ok=True)
+    write_labels(os.path.join(OUT_DIR, "gesture_dataset.txt"), gesture_reference())
+    write_labels(os.path.join(OUT_DIR, "sentence_dataset.txt"), sentence_reference())
+
+
+if __name__ == "__main__":
+    main()
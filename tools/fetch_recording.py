@@ -0,0 +1,264 @@
+"""Download full-rate glove recordings and turn them into training logs.
+
+The glove records sessions to LittleFS at the acquisition rate (REC
+commands, src/session_recorder.h). This tool lists / downloads them (REC
+DUMP, raw bytes at --dump-baud), keeps the .bin in data/recordings/ and
+cuts the marked segments into logs in the format the collectors write:
+
+  gesture (default): data/raw_<label>_<id>.txt        -> tools/merge_logs.py
+  --sentence:        data/sentence_raw_<label>_<id>.txt -> train_sentence_knn.py
+
+A session on the glove (serial monitor or any terminal):
+  REC START            -> /rec/s01.bin, LED on
+  REC MARK Thank you.  -> frames from here on are "Thank you." (rest of the
+                          line, at most 19 characters)
+  REC MARK             -> end of the segment (unlabeled gap)
+  REC MARK Rest ...
+  REC STOP
+
+  python tools/fetch_recording.py --list
+  python tools/fetch_recording.py s01.bin --merge
+  python tools/fetch_recording.py s01.bin --sentence --delete
+  python tools/fetch_recording.py --from-file data/recordings/s01.bin
+
+The logs keep the full rate (100 Hz, five times the 20 Hz serial
+collectors); --hz writes every n-th frame for a lower rate. The sentence
+trainer resamples each log to its window either way.
+"""
+import argparse
+import json
+import os
+import struct
+import subprocess
+import sys
+import time
+import zlib
+
+import serial
+
+DATA_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "data")
+REC_DIR = os.path.join(DATA_DIR, "recordings")
+
+# session_recorder.h
+REC_MAGIC = 0x43455247
+REC_VERSION = 1
+REC_MARKER_TAG = 0xFFFF
+HEADER = struct.Struct("<IHHHHI")     # magic, version, recordSize, rateHz, reserved, startMs
+FRAME = struct.Struct("<H5H3h3h")     # tMs, flex[5], acc[3], gyro[3]
+MARKER = struct.Struct("<HH20s")      # tMs, tag, label
+
+LOG_FORMAT = "FLEX: f1 f2 f3 f4 f5 | ACC: ax ay az | GYRO: gx gy gz | GDP=val"
+REPLY_TIMEOUT = 3.0
+
+
+def make_slug(label: str, sentence: bool) -> str:
+    """Same file names as tools/collect_gesture_data.py / collect_sentence_data.py
+    (merge_logs.py takes the gesture label from the file name, so keep its case)"""
+    slug = label.strip().replace(" ", "_")
+    if sentence:
+        slug = slug.lower()
+    slug = "".join(c for c in slug if c.isalnum() or c in "_-")
+    return slug or ("sentence" if sentence else "gesture")
+
+
+def parse_recording(data: bytes):
+    """(rate Hz, records): records are ("frame", t, values) / ("mark", t, label), t in ms."""
+    if len(data) < HEADER.size:
+        raise ValueError("recording too short")
+    magic, version, size, rate, _, start_ms = HEADER.unpack_from(data, 0)
+    if magic != REC_MAGIC or version != REC_VERSION or size != FRAME.size:
+        raise ValueError("not a glove recording (magic/version/record size)")
+
+    records = []
+    t_last = start_ms
+    for off in range(HEADER.size, len(data) - FRAME.size + 1, FRAME.size):
+        t16, word = struct.unpack_from("<HH", data, off)
+        # Unwrap the 16-bit timestamp to the full time nearest the previous
+        # record (markers may sit slightly ahead of the frames after them)
+        t = (t_last & ~0xFFFF) | t16
+        t = min((t - 0x10000, t, t + 0x10000), key=lambda c: abs(c - t_last))
+        t_last = t
+
+        if word == REC_MARKER_TAG:
+            _, _, raw = MARKER.unpack_from(data, off)
+            records.append(("mark", t, raw.split(b"\0", 1)[0].decode("utf-8", "replace")))
+        else:
+            records.append(("frame", t, FRAME.unpack_from(data, off)[1:]))
+    return rate, records
+
+
+def segments(records):
+    """[(label, [frame values])]: each marker opens a segment at its time,
+    an empty label closes it. Frames are assigned by timestamp."""
+    marks = sorted((t, label) for kind, t, label in records if kind == "mark")
+    frames = sorted(((t, v) for kind, t, v in records if kind == "frame"), key=lambda x: x[0])
+
+    out = []
+    for i, (t0, label) in enumerate(marks):
+        if not label:
+            continue
+        t1 = marks[i + 1][0] if i + 1 < len(marks) else float("inf")
+        seg = [v for t, v in frames if t0 <= t < t1]
+        if seg:
+            out.append((label, seg))
+    return out
+
+
+def log_line(v) -> str:
+    f1, f2, f3, f4, f5, ax, ay, az, gx, gy, gz = v
+    gdp = (gx * gx + gy * gy + gz * gz) ** 0.5
+    return (f"FLEX: {f1} {f2} {f3} {f4} {f5} | ACC: {ax} {ay} {az} | "
+            f"GYRO: {gx} {gy} {gz} | GDP={gdp:.3f}")
+
+
+def write_log(label, frames, rate_hz, sentence, source, data_dir=DATA_DIR) -> str:
+    slug = make_slug(label, sentence)
+    prefix = "sentence_raw" if sentence else "raw"
+    session_id = 1
+    while os.path.exists(os.path.join(data_dir, f"{prefix}_{slug}_{session_id:02d}.txt")):
+        session_id += 1
+    path = os.path.join(data_dir, f"{prefix}_{slug}_{session_id:02d}.txt")
+
+    with open(path, "w", encoding="utf-8") as f:
+        if sentence:
+            f.write(f"# sentence_label={label}\n")
+        else:
+            f.write(f"# label={label}\n")
+        f.write(f"# timestamp={time.time()}\n")
+        f.write(f"# source={source}\n")
+        f.write(f"# sample_rate_hz={rate_hz}\n")
+        f.write(f"# total_samples={len(frames)}\n")
+        f.write(f"# format: {LOG_FORMAT}\n")
+        for v in frames:
+            f.write(log_line(v) + "\n")
+    return path
+
+
+class Glove:
+    """REC commands over serial."""
+
+    def __init__(self, port, baud):
+        self.ser = serial.Serial(port, baud, timeout=0.2)
+        self.baud = baud
+        time.sleep(2.0)               # board resets on open
+        self.ser.reset_input_buffer()
+
+    def command(self, line):
+        self.ser.write((line + "\n").encode("ascii"))
+
+    def wait_event(self, name, timeout=REPLY_TIMEOUT):
+        """The next {"event":name,...} line; other output is skipped."""
+        deadline = time.time() + timeout
+        while time.time() < deadline:
+            line = self.ser.readline().decode("utf-8", "ignore").strip()
+            if not line.startswith("{"):
+                continue
+            try:
+                msg = json.loads(line)
+            except ValueError:
+                continue
+            if msg.get("event") == name:
+                return msg
+            if "debug" in msg and ("Usage" in msg["debug"] or "not" in msg["debug"]):
+                raise RuntimeError(msg["debug"])
+        raise TimeoutError(f"no '{name}' from the glove")
+
+    def list(self):
+        self.command("REC LIST")
+        return self.wait_event("rec_list")
+
+    def dump(self, name, dump_baud):
+        self.command(f"REC DUMP {name} {dump_baud}")
+        start = self.wait_event("rec_dump")
+        size = int(start["bytes"])
+        if dump_baud != self.baud:
+            self.ser.baudrate = dump_baud
+
+        data = bytearray()
+        t0 = time.time()
+        deadline = t0 + 5.0 + size * 12.0 / dump_baud
+        while len(data) < size and time.time() < deadline:
+            data += self.ser.read(size - len(data))
+        elapsed = time.time() - t0
+
+        if dump_baud != self.baud:
+            self.ser.baudrate = self.baud
+        done = self.wait_event("rec_dump_done", timeout=REPLY_TIMEOUT + 1.0)
+        if len(data) != size or int(done["bytes"]) != size:
+            raise RuntimeError(f"transfer incomplete: {len(data)} of {size} bytes")
+        if int(done["crc32"], 16) != zlib.crc32(bytes(data)):
+            raise RuntimeError("transfer CRC mismatch, try a lower --dump-baud")
+        print(f"Downloaded {size} bytes in {elapsed:.1f} s ({size / max(elapsed, 1e-3) / 1024:.1f} KB/s)")
+        return bytes(data)
+
+    def delete(self, name):
+        self.command(f"REC DELETE {name}")
+        return self.wait_event("rec_list")
+
+
+def convert(data, source, sentence, hz):
+    rate, records = parse_recording(data)
+    segs = segments(records)
+    n_frames = sum(1 for r in records if r[0] == "frame")
+    print(f"{source}: {n_frames} frames at {rate} Hz, {len(segs)} labeled segment(s)")
+
+    step = max(1, round(rate / hz)) if hz else 1
+    paths = []
+    for label, frames in segs:
+        path = write_log(label, frames[::step], rate // step, sentence, source)
+        print(f"  {label}: {len(frames[::step])} samples -> {os.path.relpath(path)}")
+        paths.append(path)
+    return paths
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("names", nargs="*", help="recordings on the glove (REC LIST), e.g. s01.bin")
+    parser.add_argument("--port", default="COM15", help="Serial port (default COM15)")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--dump-baud", type=int, default=921600,
+                        help="baud rate for the transfer itself (115200 = no switch)")
+    parser.add_argument("--list", action="store_true", help="list the recordings on the glove")
+    parser.add_argument("--all", action="store_true", help="fetch every recording on the glove")
+    parser.add_argument("--delete", action="store_true", help="delete each recording after a good download")
+    parser.add_argument("--from-file", nargs="+", default=[], metavar="BIN",
+                        help="convert downloaded .bin files, no glove needed")
+    parser.add_argument("--sentence", action="store_true", help="write sentence_raw_*.txt logs")
+    parser.add_argument("--hz", type=int, default=0, help="write at this rate (default: recorded rate)")
+    parser.add_argument("--merge", action="store_true", help="run tools/merge_logs.py afterwards")
+    args = parser.parse_args()
+
+    written = []
+    for path in args.from_file:
+        with open(path, "rb") as f:
+            written += convert(f.read(), os.path.basename(path), args.sentence, args.hz)
+
+    if args.list or args.names or args.all:
+        glove = Glove(args.port, args.baud)
+        listing = glove.list()
+        if args.list or args.all:
+            for entry in listing["files"]:
+                print(f"  {entry['name']:<20} {entry['bytes']:>8} bytes")
+            print(f"  free: {listing['free']} bytes")
+
+        names = [e["name"] for e in listing["files"]] if args.all else args.names
+        os.makedirs(REC_DIR, exist_ok=True)
+        for name in names:
+            data = glove.dump(name, args.dump_baud)
+            with open(os.path.join(REC_DIR, name), "wb") as f:
+                f.write(data)
+            written += convert(data, name, args.sentence, args.hz)
+            if args.delete:
+                glove.delete(name)
+
+    if not written:
+        print("No labeled segments written.")
+        return 1
+    if args.merge and not args.sentence:
+        subprocess.run([sys.executable, os.path.join(os.path.dirname(os.path.abspath(__file__)), "merge_logs.py")],
+                       check=True)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
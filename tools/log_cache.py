@@ -0,0 +1,109 @@
+"""
+Parsed-log cache shared by merge_logs.py and the trainers.
+
+Parsing the text logs (a regex per line) dominates a retrain once there are
+many recordings. Each log is parsed once and its arrays are stored as an
+.npz file under data/cache/<tag>/, named by the SHA-1 of the log's bytes,
+so an edited or re-recorded log is parsed again and every other log is
+loaded from its binary copy. The tag names the parser; bump its version
+when the parsed layout changes.
+
+Entries of logs that no longer exist are removed by prune(). The whole
+folder can be deleted at any time; it is not part of the LittleFS image
+(tools/pio_fs_web.py stages the web UI files only).
+
+The trainers also keep their last hyperparameter search here
+(save_state / load_state), which the incremental mode reuses.
+"""
+import hashlib
+import json
+import os
+from typing import Any, Callable, Dict, Optional, Set
+
+import numpy as np
+
+CACHE_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "data", "cache")
+
+
+def file_hash(path: str) -> str:
+    h = hashlib.sha1()
+    with open(path, "rb") as f:
+        for chunk in iter(lambda: f.read(1 << 20), b""):
+            h.update(chunk)
+    return h.hexdigest()
+
+
+class LogCache:
+    """Arrays parsed from logs, keyed by file contents."""
+
+    def __init__(self, tag: str) -> None:
+        self.dir = os.path.join(CACHE_DIR, tag)
+        self.hits = 0
+        self.misses = 0
+        self.live: Set[str] = set()
+
+    def load(self, path: str, parse: Callable[[str], Dict[str, np.ndarray]]) -> Dict[str, np.ndarray]:
+        """Arrays of one log; parse(path) only runs when the contents are new."""
+        digest = file_hash(path)
+        self.live.add(digest)
+        entry = os.path.join(self.dir, digest + ".npz")
+
+        if os.path.exists(entry):
+            try:
+                with np.load(entry, allow_pickle=False) as z:
+                    arrays = {k: np.asarray(z[k]) for k in z.files}
+                self.hits += 1
+                return arrays
+            except (OSError, ValueError, KeyError):
+                pass  # truncated or unreadable entry: parse again
+
+        arrays = {k: np.asarray(v) for k, v in parse(path).items()}
+        os.makedirs(self.dir, exist_ok=True)
+        tmp = entry + ".tmp"
+        with open(tmp, "wb") as f:  # file object: savez would append .npz to a name
+            np.savez(f, **arrays)
+        os.replace(tmp, entry)
+        self.misses += 1
+        return arrays
+
+    def prune(self) -> int:
+        """Remove entries of logs not loaded in this run; returns the count."""
+        if not os.path.isdir(self.dir):
+            return 0
+        removed = 0
+        for name in os.listdir(self.dir):
+            digest, ext = os.path.splitext(name)
+            if ext in (".npz", ".tmp") and digest not in self.live:
+                os.remove(os.path.join(self.dir, name))
+                removed += 1
+        return removed
+
+    def summary(self) -> str:
+        return f"{self.misses} parsed, {self.hits} from cache ({self.dir})"
+
+
+def save_state(name: str, state: Dict[str, Any]) -> None:
+    os.makedirs(CACHE_DIR, exist_ok=True)
+    with open(os.path.join(CACHE_DIR, name + ".json"), "w", encoding="utf-8") as f:
+        json.dump(state, f, indent=2, sort_keys=True)
+
+
+def load_state(name: str) -> Optional[Dict[str, Any]]:
+    try:
+        with open(os.path.join(CACHE_DIR, name + ".json"), "r", encoding="utf-8") as f:
+            return json.load(f)
+    except (OSError, ValueError):
+        return None
+
+
+def jobs_from_env(default: int = -1) -> int:
+    """TRAIN_JOBS=<n> (environment): worker processes for the searches, -1 = all cores."""
+    try:
+        return int(os.getenv("TRAIN_JOBS", str(default)))
+    except ValueError:
+        return default
+
+
+def incremental_from_env() -> bool:
+    """TRAIN_INCREMENTAL=1 (environment): skip the search, reuse the last selected config."""
+    return os.getenv("TRAIN_INCREMENTAL", "0").strip().lower() in ("1", "true", "yes")
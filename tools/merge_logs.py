@@ -3,6 +3,10 @@ import os
 import re
 import csv
 
+import numpy as np
+
+from log_cache import LogCache
+
 DATA_DIR = os.path.join(os.path.dirname(__file__), "..", "data")
 OUT_CSV = os.path.join(DATA_DIR, "dataset.csv")
 
@@ -39,6 +43,30 @@ def extract_label_from_filename(path: str) -> str:
     return label
 
 
+def parse_log(path: str) -> dict:
+    """Frames of one raw_*.txt log, {"rows": float[n][12]} in HEADER order."""
+    rows = []
+    with open(path, "r", encoding="utf-8") as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            m = LINE_RE.match(line)
+            if not m:
+                continue
+            vals = [float(x) for x in m.groups()]
+            f1, f2, f3, f4, f5, ax, ay, az, gx, gy, gz, gdp = vals
+            # Reorder into our canonical feature order:
+            # f1,f2,f3,f4,f5,gdp,ax,ay,az,gx,gy,gz
+            rows.append([
+                f1, f2, f3, f4, f5,
+                gdp,
+                ax, ay, az,
+                gx, gy, gz,
+            ])
+    return {"rows": np.asarray(rows, dtype=float).reshape(-1, len(HEADER) - 1)}
+
+
 def main():
     os.makedirs(DATA_DIR, exist_ok=True)
     paths = sorted(glob.glob(os.path.join(DATA_DIR, "raw_*.txt")))
@@ -47,31 +75,17 @@ def main():
         return
 
     rows = []
+    # Only logs that changed since the last merge are parsed (log_cache.py)
+    cache = LogCache("gesture_raw_v1")
 
     for path in paths:
         label = extract_label_from_filename(path)
         print(f"Parsing {os.path.basename(path)} (label='{label}')")
+        for vals in cache.load(path, parse_log)["rows"].tolist():
+            rows.append(vals + [label])
 
-        with open(path, "r", encoding="utf-8") as f:
-            for line in f:
-                line = line.strip()
-                if not line or line.startswith("#"):
-                    continue
-                m = LINE_RE.match(line)
-                if not m:
-                    continue
-                vals = [float(x) for x in m.groups()]
-                f1, f2, f3, f4, f5, ax, ay, az, gx, gy, gz, gdp = vals
-                # Reorder into our canonical feature order:
-                # f1,f2,f3,f4,f5,gdp,ax,ay,az,gx,gy,gz,label
-                row = [
-                    f1, f2, f3, f4, f5,
-                    gdp,
-                    ax, ay, az,
-                    gx, gy, gz,
-                    label,
-                ]
-                rows.append(row)
+    cache.prune()
+    print(f"Logs: {cache.summary()}")
 
     if not rows:
         print("No valid data lines found in any raw_*.txt files.")
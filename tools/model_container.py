@@ -0,0 +1,263 @@
+"""Pack the trained models into the flash model container (src/model_store.h).
+
+The trainers export C headers into src/; this packs the same tables into
+one versioned binary (data/models.bin) that the glove maps from its
+"models" partition (partitions_models.csv). A retrained model then only
+needs the container written, not a firmware rebuild, as long as the
+architecture (feature count, K, metric, weights, class list, sentence
+block layout) is unchanged; the glove checks that and otherwise keeps
+the tables compiled into the firmware.
+
+  python tools/model_container.py build
+  python tools/model_container.py upload --port COM15    # over serial (MODEL UPLOAD)
+  python tools/model_container.py flash --port COM15     # esptool, glove in bootloader
+
+train_knn.py and train_sentence_knn.py run `build` after exporting.
+"""
+import argparse
+import json
+import os
+import re
+import struct
+import subprocess
+import sys
+import time
+import zlib
+
+import numpy as np
+
+ROOT = os.path.join(os.path.dirname(__file__), "..")
+SRC_DIR = os.path.join(ROOT, "src")
+OUT_PATH = os.path.join(ROOT, "data", "models.bin")
+
+# Must match src/model_store.h and partitions_models.csv
+MAGIC = 0x444D5345           # "ESMD"
+FORMAT_VERSION = 1
+ALIGN = 16
+PARTITION_OFFSET = 0x260000
+PARTITION_SIZE = 0xF0000
+
+SEC_GESTURE_META = 1
+SEC_GESTURE_MEAN = 2
+SEC_GESTURE_SCALE = 3
+SEC_GESTURE_QSCALES = 4
+SEC_GESTURE_ROWS = 5
+SEC_GESTURE_LABELS = 6
+SEC_INDEX_DIM = 7
+SEC_INDEX_SPLIT = 8
+SEC_INDEX_A = 9
+SEC_INDEX_B = 10
+SEC_INDEX_PERM = 11
+SEC_SENTENCE_META = 32
+SEC_SENTENCE_AFFINE_A = 33
+SEC_SENTENCE_AFFINE_B = 34
+SEC_SENTENCE_ROWS = 35
+SEC_SENTENCE_LABELS = 36
+SEC_SENTENCE_BLOCKS = 37
+SEC_SENTENCE_COARSE = 38
+SEC_SENTENCE_DTW_UPPER = 39
+SEC_SENTENCE_DTW_LOWER = 40
+
+FILE_HEADER = struct.Struct("<IHHII")      # magic, version, numSections, totalSize, crc32
+SECTION = struct.Struct("<IIII")           # id, offset, size, reserved
+GESTURE_META = struct.Struct("<HBBBBHII")  # ModelGestureMeta
+SENTENCE_META = struct.Struct("<HBBIHHHH") # ModelSentenceMeta
+
+UPLOAD_ACK_TIMEOUT = 3.0
+
+
+def read_header(name: str) -> str:
+    with open(os.path.join(SRC_DIR, name), "r", encoding="utf-8") as f:
+        return f.read()
+
+
+def header_define(text: str, name: str) -> int:
+    m = re.search(r"#define\s+%s\s+(-?\d+)" % name, text)
+    if not m:
+        raise ValueError("missing #define " + name)
+    return int(m.group(1))
+
+
+def header_array(text: str, name: str) -> np.ndarray:
+    """Flat numeric contents of `... name[...] ... = { ... };`."""
+    m = re.search(r"\b%s\s*\[[^=]*=\s*\{(.*?)\};" % re.escape(name), text, re.S)
+    if not m:
+        raise ValueError("missing array " + name)
+    body = re.sub(r"//[^\n]*", "", m.group(1))
+    values = re.findall(r"-?\d+\.?\d*(?:[eE][-+]?\d+)?", body.replace("f", ""))
+    return np.array([float(v) for v in values])
+
+
+def gesture_sections() -> list:
+    model = read_header("glove_knn_model_q.h")
+    index = read_header("glove_knn_index.h")
+    scaler = read_header("scaler_params.h")
+    n_features = header_define(scaler, "NUM_FEATURES")
+    n_samples = header_define(model, "NUM_SAMPLES")
+    n_nodes = header_define(index, "KNN_INDEX_NUM_NODES")
+    if header_define(index, "KNN_INDEX_NUM_SAMPLES") != n_samples:
+        raise ValueError("glove_knn_index.h was built for a different table; re-run train_knn.py")
+
+    meta = GESTURE_META.pack(n_features, header_define(model, "KNN_K"),
+                             header_define(model, "KNN_METRIC"), header_define(model, "KNN_WEIGHTS"),
+                             header_define(read_header("label_names.h"), "NUM_CLASSES"),
+                             header_define(index, "KNN_INDEX_LEAF_SIZE"), n_samples, n_nodes)
+    f32 = lambda text, name: header_array(text, name).astype("<f4").tobytes()
+    return [
+        (SEC_GESTURE_META, meta),
+        (SEC_GESTURE_MEAN, f32(scaler, "SCALER_MEAN")),
+        (SEC_GESTURE_SCALE, f32(scaler, "SCALER_SCALE")),
+        (SEC_GESTURE_QSCALES, f32(model, "KNN_Q_SCALES")),
+        (SEC_GESTURE_ROWS, header_array(model, "X_train_q").astype(np.int8).tobytes()),
+        (SEC_GESTURE_LABELS, header_array(model, "y_train").astype(np.uint8).tobytes()),
+        (SEC_INDEX_DIM, header_array(index, "KNN_INDEX_DIM").astype(np.uint8).tobytes()),
+        (SEC_INDEX_SPLIT, header_array(index, "KNN_INDEX_SPLIT").astype(np.int8).tobytes()),
+        (SEC_INDEX_A, header_array(index, "KNN_INDEX_A").astype("<u2").tobytes()),
+        (SEC_INDEX_B, header_array(index, "KNN_INDEX_B").astype("<u2").tobytes()),
+        (SEC_INDEX_PERM, header_array(index, "KNN_INDEX_PERM").astype("<u2").tobytes()),
+    ]
+
+
+def sentence_sections() -> list:
+    model = read_header("sentence_knn_model_q.h")
+    if "SENTENCE_KNN_Q_PCA_COMPONENTS" in model:
+        raise ValueError("PCA sentence models are compiled into the firmware only")
+    if "SENTENCE_KNN_Q_HAS_AFFINE" not in model or "SENTENCE_KNN_Q_N_BLOCKS" not in model:
+        raise ValueError("sentence_knn_model_q.h predates the affine / block order export; "
+                         "re-run train_sentence_knn.py")
+    coarse = "SENTENCE_KNN_Q_COARSE_FACTOR" in model
+    dtw = "SENTENCE_KNN_Q_DTW_BAND" in model
+    meta = SENTENCE_META.pack(header_define(model, "SENTENCE_KNN_Q_N_FEATURES"),
+                              header_define(model, "SENTENCE_KNN_Q_N_NEIGHBORS"),
+                              header_define(read_header("sentence_label_names.h"), "SENTENCE_NUM_CLASSES"),
+                              header_define(model, "SENTENCE_KNN_Q_N_SAMPLES"),
+                              header_define(model, "SENTENCE_KNN_Q_BLOCK_LEN"),
+                              header_define(model, "SENTENCE_KNN_Q_N_BLOCKS"),
+                              header_define(model, "SENTENCE_KNN_Q_COARSE_FACTOR") if coarse else 0,
+                              header_define(model, "SENTENCE_KNN_Q_DTW_BAND") if dtw else 0)
+    sections = [
+        (SEC_SENTENCE_META, meta),
+        (SEC_SENTENCE_AFFINE_A, header_array(model, "SENTENCE_Q_AFFINE_A").astype("<f4").tobytes()),
+        (SEC_SENTENCE_AFFINE_B, header_array(model, "SENTENCE_Q_AFFINE_B").astype("<f4").tobytes()),
+        (SEC_SENTENCE_ROWS, header_array(model, "SENTENCE_TRAINING_DATA_Q").astype(np.int8).tobytes()),
+        (SEC_SENTENCE_LABELS, header_array(model, "SENTENCE_TRAINING_LABELS_Q").astype(np.uint8).tobytes()),
+        (SEC_SENTENCE_BLOCKS, header_array(model, "SENTENCE_Q_BLOCK_ORDER").astype("<u2").tobytes()),
+    ]
+    if coarse:
+        sections.append((SEC_SENTENCE_COARSE, header_array(model, "SENTENCE_Q_COARSE").astype("<i2").tobytes()))
+    if dtw:
+        sections.append((SEC_SENTENCE_DTW_UPPER, header_array(model, "SENTENCE_Q_DTW_UPPER").astype(np.int8).tobytes()))
+        sections.append((SEC_SENTENCE_DTW_LOWER, header_array(model, "SENTENCE_Q_DTW_LOWER").astype(np.int8).tobytes()))
+    return sections
+
+
+def pack(sections: list) -> bytes:
+    """Header + section table + 16-byte aligned payloads, crc32 over all but the header."""
+    pad = lambda n: (n + ALIGN - 1) // ALIGN * ALIGN
+    offset = pad(FILE_HEADER.size + SECTION.size * len(sections))
+    table, body = b"", b""
+    for sec_id, data in sections:
+        table += SECTION.pack(sec_id, offset + len(body), len(data), 0)
+        body += data + b"\0" * (pad(len(data)) - len(data))
+    rest = table + b"\0" * (offset - FILE_HEADER.size - len(table)) + body
+    total = FILE_HEADER.size + len(rest)
+    return FILE_HEADER.pack(MAGIC, FORMAT_VERSION, len(sections), total, zlib.crc32(rest)) + rest
+
+
+def build(out_path: str = OUT_PATH) -> str:
+    sections = []
+    for name, part in (("gesture", gesture_sections), ("sentence", sentence_sections)):
+        try:
+            sections += part()
+        except (OSError, ValueError) as e:
+            print(f"model container: {name} model skipped ({e})")
+    if not sections:
+        raise ValueError("no exported models found in src/")
+
+    blob = pack(sections)
+    if len(blob) > PARTITION_SIZE:
+        raise ValueError(f"container is {len(blob)} bytes, the models partition holds {PARTITION_SIZE}")
+    os.makedirs(os.path.dirname(out_path), exist_ok=True)
+    with open(out_path, "wb") as f:
+        f.write(blob)
+    print(f"Model container: {out_path} ({len(blob) / 1024:.1f} KB, crc32 {zlib.crc32(blob):08x})")
+    return out_path
+
+
+def wait_event(ser, names, timeout: float):
+    """Next JSON line whose "event" is one of names (other output is skipped)."""
+    end = time.time() + timeout
+    while time.time() < end:
+        line = ser.readline().decode("utf-8", errors="ignore").strip()
+        if not line.startswith("{"):
+            continue
+        try:
+            msg = json.loads(line)
+        except ValueError:
+            continue
+        if isinstance(msg, dict) and msg.get("event") in names:
+            return msg
+    return None
+
+
+def upload(port: str, baud: int, path: str) -> bool:
+    import serial
+
+    with open(path, "rb") as f:
+        blob = f.read()
+    ser = serial.Serial(port, baud, timeout=0.2)
+    time.sleep(2)
+    ser.reset_input_buffer()
+    ser.write(b"FORMAT JSON\n")      # acks must not hide among binary frames
+    ser.write(("MODEL UPLOAD %d %08x\n" % (len(blob), zlib.crc32(blob))).encode("ascii"))
+
+    ack = wait_event(ser, ("model_ack", "model_error"), UPLOAD_ACK_TIMEOUT)
+    if not ack or ack["event"] != "model_ack":
+        print("Glove did not accept the upload:", ack)
+        return False
+    chunk = int(ack.get("chunk", 1024))
+
+    sent = 0
+    while sent < len(blob):
+        part = blob[sent:sent + chunk]
+        ser.write(part)
+        sent += len(part)
+        ack = wait_event(ser, ("model_ack", "model_error"), UPLOAD_ACK_TIMEOUT)
+        if not ack or ack["event"] != "model_ack" or ack.get("received") != sent:
+            print(f"\nUpload failed at {sent} bytes:", ack)
+            return False
+        print(f"\r  {sent * 100 // len(blob)}%", end="", flush=True)
+    print()
+
+    info = wait_event(ser, ("model", "model_error"), UPLOAD_ACK_TIMEOUT)
+    ser.close()
+    print("Glove:", info)
+    return bool(info) and info["event"] == "model"
+
+
+def flash(port: str, path: str) -> bool:
+    cmd = [sys.executable, "-m", "esptool", "--chip", "esp32", "--port", port,
+           "write_flash", hex(PARTITION_OFFSET), path]
+    print(" ".join(cmd))
+    return subprocess.call(cmd) == 0
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("action", choices=("build", "upload", "flash"))
+    parser.add_argument("--port", default="COM15", help="Serial port (default COM15)")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--file", default=OUT_PATH, help="container path (default data/models.bin)")
+    args = parser.parse_args()
+
+    if args.action == "build":
+        build(args.file)
+        return
+    if not os.path.exists(args.file):
+        build(args.file)
+    ok = upload(args.port, args.baud, args.file) if args.action == "upload" else flash(args.port, args.file)
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,43 @@
+"""PlatformIO pre-script (env:native): regenerate bench/reference/ when stale.
+
+bench/knn_bench.cpp fails its agreement checks without sklearn's
+predictions, so tools/bench_reference.py is re-run whenever one of its
+inputs (the exported model headers, the datasets) is newer than them. It
+needs numpy, pandas and scikit-learn, i.e. the Python used for training,
+not PlatformIO's own: set BENCH_PYTHON if that is not `python` on PATH.
+"""
+import os
+import shutil
+import subprocess
+
+Import("env")  # noqa: F821  (provided by PlatformIO)
+
+INPUTS = [
+    "src/glove_knn_model.h",
+    "src/scaler_params.h",
+    "src/sentence_knn_model_q.h",
+    "src/sentence_scaler_params.h",
+    "data/dataset.csv",
+    "data/sentence_dataset.csv",
+    "tools/bench_reference.py",
+]
+OUTPUTS = ["bench/reference/gesture_dataset.txt", "bench/reference/sentence_dataset.txt"]
+
+root = env.subst("$PROJECT_DIR")  # noqa: F821
+
+
+def mtime(rel):
+    path = os.path.join(root, rel)
+    return os.path.getmtime(path) if os.path.exists(path) else None
+
+
+newest_input = max([t for t in map(mtime, INPUTS) if t is not None] or [0])
+outputs = [mtime(rel) for rel in OUTPUTS]
+
+if None in outputs or newest_input > min(outputs):
+    python = os.environ.get("BENCH_PYTHON") or shutil.which("python3" if os.name != "nt" else "python")
+    print("pio_bench_reference: bench/reference/ is missing or stale, running tools/bench_reference.py")
+    ok = python is not None and subprocess.call([python, os.path.join("tools", "bench_reference.py")], cwd=root) == 0
+    if not ok:
+        print("pio_bench_reference: no sklearn reference; the benchmark will fail its agreement checks "
+              "(install scikit-learn, set BENCH_PYTHON, or add -DBENCH_REQUIRE_REFERENCE=0)")
@@ -0,0 +1,35 @@
+"""PlatformIO pre-script: build the LittleFS image from the web UI files only.
+
+data/ also holds the training CSVs, raw logs and photos (several MB), which
+do not fit in the filesystem partition and are not needed on the glove.
+`pio run -t buildfs` / `-t uploadfs` get a staging copy of just the files
+served by src/web_stream.h, plus data/replay/ (logs for REPLAY FILE, see
+tools/replay_log.py) when that folder exists.
+"""
+import os
+import shutil
+
+Import("env")  # noqa: F821  (provided by PlatformIO)
+
+WEB_FILES = ["index.html", "main.js", "style.css", "hand.glb"]
+REPLAY_DIR = "replay"
+
+src_dir = env.subst("$PROJECT_DATA_DIR")  # noqa: F821
+stage_dir = os.path.join(env.subst("$BUILD_DIR"), "littlefs_web")  # noqa: F821
+
+if os.path.isdir(stage_dir):
+    shutil.rmtree(stage_dir)
+os.makedirs(stage_dir)
+
+for name in WEB_FILES:
+    path = os.path.join(src_dir, name)
+    if os.path.isfile(path):
+        shutil.copy2(path, stage_dir)
+    else:
+        print("pio_fs_web: missing %s" % path)
+
+replay_src = os.path.join(src_dir, REPLAY_DIR)
+if os.path.isdir(replay_src):
+    shutil.copytree(replay_src, os.path.join(stage_dir, REPLAY_DIR))
+
+env.Replace(PROJECT_DATA_DIR=stage_dir)  # noqa: F821
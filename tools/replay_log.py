@@ -0,0 +1,231 @@
+"""Replay recorded glove logs through the firmware's prediction path.
+
+Takes raw_*.txt / sentence_raw_*.txt files written by tools/collect_*,
+runs them through the glove (REPLAY command, src/replay_source.h) and
+scores the predictions against the label in the log header.
+
+Serial (default): the frames are streamed over the port at the log's rate
+times --speed, so end-to-end latency (frame sent -> prediction received)
+is measured too. 115200 baud carries about 100 frames/s, so keep
+--speed * 20 Hz below that.
+
+--on-device: the glove reads /replay/<name> from LittleFS itself (put the
+logs in data/replay/ and run `pio run -t uploadfs`). No baud limit, so
+this is the mode for 10x stress runs; only accuracy and the device's
+frame / drop counts are reported.
+
+  python tools/replay_log.py data/raw_A_01.txt data/raw_B_01.txt --port COM15
+  python tools/replay_log.py data/raw_A_01.txt --on-device --speed 10
+"""
+import argparse
+import json
+import os
+import statistics
+import sys
+import threading
+import time
+
+import serial
+
+from wire_protocol import StreamDecoder
+
+LOG_HZ = 20            # tools/collect_* log at 20 Hz
+DONE_TIMEOUT = 5.0     # seconds to wait for replay_done after the last frame
+
+
+def read_log(path):
+    """(label, is_sentence, FLEX lines) of one collected log."""
+    label, is_sentence, frames = None, False, []
+    with open(path, "r", encoding="utf-8", errors="ignore") as f:
+        for line in f:
+            line = line.strip()
+            if line.startswith("# sentence_label="):
+                label, is_sentence = line.split("=", 1)[1], True
+            elif line.startswith("# label="):
+                label = line.split("=", 1)[1]
+            elif line.startswith("FLEX:"):
+                frames.append(line)
+    return label, is_sentence, frames
+
+
+class Listener(threading.Thread):
+    """Decodes everything the glove sends and keeps what a replay needs."""
+
+    def __init__(self, ser):
+        super().__init__(daemon=True)
+        self.ser = ser
+        self.decoder = StreamDecoder()
+        self.lock = threading.Lock()
+        self.events = {}        # event name -> last event dict
+        self.predictions = []   # (host receive time, frame dict)
+        self.running = True
+
+    def run(self):
+        while self.running:
+            data = self.ser.read(self.ser.in_waiting or 1)
+            if not data:
+                continue
+            now = time.perf_counter()
+            for kind, item in self.decoder.feed(data):
+                if kind == "line":
+                    try:
+                        item = json.loads(item)
+                    except ValueError:
+                        continue
+                    if not isinstance(item, dict):
+                        continue
+                with self.lock:
+                    if "event" in item:
+                        self.events[item["event"]] = item
+                    elif "mode" in item:
+                        self.predictions.append((now, item))
+
+    def reset(self):
+        with self.lock:
+            self.events.clear()
+            self.predictions = []
+
+    def wait_event(self, name, timeout):
+        end = time.time() + timeout
+        while time.time() < end:
+            with self.lock:
+                if name in self.events:
+                    return self.events[name]
+            time.sleep(0.01)
+        return None
+
+
+def send(ser, line):
+    ser.write((line + "\n").encode("ascii"))
+
+
+def replay_one(ser, listener, path, args):
+    label, is_sentence, frames = read_log(path)
+    if not frames:
+        print("%s: no FLEX lines, skipped" % path)
+        return None
+
+    send(ser, "MODE SENTENCE" if is_sentence else "MODE GESTURE")
+    time.sleep(0.2)
+    listener.reset()
+
+    sent_at = []
+    if args.on_device:
+        device_path = "/replay/" + os.path.basename(path)
+        send(ser, "REPLAY FILE %s %d %d" % (device_path, args.hz, args.speed))
+        start = listener.wait_event("replay_start", 2.0)
+        if start is None:
+            print("%s: glove did not start the replay (is %s on LittleFS?)" % (path, device_path))
+            return None
+        done = listener.wait_event("replay_done",
+                                   len(frames) / float(args.hz * args.speed) + DONE_TIMEOUT)
+    else:
+        send(ser, "REPLAY SERIAL %d %d" % (args.hz, args.speed))
+        start = listener.wait_event("replay_start", 2.0)
+        if start is None:
+            print("%s: glove did not start the replay" % path)
+            return None
+        period = 1.0 / (args.hz * args.speed)
+        t_start = time.perf_counter()
+        for i, line in enumerate(frames):
+            delay = t_start + i * period - time.perf_counter()
+            if delay > 0:
+                time.sleep(delay)
+            sent_at.append(time.perf_counter())
+            send(ser, line)
+        time.sleep(0.5)  # let the last windows come out
+        send(ser, "REPLAY STOP")
+        done = listener.wait_event("replay_done", DONE_TIMEOUT)
+
+    with listener.lock:
+        predictions = list(listener.predictions)
+
+    # Accuracy: gesture frames (or sentence results) that match the label
+    if is_sentence:
+        outputs = [p["sentence"] for _, p in predictions if "sentence" in p]
+    else:
+        outputs = [p["label"] for _, p in predictions if "label" in p]
+    hits = sum(1 for o in outputs if o == label)
+
+    # Latency from the virtual timestamp of the frame that produced each
+    # prediction (binary frames carry it; FORMAT BINARY for this)
+    latencies = []
+    t0 = start.get("t0", 0)
+    for received, p in predictions:
+        if "t" not in p or not sent_at:
+            continue
+        idx = int(round((p["t"] - t0) * args.hz / 1000.0))
+        if 0 <= idx < len(sent_at):
+            latencies.append((received - sent_at[idx]) * 1000.0)
+
+    result = {
+        "file": os.path.basename(path), "label": label, "frames": len(frames),
+        "outputs": len(outputs), "hits": hits,
+        "accuracy": hits / float(len(outputs)) if outputs else 0.0,
+        "latencies": latencies, "device": done or {},
+    }
+    print_result(result)
+    return result
+
+
+def print_result(r):
+    dev = r["device"]
+    line = "%-32s %-20s %5d frames  %4d outputs  acc %5.1f%%" % (
+        r["file"], r["label"], r["frames"], r["outputs"], 100.0 * r["accuracy"])
+    if r["latencies"]:
+        lat = sorted(r["latencies"])
+        line += "  latency p50 %.1f ms p99 %.1f ms" % (
+            statistics.median(lat), lat[min(len(lat) - 1, int(len(lat) * 0.99))])
+    if dev:
+        line += "  device %s frames / %s ms, %s underruns, %s dropped" % (
+            dev.get("frames"), dev.get("ms"), dev.get("underruns"), dev.get("dropped"))
+    else:
+        line += "  (no replay_done)"
+    print(line)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("logs", nargs="+", help="raw_*.txt / sentence_raw_*.txt files")
+    parser.add_argument("--port", default="COM15", help="Serial port (default COM15)")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--hz", type=int, default=LOG_HZ, help="rate the logs were recorded at")
+    parser.add_argument("--speed", type=int, default=1, help="replay speed multiplier")
+    parser.add_argument("--on-device", action="store_true",
+                        help="replay /replay/<name> from the glove's LittleFS")
+    parser.add_argument("--binary", action="store_true",
+                        help="switch the glove to binary frames (needed for latency)")
+    args = parser.parse_args()
+
+    if not args.on_device and args.hz * args.speed > 100:
+        print("warning: %d frames/s is more than 115200 baud carries; use --on-device"
+              % (args.hz * args.speed))
+
+    try:
+        ser = serial.Serial(args.port, args.baud, timeout=0.05)
+    except Exception as e:
+        print(f"ERROR opening serial port {args.port}: {e}")
+        sys.exit(1)
+    time.sleep(2)
+    ser.reset_input_buffer()
+
+    listener = Listener(ser)
+    listener.start()
+    if args.binary:
+        send(ser, "FORMAT BINARY")
+
+    results = [r for r in (replay_one(ser, listener, p, args) for p in args.logs) if r]
+
+    if args.binary:
+        send(ser, "FORMAT JSON")
+    listener.running = False
+
+    outputs = sum(r["outputs"] for r in results)
+    if outputs:
+        print("\nOverall: %d / %d outputs match the log label (%.1f%%)"
+              % (sum(r["hits"] for r in results), outputs,
+                 100.0 * sum(r["hits"] for r in results) / outputs))
+
+
+if __name__ == "__main__":
+    main()
@@ -2,14 +2,19 @@ import os
 import numpy as np
 import pandas as pd
 
-from typing import Any, Dict, cast
+from typing import Any, Dict, List, Tuple, cast
 
-from sklearn.model_selection import train_test_split, StratifiedKFold, cross_val_predict
+from joblib import Parallel, delayed
+from sklearn.model_selection import train_test_split, StratifiedKFold
 from sklearn.preprocessing import StandardScaler, LabelEncoder
 from sklearn.neighbors import KNeighborsClassifier
+from sklearn.cluster import KMeans
 from sklearn.pipeline import Pipeline
 from sklearn.metrics import classification_report, confusion_matrix
 
+import model_container
+from log_cache import LogCache, save_state, load_state, jobs_from_env, incremental_from_env
+
 DATA_DIR = os.path.join(os.path.dirname(__file__), "..", "data")
 SRC_DIR = os.path.join(os.path.dirname(__file__), "..", "src")
 
@@ -142,19 +147,347 @@ def export_knn_model(
     print(f"Wrote KNN model to {out_path}")
 
 
-def main() -> None:
-    if not os.path.exists(CSV_PATH):
-        raise SystemExit(f"dataset.csv not found at {CSV_PATH}")
+def compute_quant_scales(X_scaled: np.ndarray) -> np.ndarray:
+    """Per-feature symmetric int8 scales: scale_j = 127 / max(|X[:, j]|)."""
+    max_abs = np.max(np.abs(X_scaled), axis=0)
+    max_abs[max_abs == 0] = 1e-6  # avoid divide by zero
+    return 127.0 / max_abs
+
+
+def quantize_int8(X_scaled: np.ndarray, scales: np.ndarray) -> np.ndarray:
+    return np.rint(np.clip(X_scaled * scales, -128, 127)).astype(np.int8)
+
 
-    df = pd.read_csv(CSV_PATH)
+def export_knn_model_int8(
+    knn: KNeighborsClassifier,
+    X_scaled: np.ndarray,
+    y_enc: np.ndarray,
+    out_path: str,
+) -> np.ndarray:
+    """Export the same KNN table quantized to int8 plus per-feature scales.
+
+    Symmetric per-feature quantization of the standardized feature space
+    (same scheme as the sentence model): q = clip(round(x * scale_j), -128, 127).
+    The firmware scans in integer space and dequantizes only the K winners.
+    """
+    n_samples, n_features = X_scaled.shape
+
+    metric = getattr(knn, "metric", "euclidean")
+    metric_code = {"euclidean": 0, "manhattan": 1, "chebyshev": 2}.get(metric)
+    if metric_code is None:
+        raise ValueError(f"Unsupported metric for export: {metric}")
+
+    weights = getattr(knn, "weights", "uniform")
+    weights_code = {"uniform": 0, "distance": 1}.get(weights)
+    if weights_code is None:
+        raise ValueError(f"Unsupported weights for export: {weights}")
+
+    k = int(getattr(knn, "n_neighbors", 3))
+
+    scales = compute_quant_scales(X_scaled)
+    q_data = quantize_int8(X_scaled, scales)
+
+    lines = []
+    lines.append("#pragma once")
+    lines.append("#include <Arduino.h>")
+    lines.append("#include \"scaler_params.h\"")
+    lines.append("")
+    lines.append("// Auto-generated by train_knn.py (int8 quantized)")
+    lines.append(f"#define KNN_K        {k}")
+    lines.append(f"#define KNN_METRIC   {metric_code}  // 0=L2, 1=L1, 2=Linf")
+    lines.append(f"#define KNN_WEIGHTS  {weights_code}  // 0=uniform, 1=distance")
+    lines.append("")
+    lines.append(f"#define NUM_SAMPLES  {n_samples}")
+    lines.append("")
+    lines.append("// Per-feature quantization scales (multiply standardized float to get int8)")
+    scale_vals = ", ".join(f"{float(v):.6f}f" for v in scales)
+    lines.append(f"static const float KNN_Q_SCALES[NUM_FEATURES] PROGMEM = {{ {scale_vals} }};")
+    lines.append("")
+    # aligned(4): rows are read as packed int8 words by the SWAR L1 kernel
+    lines.append("static const int8_t X_train_q[NUM_SAMPLES][NUM_FEATURES] PROGMEM __attribute__((aligned(4))) = {")
+    for i in range(n_samples):
+        row = ", ".join(str(int(v)) for v in q_data[i])
+        comma = "," if i < n_samples - 1 else ""
+        lines.append(f"  {{ {row} }}{comma}")
+    lines.append("};")
+    lines.append("")
+    lines.append("static const uint8_t y_train[NUM_SAMPLES] PROGMEM = {")
+    row = ", ".join(str(int(v)) for v in y_enc)
+    lines.append(f"  {row}")
+    lines.append("};")
+    lines.append("")
+    lines.append("inline void quantizeFeatures(const float* inFeat, int8_t* outQ) {")
+    lines.append("  for (int i = 0; i < NUM_FEATURES; ++i) {")
+    lines.append("    float q = inFeat[i] * pgm_read_float(&KNN_Q_SCALES[i]);")
+    lines.append("    if (q > 127.0f) q = 127.0f; else if (q < -128.0f) q = -128.0f;")
+    lines.append("    outQ[i] = (int8_t)lrintf(q);")
+    lines.append("  }")
+    lines.append("}")
+    lines.append("")
+
+    with open(out_path, "w", encoding="utf-8") as f:
+        f.write("\n".join(lines))
+
+    print(f"Wrote INT8 KNN model to {out_path} (~{n_samples * n_features / 1024:.1f} KB table)")
+    return q_data
+
+
+KD_LEAF_SIZE = 16
+KD_INDEX_MAX = 0xFFFF   # KNN_INDEX_A / B / PERM are uint16_t (firmware and container)
+
+
+def build_kd_index(q_data: np.ndarray, leaf_size: int = KD_LEAF_SIZE) -> Dict[str, Any]:
+    """KD-tree over the int8 table, flattened in pre-order.
+
+    Internal node: dim = split dimension, split = threshold (rows with
+    code <= split go left), a = index of the right child (left = node + 1).
+    Leaf: dim = 0xFF, a = start in perm[], b = row count.
+    The split dimension is the one with the largest code spread; the
+    threshold is the median code (moved down one step if that would leave
+    the right side empty). Rows inside a leaf stay in ascending row order.
+    """
+    dims, splits, a_arr, b_arr, perm = [], [], [], [], []
+
+    def build(idx: np.ndarray) -> int:
+        node = len(dims)
+        dims.append(0xFF)
+        splits.append(0)
+        a_arr.append(0)
+        b_arr.append(0)
+
+        codes = q_data[idx].astype(int)
+        spread = codes.max(axis=0) - codes.min(axis=0) if idx.size else np.zeros(1, dtype=int)
+        if idx.size <= leaf_size or int(spread.max()) == 0:
+            a_arr[node] = len(perm)
+            b_arr[node] = int(idx.size)
+            perm.extend(int(i) for i in idx)
+            return node
+
+        dim = int(np.argmax(spread))
+        col = codes[:, dim]
+        t = int(np.sort(col, kind="stable")[(idx.size - 1) // 2])
+        if int(np.sum(col <= t)) == idx.size:
+            t = int(col[col < t].max())
+
+        dims[node] = dim
+        splits[node] = t
+        build(idx[col <= t])
+        a_arr[node] = build(idx[col > t])
+        return node
+
+    build(np.arange(q_data.shape[0]))
+    return {"dim": dims, "split": splits, "a": a_arr, "b": b_arr, "perm": perm}
+
+
+def export_kd_index(q_data: np.ndarray, out_path: str, leaf_size: int = KD_LEAF_SIZE) -> None:
+    """Write glove_knn_index.h for the int8 table exported alongside it."""
+    index = build_kd_index(q_data, leaf_size)
+    n_nodes = len(index["dim"])
+    # Wider tables would wrap silently and the KD search would return wrong rows
+    if q_data.shape[0] > KD_INDEX_MAX or n_nodes > KD_INDEX_MAX:
+        raise ValueError(f"KD index does not fit uint16_t: {q_data.shape[0]} samples, {n_nodes} nodes "
+                         f"(max {KD_INDEX_MAX})")
+
+    def arr(vals: list) -> str:
+        return ", ".join(str(int(v)) for v in vals)
+
+    lines = []
+    lines.append("#pragma once")
+    lines.append("#include <Arduino.h>")
+    lines.append("")
+    lines.append("// Auto-generated by train_knn.py (KD-tree over X_train_q)")
+    lines.append("// Node i: dim==0xFF -> leaf rows perm[a .. a+b), else split on dim at")
+    lines.append("// split (code <= split goes left = i+1, right child = a)")
+    lines.append(f"#define KNN_INDEX_NUM_SAMPLES {q_data.shape[0]}")
+    lines.append(f"#define KNN_INDEX_NUM_NODES   {n_nodes}")
+    lines.append(f"#define KNN_INDEX_LEAF_SIZE   {leaf_size}")
+    lines.append("")
+    lines.append(f"static const uint8_t KNN_INDEX_DIM[KNN_INDEX_NUM_NODES] PROGMEM = {{ {arr(index['dim'])} }};")
+    lines.append("")
+    lines.append(f"static const int8_t KNN_INDEX_SPLIT[KNN_INDEX_NUM_NODES] PROGMEM = {{ {arr(index['split'])} }};")
+    lines.append("")
+    lines.append(f"static const uint16_t KNN_INDEX_A[KNN_INDEX_NUM_NODES] PROGMEM = {{ {arr(index['a'])} }};")
+    lines.append("")
+    lines.append(f"static const uint16_t KNN_INDEX_B[KNN_INDEX_NUM_NODES] PROGMEM = {{ {arr(index['b'])} }};")
+    lines.append("")
+    lines.append("static const uint16_t KNN_INDEX_PERM[KNN_INDEX_NUM_SAMPLES] PROGMEM = {")
+    perm = index["perm"]
+    for i in range(0, len(perm), 32):
+        comma = "," if i + 32 < len(perm) else ""
+        lines.append(f"  {arr(perm[i:i + 32])}{comma}")
+    lines.append("};")
+    lines.append("")
+
+    with open(out_path, "w", encoding="utf-8") as f:
+        f.write("\n".join(lines))
+
+    print(f"Wrote KD index to {out_path} ({n_nodes} nodes, leaf size {leaf_size})")
+
+
+def _pairwise_dist(A: np.ndarray, x: np.ndarray, metric: str) -> np.ndarray:
+    diff = np.abs(A - x)
+    if metric == "manhattan":
+        return diff.sum(axis=1)
+    if metric == "chebyshev":
+        return diff.max(axis=1)
+    return (diff * diff).sum(axis=1)  # squared L2, same ranking as euclidean
+
+
+def condense_cnn(X: np.ndarray, y: np.ndarray, metric: str, max_passes: int = 10,
+                 seed: int = 42) -> np.ndarray:
+    """Hart's condensed nearest neighbour. Returns indices of the kept rows.
+
+    Starts with one random sample per class, then repeatedly adds every
+    sample the current store misclassifies (1-NN) until a pass adds nothing.
+    """
+    rng = np.random.default_rng(seed)
+    store = [int(rng.choice(np.where(y == c)[0])) for c in np.unique(y)]
+    in_store = np.zeros(len(y), dtype=bool)
+    in_store[store] = True
+
+    # The store can grow to every row: preallocate and fill instead of
+    # copying it on each addition
+    S = np.empty((len(y), X.shape[1]), dtype=X.dtype)
+    S_y = np.empty(len(y), dtype=y.dtype)
+    n = len(store)
+    S[:n] = X[store]
+    S_y[:n] = y[store]
+
+    for _ in range(max_passes):
+        added = 0
+        for i in rng.permutation(len(y)):
+            if in_store[i]:
+                continue
+            nn = int(np.argmin(_pairwise_dist(S[:n], X[i], metric)))
+            if S_y[nn] != y[i]:
+                store.append(int(i))
+                in_store[i] = True
+                S[n] = X[i]
+                S_y[n] = y[i]
+                n += 1
+                added += 1
+        if added == 0:
+            break
+    return np.asarray(store, dtype=int)
+
+
+def condense_kmeans(X: np.ndarray, y: np.ndarray, per_class: int,
+                    seed: int = 42) -> "tuple[np.ndarray, np.ndarray]":
+    """Per-class k-means prototypes (cluster centres in standardized space)."""
+    X_out, y_out = [], []
+    for c in np.unique(y):
+        Xc = X[y == c]
+        n = min(per_class, Xc.shape[0])
+        km = KMeans(n_clusters=n, n_init=4, random_state=seed).fit(Xc)
+        X_out.append(km.cluster_centers_)
+        y_out.append(np.full(n, c, dtype=np.uint8))
+    return np.vstack(X_out), np.concatenate(y_out)
+
+
+def condense_export_set(X: np.ndarray, y: np.ndarray, method: str, per_class: int,
+                        metric: str) -> "tuple[np.ndarray, np.ndarray]":
+    """Reduce the KNN table. method: "cnn" or "kmeans" (anything else = no-op)."""
+    if method == "cnn":
+        keep = condense_cnn(X, y, metric)
+        return X[keep], y[keep]
+    if method == "kmeans":
+        return condense_kmeans(X, y, per_class)
+    return X, y
+
+
+def report_condensed_accuracy(cfg: Dict[str, Any], X_tr: np.ndarray, X_te: np.ndarray,
+                              y_tr: np.ndarray, y_te: np.ndarray,
+                              method: str, per_class: int) -> None:
+    """Holdout accuracy of the full table vs. the condensed table."""
+    scaler = StandardScaler().fit(X_tr)
+    A: np.ndarray = np.asarray(scaler.transform(X_tr), dtype=float)
+    B: np.ndarray = np.asarray(scaler.transform(X_te), dtype=float)
+
+    params = dict(n_neighbors=cfg["n_neighbors"], metric=cfg["metric"], weights=cfg["weights"])
+    acc_full = float(np.mean(KNeighborsClassifier(**params).fit(A, y_tr).predict(B) == y_te))
+
+    A_c, y_c = condense_export_set(A, y_tr, method, per_class, cfg["metric"])
+    params["n_neighbors"] = min(cfg["n_neighbors"], len(y_c))
+    acc_c = float(np.mean(KNeighborsClassifier(**params).fit(A_c, y_c).predict(B) == y_te))
+
+    print(f"\nCondensation ({method}): {len(y_tr)} -> {len(y_c)} samples "
+          f"({100.0 * len(y_c) / len(y_tr):.1f}%), holdout accuracy full={acc_full:.4f} "
+          f"condensed={acc_c:.4f} delta={acc_c - acc_full:+.4f}")
+
+
+def report_int8_accuracy_delta(cfg: Dict[str, Any], X_tr: np.ndarray, X_te: np.ndarray,
+                               y_tr: np.ndarray, y_te: np.ndarray) -> None:
+    """Holdout accuracy of the float model vs. the same model on int8 features."""
+    scaler = StandardScaler().fit(X_tr)
+    A: np.ndarray = np.asarray(scaler.transform(X_tr), dtype=float)
+    B: np.ndarray = np.asarray(scaler.transform(X_te), dtype=float)
+    scales = compute_quant_scales(A)
+
+    params = dict(n_neighbors=cfg["n_neighbors"], metric=cfg["metric"], weights=cfg["weights"])
+    acc_f = float(np.mean(KNeighborsClassifier(**params).fit(A, y_tr).predict(B) == y_te))
+    A_q = quantize_int8(A, scales).astype(float)
+    B_q = quantize_int8(B, scales).astype(float)
+    acc_q = float(np.mean(KNeighborsClassifier(**params).fit(A_q, y_tr).predict(B_q) == y_te))
+
+    print(f"\nINT8 holdout accuracy: float={acc_f:.4f} int8={acc_q:.4f} delta={acc_q - acc_f:+.4f}")
+
+
+def _parse_dataset(path: str) -> Dict[str, np.ndarray]:
+    df = pd.read_csv(path)
 
     missing = [c for c in FEATURE_COLS + [LABEL_COL] if c not in df.columns]
     if missing:
         raise SystemExit(f"dataset.csv missing columns: {missing}")
 
     # Force numpy arrays so types are clean
-    X: np.ndarray = df[FEATURE_COLS].to_numpy(dtype=float)
-    y_str: np.ndarray = df[LABEL_COL].astype(str).to_numpy()
+    return {
+        "X": df[FEATURE_COLS].to_numpy(dtype=float),
+        "y": df[LABEL_COL].astype(str).to_numpy(dtype=str),
+    }
+
+
+def load_dataset(path: str) -> Tuple[np.ndarray, np.ndarray]:
+    """Features and labels of dataset.csv; the CSV is only parsed again after it changed."""
+    cache = LogCache("gesture_csv_v1")
+    arrays = cache.load(path, _parse_dataset)
+    cache.prune()
+    print(f"Dataset: {cache.summary()}")
+    return np.asarray(arrays["X"], dtype=float), np.asarray(arrays["y"], dtype=str)
+
+
+def _fold_predict(cfg: Dict[str, Any], X: np.ndarray, y: np.ndarray,
+                  train_idx: np.ndarray, test_idx: np.ndarray) -> np.ndarray:
+    pipe = Pipeline([
+        ("scaler", StandardScaler()),
+        ("knn", KNeighborsClassifier(n_neighbors=cfg["n_neighbors"], metric=cfg["metric"], weights=cfg["weights"]))
+    ])
+    pipe.fit(X[train_idx], y[train_idx])
+    return pipe.predict(X[test_idx])
+
+
+def sweep_cv_predictions(candidates: List[Dict[str, Any]], X: np.ndarray, y: np.ndarray,
+                         cv: StratifiedKFold, n_jobs: int) -> List[np.ndarray]:
+    """Out-of-fold predictions of every candidate (cross_val_predict per config).
+
+    All (config, fold) fits go to one joblib pool, so the whole sweep keeps
+    every core busy instead of one config's folds at a time.
+    """
+    splits = list(cv.split(X, y))
+    tasks = [(ci, tr, te) for ci in range(len(candidates)) for tr, te in splits]
+    results = Parallel(n_jobs=n_jobs)(
+        delayed(_fold_predict)(candidates[ci], X, y, tr, te) for ci, tr, te in tasks
+    )
+    preds = [np.empty_like(y) for _ in candidates]
+    for (ci, _tr, te), pred in zip(tasks, results):
+        preds[ci][te] = pred
+    return preds
+
+
+def main() -> None:
+    if not os.path.exists(CSV_PATH):
+        raise SystemExit(f"dataset.csv not found at {CSV_PATH}")
+
+    X, y_str = load_dataset(CSV_PATH)
 
     le = LabelEncoder()
     y_enc: np.ndarray = np.asarray(le.fit_transform(y_str), dtype=int)
@@ -177,34 +510,45 @@ def main() -> None:
     # Use plain Python strings for class names so dict lookups are well-typed
     class_names = [str(c) for c in le.classes_]
 
-    cv = StratifiedKFold(n_splits=10, shuffle=True, random_state=42)
-    for cfg in candidates:
-        pipe = Pipeline([
-            ("scaler", StandardScaler()),
-            ("knn", KNeighborsClassifier(n_neighbors=cfg["n_neighbors"], metric=cfg["metric"], weights=cfg["weights"]))
-        ])
-
-        y_pred_cv = cross_val_predict(pipe, X, y_enc, cv=cv, n_jobs=-1)
-        report: Dict[str, Any] = cast(Dict[str, Any], classification_report(
-            y_enc, y_pred_cv, target_names=class_names, output_dict=True, zero_division=0
-        ))
-        macro_f1 = float(report.get("macro avg", {}).get("f1-score", 0.0))
-        weighted_f1 = float(report.get("weighted avg", {}).get("f1-score", 0.0))
-
-        # Store textual summary line for printing later
-        per_class = {label: float(report[label]["f1-score"]) for label in class_names if label in report}
-        reports.append((cfg, macro_f1, weighted_f1, per_class))
-
-        # Track best configuration by weighted F1 (tie-breaker by macro F1)
-        if (weighted_f1 > best_weighted) or (weighted_f1 == best_weighted and macro_f1 > best_macro):
-            best_weighted = weighted_f1
-            best_macro = macro_f1
-            best_cfg = cfg
-
-    print("\nSweep results (macro-F1 then per-class F1):")
-    for cfg, macro_f1, weighted_f1, per_class in reports:
-        pcs = ", ".join(f"{lbl}:{per_class.get(lbl, 0.0):.3f}" for lbl in class_names)
-        print(f"  k={cfg['n_neighbors']}, metric={cfg['metric']}, weights=distance -> macro-F1={macro_f1:.4f}, weighted-F1={weighted_f1:.4f} | {pcs}")
+    # TRAIN_INCREMENTAL=1: new recordings only change the table, keep the
+    # config the last full sweep selected (if the sweep grid still has it)
+    if incremental_from_env():
+        state = load_state("train_knn")
+        if state and state.get("best") in candidates and state.get("classes") == class_names:
+            best_cfg = state["best"]
+            best_macro = float(state.get("macro_f1", -1.0))
+            print("\nIncremental: reusing the last sweep's config", best_cfg)
+        else:
+            print("\nIncremental: no matching previous sweep, running the full sweep")
+
+    if best_cfg is None:
+        cv = StratifiedKFold(n_splits=10, shuffle=True, random_state=42)
+        sweep_preds = sweep_cv_predictions(candidates, X, y_enc, cv, jobs_from_env())
+        for cfg, y_pred_cv in zip(candidates, sweep_preds):
+            report: Dict[str, Any] = cast(Dict[str, Any], classification_report(
+                y_enc, y_pred_cv, target_names=class_names, output_dict=True, zero_division=0
+            ))
+            macro_f1 = float(report.get("macro avg", {}).get("f1-score", 0.0))
+            weighted_f1 = float(report.get("weighted avg", {}).get("f1-score", 0.0))
+
+            # Store textual summary line for printing later
+            per_class = {label: float(report[label]["f1-score"]) for label in class_names if label in report}
+            reports.append((cfg, macro_f1, weighted_f1, per_class))
+
+            # Track best configuration by weighted F1 (tie-breaker by macro F1)
+            if (weighted_f1 > best_weighted) or (weighted_f1 == best_weighted and macro_f1 > best_macro):
+                best_weighted = weighted_f1
+                best_macro = macro_f1
+                best_cfg = cfg
+
+        print("\nSweep results (macro-F1 then per-class F1):")
+        for cfg, macro_f1, weighted_f1, per_class in reports:
+            pcs = ", ".join(f"{lbl}:{per_class.get(lbl, 0.0):.3f}" for lbl in class_names)
+            print(f"  k={cfg['n_neighbors']}, metric={cfg['metric']}, weights=distance -> macro-F1={macro_f1:.4f}, weighted-F1={weighted_f1:.4f} | {pcs}")
+
+        if best_cfg is not None:
+            save_state("train_knn", {"best": best_cfg, "classes": class_names,
+                                     "macro_f1": best_macro, "weighted_f1": best_weighted})
 
     if best_cfg is None:
         raise SystemExit("No valid hyperparameter configuration evaluated.")
@@ -227,6 +571,19 @@ def main() -> None:
     print("Confusion matrix:")
     print(confusion_matrix(y_te, y_pred))
 
+    report_int8_accuracy_delta(best_cfg, X_tr, X_te, y_tr, y_te)
+
+    # Optional training-set condensation for the exported table
+    # CONDENSE_METHOD = none (default) | cnn | kmeans
+    # CONDENSE_PER_CLASS = prototypes per class for kmeans (default 20)
+    condense_method = os.getenv("CONDENSE_METHOD", "none").strip().lower()
+    try:
+        condense_per_class = int(os.getenv("CONDENSE_PER_CLASS", "20"))
+    except Exception:
+        condense_per_class = 20
+    if condense_method in ("cnn", "kmeans"):
+        report_condensed_accuracy(best_cfg, X_tr, X_te, y_tr, y_te, condense_method, condense_per_class)
+
     scaler: StandardScaler = best_pipe.named_steps["scaler"]  # type: ignore[assignment]
     knn: KNeighborsClassifier = best_pipe.named_steps["knn"]  # type: ignore[assignment]
 
@@ -249,11 +606,21 @@ def main() -> None:
     except Exception:
         max_per_class = 800
 
+    X_export, y_export = X_all_scaled, y_all_enc
+    if condense_method in ("cnn", "kmeans"):
+        # Condense from the full scaled set, then cap what the condensation kept
+        n_before = int(X_all_scaled.shape[0])
+        X_export, y_export = condense_export_set(
+            X_all_scaled, y_all_enc, condense_method, condense_per_class, best_cfg["metric"]
+        )
+        y_export = np.asarray(y_export, dtype=np.uint8)
+        print(f"\nCondensed export set ({condense_method}): {n_before} -> {X_export.shape[0]} samples")
+
     rng = np.random.default_rng(42)
     kept_indices = []
     per_class_counts = []
     for c, _name in enumerate(le.classes_):
-        cls_idx = np.where(y_all_enc == c)[0]
+        cls_idx = np.where(y_export == c)[0]
         if cls_idx.size > max_per_class:
             sel = rng.choice(cls_idx, size=max_per_class, replace=False)
         else:
@@ -264,12 +631,19 @@ def main() -> None:
     kept_indices = np.concatenate(kept_indices)
     rng.shuffle(kept_indices)
 
-    X_export = X_all_scaled[kept_indices]
-    y_export = y_all_enc[kept_indices]
+    X_export = X_export[kept_indices]
+    y_export = y_export[kept_indices]
+    if X_export.shape[0] < int(knn.n_neighbors):
+        knn.set_params(n_neighbors=int(X_export.shape[0]))
 
     total_kept = int(X_export.shape[0])
+    if total_kept > KD_INDEX_MAX:
+        # Checked before any header is written, so src/ stays consistent
+        raise SystemExit(f"Export table has {total_kept} samples, the KD index holds at most {KD_INDEX_MAX}. "
+                         "Lower MAX_SAMPLES_PER_CLASS or condense the export set.")
     approx_bytes = total_kept * X_export.shape[1] * 4 + total_kept  # floats + labels
-    print(f"\nExport capping per class (max {max_per_class}). kept={total_kept} samples, ~{approx_bytes/1024:.1f} KB for X/y")
+    approx_bytes_q = total_kept * X_export.shape[1] + total_kept    # int8 + labels
+    print(f"\nExport capping per class (max {max_per_class}). kept={total_kept} samples, ~{approx_bytes/1024:.1f} KB for X/y (float), ~{approx_bytes_q/1024:.1f} KB (int8)")
     print("Per-class kept counts:")
     for c, name, cnt in per_class_counts:
         print(f"  {name}: {cnt}")
@@ -282,8 +656,20 @@ def main() -> None:
         y_export,
         os.path.join(SRC_DIR, "glove_knn_model.h"),
     )
+    # INT8 table (default in firmware, see KNN_USE_INT8 in knn_runtime.h)
+    q_export = export_knn_model_int8(
+        knn,
+        X_export,
+        y_export,
+        os.path.join(SRC_DIR, "glove_knn_model_q.h"),
+    )
+    # KD-tree over the int8 table (see KNN_USE_INDEX in knn_runtime.h)
+    export_kd_index(q_export, os.path.join(SRC_DIR, "glove_knn_index.h"))
+    # Same tables as a flash container (src/model_store.h)
+    model_container.build()
 
-    print("\nAll headers exported. Rebuild the firmware in PlatformIO.")
+    print("\nAll headers exported. Rebuild the firmware in PlatformIO, or, with the")
+    print("architecture unchanged: python tools/model_container.py upload")
 
 if __name__ == "__main__":
     main()
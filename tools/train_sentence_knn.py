@@ -24,9 +24,13 @@ import pandas as pd
 from sklearn.model_selection import train_test_split, GridSearchCV
 from sklearn.preprocessing import StandardScaler, LabelEncoder
 from sklearn.neighbors import KNeighborsClassifier
+from sklearn.decomposition import PCA
 from sklearn.metrics import classification_report, confusion_matrix, accuracy_score
 from typing import List, Tuple, Optional, Dict, Union, Sequence
 
+import model_container
+from log_cache import LogCache, save_state, load_state, jobs_from_env, incremental_from_env
+
 # Paths
 SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
 DATA_DIR = os.path.join(SCRIPT_DIR, "..", "data")
@@ -44,6 +48,11 @@ MODEL_HEADER_INT8 = os.path.join(SRC_DIR, "sentence_knn_model_q.h")
 FEATURES_PER_SAMPLE = 12
 SAMPLES_PER_WINDOW = 80  # 4 seconds at 20 Hz
 TOTAL_FEATURES = FEATURES_PER_SAMPLE * SAMPLES_PER_WINDOW
+COARSE_FACTOR = 8        # timesteps per cell of the coarse prefilter table (80 -> 10)
+# SENTENCE_PCA_COMPONENTS=<n> (environment): export the KNN in an n-dim PCA
+# space instead of the 960 raw features (0 / unset = off)
+# SENTENCE_DTW_BAND=<r> (environment): export LB_Keogh envelopes so the
+# firmware matches with DTW banded to +-r timesteps (0 / unset = L1)
 
 
 def parse_sensor_line(line: str) -> Dict[str, float]:
@@ -121,19 +130,24 @@ def load_sentence_file(file_path: str) -> Tuple[Optional[str], List[Dict[str, fl
     return label, samples
 
 
-def create_feature_window(samples: List[Dict[str, float]], target_size: int = SAMPLES_PER_WINDOW) -> Optional[np.ndarray]:
-    """Convert list of samples into a flattened feature vector"""
+def parse_sentence_file(file_path: str) -> Dict[str, np.ndarray]:
+    """load_sentence_file as arrays for the log cache: rows = samples x 12 (feature order)"""
+    label, samples = load_sentence_file(file_path)
+    feature_names = ['f1', 'f2', 'f3', 'f4', 'f5', 'gdp', 'ax', 'ay', 'az', 'gx', 'gy', 'gz']
+    rows = np.array([[s[k] for k in feature_names] for s in samples], dtype=float)
+    return {"rows": rows.reshape(-1, FEATURES_PER_SAMPLE), "label": np.array(label or "")}
+
+
+def create_feature_window(data_matrix: np.ndarray, target_size: int = SAMPLES_PER_WINDOW) -> Optional[np.ndarray]:
+    """Convert a samples x 12 matrix into a flattened feature vector"""
     # Resample to exactly target_size samples
-    if len(samples) == 0:
+    n = len(data_matrix)
+    if n == 0:
         return None
     
-    # Convert to array
-    feature_names = ['f1', 'f2', 'f3', 'f4', 'f5', 'gdp', 'ax', 'ay', 'az', 'gx', 'gy', 'gz']
-    data_matrix = np.array([[s[k] for k in feature_names] for s in samples])
-    
     # Resample to target size using linear interpolation
-    original_indices = np.linspace(0, len(samples) - 1, len(samples))
-    target_indices = np.linspace(0, len(samples) - 1, target_size)
+    original_indices = np.linspace(0, n - 1, n)
+    target_indices = np.linspace(0, n - 1, target_size)
     
     resampled = np.zeros((target_size, FEATURES_PER_SAMPLE))
     for i in range(FEATURES_PER_SAMPLE):
@@ -168,13 +182,16 @@ def load_all_sentence_data() -> Optional[pd.DataFrame]:
     
     print(f"\nFound {len(sentence_files)} sentence data files")
     
-    # Process each file
+    # Process each file; only logs that changed since the last run are
+    # parsed again (log_cache.py)
+    cache = LogCache("sentence_raw_v1")
     file_count = {}
     for file_path in sorted(sentence_files):
         filename = os.path.basename(file_path)
-        label, samples = load_sentence_file(file_path)
+        parsed = cache.load(file_path, parse_sentence_file)
+        label, samples = str(parsed["label"]), parsed["rows"]
         
-        if not label or not samples:
+        if not label or len(samples) == 0:
             print(f"  ⚠ Skipping {filename}: no label or no data")
             continue
         
@@ -192,6 +209,9 @@ def load_all_sentence_data() -> Optional[pd.DataFrame]:
         
         print(f"  ✓ {filename}: {len(samples)} samples → {len(features)} features, label='{label}'")
     
+    cache.prune()
+    print(f"\nLogs: {cache.summary()}")
+
     if not all_features:
         print("\n✗ ERROR: No valid data loaded!")
         return None
@@ -352,13 +372,127 @@ def export_sentence_knn_model(knn: KNeighborsClassifier, X_scaled: np.ndarray,
     print(f"✓ Wrote model to: {out_path}")
 
 
-def export_sentence_knn_model_int8(X_scaled: np.ndarray, y_enc: np.ndarray, out_path: str) -> None:
+def compute_block_order(q_data: np.ndarray, block_len: int) -> np.ndarray:
+    """Order feature blocks (one timestep = block_len features) by decreasing variance.
+
+    Variance is measured on the quantized training table, summed over the
+    channels of each block. Ties keep timestep order (stable sort).
+    """
+    n_features = q_data.shape[1]
+    if n_features % block_len != 0:
+        raise ValueError(f"{n_features} features is not a multiple of block length {block_len}")
+    col_var = np.var(q_data.astype(np.float64), axis=0)
+    block_var = col_var.reshape(-1, block_len).sum(axis=1)
+    return np.argsort(-block_var, kind="stable")
+
+
+def compute_coarse_table(q_data: np.ndarray, block_len: int, factor: int) -> np.ndarray:
+    """Downsampled copy of the quantized table for the cascaded search.
+
+    Each cell is the sum of `factor` consecutive timesteps of one channel.
+    Since |sum(a) - sum(b)| <= sum(|a - b|), L1 over these cells is a lower
+    bound of the full int8 L1 distance.
+    """
+    n_samples, n_features = q_data.shape
+    steps = n_features // block_len
+    if steps % factor != 0:
+        raise ValueError(f"{steps} timesteps is not a multiple of the coarse factor {factor}")
+    cells = q_data.astype(np.int16).reshape(n_samples, steps // factor, factor, block_len).sum(axis=2)
+    return cells.reshape(n_samples, -1).astype(np.int16)
+
+
+def compute_dtw_envelopes(q_data: np.ndarray, block_len: int, band: int) -> Tuple[np.ndarray, np.ndarray]:
+    """LB_Keogh envelopes of the quantized table (src/dtw_kernel.h).
+
+    upper / lower hold the max / min of each channel over timesteps
+    t - band .. t + band, in the table's layout, so
+    sum(max(0, q - upper, lower - q)) is a lower bound of the banded DTW.
+    """
+    n_samples, n_features = q_data.shape
+    steps = q_data.reshape(n_samples, n_features // block_len, block_len)
+    upper, lower = steps.copy(), steps.copy()
+    for d in range(1, band + 1):
+        upper[:, d:] = np.maximum(upper[:, d:], steps[:, :-d])
+        upper[:, :-d] = np.maximum(upper[:, :-d], steps[:, d:])
+        lower[:, d:] = np.minimum(lower[:, d:], steps[:, :-d])
+        lower[:, :-d] = np.minimum(lower[:, :-d], steps[:, d:])
+    return upper.reshape(n_samples, -1), lower.reshape(n_samples, -1)
+
+
+def dtw_distances(q: np.ndarray, table: np.ndarray, block_len: int, band: int) -> np.ndarray:
+    """Banded DTW from one int8 window to every table row, as dtw_distance_i8.
+
+    Cell cost is the L1 over the channels of a timestep pair; the path stays
+    within `band` timesteps of the diagonal.
+    """
+    a = q.astype(np.int64).reshape(-1, block_len)
+    b = table.astype(np.int64).reshape(len(table), -1, block_len)
+    steps = a.shape[0]
+    inf = np.iinfo(np.int64).max // 4
+    prev = np.full((len(table), steps), inf, dtype=np.int64)
+    for i in range(steps):
+        cur = np.full_like(prev, inf)
+        for j in range(max(0, i - band), min(steps, i + band + 1)):
+            if i == 0 and j == 0:
+                best = np.zeros(len(table), dtype=np.int64)
+            else:
+                best = prev[:, j]
+                if j > 0:
+                    best = np.minimum(best, np.minimum(prev[:, j - 1], cur[:, j - 1]))
+            cur[:, j] = best + np.abs(b[:, j] - a[i]).sum(axis=1)
+        prev = cur
+    return prev[:, steps - 1]
+
+
+def holdout_int8(X_tr: np.ndarray, X_te: np.ndarray) -> Tuple[np.ndarray, np.ndarray]:
+    """Quantize a train / test split the way the int8 export does (scales from train)."""
+    max_abs = np.max(np.abs(X_tr), axis=0)
+    max_abs[max_abs == 0] = 1e-6
+    quant = lambda A: np.rint(np.clip(A * (127.0 / max_abs), -128, 127))
+    return quant(X_tr), quant(X_te)
+
+
+def report_dtw_accuracy(X_tr: np.ndarray, X_te: np.ndarray, y_tr: np.ndarray, y_te: np.ndarray,
+                        k: int, band: int) -> None:
+    """Holdout accuracy of the int8 KNN with L1 vs. banded DTW, and how much LB_Keogh prunes."""
+    Q_tr, Q_te = holdout_int8(X_tr, X_te)
+    params = dict(n_neighbors=k, weights="distance")
+    acc_l1 = float(np.mean(KNeighborsClassifier(metric="manhattan", **params)
+                           .fit(Q_tr, y_tr).predict(Q_te) == y_te))
+
+    upper, lower = compute_dtw_envelopes(Q_tr, FEATURES_PER_SAMPLE, band)
+    D_tr = np.stack([dtw_distances(q, Q_tr, FEATURES_PER_SAMPLE, band) for q in Q_tr])
+    D_te = np.stack([dtw_distances(q, Q_tr, FEATURES_PER_SAMPLE, band) for q in Q_te])
+    acc_dtw = float(np.mean(KNeighborsClassifier(metric="precomputed", **params)
+                            .fit(D_tr, y_tr).predict(D_te) == y_te))
+
+    # Rows whose bound already exceeds the K-th best DTW distance never reach DTW
+    pruned = 0
+    for q, d in zip(Q_te, D_te):
+        lb = np.maximum(0, np.maximum(q - upper, lower - q)).sum(axis=1)
+        pruned += int(np.sum(lb > np.sort(d)[k - 1]))
+
+    print(f"\nDTW band +-{band} timesteps: int8 holdout accuracy l1={acc_l1:.4f} "
+          f"dtw={acc_dtw:.4f} delta={acc_dtw - acc_l1:+.4f}")
+    print(f"  LB_Keogh prunes {pruned * 100.0 / D_te.size:.1f}% of rows before DTW "
+          f"(+ {Q_tr.size * 2} bytes of envelopes)")
+
+
+def export_sentence_knn_model_int8(X_scaled: np.ndarray, y_enc: np.ndarray, out_path: str,
+                                   scaler: Optional[StandardScaler] = None, dtw_band: int = 0) -> None:
     """Export quantized (int8) KNN training data + per-feature scales.
 
     We perform symmetric per-feature quantization on the standardized feature space.
     For each feature column j, scale_j = 127 / maxAbs_j, where maxAbs_j = max(|X[:,j]|).
     Quantized value q = clip(round(x * scale_j), -128, 127).
     Distance is computed directly on int8 values (Manhattan), preserving relative ordering.
+
+    If the scaler is given, standardize + quantize is also folded into one
+    affine map per feature, q = x_raw * A_j + B_j, so the firmware can go from
+    raw samples to the int8 query in a single multiply-add pass.
+
+    dtw_band > 0 adds the LB_Keogh envelopes (compute_dtw_envelopes) and
+    switches the firmware to banded DTW matching.
     """
     y_arr = np.asarray(y_enc, dtype=int)
     n_samples, n_features = X_scaled.shape
@@ -394,7 +528,8 @@ def export_sentence_knn_model_int8(X_scaled: np.ndarray, y_enc: np.ndarray, out_
 
     # Write quantized training data
     lines.append("// Quantized training data (int8)")
-    lines.append("static const int8_t SENTENCE_TRAINING_DATA_Q[SENTENCE_KNN_Q_N_SAMPLES * SENTENCE_KNN_Q_N_FEATURES] PROGMEM = {")
+    # aligned(4): the firmware's SWAR L1 kernel reads 4 int8 lanes per word
+    lines.append("static const int8_t SENTENCE_TRAINING_DATA_Q[SENTENCE_KNN_Q_N_SAMPLES * SENTENCE_KNN_Q_N_FEATURES] PROGMEM __attribute__((aligned(4))) = {")
     flat_q = q_data.flatten()
     for i in range(0, len(flat_q), 32):  # 32 per line for compactness
         chunk = flat_q[i:i+32]
@@ -415,6 +550,72 @@ def export_sentence_knn_model_int8(X_scaled: np.ndarray, y_enc: np.ndarray, out_
     lines.append("};")
     lines.append("")
 
+    # Timestep blocks ordered by decreasing quantized variance. The firmware's
+    # early-abandoning KNN sums high-variance blocks first, so the running
+    # distance passes the current K-th best as early as possible. Rows stay in
+    # timestep order; each block is FEATURES_PER_SAMPLE contiguous bytes.
+    block_order = compute_block_order(q_data, FEATURES_PER_SAMPLE)
+    n_blocks = len(block_order)
+    lines.append(f"#define SENTENCE_KNN_Q_BLOCK_LEN {FEATURES_PER_SAMPLE}")
+    lines.append(f"#define SENTENCE_KNN_Q_N_BLOCKS {n_blocks}")
+    lines.append("")
+    lines.append("// Block visiting order for early-abandon distance (highest variance first)")
+    lines.append("static const uint16_t SENTENCE_Q_BLOCK_ORDER[SENTENCE_KNN_Q_N_BLOCKS] PROGMEM = {")
+    for i in range(0, n_blocks, 20):
+        chunk = block_order[i:i+20]
+        vals = ", ".join(str(int(v)) for v in chunk)
+        lines.append(f"  {vals},")
+    lines[-1] = lines[-1].rstrip(',')
+    lines.append("};")
+    lines.append("")
+
+    # Coarse prefilter (lower bound of the int8 L1, see compute_coarse_table)
+    coarse = compute_coarse_table(q_data, FEATURES_PER_SAMPLE, COARSE_FACTOR)
+    lines.append(f"#define SENTENCE_KNN_Q_COARSE_FACTOR {COARSE_FACTOR}")
+    lines.append(f"#define SENTENCE_KNN_Q_COARSE_FEATURES {coarse.shape[1]}")
+    lines.append("")
+    lines.append(f"// Sums of {COARSE_FACTOR} consecutive timesteps per channel, for the cascaded search")
+    lines.append("static const int16_t SENTENCE_Q_COARSE[SENTENCE_KNN_Q_N_SAMPLES * SENTENCE_KNN_Q_COARSE_FEATURES] PROGMEM __attribute__((aligned(4))) = {")
+    flat_c = coarse.flatten()
+    for i in range(0, len(flat_c), 24):
+        vals = ", ".join(str(int(v)) for v in flat_c[i:i+24])
+        lines.append(f"  {vals},")
+    lines[-1] = lines[-1].rstrip(',')
+    lines.append("};")
+    lines.append("")
+
+    if dtw_band > 0:
+        upper, lower = compute_dtw_envelopes(q_data, FEATURES_PER_SAMPLE, dtw_band)
+        lines.append(f"#define SENTENCE_KNN_Q_DTW_BAND {dtw_band}")
+        lines.append("")
+        lines.append(f"// LB_Keogh envelopes: per-channel max / min over +-{dtw_band} timesteps")
+        for name, env in (("SENTENCE_Q_DTW_UPPER", upper), ("SENTENCE_Q_DTW_LOWER", lower)):
+            lines.append(f"static const int8_t {name}[SENTENCE_KNN_Q_N_SAMPLES * SENTENCE_KNN_Q_N_FEATURES] PROGMEM __attribute__((aligned(4))) = {{")
+            flat_e = env.flatten()
+            for i in range(0, len(flat_e), 32):
+                vals = ", ".join(str(int(v)) for v in flat_e[i:i+32])
+                lines.append(f"  {vals},")
+            lines[-1] = lines[-1].rstrip(',')
+            lines.append("};")
+            lines.append("")
+
+    if scaler is not None:
+        # Fused standardize + quantize: ((x - mean) / sd) * s = x * (s / sd) - mean * (s / sd)
+        # 9 significant digits so the float32 coefficients round-trip exactly
+        affine_a = scales / np.asarray(scaler.scale_, dtype=float)
+        affine_b = -np.asarray(scaler.mean_, dtype=float) * affine_a
+        lines.append("#define SENTENCE_KNN_Q_HAS_AFFINE 1")
+        lines.append("")
+        lines.append("// Fused standardize + quantize coefficients: q = x_raw * A + B")
+        for name, arr in (("SENTENCE_Q_AFFINE_A", affine_a), ("SENTENCE_Q_AFFINE_B", affine_b)):
+            lines.append(f"static const float {name}[SENTENCE_KNN_Q_N_FEATURES] PROGMEM = {{")
+            for i in range(0, n_features, 10):
+                vals = ", ".join(f"{v:.9g}f" for v in arr[i:i+10])
+                lines.append(f"  {vals},")
+            lines[-1] = lines[-1].rstrip(',')
+            lines.append("};")
+            lines.append("")
+
     # Helper inline for quantizing a query vector already standardized
     lines.extend([
         "inline void quantizeSentenceFeatures(const float* inFeat, int8_t* outQ) {",
@@ -426,12 +627,127 @@ def export_sentence_knn_model_int8(X_scaled: np.ndarray, y_enc: np.ndarray, out_
         "}",
         "",
     ])
+    if scaler is not None:
+        lines.extend([
+            "// Raw (unstandardized) features [first, first + count) -> int8 in one pass",
+            "inline void quantizeSentenceRawFeatures(const float* inRaw, int8_t* outQ, int first, int count) {",
+            "  for (int i = 0; i < count; ++i) {",
+            "    float q = inRaw[i] * pgm_read_float(&SENTENCE_Q_AFFINE_A[first + i]) + pgm_read_float(&SENTENCE_Q_AFFINE_B[first + i]);",
+            "    if (q > 127.0f) q = 127.0f; else if (q < -128.0f) q = -128.0f;",
+            "    outQ[i] = (int8_t)lrintf(q);",
+            "  }",
+            "}",
+            "",
+        ])
 
     with open(out_path, 'w', encoding='utf-8') as f:
         f.write('\n'.join(lines))
     print(f"✓ Wrote INT8 model to: {out_path}")
 
 
+def fit_pca_projection(X_scaled: np.ndarray, n_components: int) -> Dict[str, np.ndarray]:
+    """PCA of the standardized windows as an int8 projection.
+
+    The component matrix is stored as int8 with one scale per component, and
+    the projected values are quantized like the raw features (127 / max|z|).
+    The firmware accumulates acc_k = sum_i Wq[k, i] * x_std[i] over the window
+    and quantizes q_k = acc_k * gain_k + offset_k, which project_int8 mirrors.
+    """
+    pca = PCA(n_components=n_components, random_state=42).fit(X_scaled)
+    W = pca.components_
+    w_scale = np.max(np.abs(W), axis=1) / 127.0
+    w_scale[w_scale == 0] = 1e-12
+    Wq = np.rint(W / w_scale[:, None]).astype(np.int8)
+
+    Wd = Wq.astype(float) * w_scale[:, None]
+    center = Wd @ pca.mean_
+    Z = X_scaled @ Wd.T - center
+    max_abs = np.max(np.abs(Z), axis=0)
+    max_abs[max_abs == 0] = 1e-6
+    q_scale = 127.0 / max_abs
+    return {
+        "weights": Wq,
+        "gain": w_scale * q_scale,
+        "offset": -center * q_scale,
+        "explained": np.asarray(np.sum(pca.explained_variance_ratio_)),
+    }
+
+
+def project_int8(X_scaled: np.ndarray, proj: Dict[str, np.ndarray]) -> np.ndarray:
+    acc = X_scaled @ proj["weights"].astype(float).T
+    return np.rint(np.clip(acc * proj["gain"] + proj["offset"], -128, 127)).astype(np.int8)
+
+
+def report_pca_accuracy(X_tr: np.ndarray, X_te: np.ndarray, y_tr: np.ndarray, y_te: np.ndarray,
+                        k: int, n_components: int) -> None:
+    """Holdout accuracy of the int8 KNN on the raw 960 features vs. the PCA space."""
+    params = dict(n_neighbors=k, metric="manhattan", weights="distance")
+    Q_tr, Q_te = holdout_int8(X_tr, X_te)
+    acc_full = float(np.mean(KNeighborsClassifier(**params).fit(Q_tr, y_tr).predict(Q_te) == y_te))
+
+    proj = fit_pca_projection(X_tr, n_components)
+    P_tr = project_int8(X_tr, proj).astype(float)
+    P_te = project_int8(X_te, proj).astype(float)
+    acc_pca = float(np.mean(KNeighborsClassifier(**params).fit(P_tr, y_tr).predict(P_te) == y_te))
+
+    n, d = X_tr.shape
+    print(f"\nPCA {n_components} components ({float(proj['explained']) * 100:.1f}% variance): "
+          f"int8 holdout accuracy full={acc_full:.4f} pca={acc_pca:.4f} delta={acc_pca - acc_full:+.4f}")
+    print(f"  table {n * d} -> {n * n_components} bytes, {d} -> {n_components} int8 ops per row "
+          f"(+ {d * n_components} byte projection)")
+
+
+def export_sentence_knn_model_pca(X_scaled: np.ndarray, y_enc: np.ndarray, out_path: str,
+                                  proj: Dict[str, np.ndarray]) -> None:
+    """Export the int8 KNN in PCA space (sentence_knn_model_q.h, SENTENCE_KNN_Q_PCA_COMPONENTS).
+
+    The firmware standardizes with sentence_scaler_params.h, applies the int8
+    projection (element-major: the components of raw feature i are adjacent),
+    then scans SENTENCE_KNN_Q_N_FEATURES = n_components int8 features per row.
+    """
+    y_arr = np.asarray(y_enc, dtype=int)
+    q_data = project_int8(X_scaled, proj)
+    n_samples, n_raw = X_scaled.shape
+    n_components = q_data.shape[1]
+
+    def arr(decl: str, vals, per_line: int, fmt=lambda v: str(int(v))) -> List[str]:
+        out = [decl + " = {"]
+        for i in range(0, len(vals), per_line):
+            out.append("  " + ", ".join(fmt(v) for v in vals[i:i + per_line]) + ",")
+        out[-1] = out[-1].rstrip(',')
+        return out + ["};", ""]
+
+    def f32(v: float) -> str:
+        t = f"{v:.9g}"
+        return (t if "." in t or "e" in t else t + ".0") + "f"   # 0 -> 0.0f
+    lines: List[str] = [
+        "#pragma once",
+        "#include <Arduino.h>",
+        "",
+        f"#define SENTENCE_KNN_Q_N_NEIGHBORS 3",
+        f"#define SENTENCE_KNN_Q_N_SAMPLES {n_samples}",
+        f"#define SENTENCE_KNN_Q_N_FEATURES {n_components}",
+        f"#define SENTENCE_KNN_Q_PCA_COMPONENTS {n_components}",
+        f"#define SENTENCE_KNN_Q_RAW_FEATURES {n_raw}",
+        "",
+        f"// PCA projection ({float(proj['explained']) * 100:.1f}% of the variance): "
+        "acc_k = sum_i W[i][k] * x_std[i], q_k = acc_k * GAIN_k + OFFSET_k",
+    ]
+    lines += arr("static const int8_t SENTENCE_Q_PCA_W[SENTENCE_KNN_Q_RAW_FEATURES * SENTENCE_KNN_Q_PCA_COMPONENTS] PROGMEM",
+                 proj["weights"].T.flatten(), 32)
+    lines += arr("static const float SENTENCE_Q_PCA_GAIN[SENTENCE_KNN_Q_PCA_COMPONENTS] PROGMEM", proj["gain"], 8, f32)
+    lines += arr("static const float SENTENCE_Q_PCA_OFFSET[SENTENCE_KNN_Q_PCA_COMPONENTS] PROGMEM", proj["offset"], 8, f32)
+    lines.append("// Quantized training data (int8, PCA space)")
+    lines += arr("static const int8_t SENTENCE_TRAINING_DATA_Q[SENTENCE_KNN_Q_N_SAMPLES * SENTENCE_KNN_Q_N_FEATURES] "
+                 "PROGMEM __attribute__((aligned(4)))", q_data.flatten(), 32)
+    lines.append("// Training labels")
+    lines += arr("static const uint8_t SENTENCE_TRAINING_LABELS_Q[SENTENCE_KNN_Q_N_SAMPLES] PROGMEM", y_arr, 32)
+
+    with open(out_path, 'w', encoding='utf-8') as f:
+        f.write('\n'.join(lines))
+    print(f"✓ Wrote INT8 PCA model ({n_components} components) to: {out_path}")
+
+
 def main() -> None:
     print("\n" + "="*60)
     print("  EchoSign - Sentence KNN Trainer")
@@ -481,13 +797,29 @@ def main() -> None:
         'metric': ['manhattan']
     }
     
-    knn: KNeighborsClassifier = KNeighborsClassifier()
-    grid_search: GridSearchCV = GridSearchCV(knn, param_grid, cv=min(3, len(X_train)), 
-                               scoring='accuracy', n_jobs=-1)
-    grid_search.fit(X_train_scaled, y_train)
-    
-    best_knn: KNeighborsClassifier = grid_search.best_estimator_
-    print(f"\nBest parameters: {grid_search.best_params_}")
+    # TRAIN_INCREMENTAL=1: new recordings only change the table, keep the
+    # parameters the last full search selected (if the grid still has them)
+    class_names = [str(c) for c in le.classes_]
+    best_params = None
+    if incremental_from_env():
+        state = load_state("train_sentence_knn")
+        if (state and state.get("classes") == class_names and
+                all(state.get("best", {}).get(k) in v for k, v in param_grid.items())):
+            best_params = state["best"]
+            print(f"\nIncremental: reusing the last search's parameters {best_params}")
+        else:
+            print("\nIncremental: no matching previous search, running the full search")
+
+    if best_params is None:
+        knn: KNeighborsClassifier = KNeighborsClassifier()
+        grid_search: GridSearchCV = GridSearchCV(knn, param_grid, cv=min(3, len(X_train)),
+                                   scoring='accuracy', n_jobs=jobs_from_env())
+        grid_search.fit(X_train_scaled, y_train)
+        best_params = dict(grid_search.best_params_)
+        save_state("train_sentence_knn", {"best": best_params, "classes": class_names})
+
+    best_knn: KNeighborsClassifier = KNeighborsClassifier(**best_params).fit(X_train_scaled, y_train)
+    print(f"\nBest parameters: {best_params}")
     
     # Evaluate
     y_pred = best_knn.predict(X_test_scaled)
@@ -501,6 +833,18 @@ def main() -> None:
     print(classification_report(y_test, y_pred, target_names=le.classes_))
     print(f"\nConfusion Matrix:")
     print(confusion_matrix(y_test, y_pred))
+
+    pca_components = int(os.getenv("SENTENCE_PCA_COMPONENTS", "0"))
+    dtw_band = int(os.getenv("SENTENCE_DTW_BAND", "0"))
+    if pca_components > 0 and dtw_band > 0:
+        raise SystemExit("SENTENCE_PCA_COMPONENTS and SENTENCE_DTW_BAND cannot be combined "
+                         "(DTW needs the per-timestep features)")
+    if pca_components > 0:
+        report_pca_accuracy(X_train_scaled, X_test_scaled, y_train, y_test,
+                            int(best_knn.n_neighbors), pca_components)
+    if dtw_band > 0:
+        report_dtw_accuracy(X_train_scaled, X_test_scaled, y_train, y_test,
+                            int(best_knn.n_neighbors), dtw_band)
     
     # Export to C++
     print(f"\n{'='*60}")
@@ -514,8 +858,14 @@ def main() -> None:
     export_sentence_labels(le, LABELS_HEADER)
     # Float model (for fallback/reference)
     export_sentence_knn_model(best_knn, X_all_scaled, y_enc, MODEL_HEADER)
-    # INT8 quantized model (primary for deployment)
-    export_sentence_knn_model_int8(X_all_scaled, y_enc, MODEL_HEADER_INT8)
+    # INT8 quantized model (primary for deployment), optionally in PCA space
+    if pca_components > 0:
+        export_sentence_knn_model_pca(X_all_scaled, y_enc, MODEL_HEADER_INT8,
+                                      fit_pca_projection(X_all_scaled, pca_components))
+    else:
+        export_sentence_knn_model_int8(X_all_scaled, y_enc, MODEL_HEADER_INT8, scaler, dtw_band)
+    # Same tables as a flash container (src/model_store.h)
+    model_container.build()
     
     print(f"\n{'='*60}")
     print("✓ TRAINING COMPLETE!")
@@ -526,6 +876,7 @@ def main() -> None:
     print(f"  - {LABELS_HEADER}")
     print(f"  - {MODEL_HEADER}")
     print(f"  - {MODEL_HEADER_INT8}")
+    print(f"  - {model_container.OUT_PATH}")
     print(f"\nNext steps:")
     print(f"  1. Update firmware to include sentence prediction mode")
     print(f"  2. Add button to trigger sentence recording")
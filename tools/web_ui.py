@@ -1,120 +1,326 @@
 import os
+import sys
 import threading
 import time
 import json
-from flask import Flask as FlaskApp, jsonify, Response, send_from_directory, request
+from collections import deque, namedtuple
+from flask import Flask as FlaskApp, jsonify, Response, send_from_directory, request, abort
 from flask_cors import CORS
+from flask_sock import Sock
 import serial
 
+from wire_protocol import StreamDecoder
+
 # -------- CONFIG --------
-SERIAL_PORT = "COM15"
+# One glove per port: `python tools/web_ui.py COM15 COM16` or
+# GLOVE_PORTS=COM15,COM16; device ids are the positions in this list
+DEFAULT_PORTS = ["COM15"]
 BAUDRATE = 115200
 
+# Recent frames kept per device for /api/frames polling (~10 s of gesture
+# frames at 20 Hz); older frames are overwritten
+DEVICE_RING_FRAMES = 256
+
+# WebSocket push: frames waiting per client before old sensor frames are
+# dropped (sentence results are never dropped)
+WS_QUEUE_MAX = 16
+WS_IDLE_TIMEOUT = 1.0   # seconds between liveness checks when no frames arrive
+
 # Path to data folder with HTML/CSS/JS
 DATA_DIR = os.path.join(os.path.dirname(__file__), "..", "data")
 
-# Shared state
-class State:
-    def __init__(self):
-        self.latest_data = {}
-        self.latest_pred_line = "---"
-        self.sentence_data = None  # Store sentence results separately
-        self.sentence_timestamp = 0.0  # Track when sentence was predicted (float for time.time())
+
+# -------- PER-DEVICE STATE --------
+# What HTTP handlers read about one glove. The reader thread never changes
+# a published Snapshot (or the dicts in it); it builds a new one and swaps
+# the reference, so handlers read a consistent view without a lock.
+Snapshot = namedtuple("Snapshot", "latest_data latest_pred_line sentence_data sentence_timestamp")
+EMPTY_SNAPSHOT = Snapshot({}, "---", None, 0.0)
+
+
+class FrameRing:
+    """Last `size` serialized frames of one device; the reader is the only writer.
+
+    Frames are numbered from 0. Readers copy out by number without a lock:
+    a slot holds (seq, text) and is only used when seq is the one wanted,
+    so a slot the writer lapped meanwhile counts as missed.
+    """
+
+    def __init__(self, size):
+        self.size = size
+        self.slots = [None] * size
+        self.head = 0                  # number of the next frame
+
+    def push(self, text):
+        seq = self.head
+        self.slots[seq % self.size] = (seq, text)
+        self.head = seq + 1
+
+    def since(self, seq):
+        """(texts, next seq, missed) for the frames from number `seq` on."""
+        head = self.head
+        if seq > head:
+            seq = head                 # cursor from before a bridge restart
+        start = max(seq, head - self.size)
+        missed = start - seq
+        texts = []
+        for s in range(start, head):
+            slot = self.slots[s % self.size]
+            if slot is None or slot[0] != s:
+                missed += 1
+                continue
+            texts.append(slot[1])
+        return texts, head, missed
+
+
+class Device:
+    """One glove: its serial port, reader thread, frame ring and counters.
+
+    The counters are only written by the reader thread; /api/devices reads
+    them as they are (a value may be one frame stale).
+    """
+
+    def __init__(self, index, port):
+        self.index = index
+        self.port = port
         self.ser = None
-        self.lock = threading.Lock()
+        self.write_lock = threading.Lock()   # commands from HTTP handlers only
+        self.snapshot = EMPTY_SNAPSHOT
+        self.ring = FrameRing(DEVICE_RING_FRAMES)
+        self.clients = ()                    # WsClient tuple, replaced under clients_lock
+        self.clients_lock = threading.Lock()
+        self.decoder = StreamDecoder()
+
+        self.frames = 0
+        self.bytes = 0
+        self.link_errors = 0                 # serial errors / failed opens
+        self.ws_dropped_closed = 0           # drops of viewers that disconnected
+        self.fps = 0.0
+        self.last_frame_time = 0.0
+        self._rate_time = time.time()
+        self._rate_frames = 0
+
+    # ---- viewers (copy-on-write, the reader iterates the tuple it sees) ----
+    def add_client(self, client):
+        with self.clients_lock:
+            self.clients = self.clients + (client,)
+            return len(self.clients)
+
+    def remove_client(self, client):
+        with self.clients_lock:
+            self.clients = tuple(c for c in self.clients if c is not client)
+            self.ws_dropped_closed += client.dropped
+
+    def publish(self, **fields):
+        self.snapshot = self.snapshot._replace(**fields)
+
+    def count_frame(self, now):
+        self.frames += 1
+        self.last_frame_time = now
+        if now - self._rate_time >= 1.0:
+            self.fps = (self.frames - self._rate_frames) / (now - self._rate_time)
+            self._rate_time = now
+            self._rate_frames = self.frames
+
+    def stats(self):
+        now = time.time()
+        clients = self.clients
+        return {
+            "device": self.index,
+            "port": self.port,
+            "connected": bool(self.ser is not None and self.ser.is_open),
+            "frames": self.frames,
+            "fps": round(self.fps if now - self.last_frame_time < 2.0 else 0.0, 1),
+            "bytes": self.bytes,
+            # decoder counters restart when the port is reopened
+            "lostFrames": self.decoder.lost_frames,   # sequence gaps (binary format)
+            "crcErrors": self.decoder.crc_errors,
+            "linkErrors": self.link_errors,
+            "viewers": len(clients),
+            "wsDropped": self.ws_dropped_closed + sum(c.dropped for c in clients),
+            "ringHead": self.ring.head,
+        }
+
+    def write(self, data):
+        ser = self.ser
+        if ser is None or not ser.is_open:
+            return None
+        with self.write_lock:
+            n = ser.write(data)
+            ser.flush()
+        return n
+
+
+def serial_ports():
+    if len(sys.argv) > 1:
+        return sys.argv[1:]
+    env = os.getenv("GLOVE_PORTS", "")
+    ports = [p.strip() for p in env.split(",") if p.strip()]
+    return ports or DEFAULT_PORTS
+
+
+DEVICES = [Device(i, port) for i, port in enumerate(serial_ports())]
+
+
+# -------- WEBSOCKET FAN-OUT --------
+class WsClient:
+    """Bounded outgoing queue for one WebSocket viewer.
+
+    The serial thread pushes pre-serialized frames; the client's handler
+    thread drains everything pending and sends it as one message (a JSON
+    array when more than one frame is queued). A client that falls behind
+    loses its oldest sensor frames, never a sentence result.
+    """
+
+    def __init__(self):
+        self.cond = threading.Condition()
+        self.frames = deque()          # (keep, json_text)
+        self.dropped = 0
+
+    def push(self, text, keep):
+        with self.cond:
+            if len(self.frames) >= WS_QUEUE_MAX:
+                self._drop_one()
+            self.frames.append((keep, text))
+            self.cond.notify()
+
+    def _drop_one(self):
+        for i, (keep, _) in enumerate(self.frames):
+            if not keep:
+                del self.frames[i]
+                self.dropped += 1
+                return
+        self.frames.popleft()  # queue is all results: drop the oldest anyway
+        self.dropped += 1
+
+    def take(self, timeout):
+        with self.cond:
+            if not self.frames:
+                self.cond.wait(timeout)
+            if not self.frames:
+                return None
+            texts = [text for _, text in self.frames]
+            self.frames.clear()
+        return texts[0] if len(texts) == 1 else "[" + ",".join(texts) + "]"
 
-STATE = State()
 
+def publish_frame(dev, data):
+    """Serialize one prediction frame once: into the ring and every viewer of dev."""
+    text = json.dumps(data, separators=(",", ":"))
+    dev.ring.push(text)
+    keep = data.get("mode") == "sentence" and "sentence" in data
+    for client in dev.clients:
+        client.push(text, keep)
 
-# -------- SERIAL READER THREAD --------
-def serial_reader():
-    global STATE
+
+# -------- SERIAL READER THREADS --------
+def handle_data(dev, data):
+    """Apply one decoded frame (JSON line or binary frame) to dev."""
+    # Check for debug/event messages
+    if "debug" in data:
+        print(f"[{dev.port}] [DEBUG] {data['debug']}")
+    if "event" in data:
+        print(f"[{dev.port}] [EVENT] {data['event']}")
+    if "mode" not in data:
+        return  # debug / event messages stay on the console
+
+    dev.count_frame(time.time())
+    publish_frame(dev, data)
+
+    # Continuous sentence mode sends a frame per hop without
+    # a "sentence" field; treat it as a live sensor update
+    if data.get("mode") == "sentence" and data.get("continuous") and "sentence" not in data:
+        dev.publish(latest_data=data)
+    # Check if this is sentence mode data
+    elif data.get("mode") == "sentence":
+        # Store sentence data separately
+        dev.publish(sentence_data=data, sentence_timestamp=time.time())
+        # Log sentence predictions (progress frames only go to the viewers)
+        if data.get("sentence"):
+            print(f"[{dev.port}] [Sentence] Predicted: {data.get('sentence')} (confidence: {data.get('confidence', 0)*100:.0f}%)")
+    elif data.get("mode") == "gesture":
+        # Regular gesture data; legacy pred line for compatibility
+        if "label" in data:
+            meanD = data.get("meanD", 0)
+            dev.publish(latest_data=data, latest_pred_line=f"PRED: {data['label']} (meanD={meanD:.2f})")
+        else:
+            dev.publish(latest_data=data)
+
+
+def handle_line(dev, line):
+    # Parse PRED: lines (legacy format)
+    if line.startswith("PRED:"):
+        latest = dev.snapshot.latest_data
+        # Try to extract gesture name
+        try:
+            parts = line.split(":")
+            if len(parts) > 1:
+                latest = dict(latest, label=parts[1].split("(")[0].strip())
+        except:
+            pass
+        dev.publish(latest_pred_line=line, latest_data=latest)
+
+    # Parse JSON lines (compact format from main.cpp)
+    elif line.startswith("{") and line.endswith("}"):
+        try:
+            handle_data(dev, json.loads(line))
+        except json.JSONDecodeError:
+            pass
+
+
+def serial_reader(dev):
+    # Handles both JSON lines and binary frames (WIRE_FORMAT in firmware)
     while True:
         try:
-            if STATE.ser is None or not STATE.ser.is_open:
-                print(f"[Serial] Opening {SERIAL_PORT} @ {BAUDRATE}")
-                STATE.ser = serial.Serial(SERIAL_PORT, BAUDRATE, timeout=1.0)
+            if dev.ser is None or not dev.ser.is_open:
+                print(f"[Serial] Opening {dev.port} @ {BAUDRATE} (device {dev.index})")
+                ser = serial.Serial(dev.port, BAUDRATE, timeout=1.0)
                 time.sleep(2)
-                if STATE.ser is not None:
-                    try:
-                        STATE.ser.reset_input_buffer()
-                    except Exception:
-                        pass
-
-            if STATE.ser is None:
-                # No serial port available yet; wait a bit and retry
-                time.sleep(0.1)
-                continue
+                try:
+                    ser.reset_input_buffer()
+                except Exception:
+                    pass
+                dev.decoder = StreamDecoder()
+                dev.ser = ser
 
-            raw = STATE.ser.readline()
+            raw = dev.ser.read(dev.ser.in_waiting or 1)
             if not raw:
                 # nothing read this iteration (timeout)
                 continue
+            dev.bytes += len(raw)
 
-            try:
-                line = raw.decode("utf-8", errors="ignore").strip()
-            except Exception:
-                # Fallback: ensure we have a string even if decode fails
-                line = str(raw).strip()
-
-            # Parse PRED: lines (legacy format)
-            if line.startswith("PRED:"):
-                with STATE.lock:
-                    STATE.latest_pred_line = line
-                    # Try to extract gesture name
-                    try:
-                        parts = line.split(":")
-                        if len(parts) > 1:
-                            gesture = parts[1].split("(")[0].strip()
-                            STATE.latest_data["label"] = gesture
-                    except:
-                        pass
-            
-            # Parse JSON lines (compact format from main.cpp)
-            elif line.startswith("{") and line.endswith("}"):
-                try:
-                    data = json.loads(line)
-                    with STATE.lock:
-                        # Check for debug/event messages
-                        if "debug" in data:
-                            print(f"[DEBUG] {data['debug']}")
-                        if "event" in data:
-                            print(f"[EVENT] {data['event']}")
-                        
-                        # Check if this is sentence mode data
-                        if data.get("mode") == "sentence":
-                            # Store sentence data separately
-                            STATE.sentence_data = data
-                            STATE.sentence_timestamp = time.time()
-                            # Log sentence predictions
-                            if data.get("recording"):
-                                print(f"[Sentence] Recording: {data.get('progress', 0)*100:.0f}%")
-                            elif data.get("sentence"):
-                                print(f"[Sentence] Predicted: {data.get('sentence')} (confidence: {data.get('confidence', 0)*100:.0f}%)")
-                        elif data.get("mode") == "gesture":
-                            # Regular gesture data
-                            STATE.latest_data = data
-                            # Update legacy pred line for compatibility
-                            if "label" in data:
-                                meanD = data.get("meanD", 0)
-                                STATE.latest_pred_line = f"PRED: {data['label']} (meanD={meanD:.2f})"
-                except json.JSONDecodeError:
-                    pass
+            for kind, item in dev.decoder.feed(raw):
+                if kind == "frame":
+                    handle_data(dev, item)
+                else:
+                    handle_line(dev, item)
 
         except Exception as e:
-            print("[Serial] Error:", e)
-            if STATE.ser:
+            print(f"[Serial] {dev.port} error:", e)
+            if dev.ser:
                 try:
-                    STATE.ser.close()
+                    dev.ser.close()
                 except:
                     pass
-            STATE.ser = None
+            dev.ser = None
+            dev.link_errors += 1
             time.sleep(2)
 
 
 # -------- FLASK WEB SERVER --------
 app = FlaskApp(__name__)
 CORS(app)
+sock = Sock(app)
+
+
+def request_device():
+    """Device of ?device=<id or port> (default: the first one)."""
+    key = request.args.get("device", "0")
+    for dev in DEVICES:
+        if key == str(dev.index) or key == dev.port:
+            return dev
+    abort(404, description=f"no device {key}")
+
 
 @app.route("/")
 def index():
@@ -139,26 +345,65 @@ def hand_model():
 @app.route("/data")
 def api_data():
     """REST endpoint for real-time data (fallback for WebSocket)"""
-    with STATE.lock:
-        # Check if we have recent sentence data (within 5 seconds)
-        if STATE.sentence_data and (time.time() - STATE.sentence_timestamp) < 5.0:
-            data = STATE.sentence_data.copy()
-        else:
-            data = STATE.latest_data.copy()
-    
+    snap = request_device().snapshot
+    # Check if we have recent sentence data (within 5 seconds)
+    if snap.sentence_data and (time.time() - snap.sentence_timestamp) < 5.0:
+        data = snap.sentence_data
+    else:
+        data = snap.latest_data
+
     # Ensure we have at least a label field
     if not data:
         data = {"label": "unknown", "gdp": 0}
-    
+
     return jsonify(data)
 
+@app.route("/api/frames")
+def api_frames():
+    """Every frame after ?since=<next> from the device ring (polling without gaps)"""
+    dev = request_device()
+    try:
+        since = int(request.args.get("since", "0"))
+    except ValueError:
+        since = 0
+    texts, head, missed = dev.ring.since(max(0, since))
+    body = '{"device":%d,"next":%d,"missed":%d,"frames":[%s]}' % (dev.index, head, missed, ",".join(texts))
+    return Response(body, mimetype="application/json")
+
+@app.route("/api/devices")
+def api_devices():
+    """Per-device link state, frame rate and drop counters"""
+    return jsonify([dev.stats() for dev in DEVICES])
+
+@sock.route("/ws")
+def ws_stream(ws):
+    """Push every frame to the browser as soon as the serial thread decodes it"""
+    dev = request_device()
+    client = WsClient()
+    snapshot = dev.snapshot.latest_data
+    if snapshot:
+        ws.send(json.dumps(snapshot, separators=(",", ":")))
+
+    total = dev.add_client(client)
+    print(f"[WS] Client connected to {dev.port} ({total} total)")
+    try:
+        while ws.connected:
+            message = client.take(WS_IDLE_TIMEOUT)
+            if message is not None:
+                ws.send(message)
+    except Exception as e:
+        print("[WS] Client error:", e)
+    finally:
+        dev.remove_client(client)
+        print(f"[WS] Client disconnected from {dev.port} (dropped {client.dropped} frames)")
+
 @app.route("/api/pred")
 def api_pred():
     """Legacy API endpoint for compatibility"""
-    with STATE.lock:
-        line = STATE.latest_pred_line
-        data = STATE.latest_data.copy()
-    
+    snap = request_device().snapshot
+    line = snap.latest_pred_line
+    data = snap.latest_data
+
     # Parse gesture name
     gesture = data.get("label", "---")
     if gesture == "---" and line.startswith("PRED:"):
@@ -166,36 +411,34 @@ def api_pred():
             gesture = line.split(":")[1].split("(")[0].strip()
         except:
             pass
-    
+
     return jsonify(pred=line, label=gesture)
 
 @app.route("/api/sentence", methods=["POST"])
 def trigger_sentence():
     """Trigger sentence prediction on ESP32"""
-    print("[API] Sentence prediction triggered from web UI")
+    dev = request_device()
+    print(f"[API] Sentence prediction triggered from web UI ({dev.port})")
     try:
-        if STATE.ser and STATE.ser.is_open:
-            print("[API] Sending START_SENTENCE command to ESP32")
-            # Send command with explicit encoding
-            cmd = b"START_SENTENCE\n"
-            bytes_written = STATE.ser.write(cmd)
-            STATE.ser.flush()
-            print(f"[API] Wrote {bytes_written} bytes, command sent successfully")
-            print(f"[API] Command bytes: {cmd}")
-            return jsonify({"status": "ok", "message": "Sentence prediction started"})
-        else:
+        bytes_written = dev.write(b"START_SENTENCE\n")
+        if bytes_written is None:
             print("[API] ERROR: Serial not connected")
             return jsonify({"status": "error", "message": "Serial not connected"}), 503
+        print(f"[API] Wrote {bytes_written} bytes, command sent successfully")
+        return jsonify({"status": "ok", "message": "Sentence prediction started"})
     except Exception as e:
         print(f"[API] ERROR: {str(e)}")
         return jsonify({"status": "error", "message": str(e)}), 500
 
 
 def main():
-    t = threading.Thread(target=serial_reader, daemon=True)
-    t.start()
-    print("Web UI running at http://127.0.0.1:5000/")
-    app.run(host="127.0.0.1", port=5000, debug=False)
+    for dev in DEVICES:
+        t = threading.Thread(target=serial_reader, args=(dev,), daemon=True, name=f"serial-{dev.port}")
+        t.start()
+    print("Web UI running at http://127.0.0.1:5000/ (gloves: " +
+          ", ".join(f"{dev.index}={dev.port}" for dev in DEVICES) + ", pick one with ?device=<id>)")
+    # threaded: handlers never wait on each other, and never on a reader
+    app.run(host="127.0.0.1", port=5000, debug=False, threaded=True)
 
 
 if __name__ == "__main__":
@@ -0,0 +1,167 @@
+"""Decoder for the binary serial frames in src/wire_protocol.h.
+
+The firmware stream is a mix of text lines (debug / event JSON, startup
+banner) and binary frames. StreamDecoder.feed() takes raw bytes and yields
+("line", str) for text lines and ("frame", dict) for binary frames. Frame
+dicts have the same keys as the JSON lines, so callers can handle both the
+same way.
+"""
+import math
+import os
+import re
+import struct
+from typing import Dict, Iterator, List, Optional, Tuple, Union
+
+SYNC = b"\xA5\x5A"
+HEADER = struct.Struct("<BBBI")   # type, seq, payload len, tMs (after sync)
+SENSORS = struct.Struct("<5H6h")  # flex * 1000, ax..az, gx..gz raw
+HEADER_SIZE = 2 + HEADER.size
+CRC_SIZE = 2
+MAX_PAYLOAD = 48
+
+TYPE_GESTURE = 1
+TYPE_SENTENCE_HOP = 2
+TYPE_SENTENCE_RESULT = 3
+TYPE_SENTENCE_PROGRESS = 4
+
+SRC_DIR = os.path.join(os.path.dirname(__file__), "..", "src")
+
+
+def _crc16_table() -> List[int]:
+    table = []
+    for b in range(256):
+        crc = b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) & 0xFFFF if crc & 0x8000 else (crc << 1) & 0xFFFF
+        table.append(crc)
+    return table
+
+
+_CRC16_TABLE = _crc16_table()
+
+
+def crc16_ccitt(data: bytes) -> int:
+    # Byte-wise table lookup: the bridge checks every frame of every glove
+    crc = 0xFFFF
+    for b in data:
+        crc = ((crc << 8) & 0xFFFF) ^ _CRC16_TABLE[(crc >> 8) ^ b]
+    return crc
+
+
+def load_label_names(header_path: str) -> List[str]:
+    """Read the string table from an exported label header."""
+    try:
+        with open(header_path, "r", encoding="utf-8") as f:
+            text = f.read()
+    except OSError:
+        return []
+    body = text[text.find("{") + 1:text.rfind("}")]
+    return re.findall(r'"([^"]*)"', body)
+
+
+def _sensor_fields(payload: bytes) -> Dict[str, float]:
+    f1, f2, f3, f4, f5, ax, ay, az, gx, gy, gz = SENSORS.unpack_from(payload, 0)
+    # Same units / rounding as printSensorJson() in main.cpp
+    return {
+        "gdp": round(math.sqrt(gx * gx + gy * gy + gz * gz), 1),
+        "f1": round(f1 / 1000.0, 2), "f2": round(f2 / 1000.0, 2), "f3": round(f3 / 1000.0, 2),
+        "f4": round(f4 / 1000.0, 2), "f5": round(f5 / 1000.0, 2),
+        "ax": round(ax / 16384.0, 2), "ay": round(ay / 16384.0, 2), "az": round(az / 16384.0, 2),
+        "gx": round(gx / 131.0, 1), "gy": round(gy / 131.0, 1), "gz": round(gz / 131.0, 1),
+    }
+
+
+class StreamDecoder:
+    def __init__(self,
+                 gesture_labels: Optional[List[str]] = None,
+                 sentence_labels: Optional[List[str]] = None):
+        if gesture_labels is None:
+            gesture_labels = load_label_names(os.path.join(SRC_DIR, "label_names.h"))
+        if sentence_labels is None:
+            sentence_labels = load_label_names(os.path.join(SRC_DIR, "sentence_label_names.h"))
+        self.gesture_labels = gesture_labels
+        self.sentence_labels = sentence_labels
+        self.buf = bytearray()
+        self.last_seq: Optional[int] = None
+        self.crc_errors = 0
+        self.lost_frames = 0
+
+    def feed(self, data: bytes) -> Iterator[Tuple[str, Union[str, Dict]]]:
+        self.buf.extend(data)
+        while self.buf:
+            sync = self.buf.find(SYNC)
+            nl = self.buf.find(b"\n")
+
+            # Text line ahead of the next frame (or no frame at all)
+            if nl >= 0 and (sync < 0 or nl < sync):
+                line = bytes(self.buf[:nl]).decode("utf-8", errors="ignore").strip()
+                del self.buf[:nl + 1]
+                if line:
+                    yield ("line", line)
+                continue
+
+            if sync < 0:
+                # Keep a trailing 0xA5, it may be the first sync byte
+                if len(self.buf) > 4096:
+                    del self.buf[:-1]
+                return
+
+            if sync > 0:
+                # Partial text before the frame (no newline): drop it
+                del self.buf[:sync]
+
+            if len(self.buf) < HEADER_SIZE:
+                return
+            ftype, seq, plen, t_ms = HEADER.unpack_from(self.buf, 2)
+            if plen > MAX_PAYLOAD:
+                del self.buf[:2]  # false sync
+                continue
+            total = HEADER_SIZE + plen + CRC_SIZE
+            if len(self.buf) < total:
+                return
+
+            frame = bytes(self.buf[:total])
+            (crc,) = struct.unpack_from("<H", frame, total - CRC_SIZE)
+            if crc16_ccitt(frame[2:total - CRC_SIZE]) != crc:
+                self.crc_errors += 1
+                del self.buf[:2]  # resync after the bad sync
+                continue
+            del self.buf[:total]
+
+            if self.last_seq is not None:
+                self.lost_frames += (seq - self.last_seq - 1) & 0xFF
+            self.last_seq = seq
+
+            decoded = self._decode(ftype, t_ms, frame[HEADER_SIZE:total - CRC_SIZE])
+            if decoded is not None:
+                yield ("frame", decoded)
+
+    def _label(self, names: List[str], idx: int) -> str:
+        return names[idx] if 0 <= idx < len(names) else "unknown"
+
+    def _decode(self, ftype: int, t_ms: int, payload: bytes) -> Optional[Dict]:
+        if len(payload) < SENSORS.size:
+            return None
+        data: Dict = {"t": t_ms}
+        rest = payload[SENSORS.size:]
+
+        if ftype == TYPE_GESTURE and len(rest) >= 5:
+            label, mean_d = struct.unpack_from("<Bf", rest, 0)
+            data.update({"mode": "gesture", "label": self._label(self.gesture_labels, label),
+                         "meanD": round(mean_d, 2)})
+        elif ftype == TYPE_SENTENCE_HOP and len(rest) >= 5:
+            hop, mean_d = struct.unpack_from("<Bf", rest, 0)
+            data.update({"mode": "sentence", "continuous": True, "hop": hop,
+                         "meanD": round(mean_d, 2)})
+        elif ftype == TYPE_SENTENCE_RESULT and len(rest) >= 7:
+            label, mean_d, conf = struct.unpack_from("<BfH", rest, 0)
+            data.update({"mode": "sentence", "recording": False,
+                         "sentence": self._label(self.sentence_labels, label),
+                         "confidence": conf / 1000.0, "meanD": round(mean_d, 2)})
+        elif ftype == TYPE_SENTENCE_PROGRESS and len(rest) >= 1:
+            data.update({"mode": "sentence", "recording": True, "progress": rest[0] / 100.0})
+        else:
+            return None
+
+        data.update(_sensor_fields(payload))
+        return data